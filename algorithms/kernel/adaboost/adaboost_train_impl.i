@@ -66,6 +66,8 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "boosting_train_utils.i"
+#include "stump_train_sorted_indices.i"
 
 #include "weak_learner_model.h"
 #include "adaboost_model.h"
@@ -84,6 +86,16 @@ namespace internal
 {
 using namespace daal::internal;
 
+/**
+ *  \brief Partial weighted classification error of the weak learner computed on a block of observations
+ */
+template <typename algorithmFPType>
+struct AdaBoostErrorPartial
+{
+    size_t nErr;            /* Number of misclassified observations */
+    algorithmFPType errM;   /* Sum of weights of misclassified observations */
+};
+
 /**
  *  \brief AdaBoost algorithm kernel
  *
@@ -112,6 +124,7 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
 {
     algorithmFPType *w = static_cast<HomogenNT*>(weakLearnerInputTables[2].get())->getArray();
     algorithmFPType *h = hTable->getArray();
+    typedef AdaBoostErrorPartial<algorithmFPType> ErrorPartial;
 
     /* Floating point constants */
     const algorithmFPType zero = (algorithmFPType)0.0;
@@ -130,10 +143,13 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
     DAAL_CHECK(aErrFlag.get(), services::ErrorMemoryAllocationFailed);
 
     /* Initialize weights */
-    for (size_t i = 0; i < nVectors; i++)
+    boosting::training::internal::parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
     {
-        w[i] = invNVectors;
-    }
+        for (size_t i = startRow; i < startRow + nRows; i++)
+        {
+            w[i] = invNVectors;
+        }
+    });
 
     services::SharedPtr<weak_learner::training::Batch> learnerTrain = parameter->weakLearnerTraining->clone();
     classifier::training::Input *trainInput = learnerTrain->getInput();
@@ -142,6 +158,10 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
     trainInput->set(classifier::training::labels,  weakLearnerInputTables[1]);
     trainInput->set(classifier::training::weights, weakLearnerInputTables[2]);
 
+    /* Every weak learner is trained on the same data set, so the features are sorted once per training */
+    services::Status s = stump::training::internal::setSortedIndices<cpu>(trainInput, *weakLearnerInputTables[0]);
+    DAAL_CHECK_STATUS_VAR(s);
+
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     classifier::prediction::Input *predictInput = learnerPredict->getInput();
     DAAL_CHECK(predictInput, services::ErrorNullInput);
@@ -157,7 +177,6 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
     /* Clear the collection of weak learners models in the boosting model */
     boostModel->clearWeakLearnerModels();
 
-    services::Status s;
     for (size_t m = 0; m < maxIter; m++)
     {
         nWeakLearners++;
@@ -184,16 +203,22 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
         size_t nErr = 0;
         algorithmFPType errM = zero;
         algorithmFPType* errFlag = aErrFlag.get();
-        for (size_t i = 0; i < nVectors; i++)
+        DAAL_CHECK_STATUS(s, (boosting::training::internal::parallelBlockedReduce<ErrorPartial>(nVectors,
+            [=](size_t startRow, size_t nRows, ErrorPartial &partial)
         {
-            errFlag[i] = -one;
-            if (h[i] * y[i] < zero)
+            for (size_t i = startRow; i < startRow + nRows; i++)
             {
-                errFlag[i] = one;
-                nErr++;
-                errM += w[i];
+                const bool isErr = (h[i] * y[i] < zero);
+                errFlag[i] = (isErr ? one : -one);
+                partial.nErr += (size_t)isErr;
+                partial.errM += (isErr ? w[i] : zero);
             }
-        }
+        },
+            [&](const ErrorPartial &partial)
+        {
+            nErr += partial.nErr;
+            errM += partial.errM;
+        })));
 
         if (nErr == 0)
         {
@@ -212,22 +237,42 @@ services::Status AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreu
         algorithmFPType cM = 0.5 * daal::internal::Math<algorithmFPType,cpu>::sLog((one - errM) / errM);
 
         /* Update weights */
-        for (size_t i = 0; i < nVectors; i++)
-        {
-            errFlag[i] *= cM;
-        }
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, errFlag, errFlag);
         algorithmFPType wSum = zero;
-        for (size_t i = 0; i < nVectors; i++)
+        DAAL_CHECK_STATUS(s, (boosting::training::internal::parallelBlockedReduce<algorithmFPType>(nVectors,
+            [=](size_t startRow, size_t nRows, algorithmFPType &partialSum)
         {
-            w[i] *= errFlag[i];
-            wSum += w[i];
-        }
-        algorithmFPType invWSum = one / wSum;
-        for (size_t i = 0; i < nVectors; i++)
+            algorithmFPType *errFlagBlock = errFlag + startRow;
+            algorithmFPType *wBlock = w + startRow;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                errFlagBlock[i] *= cM;
+            }
+            daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, errFlagBlock, errFlagBlock);
+            algorithmFPType sum = zero;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                wBlock[i] *= errFlagBlock[i];
+                sum += wBlock[i];
+            }
+            partialSum += sum;
+        },
+            [&](algorithmFPType partialSum) { wSum += partialSum; })));
+
+        const algorithmFPType invWSum = one / wSum;
+        boosting::training::internal::parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
         {
-            w[i] *= invWSum;
-        }
+            algorithmFPType *wBlock = w + startRow;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRows; i++)
+            {
+                wBlock[i] *= invWSum;
+            }
+        });
         alpha[m] = cM;
 
         if (errM < accThr) { break; }
@@ -45,8 +45,12 @@
 //--
 */
 
+#include <typeinfo>
 #include "algorithm_base.h"
 #include "algorithm_base_mode_impl.h"
+#include "service_tracing.h"
+#include "service_workspace.h"
+#include "service_threading.h"
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
     #include "service_thread_pinner.h"
 #endif
@@ -55,9 +59,81 @@ namespace daal
 {
 namespace algorithms
 {
+namespace
+{
+
+/* Runs computeNoThrow of the algorithm as a task of its own task group,
+   so that the completion of each computation can be waited for separately */
+template<typename AlgorithmType>
+class ComputeFutureImpl : public ComputeFutureIface
+{
+public:
+    ComputeFutureImpl(AlgorithmType *algorithm) : _algorithm(algorithm), _done(0) {}
+
+    ~ComputeFutureImpl()
+    {
+        _group.wait();
+    }
+
+    void submit()
+    {
+        auto computeTask = [this]()
+        {
+            _status = _algorithm->computeNoThrow();
+            _done.set(1);
+        };
+        _group.run(computeTask);
+    }
+
+    services::Status wait() DAAL_C11_OVERRIDE
+    {
+        _group.wait();
+        return _status;
+    }
+
+    bool isReady() const DAAL_C11_OVERRIDE
+    {
+        return (_done.get() != 0);
+    }
+
+private:
+    AlgorithmType *_algorithm;
+    task_group _group;
+    services::Status _status;
+    services::AtomicInt _done;
+};
+
+template<typename AlgorithmType>
+ComputeFuture submitCompute(AlgorithmType *algorithm)
+{
+    ComputeFutureImpl<AlgorithmType> *impl = new ComputeFutureImpl<AlgorithmType>(algorithm);
+    if(!impl)
+        return ComputeFuture(services::Status(services::ErrorMemoryAllocationFailed));
+
+    services::SharedPtr<ComputeFutureIface> implPtr(impl);
+    impl->submit();
+    return ComputeFuture(implPtr);
+}
+
+} // namespace
+
+template<ComputeMode mode>
+ComputeFuture AlgorithmImpl<mode>::computeAsync()
+{
+    return submitCompute(this);
+}
+
+ComputeFuture AlgorithmImpl<batch>::computeAsync()
+{
+    return submitCompute(this);
+}
+
 template<ComputeMode mode>
 services::Status AlgorithmImpl<mode>::computeNoThrow()
 {
+    const char *algorithmName = (daal::internal::isTracingEnabled() ? typeid(*this).name() : 0);
+    daal::internal::TraceScope traceCompute("computeNoThrow", "algorithm", algorithmName, this->getMethod());
+
     this->setParameter();
 
     services::Status s;
@@ -87,24 +163,36 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
         this->setInitFlag(true);
     }
 
-    s = setupCompute();
+    {
+        daal::internal::TraceScope traceSetup("setupCompute", "algorithm", algorithmName, this->getMethod());
+        s = setupCompute();
+    }
     if(s)
     {
+        daal::internal::TraceScope traceContainer("compute", "algorithm", algorithmName, this->getMethod());
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
         daal::services::interface1::thread_pinner_t* pinner = daal::services::interface1::getThreadPinner(false);
 
         if( pinner != NULL )
         {
-            pinner->execute([&]() { s |=  this->_ac->compute(); });
+            pinner->execute([&]()
+            {
+                daal::internal::WorkspaceScope workspaceScope(this->_workspace.get());
+                s |=  this->_ac->compute();
+            });
         }
         else
 #endif
         {
+            daal::internal::WorkspaceScope workspaceScope(this->_workspace.get());
             s =  this->_ac->compute();
         }
     }
 
-    s |= resetCompute();
+    {
+        daal::internal::TraceScope traceReset("resetCompute", "algorithm", algorithmName, this->getMethod());
+        s |= resetCompute();
+    }
     return s;
 }
 
@@ -113,6 +201,9 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
  */
 services::Status AlgorithmImpl<batch>::computeNoThrow()
 {
+    const char *algorithmName = (daal::internal::isTracingEnabled() ? typeid(*this).name() : 0);
+    daal::internal::TraceScope traceCompute("computeNoThrow", "algorithm", algorithmName, this->getMethod());
+
     this->setParameter();
 
     if(this->isChecksEnabled())
@@ -134,25 +225,37 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
             return s;
     }
 
-    s = setupCompute();
+    {
+        daal::internal::TraceScope traceSetup("setupCompute", "algorithm", algorithmName, this->getMethod());
+        s = setupCompute();
+    }
     if(s)
     {
+        daal::internal::TraceScope traceContainer("compute", "algorithm", algorithmName, this->getMethod());
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
         daal::services::interface1::thread_pinner_t* pinner = daal::services::interface1::getThreadPinner(false);
 
         if( pinner != NULL )
         {
-            pinner->execute([&]() { s |=  this->_ac->compute(); });
+            pinner->execute([&]()
+            {
+                daal::internal::WorkspaceScope workspaceScope(this->_workspace.get());
+                s |=  this->_ac->compute();
+            });
         }
         else
 #endif
         {
+            daal::internal::WorkspaceScope workspaceScope(this->_workspace.get());
             s |=  this->_ac->compute();
         }
     }
 
     if(resetFlag)
+    {
+        daal::internal::TraceScope traceReset("resetCompute", "algorithm", algorithmName, this->getMethod());
         s |= resetCompute();
+    }
     _res = this->_ac->getResult();
     return s;
 }
@@ -0,0 +1,135 @@
+/* file: boosting_train_utils.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common utilities for parallel processing of observations in boosting training algorithms.
+//--
+*/
+
+#ifndef __BOOSTING_TRAIN_UTILS_I__
+#define __BOOSTING_TRAIN_UTILS_I__
+
+#include "threading.h"
+#include "service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace boosting
+{
+namespace training
+{
+namespace internal
+{
+
+/* Number of observations processed by one thread at a time */
+const size_t blockSize = 4096;
+
+/**
+ *  \brief Apply the function to the blocks of observations in parallel
+ *
+ *  \param n[in]          Number of observations
+ *  \param blockFunc[in]  Function of (startRow, nRows) that processes a block of observations
+ */
+template <typename BlockFunc>
+void parallelBlockedFor(size_t n, const BlockFunc &blockFunc)
+{
+    const size_t nBlocks = n / blockSize + !!(n % blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > n) ? n - startRow : blockSize;
+        blockFunc(startRow, nRows);
+    });
+}
+
+/**
+ *  \brief Apply the function to the blocks of observations in parallel and
+ *         reduce the partial results accumulated by the threads
+ *
+ *  \param n[in]          Number of observations
+ *  \param blockFunc[in]  Function of (startRow, nRows, partial) that processes a block of observations
+ *                        and accumulates its contribution into the thread-local zero-initialized partial result
+ *  \param reduceFunc[in] Function of (partial) that merges the partial result of a thread into the total one
+ */
+template <typename PartialType, typename BlockFunc, typename ReduceFunc>
+services::Status parallelBlockedReduce(size_t n, const BlockFunc &blockFunc, const ReduceFunc &reduceFunc)
+{
+    SafeStatus safeStat;
+    daal::tls<PartialType *> tlsPartial([&]()
+    {
+        PartialType *partial = new PartialType();
+        if (!partial)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        }
+        return partial;
+    });
+
+    parallelBlockedFor(n, [&](size_t startRow, size_t nRows)
+    {
+        PartialType *partial = tlsPartial.local();
+        if (partial)
+        {
+            blockFunc(startRow, nRows, *partial);
+        }
+    });
+
+    tlsPartial.reduce([&](PartialType *partial)
+    {
+        if (partial)
+        {
+            reduceFunc(*partial);
+            delete partial;
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::boosting::training::internal
+}
+}
+}
+} // namespace daal
+
+#endif
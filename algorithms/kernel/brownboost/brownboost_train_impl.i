@@ -62,6 +62,8 @@
 #include "service_math.h"
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "boosting_train_utils.i"
+#include "stump_train_sorted_indices.i"
 
 #include "weak_learner_model.h"
 #include "brownboost_model.h"
@@ -78,6 +80,31 @@ namespace internal
 {
 using namespace daal::internal;
 using namespace daal::data_management;
+using boosting::training::internal::parallelBlockedFor;
+using boosting::training::internal::parallelBlockedReduce;
+
+/**
+ *  \brief Partial edge of the weak learner computed on a block of observations
+ */
+template <typename algorithmFPType>
+struct BrownBoostGammaPartial
+{
+    algorithmFPType gamma;  /* Weighted sum of the products of predicted and actual class labels */
+    size_t nCorrect;        /* Number of correctly classified observations */
+};
+
+/**
+ *  \brief Partial sums of the Newton-Raphson method computed on a block of observations
+ */
+template <typename algorithmFPType>
+struct NewtonRaphsonPartial
+{
+    algorithmFPType nrW;
+    algorithmFPType nrU;
+    algorithmFPType nrB;
+    algorithmFPType nrV;
+    algorithmFPType nrE;
+};
 
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::compute(size_t na, NumericTablePtr *a,
@@ -169,7 +196,14 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
     /* Allocate memory for storing intermediate results */
     daal::internal::TArray<algorithmFPType, cpu> r(nVectors);/* Weak classifier's classification margin */
     DAAL_CHECK(r.get(), services::ErrorMemoryAllocationFailed);
-    for(auto i = 0; i < nVectors; r[i++] = 0.);
+    algorithmFPType *rr = r.get();
+    parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
+    {
+        for (size_t j = startRow; j < startRow + nRows; j++)
+        {
+            rr[j] = zero;
+        }
+    });
 
     services::SharedPtr<weak_learner::training::Batch> learnerTrain = parameter->weakLearnerTraining->clone();
     classifier::training::Input *trainInput = learnerTrain->getInput();
@@ -178,6 +212,10 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
     trainInput->set(classifier::training::labels,  weakLearnerInputTables[1]);
     trainInput->set(classifier::training::weights, weakLearnerInputTables[2]);
 
+    /* Every weak learner is trained on the same data set, so the features are sorted once per training */
+    services::Status status = stump::training::internal::setSortedIndices<cpu>(trainInput, *weakLearnerInputTables[0]);
+    DAAL_CHECK_STATUS_VAR(status);
+
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     classifier::prediction::Input *predictInput = learnerPredict->getInput();
     DAAL_CHECK(predictInput, services::ErrorNullInput);
@@ -192,13 +230,12 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
 
     algorithmFPType s = nr.c;      /* Remaining time */
     nWeakLearners = 0;
-    services::Status status;
     for (size_t iteration = 0; iteration < parameter->maxIterations && s > zero; iteration++)
     {
         nWeakLearners++;
 
         /* Update weights */
-        updateWeights(nVectors, s, nr.c, nr.invSqrtC, r.get(), nr.aNra.get(), nr.aNre2.get(), w);
+        DAAL_CHECK_STATUS(status, updateWeights(nVectors, s, nr.c, nr.invSqrtC, r.get(), nr.aNra.get(), nr.aNre2.get(), w));
 
         /* Re-allocate array of weak learners' models and boosting coefficients */
         alpha = reallocateAlpha(nWeakLearners-1, nWeakLearners, alpha);
@@ -221,15 +258,24 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
         DAAL_CHECK_STATUS(status, learnerPredict->computeNoThrow());
 
         algorithmFPType gamma = zero;
-
         size_t nCorrect = 0;
-        for (size_t j = 0; j < nVectors; j++)
+        typedef BrownBoostGammaPartial<algorithmFPType> GammaPartial;
+        DAAL_CHECK_STATUS(status, parallelBlockedReduce<GammaPartial>(nVectors,
+            [=](size_t startRow, size_t nRows, GammaPartial &partial)
         {
-            h[j] = ((h[j] > zero) ? one : -one);
-            algorithmFPType hy = h[j] * y[j];
-            gamma += w[j] * hy;
-            nCorrect += (size_t)(hy > zero);
-        }
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                h[j] = ((h[j] > zero) ? one : -one);
+                algorithmFPType hy = h[j] * y[j];
+                partial.gamma += w[j] * hy;
+                partial.nCorrect += (size_t)(hy > zero);
+            }
+        },
+            [&](const GammaPartial &partial)
+        {
+            gamma += partial.gamma;
+            nCorrect += partial.nCorrect;
+        }));
 
         if (nCorrect == nVectors)
         {
@@ -241,45 +287,74 @@ services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoost
         }
 
         /* Find alpha coefficient with Newton-Raphson method */
-        nr.compute(gamma, s, h, y);
+        DAAL_CHECK_STATUS(status, nr.compute(gamma, s, h, y));
         s -= nr.nrT;
         alpha[nWeakLearners - 1] = nr.nrAlpha;
 
         /* Update margin */
         const algorithmFPType* nrb = nr.aNrb.get();
-        algorithmFPType* rr = r.get();
-        for (size_t j = 0; j < nVectors; j++)
+        const algorithmFPType nrAlpha = nr.nrAlpha;
+        parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
         {
-            rr[j] += nr.nrAlpha * nrb[j];
-        }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startRow; j < startRow + nRows; j++)
+            {
+                rr[j] += nrAlpha * nrb[j];
+            }
+        });
     }
 
     return status;
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
-void BrownBoostTrainKernel<method, algorithmFPType, cpu>::updateWeights(
+services::Status BrownBoostTrainKernel<method, algorithmFPType, cpu>::updateWeights(
             size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
             const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w)
 {
-    for (size_t j = 0; j < nVectors; j++)
-    {
-        nra[j] = r[j] + s;
-        nre2[j] = nra[j] * invSqrtC;
-        w[j] = -nra[j] * nra[j] / c;
-    }
-    daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, w, w);
-    daal::internal::Math<algorithmFPType,cpu>::vErf(nVectors, nre2, nre2);
     algorithmFPType wSum = (algorithmFPType)0.0;
-    for (size_t j = 0; j < nVectors; j++)
+    services::Status status = parallelBlockedReduce<algorithmFPType>(nVectors,
+        [=](size_t startRow, size_t nRows, algorithmFPType &partialSum)
     {
-        wSum += w[j];
-    }
-    algorithmFPType invWSum = 1.0 / wSum;
-    for (size_t j = 0; j < nVectors; j++)
+        const algorithmFPType *rBlock = r + startRow;
+        algorithmFPType *nraBlock = nra + startRow;
+        algorithmFPType *nre2Block = nre2 + startRow;
+        algorithmFPType *wBlock = w + startRow;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRows; j++)
+        {
+            nraBlock[j] = rBlock[j] + s;
+            nre2Block[j] = nraBlock[j] * invSqrtC;
+            wBlock[j] = -nraBlock[j] * nraBlock[j] / c;
+        }
+        daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, wBlock, wBlock);
+        daal::internal::Math<algorithmFPType,cpu>::vErf(nRows, nre2Block, nre2Block);
+        algorithmFPType sum = (algorithmFPType)0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRows; j++)
+        {
+            sum += wBlock[j];
+        }
+        partialSum += sum;
+    },
+        [&](algorithmFPType partialSum) { wSum += partialSum; });
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const algorithmFPType invWSum = 1.0 / wSum;
+    parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
     {
-        w[j] *= invWSum;
-    }
+        algorithmFPType *wBlock = w + startRow;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRows; j++)
+        {
+            wBlock[j] *= invWSum;
+        }
+    });
+    return status;
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -318,7 +393,7 @@ NewtonRaphsonKernel<method, algorithmFPType, cpu>::NewtonRaphsonKernel(size_t nV
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
-void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType gamma,
+services::Status NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType gamma,
     algorithmFPType s, const algorithmFPType *h, const algorithmFPType *y)
 {
     /* Floating point constants */
@@ -347,37 +422,83 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
     algorithmFPType* nre1 = aNre1.get();
     algorithmFPType* nre2 = aNre2.get();
 
-    for(size_t j = 0; j < nVectors; j++)
+    parallelBlockedFor(nVectors, [=](size_t startRow, size_t nRows)
     {
-        nrb[j] = h[j] * y[j] * alphaSign;
-    }
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = startRow; j < startRow + nRows; j++)
+        {
+            nrb[j] = h[j] * y[j] * alphaSign;
+        }
+    });
 
+    const algorithmFPType invC = this->invC;
+    const algorithmFPType invSqrtC = this->invSqrtC;
+    typedef NewtonRaphsonPartial<algorithmFPType> NRPartial;
     for(size_t nrIter = 0; nrIter < nrMaxIter; ++nrIter)
     {
+        const algorithmFPType alpha = nrAlpha;
+        const algorithmFPType t = nrT;
+
         /* Calculate Newton-Raphson parameters */
-        for(size_t j = 0; j < nVectors; j++)
+        NRPartial total = { zero, zero, zero, zero, zero };
+        services::Status status = parallelBlockedReduce<NRPartial>(nVectors,
+            [=](size_t startRow, size_t nRows, NRPartial &partial)
         {
-            nrd[j] = nra[j] + nrAlpha * nrb[j] - nrT;
-            nrw[j] = -invC * nrd[j] * nrd[j];
-            nre1[j] = nrd[j] * invSqrtC;
-        }
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nVectors, nrw,  nrw);
-        daal::internal::Math<algorithmFPType, cpu>::vErf(nVectors, nre1, nre1);
-        algorithmFPType nrW(0.0);
-        algorithmFPType nrU(0.0);
-        algorithmFPType nrB(0.0);
-        algorithmFPType nrV(0.0);
-        algorithmFPType nrE(0.0);
-        for(size_t j = 0; j < nVectors; j++)
+            algorithmFPType *nrdBlock = nrd + startRow;
+            algorithmFPType *nrwBlock = nrw + startRow;
+            algorithmFPType *nre1Block = nre1 + startRow;
+            const algorithmFPType *nraBlock = nra + startRow;
+            const algorithmFPType *nrbBlock = nrb + startRow;
+            const algorithmFPType *nre2Block = nre2 + startRow;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nRows; j++)
+            {
+                nrdBlock[j] = nraBlock[j] + alpha * nrbBlock[j] - t;
+                nrwBlock[j] = -invC * nrdBlock[j] * nrdBlock[j];
+                nre1Block[j] = nrdBlock[j] * invSqrtC;
+            }
+            daal::internal::Math<algorithmFPType,cpu>::vExp(nRows, nrwBlock, nrwBlock);
+            daal::internal::Math<algorithmFPType, cpu>::vErf(nRows, nre1Block, nre1Block);
+            algorithmFPType nrW(0.0);
+            algorithmFPType nrU(0.0);
+            algorithmFPType nrB(0.0);
+            algorithmFPType nrV(0.0);
+            algorithmFPType nrE(0.0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nRows; j++)
+            {
+                algorithmFPType nrwb  = nrwBlock[j] * nrbBlock[j];
+                algorithmFPType nrwdb = nrwb * nrdBlock[j];
+                nrW += nrwBlock[j];
+                nrB += nrwb;
+                nrU += nrwdb;
+                nrV += nrwdb * nrbBlock[j];
+                nrE += nre1Block[j] - nre2Block[j];
+            }
+            partial.nrW += nrW;
+            partial.nrU += nrU;
+            partial.nrB += nrB;
+            partial.nrV += nrV;
+            partial.nrE += nrE;
+        },
+            [&](const NRPartial &partial)
         {
-            algorithmFPType nrwb  = nrw[j] * nrb[j];
-            algorithmFPType nrwdb = nrwb * nrd[j];
-            nrW += nrw[j];
-            nrB += nrwb;
-            nrU += nrwdb;
-            nrV += nrwdb * nrb[j];
-            nrE += nre1[j] - nre2[j];
-        }
+            total.nrW += partial.nrW;
+            total.nrU += partial.nrU;
+            total.nrB += partial.nrB;
+            total.nrV += partial.nrV;
+            total.nrE += partial.nrE;
+        });
+        DAAL_CHECK_STATUS_VAR(status);
+
+        const algorithmFPType nrW = total.nrW;
+        const algorithmFPType nrU = total.nrU;
+        const algorithmFPType nrB = total.nrB;
+        const algorithmFPType nrV = total.nrV;
+        const algorithmFPType nrE = total.nrE;
 
         /* Update Newton-Raphson variables */
         const algorithmFPType invDenom = one / (two * (nrV * nrW - nrU * nrB));
@@ -390,6 +511,7 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
             break;
     }
     nrAlpha *= alphaSign;
+    return services::Status();
 }
 
 
@@ -76,8 +76,8 @@ private:
     typedef typename daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
     typedef typename services::SharedPtr<HomogenNT> HomogenNTPtr;
 
-    void updateWeights(size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
-                       const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w);
+    services::Status updateWeights(size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
+                               const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w);
 
     algorithmFPType *reallocateAlpha(size_t oldAlphaSize, size_t alphaSize, algorithmFPType *oldAlpha);
 
@@ -97,7 +97,7 @@ struct NewtonRaphsonKernel
         return (aNrd.get() && aNrw.get() && aNra.get() && aNrb.get() && aNre1.get() && aNre2.get());
     }
 
-    void compute(algorithmFPType gamma, algorithmFPType s, const algorithmFPType *h, const algorithmFPType *y);
+    services::Status compute(algorithmFPType gamma, algorithmFPType s, const algorithmFPType *h, const algorithmFPType *y);
 
     size_t nVectors;
     algorithmFPType nrT;
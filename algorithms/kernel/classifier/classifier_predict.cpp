@@ -158,6 +158,8 @@ services::Status Input::checkImpl(const daal::algorithms::Parameter *parameter)
 
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
 
+Result::Result(const size_t n) : daal::algorithms::Result(n) {}
+
 /**
  * Returns the prediction result of the classification algorithm
  * \param[in] id   Identifier of the prediction result, \ref ResultId
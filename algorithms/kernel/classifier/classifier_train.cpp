@@ -48,6 +48,7 @@
 #include "classifier_training_types.h"
 #include "serialization_utils.h"
 #include "daal_strings.h"
+#include "service_numeric_table.h"
 
 namespace daal
 {
@@ -132,6 +133,7 @@ services::Status Input::checkImpl(const daal::algorithms::Parameter *parameter)
     if(weightsTable)
     {
         DAAL_CHECK_STATUS(s, data_management::checkNumericTable(weightsTable.get(), weightsStr(), 0, 0, 1, nRows));
+        DAAL_CHECK_STATUS(s, daal::internal::checkWeights(weightsTable.get(), weightsStr()));
     }
     return s;
 }
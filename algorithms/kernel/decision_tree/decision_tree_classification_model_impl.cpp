@@ -111,6 +111,7 @@ services::Status Parameter::check() const
     DAAL_CHECK_STATUS(s, daal::algorithms::classifier::Parameter::check());
 
     DAAL_CHECK_EX(minObservationsInLeafNodes >= 1, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafNodesStr());
+    DAAL_CHECK_EX(maxBins >= 2 && maxBins <= 256, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
     return s;
 }
 
@@ -0,0 +1,155 @@
+/* file: decision_tree_classification_train_dense_binned_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for Decision tree binnedDense method.
+//--
+*/
+
+#ifndef __DECISION_TREE_CLASSIFICATION_TRAIN_DENSE_BINNED_IMPL_I__
+#define __DECISION_TREE_CLASSIFICATION_TRAIN_DENSE_BINNED_IMPL_I__
+
+#include "decision_tree_classification_train_dense_default_impl.i"
+#include "decision_tree_train_binned_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_tree
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+
+using daal::internal::ReadColumns;
+
+/**
+ *  \brief Histogram of class labels, every bin holds the number of observations of each class
+ */
+class ClassHistogram
+{
+public:
+    typedef size_t BinValueType;
+
+    ClassHistogram(size_t nClasses) : _nClasses(nClasses) {}
+
+    size_t binSize() const { return _nClasses; }
+
+    size_t statisticsSize() const { return _nClasses; }
+
+    void addRow(BinValueType * bin, int y) const { ++bin[y]; }
+
+    size_t count(const BinValueType * bin) const
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < _nClasses; ++i) { result += bin[i]; }
+        return result;
+    }
+
+    template <typename DataStatistics>
+    void addToStatistics(DataStatistics & dataStatistics, const BinValueType * bin) const
+    {
+        for (size_t i = 0; i < _nClasses; ++i) { dataStatistics.update(i, bin[i]); }
+    }
+
+private:
+    size_t _nClasses;
+};
+
+template <typename algorithmFPType, CpuType cpu, typename SplitCriterion>
+services::Status trainBinned(BinnedTree<cpu, algorithmFPType, int> & tree, SplitCriterion & splitCriterion, const BinnedData<algorithmFPType, cpu> & data,
+                             const FeatureTypesCache & featureTypesCache, const int * y, const decision_tree::classification::Parameter * parameter)
+{
+    const ClassHistogram histogram(parameter->nClasses);
+    BinnedTreeBuilder<cpu, algorithmFPType, int, SplitCriterion, ClassHistogram> builder(tree, splitCriterion, histogram, data, featureTypesCache,
+                                                                                         y, parameter->minObservationsInLeafNodes);
+    return builder.build(parameter->maxTreeDepth);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::binnedDense, cpu>::
+    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
+            decision_tree::classification::Model * r, const daal::algorithms::Parameter * par)
+{
+    DAAL_ASSERT(x);
+    DAAL_ASSERT(y);
+    DAAL_ASSERT(r);
+    const decision_tree::classification::Parameter * const parameter = static_cast<const decision_tree::classification::Parameter *>(par);
+    DAAL_ASSERT(parameter);
+
+    r->setNFeatures(x->getNumberOfColumns());
+
+    const FeatureTypesCache featureTypesCache(*x);
+    BinnedData<algorithmFPType, cpu> data;
+    services::Status status;
+    DAAL_CHECK_STATUS(status, data.init(*x, featureTypesCache, parameter->maxBins));
+
+    ReadColumns<int, cpu> yColumn(const_cast<NumericTable *>(y), 0, 0, y->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(yColumn);
+
+    BinnedTree<cpu, algorithmFPType, int> tree;
+    if (parameter->splitCriterion == gini)
+    {
+        Gini<algorithmFPType, cpu> splitCriterion;
+        DAAL_CHECK_STATUS(status, (trainBinned<algorithmFPType, cpu>(tree, splitCriterion, data, featureTypesCache, yColumn.get(), parameter)));
+    }
+    else
+    {
+        DAAL_ASSERT(parameter->splitCriterion == infoGain);
+        InfoGain<algorithmFPType, cpu> splitCriterion;
+        DAAL_CHECK_STATUS(status, (trainBinned<algorithmFPType, cpu>(tree, splitCriterion, data, featureTypesCache, yColumn.get(), parameter)));
+    }
+    return storeTree<algorithmFPType, cpu>(tree, px, py, parameter, r);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace decision_tree
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -167,6 +167,12 @@ public:
         ++_counters[index];
     }
 
+    void update(size_t index, size_t count)
+    {
+        DAAL_ASSERT(index < _size);
+        _counters[index] += count;
+    }
+
     bool isPure(size_t & onlyClass) const
     {
         size_t numberOfClasses = 0;
@@ -425,30 +431,9 @@ static void copyNode(size_t srcNodeIdx, size_t destNodeIdx, const decision_tree:
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu>::
-    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
-            decision_tree::classification::Model * r, const daal::algorithms::Parameter * par)
+services::Status storeTree(const Tree<cpu, algorithmFPType, int> & tree, const NumericTable * px, const NumericTable * py,
+                           const decision_tree::classification::Parameter * parameter, decision_tree::classification::Model * r)
 {
-    DAAL_ASSERT(x);
-    DAAL_ASSERT(y);
-    DAAL_ASSERT(r);
-    const decision_tree::classification::Parameter * const parameter = static_cast<const decision_tree::classification::Parameter *>(par);
-    DAAL_ASSERT(parameter);
-
-    r->setNFeatures(x->getNumberOfColumns());
-
-    Tree<cpu, algorithmFPType, int> tree;
-    if (parameter->splitCriterion == gini)
-    {
-        Gini<algorithmFPType, cpu> splitCriterion;
-        tree.train(splitCriterion, *x, *y, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
-    }
-    else
-    {
-        DAAL_ASSERT(parameter->splitCriterion == infoGain);
-        InfoGain<algorithmFPType, cpu> splitCriterion;
-        tree.train(splitCriterion, *x, *y, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
-    }
     services::Status status;
     if (parameter->pruning == reducedErrorPruning)
     {
@@ -491,6 +476,34 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::default
     return status;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu>::
+    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
+            decision_tree::classification::Model * r, const daal::algorithms::Parameter * par)
+{
+    DAAL_ASSERT(x);
+    DAAL_ASSERT(y);
+    DAAL_ASSERT(r);
+    const decision_tree::classification::Parameter * const parameter = static_cast<const decision_tree::classification::Parameter *>(par);
+    DAAL_ASSERT(parameter);
+
+    r->setNFeatures(x->getNumberOfColumns());
+
+    Tree<cpu, algorithmFPType, int> tree;
+    if (parameter->splitCriterion == gini)
+    {
+        Gini<algorithmFPType, cpu> splitCriterion;
+        tree.train(splitCriterion, *x, *y, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+    }
+    else
+    {
+        DAAL_ASSERT(parameter->splitCriterion == infoGain);
+        InfoGain<algorithmFPType, cpu> splitCriterion;
+        tree.train(splitCriterion, *x, *y, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+    }
+    return storeTree<algorithmFPType, cpu>(tree, px, py, parameter, r);
+}
+
 } // namespace internal
 } // namespace training
 } // namespace classification
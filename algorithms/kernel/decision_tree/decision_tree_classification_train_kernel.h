@@ -80,6 +80,14 @@ public:
                  decision_tree::classification::Model * r, const daal::algorithms::Parameter * par);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class DecisionTreeTrainBatchKernel<algorithmFPType, training::binnedDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
+                 decision_tree::classification::Model * r, const daal::algorithms::Parameter * par);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace classification
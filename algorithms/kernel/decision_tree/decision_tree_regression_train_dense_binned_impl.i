@@ -0,0 +1,137 @@
+/* file: decision_tree_regression_train_dense_binned_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for Decision tree binnedDense method.
+//--
+*/
+
+#ifndef __DECISION_TREE_REGRESSION_TRAIN_DENSE_BINNED_IMPL_I__
+#define __DECISION_TREE_REGRESSION_TRAIN_DENSE_BINNED_IMPL_I__
+
+#include "decision_tree_regression_train_dense_default_impl.i"
+#include "decision_tree_train_binned_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_tree
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+using daal::internal::ReadColumns;
+
+/**
+ *  \brief Histogram of the dependent variable, every bin holds the number of observations,
+ *         the sum and the sum of squares of their responses
+ */
+class MSEHistogram
+{
+public:
+    typedef double BinValueType;
+
+    size_t binSize() const { return 3; }
+
+    size_t statisticsSize() const { return 0; }
+
+    template <typename DependentVariable>
+    void addRow(BinValueType * bin, DependentVariable y) const
+    {
+        bin[0] += 1;
+        bin[1] += y;
+        bin[2] += BinValueType(y) * y;
+    }
+
+    size_t count(const BinValueType * bin) const { return static_cast<size_t>(bin[0] + 0.5); }
+
+    template <typename DataStatistics>
+    void addToStatistics(DataStatistics & dataStatistics, const BinValueType * bin) const
+    {
+        dataStatistics.update(bin[0], bin[1], bin[2]);
+    }
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::binnedDense, cpu>::
+    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
+            decision_tree::regression::Model * r, const daal::algorithms::Parameter * par)
+{
+    DAAL_ASSERT(x);
+    DAAL_ASSERT(y);
+    DAAL_ASSERT(r);
+    const decision_tree::regression::Parameter * const parameter = static_cast<const decision_tree::regression::Parameter *>(par);
+    DAAL_ASSERT(parameter);
+
+    DAAL_ASSERT(r->impl());
+    r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
+
+    const FeatureTypesCache featureTypesCache(*x);
+    BinnedData<algorithmFPType, cpu> data;
+    services::Status status;
+    DAAL_CHECK_STATUS(status, data.init(*x, featureTypesCache, parameter->maxBins));
+
+    ReadColumns<algorithmFPType, cpu> yColumn(const_cast<NumericTable *>(y), 0, 0, y->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(yColumn);
+
+    BinnedTree<cpu, algorithmFPType, algorithmFPType> tree;
+    MSE<algorithmFPType, cpu> splitCriterion;
+    const MSEHistogram histogram;
+    BinnedTreeBuilder<cpu, algorithmFPType, algorithmFPType, MSE<algorithmFPType, cpu>, MSEHistogram> builder(
+        tree, splitCriterion, histogram, data, featureTypesCache, yColumn.get(), parameter->minObservationsInLeafNodes);
+    DAAL_CHECK_STATUS(status, builder.build(parameter->maxTreeDepth));
+    return storeTree<algorithmFPType, cpu>(tree, px, py, parameter, r);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace decision_tree
+} // namespace algorithms
+} // namespace daal
+
+#endif
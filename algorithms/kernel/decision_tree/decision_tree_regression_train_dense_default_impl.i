@@ -148,6 +148,21 @@ public:
         }
     }
 
+    void update(algorithmFPType count, algorithmFPType sum, algorithmFPType sumOfSquares)
+    {
+        // Chan et al. pairwise update with the group of values given by its count, sum and sum of squares.
+
+        if (count <= 0) { return; }
+        const algorithmFPType mean = sum / count;
+        algorithmFPType mse = sumOfSquares - sum * mean;
+        if (mse < 0) { mse = 0; }
+        const algorithmFPType newCount = _count + count;
+        const algorithmFPType delta = mean - _mean;
+        _mse += mse + delta * delta * _count * count / newCount;
+        _mean += delta * count / newCount;
+        _count = newCount;
+    }
+
     bool isPure(algorithmFPType & result) const
     {
         const algorithmFPType epsilon = daal::data_feature_utils::internal::EpsilonVal<algorithmFPType, cpu>::get();
@@ -319,22 +334,9 @@ static void copyNode(size_t srcNodeIdx, size_t destNodeIdx, const decision_tree:
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu>::
-    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
-            decision_tree::regression::Model * r, const daal::algorithms::Parameter * par)
+services::Status storeTree(const Tree<cpu, algorithmFPType, algorithmFPType> & tree, const NumericTable * px, const NumericTable * py,
+                           const decision_tree::regression::Parameter * parameter, decision_tree::regression::Model * r)
 {
-    DAAL_ASSERT(x);
-    DAAL_ASSERT(y);
-    DAAL_ASSERT(r);
-    const decision_tree::regression::Parameter * const parameter = static_cast<const decision_tree::regression::Parameter *>(par);
-    DAAL_ASSERT(parameter);
-
-    DAAL_ASSERT(r->impl());
-    r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
-
-    Tree<cpu, algorithmFPType, algorithmFPType> tree;
-    MSE<algorithmFPType, cpu> splitCriterion;
-    tree.train(splitCriterion, *x, *y, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
     services::Status status;
     if (parameter->pruning == reducedErrorPruning)
     {
@@ -377,6 +379,26 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::default
     return status;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu>::
+    compute(const NumericTable * x, const NumericTable * y, const NumericTable * px, const NumericTable * py,
+            decision_tree::regression::Model * r, const daal::algorithms::Parameter * par)
+{
+    DAAL_ASSERT(x);
+    DAAL_ASSERT(y);
+    DAAL_ASSERT(r);
+    const decision_tree::regression::Parameter * const parameter = static_cast<const decision_tree::regression::Parameter *>(par);
+    DAAL_ASSERT(parameter);
+
+    DAAL_ASSERT(r->impl());
+    r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
+
+    Tree<cpu, algorithmFPType, algorithmFPType> tree;
+    MSE<algorithmFPType, cpu> splitCriterion;
+    tree.train(splitCriterion, *x, *y, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+    return storeTree<algorithmFPType, cpu>(tree, px, py, parameter, r);
+}
+
 } // namespace internal
 } // namespace training
 } // namespace regression
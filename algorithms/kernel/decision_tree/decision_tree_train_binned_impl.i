@@ -0,0 +1,664 @@
+/* file: decision_tree_train_binned_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for Decision tree training on binned features
+//--
+*/
+
+#ifndef __DECISION_TREE_TRAIN_BINNED_IMPL_I__
+#define __DECISION_TREE_TRAIN_BINNED_IMPL_I__
+
+#include "decision_tree_train_impl.i"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_tracing.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_tree
+{
+namespace internal
+{
+
+using daal::internal::TArray;
+using daal::internal::ReadRows;
+using daal::internal::ReadColumns;
+
+typedef unsigned char BinIndex;
+
+const size_t maxNumberOfBins = 256;
+
+/**
+ *  \brief Training data set with features quantized into at most 256 bins.
+ *
+ *  Bins of ordinal and continuous features are ranges of consecutive values
+ *  containing about the same number of observations. Equal values always fall
+ *  into the same bin. Bins of categorical features hold a single category each.
+ *  If there are more categories than bins, the least frequent categories share
+ *  the last bin which is never used as a split candidate.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BinnedData
+{
+public:
+    BinnedData() : _nRows(0), _nFeatures(0), _maxBins(0) {}
+
+    BinnedData(const BinnedData &) = delete;
+    BinnedData & operator= (const BinnedData &) = delete;
+
+    services::Status init(const NumericTable & x, const FeatureTypesCache & featureTypesCache, size_t maxBins)
+    {
+        DAAL_TRACE_SCOPE("decision_tree.binning");
+        DAAL_ASSERT(maxBins >= 2 && maxBins <= maxNumberOfBins);
+
+        _nRows = x.getNumberOfRows();
+        _nFeatures = x.getNumberOfColumns();
+        _maxBins = maxBins;
+
+        _bins.reset(_nRows * _nFeatures);
+        _nBins.reset(_nFeatures);
+        _overflowBins.reset(_nFeatures);
+        _minValues.reset(_nFeatures * _maxBins);
+        _maxValues.reset(_nFeatures * _maxBins);
+        DAAL_CHECK_MALLOC(_bins.get() && _nBins.get() && _overflowBins.get() && _minValues.get() && _maxValues.get());
+
+        NumericTable & table = const_cast<NumericTable &>(x);
+
+        /* Find bin boundaries of every feature */
+        SafeStatus safeStat;
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t iFeature)
+        {
+            ReadColumns<algorithmFPType, cpu> column(table, iFeature, 0, _nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(column);
+            safeStat |= findBins(iFeature, column.get(), featureTypesCache[iFeature]);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        /* Replace feature values with bin indices */
+        const size_t rowsPerBlock = 1024;
+        const size_t nBlocks = _nRows / rowsPerBlock + !!(_nRows % rowsPerBlock);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t startRow = iBlock * rowsPerBlock;
+            const size_t nRowsInBlock = (startRow + rowsPerBlock > _nRows) ? _nRows - startRow : rowsPerBlock;
+
+            ReadRows<algorithmFPType, cpu> rows(table, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(rows);
+            const algorithmFPType * const dx = rows.get();
+            BinIndex * const bins = _bins.get() + startRow * _nFeatures;
+
+            for (size_t i = 0; i < nRowsInBlock; ++i)
+            {
+                for (size_t j = 0; j < _nFeatures; ++j)
+                {
+                    bins[i * _nFeatures + j] = findBin(j, dx[i * _nFeatures + j], featureTypesCache[j]);
+                }
+            }
+        });
+        return safeStat.detach();
+    }
+
+    size_t nRows() const { return _nRows; }
+
+    size_t nFeatures() const { return _nFeatures; }
+
+    size_t maxBins() const { return _maxBins; }
+
+    /** Bin indices of all features of the observation */
+    const BinIndex * row(size_t index) const
+    {
+        DAAL_ASSERT(index < _nRows);
+        return _bins.get() + index * _nFeatures;
+    }
+
+    size_t nBins(FeatureIndex featureIndex) const { return _nBins.get()[featureIndex]; }
+
+    bool isSplitCandidate(FeatureIndex featureIndex, size_t binIndex) const { return binIndex != _overflowBins.get()[featureIndex]; }
+
+    algorithmFPType minValue(FeatureIndex featureIndex, size_t binIndex) const { return _minValues.get()[featureIndex * _maxBins + binIndex]; }
+
+    algorithmFPType maxValue(FeatureIndex featureIndex, size_t binIndex) const { return _maxValues.get()[featureIndex * _maxBins + binIndex]; }
+
+    /**
+     * Returns the cut point of the decision node that sends observations from the bin
+     * (categorical features) or from the bins up to and including the given one
+     * (ordinal and continuous features) to the left child
+     */
+    algorithmFPType cutPoint(FeatureIndex featureIndex, size_t binIndex, data_management::data_feature_utils::FeatureType featureType) const
+    {
+        switch (featureType)
+        {
+        case data_management::data_feature_utils::DAAL_CATEGORICAL:
+            return minValue(featureIndex, binIndex);
+        case data_management::data_feature_utils::DAAL_ORDINAL:
+            return minValue(featureIndex, binIndex + 1);
+        default:
+            return (maxValue(featureIndex, binIndex) + minValue(featureIndex, binIndex + 1)) / 2;
+        }
+    }
+
+protected:
+    services::Status findBins(FeatureIndex featureIndex, const algorithmFPType * x,
+                              data_management::data_feature_utils::FeatureType featureType)
+    {
+        TArray<algorithmFPType, cpu> sortedPtr(_nRows);
+        algorithmFPType * const sorted = sortedPtr.get();
+        DAAL_CHECK_MALLOC(sorted);
+        daal_memcpy_s(sorted, _nRows * sizeof(algorithmFPType), x, _nRows * sizeof(algorithmFPType));
+        introSort<cpu>(sorted, sorted + _nRows);
+
+        algorithmFPType * const minValues = _minValues.get() + featureIndex * _maxBins;
+        algorithmFPType * const maxValues = _maxValues.get() + featureIndex * _maxBins;
+        size_t & nBins = _nBins.get()[featureIndex];
+        _overflowBins.get()[featureIndex] = _maxBins;
+
+        /* Compact sorted values into the array of unique values and their frequencies */
+        TArray<size_t, cpu> countsPtr(_nRows);
+        size_t * const counts = countsPtr.get();
+        DAAL_CHECK_MALLOC(counts);
+        size_t nUnique = 0;
+        for (size_t i = 0; i < _nRows;)
+        {
+            const size_t next = upperBound<cpu>(sorted + i, sorted + _nRows, sorted[i]) - sorted;
+            sorted[nUnique] = sorted[i];
+            counts[nUnique++] = next - i;
+            i = next;
+        }
+
+        if (nUnique <= _maxBins)
+        {
+            for (size_t i = 0; i < nUnique; ++i)
+            {
+                minValues[i] = maxValues[i] = sorted[i];
+            }
+            nBins = nUnique;
+            return services::Status();
+        }
+
+        if (featureType == data_management::data_feature_utils::DAAL_CATEGORICAL)
+        {
+            /* Keep the most frequent categories, the rest go to the overflow bin */
+            const size_t nKept = _maxBins - 1;
+            TArray<size_t, cpu> orderPtr(nUnique);
+            size_t * const order = orderPtr.get();
+            DAAL_CHECK_MALLOC(order);
+            for (size_t i = 0; i < nUnique; ++i) { order[i] = i; }
+            introSort<cpu>(order, order + nUnique, [counts](size_t a, size_t b) -> bool
+            {
+                return (counts[a] > counts[b]) || (counts[a] == counts[b] && a < b);
+            });
+            introSort<cpu>(order, order + nKept);
+            for (size_t i = 0; i < nKept; ++i)
+            {
+                minValues[i] = maxValues[i] = sorted[order[i]];
+            }
+            minValues[nKept] = maxValues[nKept] = 0;
+            _overflowBins.get()[featureIndex] = nKept;
+            nBins = _maxBins;
+            return services::Status();
+        }
+
+        /* Split unique values into ranges holding about the same number of observations */
+        nBins = 0;
+        size_t nRemaining = _nRows;
+        for (size_t i = 0; i < nUnique;)
+        {
+            const size_t nBinsLeft = _maxBins - nBins;
+            const size_t target = (nRemaining + nBinsLeft - 1) / nBinsLeft;
+            size_t nInBin = 0;
+            size_t j = i;
+            if (nBinsLeft == 1)
+            {
+                j = nUnique;
+                nInBin = nRemaining;
+            }
+            else
+            {
+                do { nInBin += counts[j++]; } while (j < nUnique && nInBin < target && (nUnique - j) >= nBinsLeft - 1);
+            }
+            minValues[nBins] = sorted[i];
+            maxValues[nBins] = sorted[j - 1];
+            ++nBins;
+            nRemaining -= nInBin;
+            i = j;
+        }
+        return services::Status();
+    }
+
+    BinIndex findBin(FeatureIndex featureIndex, algorithmFPType value, data_management::data_feature_utils::FeatureType featureType) const
+    {
+        const size_t nFeatureBins = _nBins.get()[featureIndex];
+        const algorithmFPType * const maxValues = _maxValues.get() + featureIndex * _maxBins;
+        const size_t overflowBin = _overflowBins.get()[featureIndex];
+        if (overflowBin < _maxBins)
+        {
+            const algorithmFPType * const it = lowerBound<cpu>(maxValues, maxValues + overflowBin, value);
+            return (it != maxValues + overflowBin && *it == value) ? BinIndex(it - maxValues) : BinIndex(overflowBin);
+        }
+        const size_t bin = lowerBound<cpu>(maxValues, maxValues + nFeatureBins, value) - maxValues;
+        return BinIndex(bin < nFeatureBins ? bin : nFeatureBins - 1);
+    }
+
+private:
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _maxBins;
+    TArray<BinIndex, cpu> _bins;                /* Bin indices of observations, nRows x nFeatures */
+    TArray<size_t, cpu> _nBins;                 /* Number of bins of every feature */
+    TArray<size_t, cpu> _overflowBins;          /* Index of the bin shared by rare categories or maxBins if there is none */
+    TArray<algorithmFPType, cpu> _minValues;    /* Minimal feature value in every bin, nFeatures x maxBins */
+    TArray<algorithmFPType, cpu> _maxValues;    /* Maximal feature value in every bin, nFeatures x maxBins */
+};
+
+/**
+ *  \brief Decision tree that can be grown by BinnedTreeBuilder
+ */
+template <CpuType cpu, typename IndependentVariable, typename DependentVariable>
+class BinnedTree : public Tree<cpu, IndependentVariable, DependentVariable>
+{
+    typedef Tree<cpu, IndependentVariable, DependentVariable> super;
+
+public:
+    using super::clear;
+    using super::pushBack;
+    using super::makeLeaf;
+    using super::makeSplit;
+};
+
+/**
+ *  \brief Grows a decision tree on binned data using per-node histograms.
+ *
+ *  Histogram is a policy that defines the statistics of the dependent variable
+ *  accumulated in every bin: BinValueType, binSize(), statisticsSize(),
+ *  addRow(bin, y), count(bin) and addToStatistics(dataStatistics, bin).
+ *  The histogram of a node is computed only for the smaller child, the histogram
+ *  of the larger child is obtained by subtracting it from the histogram of the parent.
+ */
+template <CpuType cpu, typename IndependentVariable, typename DependentVariable, typename SplitCriterion, typename Histogram>
+class BinnedTreeBuilder
+{
+public:
+    typedef BinnedTree<cpu, IndependentVariable, DependentVariable> TreeType;
+    typedef BinnedData<IndependentVariable, cpu> DataType;
+    typedef typename Histogram::BinValueType BinValueType;
+    typedef typename SplitCriterion::DataStatistics DataStatistics;
+    typedef typename SplitCriterion::ValueType ValueType;
+
+    BinnedTreeBuilder(TreeType & tree, SplitCriterion & splitCriterion, const Histogram & histogram, const DataType & data,
+                      const FeatureTypesCache & featureTypesCache, const DependentVariable * y,
+                      size_t minLeafSize, size_t minSplitSize = 2) :
+        _tree(tree), _splitCriterion(splitCriterion), _histogram(histogram), _data(data), _featureTypesCache(featureTypesCache), _y(y),
+        _minLeafSize(minLeafSize), _minSplitSize(minSplitSize), _nFeatures(data.nFeatures()),
+        _featureHistSize(data.maxBins() * histogram.binSize()), _histSize(_nFeatures * _featureHistSize) {}
+
+    services::Status build(size_t maxTreeDepth)
+    {
+        DAAL_TRACE_SCOPE("decision_tree.build");
+        DAAL_ASSERT(_minLeafSize >= 1);
+        const size_t nRows = _data.nRows();
+
+        TArray<size_t, cpu> indexesPtr(nRows);
+        size_t * const indexes = indexesPtr.get();
+        TArray<BinValueType, cpu> histPtr(_histSize);
+        DAAL_CHECK_MALLOC(indexes && histPtr.get());
+        for (size_t i = 0; i < nRows; ++i) { indexes[i] = i; }
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, computeHistogram(indexes, nRows, histPtr.get()));
+
+        DataStatistics totalDataStatistics(_histogram.statisticsSize());
+        for (size_t b = 0; b < _data.nBins(0); ++b)
+        {
+            _histogram.addToStatistics(totalDataStatistics, histPtr.get() + b * _histogram.binSize());
+        }
+
+        _tree.clear();
+        return buildNode(_tree.pushBack(), indexes, nRows, histPtr.get(), totalDataStatistics,
+                         maxTreeDepth != 0 ? maxTreeDepth : static_cast<size_t>(-1));
+    }
+
+protected:
+    struct Split
+    {
+        FeatureIndex featureIndex;
+        size_t binIndex;
+        size_t leftCount;
+    };
+
+    services::Status buildNode(TreeNodeIndex nodeIndex, size_t * indexes, size_t indexCount, BinValueType * hist,
+                               const DataStatistics & totalDataStatistics, size_t depthLimit)
+    {
+        DAAL_ASSERT(depthLimit != 0);
+
+        if (depthLimit == 1 || indexCount < _minSplitSize || indexCount < _minLeafSize * 2)
+        {
+            _tree.makeLeaf(nodeIndex, totalDataStatistics.getBestDependentVariableValue());
+            return services::Status();
+        }
+
+        {
+            typename SplitCriterion::DependentVariableType leafDependentVariableValue;
+            if (totalDataStatistics.isPure(leafDependentVariableValue))
+            {
+                _tree.makeLeaf(nodeIndex, leafDependentVariableValue);
+                return services::Status();
+            }
+        }
+
+        Split split;
+        services::Status s;
+        bool found = false;
+        DAAL_CHECK_STATUS(s, findSplit(hist, indexCount, totalDataStatistics, split, found));
+        if (!found || split.leftCount < _minLeafSize || indexCount - split.leftCount < _minLeafSize)
+        {
+            _tree.makeLeaf(nodeIndex, totalDataStatistics.getBestDependentVariableValue());
+            return services::Status();
+        }
+
+        const data_management::data_feature_utils::FeatureType featureType = _featureTypesCache[split.featureIndex];
+        _tree.makeSplit(nodeIndex, split.featureIndex, _data.cutPoint(split.featureIndex, split.binIndex, featureType));
+        const TreeNodeIndex leftChildIndex = _tree[nodeIndex].leftChildIndex();
+        const TreeNodeIndex rightChildIndex = _tree[nodeIndex].rightChildIndex();
+
+        // Partition.
+        const DataType & data = _data;
+        const FeatureIndex splitFeature = split.featureIndex;
+        const size_t splitBin = split.binIndex;
+        size_t * splitIndexes = nullptr;
+        if (featureType == data_management::data_feature_utils::DAAL_CATEGORICAL)
+        {
+            splitIndexes = partition<cpu>(indexes, &indexes[indexCount], [&data, splitFeature, splitBin](size_t i) -> bool
+            {
+                return (data.row(i)[splitFeature] == splitBin);
+            });
+        }
+        else
+        {
+            splitIndexes = partition<cpu>(indexes, &indexes[indexCount], [&data, splitFeature, splitBin](size_t i) -> bool
+            {
+                return (data.row(i)[splitFeature] <= splitBin);
+            });
+        }
+        const size_t leftCount = splitIndexes - indexes;
+        const size_t rightCount = indexCount - leftCount;
+        DAAL_ASSERT(leftCount == split.leftCount);
+
+        // Estimate data statistics after partitioning.
+        DataStatistics leftDataStatistics(_histogram.statisticsSize());
+        leftDataStatistics.reset(totalDataStatistics);
+        const BinValueType * const featureHist = hist + splitFeature * _featureHistSize;
+        const size_t firstBin = (featureType == data_management::data_feature_utils::DAAL_CATEGORICAL) ? splitBin : 0;
+        for (size_t b = firstBin; b <= splitBin; ++b)
+        {
+            _histogram.addToStatistics(leftDataStatistics, featureHist + b * _histogram.binSize());
+        }
+        DataStatistics rightDataStatistics(totalDataStatistics);
+        rightDataStatistics -= leftDataStatistics;
+
+        // Compute the histogram of the smaller child, the larger child reuses the histogram of the parent.
+        const bool isLeftSmaller = (leftCount <= rightCount);
+        {
+            TArray<BinValueType, cpu> smallHistPtr(_histSize);
+            BinValueType * const smallHist = smallHistPtr.get();
+            DAAL_CHECK_MALLOC(smallHist);
+            DAAL_CHECK_STATUS(s, computeHistogram(isLeftSmaller ? indexes : splitIndexes, isLeftSmaller ? leftCount : rightCount, smallHist));
+            subtractHistogram(hist, smallHist);
+
+            DAAL_CHECK_STATUS(s, isLeftSmaller ?
+                buildNode(leftChildIndex, indexes, leftCount, smallHist, leftDataStatistics, depthLimit - 1) :
+                buildNode(rightChildIndex, splitIndexes, rightCount, smallHist, rightDataStatistics, depthLimit - 1));
+        }
+        return isLeftSmaller ?
+            buildNode(rightChildIndex, splitIndexes, rightCount, hist, rightDataStatistics, depthLimit - 1) :
+            buildNode(leftChildIndex, indexes, leftCount, hist, leftDataStatistics, depthLimit - 1);
+    }
+
+    void accumulateHistogram(const size_t * indexes, size_t indexCount, BinValueType * hist, FeatureIndex firstFeature, FeatureIndex lastFeature) const
+    {
+        const size_t binSize = _histogram.binSize();
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            const BinIndex * const bins = _data.row(indexes[i]);
+            const DependentVariable y = _y[indexes[i]];
+            for (FeatureIndex j = firstFeature; j < lastFeature; ++j)
+            {
+                _histogram.addRow(hist + j * _featureHistSize + bins[j] * binSize, y);
+            }
+        }
+    }
+
+    services::Status computeHistogram(const size_t * indexes, size_t indexCount, BinValueType * hist) const
+    {
+        const size_t histSize = _histSize;
+        const size_t nFeatures = _nFeatures;
+        const size_t featureHistSize = _featureHistSize;
+        for (size_t i = 0; i < histSize; ++i) { hist[i] = 0; }
+
+        const size_t nThreads = threader_get_threads_number();
+        if (indexCount >= 4 * nThreads * featureHistSize)
+        {
+            /* Large node: each thread accumulates a private histogram over blocks of observations */
+            SafeStatus safeStat;
+            daal::tls<BinValueType *> localHist([=, &safeStat]() -> BinValueType *
+            {
+                BinValueType * const ptr = service_scalable_calloc<BinValueType, cpu>(histSize);
+                if (!ptr) { safeStat.add(services::ErrorMemoryAllocationFailed); }
+                return ptr;
+            });
+
+            const size_t rowsPerBlock = 2048;
+            const size_t nBlocks = indexCount / rowsPerBlock + !!(indexCount % rowsPerBlock);
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+            {
+                BinValueType * const local = localHist.local();
+                if (!local) { return; }
+                const size_t first = iBlock * rowsPerBlock;
+                const size_t count = (first + rowsPerBlock > indexCount) ? indexCount - first : rowsPerBlock;
+                accumulateHistogram(indexes + first, count, local, 0, nFeatures);
+            });
+
+            localHist.reduce([=](BinValueType * local)
+            {
+                if (!local) { return; }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < histSize; ++i) { hist[i] += local[i]; }
+                service_scalable_free<BinValueType, cpu>(local);
+            });
+            return safeStat.detach();
+        }
+
+        /* Small node: groups of features are processed in parallel, no reduction is needed */
+        const size_t featuresPerBlock = 16;
+        const size_t nFeatureBlocks = nFeatures / featuresPerBlock + !!(nFeatures % featuresPerBlock);
+        if (indexCount * nFeatures < 8 * 1024 || nFeatureBlocks == 1)
+        {
+            accumulateHistogram(indexes, indexCount, hist, 0, nFeatures);
+            return services::Status();
+        }
+        daal::threader_for(nFeatureBlocks, nFeatureBlocks, [&](size_t iBlock)
+        {
+            const FeatureIndex first = iBlock * featuresPerBlock;
+            const FeatureIndex last = min<cpu>(first + featuresPerBlock, nFeatures);
+            accumulateHistogram(indexes, indexCount, hist, first, last);
+        });
+        return services::Status();
+    }
+
+    void subtractHistogram(BinValueType * hist, const BinValueType * other) const
+    {
+        const size_t featureHistSize = _featureHistSize;
+        daal::threader_for(_nFeatures, _nFeatures, [=](size_t iFeature)
+        {
+            BinValueType * const h = hist + iFeature * featureHistSize;
+            const BinValueType * const o = other + iFeature * featureHistSize;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < featureHistSize; ++i) { h[i] -= o[i]; }
+        });
+    }
+
+    services::Status findSplit(const BinValueType * hist, size_t indexCount, const DataStatistics & totalDataStatistics, Split & winner,
+                               bool & found) const
+    {
+        typedef daal::internal::Math<ValueType, cpu> SplitCriterionMath;
+        typedef daal::data_feature_utils::internal::EpsilonVal<ValueType, cpu> SplitCriterionEpsilon;
+
+        struct Local
+        {
+            Split winner;
+            ValueType winnerSplitCriterionValue;
+            DataStatistics dataStatistics;
+            bool winnerIsLeaf;
+            SplitCriterion splitCriterion;
+
+            Local(const SplitCriterion & criterion, size_t statisticsSize) :
+                dataStatistics(statisticsSize), winnerIsLeaf(true), splitCriterion(criterion) {}
+        };
+
+        SafeStatus safeStat;
+        SplitCriterion & splitCriterion = _splitCriterion;
+        const size_t statisticsSize = _histogram.statisticsSize();
+        daal::tls<Local *> localTLS([&]() -> Local *
+        {
+            Local * const ptr = new Local(splitCriterion, statisticsSize);
+            if (!ptr) { safeStat.add(services::ErrorMemoryAllocationFailed); }
+            return ptr;
+        });
+
+        const ValueType epsilon = SplitCriterionEpsilon::get();
+        const size_t binSize = _histogram.binSize();
+        const BinIndex * const dummy = nullptr;
+
+        daal::threader_for(_nFeatures, _nFeatures, [&](size_t featureIndex)
+        {
+            Local * const local = localTLS.local();
+            if (!local) { return; }
+
+            const BinValueType * const featureHist = hist + featureIndex * _featureHistSize;
+            const size_t nBins = _data.nBins(featureIndex);
+            const data_management::data_feature_utils::FeatureType featureType = _featureTypesCache[featureIndex];
+
+            auto updateWinner = [&](size_t binIndex, size_t leftCount)
+            {
+                const ValueType value = local->splitCriterion(dummy, dummy, dummy, dummy, local->dataStatistics, totalDataStatistics, featureType,
+                                                              leftCount, indexCount - leftCount, indexCount);
+                if (local->winnerIsLeaf || value < local->winnerSplitCriterionValue ||
+                    (SplitCriterionMath::sFabs(value - local->winnerSplitCriterionValue) <= epsilon && local->winner.featureIndex > featureIndex))
+                {
+                    local->winnerIsLeaf = false;
+                    local->winnerSplitCriterionValue = value;
+                    local->winner.featureIndex = featureIndex;
+                    local->winner.binIndex = binIndex;
+                    local->winner.leftCount = leftCount;
+                }
+            };
+
+            if (featureType == data_management::data_feature_utils::DAAL_CATEGORICAL)
+            {
+                for (size_t b = 0; b < nBins; ++b)
+                {
+                    const size_t count = _histogram.count(featureHist + b * binSize);
+                    if (count == 0 || count == indexCount || !_data.isSplitCandidate(featureIndex, b)) { continue; }
+                    local->dataStatistics.reset(totalDataStatistics);
+                    _histogram.addToStatistics(local->dataStatistics, featureHist + b * binSize);
+                    updateWinner(b, count);
+                }
+            }
+            else
+            {
+                local->dataStatistics.reset(totalDataStatistics);
+                size_t leftCount = 0;
+                for (size_t b = 0; b + 1 < nBins; ++b)
+                {
+                    const size_t count = _histogram.count(featureHist + b * binSize);
+                    if (count == 0) { continue; }
+                    leftCount += count;
+                    if (leftCount == indexCount) { break; }
+                    _histogram.addToStatistics(local->dataStatistics, featureHist + b * binSize);
+                    updateWinner(b, leftCount);
+                }
+            }
+        });
+
+        found = false;
+        ValueType winnerSplitCriterionValue = 0;
+        localTLS.reduce([&](Local * v) -> void
+        {
+            if (!v) { return; }
+            if ((!v->winnerIsLeaf) && (!found || v->winnerSplitCriterionValue < winnerSplitCriterionValue ||
+                                       (SplitCriterionMath::sFabs(winnerSplitCriterionValue - v->winnerSplitCriterionValue) <= epsilon &&
+                                        winner.featureIndex > v->winner.featureIndex)))
+            {
+                found = true;
+                winner = v->winner;
+                winnerSplitCriterionValue = v->winnerSplitCriterionValue;
+            }
+            delete v;
+        });
+        return safeStat.detach();
+    }
+
+private:
+    TreeType & _tree;
+    SplitCriterion & _splitCriterion;
+    const Histogram & _histogram;
+    const DataType & _data;
+    const FeatureTypesCache & _featureTypesCache;
+    const DependentVariable * _y;
+    const size_t _minLeafSize;
+    const size_t _minSplitSize;
+    const size_t _nFeatures;
+    const size_t _featureHistSize;
+    const size_t _histSize;
+};
+
+} // namespace internal
+} // namespace decision_tree
+} // namespace algorithms
+} // namespace daal
+
+#endif
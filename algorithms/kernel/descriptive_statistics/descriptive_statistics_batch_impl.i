@@ -0,0 +1,150 @@
+/* file: descriptive_statistics_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm in the batch processing mode
+//--
+*/
+
+#ifndef __DESCRIPTIVE_STATISTICS_BATCH_IMPL_I__
+#define __DESCRIPTIVE_STATISTICS_BATCH_IMPL_I__
+
+#include "descriptive_statistics_impl.i"
+#include "quantiles_kernel.h"
+#include "sorting_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+namespace internal
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DescriptiveStatisticsBatchKernel<algorithmFPType, method, cpu>::compute(
+    NumericTable *dataTable, Result *result, const Parameter *parameter)
+{
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const DAAL_UINT64 statisticsToCompute = parameter->statisticsToCompute;
+
+    services::Status s;
+
+    /* The moments accumulators write minimum, maximum and sums straight into the final result */
+    low_order_moments::PartialResultPtr momentsPartialResult;
+    if (statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::Result *momentsResult = result->get(lowOrderMomentsResult).get();
+        momentsPartialResult.reset(new low_order_moments::PartialResult());
+        DAAL_CHECK_MALLOC(momentsPartialResult.get());
+
+        momentsPartialResult->set(low_order_moments::nObservations, HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, 1, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        momentsPartialResult->set(low_order_moments::partialMinimum,            momentsResult->get(low_order_moments::minimum));
+        momentsPartialResult->set(low_order_moments::partialMaximum,            momentsResult->get(low_order_moments::maximum));
+        momentsPartialResult->set(low_order_moments::partialSum,                momentsResult->get(low_order_moments::sum));
+        momentsPartialResult->set(low_order_moments::partialSumSquares,         momentsResult->get(low_order_moments::sumSquares));
+        momentsPartialResult->set(low_order_moments::partialSumSquaresCentered, momentsResult->get(low_order_moments::sumSquaresCentered));
+    }
+
+    covariance::PartialResultPtr covPartialResult;
+    if (statisticsToCompute & covarianceMatrix)
+    {
+        covPartialResult.reset(new covariance::PartialResult());
+        DAAL_CHECK_MALLOC(covPartialResult.get());
+
+        covPartialResult->set(covariance::nObservations, HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, 1, &s));
+        covPartialResult->set(covariance::crossProduct,  HomogenNumericTableCPU<algorithmFPType, cpu>::create(nFeatures, nFeatures, &s));
+        covPartialResult->set(covariance::sum,           HomogenNumericTableCPU<algorithmFPType, cpu>::create(nFeatures, 1, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::nObservations)->assign((algorithmFPType)0.0));
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::crossProduct)->assign((algorithmFPType)0.0));
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::sum)->assign((algorithmFPType)0.0));
+    }
+
+    /* Quantiles and sorting need all observations, so the scan keeps one converted copy of the data for them */
+    const bool computeOrderStatistics = (statisticsToCompute & (quantileEstimates | sortedObservations)) != 0;
+    TArray<algorithmFPType, cpu> convertedDataArray(computeOrderStatistics ? nVectors * nFeatures : 0);
+    if (computeOrderStatistics)
+    {
+        DAAL_CHECK_MALLOC(convertedDataArray.get());
+    }
+
+    DAAL_CHECK_STATUS(s, (scanData<algorithmFPType, cpu>(dataTable, momentsPartialResult.get(), false,
+                                                         covPartialResult.get(), convertedDataArray.get())));
+
+    DAAL_CHECK_STATUS(s, (finalizeMomentsAndCovariance<algorithmFPType, cpu>(momentsPartialResult.get(), covPartialResult.get(),
+                                                                             result, parameter)));
+
+    if (!computeOrderStatistics)
+    {
+        return s;
+    }
+
+    NumericTablePtr convertedDataTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(convertedDataArray.get(), nFeatures, nVectors, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    if (statisticsToCompute & quantileEstimates)
+    {
+        quantiles::internal::QuantilesKernel<quantiles::defaultDense, algorithmFPType, cpu> quantilesKernel;
+        NumericTable *quantilesTable = result->get(quantilesResult)->get(quantiles::quantiles).get();
+        DAAL_CHECK_STATUS(s, quantilesKernel.compute(*convertedDataTable, *parameter->quantileOrders, *quantilesTable));
+    }
+
+    if (statisticsToCompute & sortedObservations)
+    {
+        sorting::internal::SortingKernel<sorting::defaultDense, algorithmFPType, cpu> sortingKernel;
+        NumericTable *sortedDataTable = result->get(sortingResult)->get(sorting::sortedData).get();
+        DAAL_CHECK_STATUS(s, sortingKernel.compute(*convertedDataTable, *sortedDataTable));
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
+
+#endif
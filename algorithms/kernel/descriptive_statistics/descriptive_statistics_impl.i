@@ -0,0 +1,239 @@
+/* file: descriptive_statistics_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the descriptive statistics algorithm: the blocked scan
+//  that feeds the low order moments and covariance accumulators and the
+//  finalization of their partial results
+//--
+*/
+
+#ifndef __DESCRIPTIVE_STATISTICS_IMPL_I__
+#define __DESCRIPTIVE_STATISTICS_IMPL_I__
+
+#include "descriptive_statistics_kernel.h"
+#include "low_order_moments_kernel.h"
+#include "covariance_kernel.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+namespace internal
+{
+
+/**
+ *  Returns the number of rows in one block of the data scan. A block of about 4 MB is small enough
+ *  to stay in cache between the moments and the covariance updates and large enough to amortize
+ *  the p x p cross-product merge the covariance kernel does once per block
+ */
+template<typename algorithmFPType>
+size_t getScanBlockSize(size_t nVectors, size_t nFeatures)
+{
+    const size_t blockSizeInBytes = 4 * 1024 * 1024;
+    const size_t minBlockSize     = 256;
+
+    size_t blockSize = blockSizeInBytes / (nFeatures * sizeof(algorithmFPType));
+    if (blockSize < minBlockSize) { blockSize = minBlockSize; }
+    if (blockSize > nVectors)     { blockSize = nVectors; }
+    return blockSize;
+}
+
+/**
+ *  Reads every block of rows of the data set once and passes it to the online kernels of the
+ *  low order moments and covariance algorithms. If convertedData is not null, the converted rows
+ *  are also kept there for the order statistics and the accumulators read them from that buffer
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status scanData(NumericTable *dataTable,
+                          low_order_moments::PartialResult *momentsPartialResult, bool isMomentsOnline,
+                          covariance::PartialResult *covPartialResult,
+                          algorithmFPType *convertedData)
+{
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t blockSize = getScanBlockSize<algorithmFPType>(nVectors, nFeatures);
+    const bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
+
+    const low_order_moments::Parameter momentsParameter(low_order_moments::estimatesAll);
+    const covariance::Parameter covParameter;
+    low_order_moments::internal::LowOrderMomentsOnlineKernel<algorithmFPType, low_order_moments::defaultDense, cpu> momentsKernel;
+    covariance::internal::CovarianceDenseOnlineKernel<algorithmFPType, covariance::defaultDense, cpu> covKernel;
+
+    NumericTable *covNObservationsTable = nullptr;
+    NumericTable *crossProductTable     = nullptr;
+    NumericTable *covSumTable           = nullptr;
+    if (covPartialResult)
+    {
+        covNObservationsTable = covPartialResult->get(covariance::nObservations).get();
+        crossProductTable     = covPartialResult->get(covariance::crossProduct).get();
+        covSumTable           = covPartialResult->get(covariance::sum).get();
+    }
+
+    services::Status s;
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > blockTable;
+    ReadRows<algorithmFPType, cpu> dataRows(dataTable);
+
+    for (size_t startRow = 0; startRow < nVectors; startRow += blockSize)
+    {
+        const size_t nRows = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        const algorithmFPType *dataBlock = dataRows.next(startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+        algorithmFPType *block = const_cast<algorithmFPType *>(dataBlock);
+        if (convertedData)
+        {
+            block = convertedData + startRow * nFeatures;
+            const size_t blockSizeInBytes = nRows * nFeatures * sizeof(algorithmFPType);
+            daal_memcpy_s(block, blockSizeInBytes, dataBlock, blockSizeInBytes);
+        }
+
+        if (!blockTable)
+        {
+            blockTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(block, nFeatures, nRows, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            if (isNormalized)
+            {
+                blockTable->setNormalizationFlag(NumericTableIface::standardScoreNormalized);
+            }
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, blockTable->setArray(block, nRows));
+        }
+
+        if (momentsPartialResult)
+        {
+            DAAL_CHECK_STATUS(s, momentsKernel.compute(blockTable.get(), momentsPartialResult, &momentsParameter,
+                                                       isMomentsOnline || startRow > 0));
+        }
+        if (covPartialResult)
+        {
+            DAAL_CHECK_STATUS(s, covKernel.compute(blockTable.get(), covNObservationsTable, crossProductTable, covSumTable, &covParameter));
+        }
+    }
+    return s;
+}
+
+/**
+ *  Computes the final low order moments and covariance results from the partial results
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status finalizeMomentsAndCovariance(low_order_moments::PartialResult *momentsPartialResult,
+                                              covariance::PartialResult *covPartialResult,
+                                              Result *result, const Parameter *parameter)
+{
+    services::Status s;
+    if (momentsPartialResult)
+    {
+        const low_order_moments::Parameter momentsParameter(low_order_moments::estimatesAll);
+        low_order_moments::internal::LowOrderMomentsOnlineKernel<algorithmFPType, low_order_moments::defaultDense, cpu> momentsKernel;
+
+        low_order_moments::Result *momentsResult = result->get(lowOrderMomentsResult).get();
+        DAAL_CHECK_STATUS(s, momentsKernel.finalizeCompute(
+            momentsPartialResult->get(low_order_moments::nObservations).get(),
+            momentsPartialResult->get(low_order_moments::partialSum).get(),
+            momentsPartialResult->get(low_order_moments::partialSumSquares).get(),
+            momentsPartialResult->get(low_order_moments::partialSumSquaresCentered).get(),
+            momentsResult->get(low_order_moments::mean).get(),
+            momentsResult->get(low_order_moments::secondOrderRawMoment).get(),
+            momentsResult->get(low_order_moments::variance).get(),
+            momentsResult->get(low_order_moments::standardDeviation).get(),
+            momentsResult->get(low_order_moments::variation).get(),
+            &momentsParameter));
+
+        momentsResult->set(low_order_moments::minimum,            momentsPartialResult->get(low_order_moments::partialMinimum));
+        momentsResult->set(low_order_moments::maximum,            momentsPartialResult->get(low_order_moments::partialMaximum));
+        momentsResult->set(low_order_moments::sum,                momentsPartialResult->get(low_order_moments::partialSum));
+        momentsResult->set(low_order_moments::sumSquares,         momentsPartialResult->get(low_order_moments::partialSumSquares));
+        momentsResult->set(low_order_moments::sumSquaresCentered, momentsPartialResult->get(low_order_moments::partialSumSquaresCentered));
+    }
+
+    if (covPartialResult)
+    {
+        covariance::Parameter covParameter;
+        covParameter.outputMatrixType = parameter->outputMatrixType;
+        covariance::internal::CovarianceDenseOnlineKernel<algorithmFPType, covariance::defaultDense, cpu> covKernel;
+
+        covariance::Result *covResult = result->get(covarianceResult).get();
+        DAAL_CHECK_STATUS(s, covKernel.finalizeCompute(
+            covPartialResult->get(covariance::nObservations).get(),
+            covPartialResult->get(covariance::crossProduct).get(),
+            covPartialResult->get(covariance::sum).get(),
+            covResult->get(covariance::covariance).get(),
+            covResult->get(covariance::mean).get(),
+            &covParameter));
+    }
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status finalizePartialResult(PartialResult *partialResult, Result *result, const Parameter *parameter)
+{
+    low_order_moments::PartialResult *momentsPartialResult = nullptr;
+    covariance::PartialResult *covPartialResult = nullptr;
+    if (parameter->statisticsToCompute & lowOrderMoments)
+    {
+        momentsPartialResult = partialResult->get(lowOrderMomentsPartialResult).get();
+    }
+    if (parameter->statisticsToCompute & covarianceMatrix)
+    {
+        covPartialResult = partialResult->get(covariancePartialResult).get();
+    }
+    return finalizeMomentsAndCovariance<algorithmFPType, cpu>(momentsPartialResult, covPartialResult, result, parameter);
+}
+
+} // namespace internal
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,198 @@
+/* file: descriptive_statistics_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm input and parameter classes.
+//--
+*/
+
+#include "algorithms/descriptive_statistics/descriptive_statistics_types.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+namespace interface1
+{
+
+Parameter::Parameter(DAAL_UINT64 statisticsToCompute) :
+    daal::algorithms::Parameter(), statisticsToCompute(statisticsToCompute),
+    outputMatrixType(covariance::covarianceMatrix)
+{
+    Status s;
+    quantileOrders = HomogenNumericTable<double>::create(1, 1, NumericTableIface::doAllocate, 0.5, &s);
+}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(statisticsToCompute != 0 && (statisticsToCompute & ~(DAAL_UINT64)allStatistics) == 0,
+        ErrorIncorrectParameter, ParameterName, statisticsToComputeStr());
+    if(statisticsToCompute & quantileEstimates)
+    {
+        return checkNumericTable(quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
+    }
+    return Status();
+}
+
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input& other) : InputIface(other) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \param[out] nCols Number of columns in the input data set
+ * \return Status of the call
+ */
+Status Input::getNumberOfColumns(size_t& nCols) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s = checkNumericTable(dataTable.get(), dataStr());
+    nCols = (s ? dataTable->getNumberOfColumns() : 0);
+    return s;
+}
+
+/**
+ * Returns the input object for the descriptive statistics algorithm
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input object for the descriptive statistics algorithm
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the %Input object
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    return checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts);
+}
+
+template<>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template<>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master>& other) : InputIface(other) {}
+
+template<>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+template<>
+Status DistributedInput<step2Master>::getNumberOfColumns(size_t& nCols) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    DAAL_CHECK(collection->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+    return partialResult->getNumberOfColumns(nCols);
+}
+
+template<>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+template<>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+template<>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks != 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, partialResult->check(parameter, method));
+
+        size_t nCols = 0;
+        DAAL_CHECK_STATUS(s, partialResult->getNumberOfColumns(nCols));
+        DAAL_CHECK(nCols == nFeatures, ErrorIncorrectElementInPartialResultCollection);
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
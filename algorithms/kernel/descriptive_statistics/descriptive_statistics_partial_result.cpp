@@ -0,0 +1,185 @@
+/* file: descriptive_statistics_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm partial result class.
+//--
+*/
+
+#include "algorithms/descriptive_statistics/descriptive_statistics_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_DESCRIPTIVE_STATISTICS_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Gets the number of columns in the partial result of the descriptive statistics algorithm
+ * \param[out] nCols Number of columns
+ * \return Status of the call
+ */
+Status PartialResult::getNumberOfColumns(size_t& nCols) const
+{
+    low_order_moments::PartialResultPtr momentsPartialResult = get(lowOrderMomentsPartialResult);
+    if(momentsPartialResult)
+    {
+        return momentsPartialResult->getNumberOfColumns(nCols);
+    }
+
+    covariance::PartialResultPtr covPartialResult = get(covariancePartialResult);
+    DAAL_CHECK_EX(covPartialResult, ErrorNullPartialResult, ArgumentName, covariancePartialResultStr());
+    nCols = covPartialResult->getNumberOfFeatures();
+    return Status();
+}
+
+/**
+ * Returns the partial result of the low order %moments algorithm
+ * \param[in] id   Identifier of the partial result, \ref LowOrderMomentsPartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+low_order_moments::PartialResultPtr PartialResult::get(LowOrderMomentsPartialResultId id) const
+{
+    return staticPointerCast<low_order_moments::PartialResult, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the partial result of the covariance algorithm
+ * \param[in] id   Identifier of the partial result, \ref CovariancePartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+covariance::PartialResultPtr PartialResult::get(CovariancePartialResultId id) const
+{
+    return staticPointerCast<covariance::PartialResult, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the low order %moments algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(LowOrderMomentsPartialResultId id, const low_order_moments::PartialResultPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the partial result of the covariance algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(CovariancePartialResultId id, const covariance::PartialResultPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks correctness of the partial result
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+/**
+ * Checks the correctness of partial result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *parameter) const
+{
+    Status s;
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    /* Quantiles and sorted observations need the whole data set and cannot be merged from partial results */
+    DAAL_CHECK_EX(!(par->statisticsToCompute & (quantileEstimates | sortedObservations)),
+        ErrorIncorrectParameter, ParameterName, statisticsToComputeStr());
+
+    if(par->statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::PartialResultPtr momentsPartialResult = get(lowOrderMomentsPartialResult);
+        DAAL_CHECK_EX(momentsPartialResult, ErrorNullPartialResult, ArgumentName, lowOrderMomentsPartialResultStr());
+        DAAL_CHECK_STATUS(s, momentsPartialResult->check(parameter, 0));
+
+        size_t nCols = 0;
+        DAAL_CHECK_STATUS(s, momentsPartialResult->getNumberOfColumns(nCols));
+        DAAL_CHECK_EX(nCols == nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, lowOrderMomentsPartialResultStr());
+    }
+    if(par->statisticsToCompute & covarianceMatrix)
+    {
+        covariance::PartialResultPtr covPartialResult = get(covariancePartialResult);
+        DAAL_CHECK_EX(covPartialResult, ErrorNullPartialResult, ArgumentName, covariancePartialResultStr());
+        DAAL_CHECK_STATUS(s, covPartialResult->check(parameter, 0));
+        DAAL_CHECK_EX(covPartialResult->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, covariancePartialResultStr());
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
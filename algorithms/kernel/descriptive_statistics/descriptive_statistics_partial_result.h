@@ -0,0 +1,164 @@
+/* file: descriptive_statistics_partial_result.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm partial result methods
+//--
+*/
+
+#ifndef __DESCRIPTIVE_STATISTICS_PARTIAL_RESULT_
+#define __DESCRIPTIVE_STATISTICS_PARTIAL_RESULT_
+
+#include "descriptive_statistics_types.h"
+#include "service_numeric_table.h"
+
+using namespace daal::internal;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+
+/**
+ * Allocates memory to store partial results of the descriptive statistics algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    services::Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+
+    if(par->statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::PartialResultPtr momentsPartialResult(new low_order_moments::PartialResult());
+        DAAL_CHECK_MALLOC(momentsPartialResult.get());
+
+        momentsPartialResult->set(low_order_moments::nObservations,
+            HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+        for(size_t i = low_order_moments::partialMinimum; i < low_order_moments::lastPartialResultId + 1; i++)
+        {
+            momentsPartialResult->set((low_order_moments::PartialResultId)i,
+                HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        }
+        set(lowOrderMomentsPartialResult, momentsPartialResult);
+    }
+
+    if(par->statisticsToCompute & covarianceMatrix)
+    {
+        covariance::PartialResultPtr covPartialResult(new covariance::PartialResult());
+        DAAL_CHECK_MALLOC(covPartialResult.get());
+
+        covPartialResult->set(covariance::nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+        covPartialResult->set(covariance::crossProduct,
+            HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+        covPartialResult->set(covariance::sum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        set(covariancePartialResult, covPartialResult);
+    }
+    return s;
+}
+
+/**
+ * Initializes partial results of the descriptive statistics algorithm: sums and cross-products are set to zero,
+ * minimum and maximum are set to the first observation of the input data set
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    NumericTable *dataTable = static_cast<const Input *>(input)->get(data).get();
+
+    services::Status s;
+    if(par->statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::PartialResultPtr momentsPartialResult = get(lowOrderMomentsPartialResult);
+        DAAL_CHECK_STATUS(s, momentsPartialResult->get(low_order_moments::nObservations)->assign((algorithmFPType)0.0))
+        DAAL_CHECK_STATUS(s, momentsPartialResult->get(low_order_moments::partialSum)->assign((algorithmFPType)0.0))
+        DAAL_CHECK_STATUS(s, momentsPartialResult->get(low_order_moments::partialSumSquares)->assign((algorithmFPType)0.0))
+        DAAL_CHECK_STATUS(s, momentsPartialResult->get(low_order_moments::partialSumSquaresCentered)->assign((algorithmFPType)0.0))
+
+        const size_t nFeatures = dataTable->getNumberOfColumns();
+
+        ReadRows<algorithmFPType, sse2> dataBlock(dataTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock)
+        const algorithmFPType *firstRow = dataBlock.get();
+
+        WriteOnlyRows<algorithmFPType, sse2> minimumBlock(momentsPartialResult->get(low_order_moments::partialMinimum).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+        WriteOnlyRows<algorithmFPType, sse2> maximumBlock(momentsPartialResult->get(low_order_moments::partialMaximum).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+        algorithmFPType *minimum = minimumBlock.get();
+        algorithmFPType *maximum = maximumBlock.get();
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            minimum[j] = firstRow[j];
+            maximum[j] = firstRow[j];
+        }
+    }
+
+    if(par->statisticsToCompute & covarianceMatrix)
+    {
+        covariance::PartialResultPtr covPartialResult = get(covariancePartialResult);
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::nObservations)->assign((algorithmFPType)0.0))
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::crossProduct)->assign((algorithmFPType)0.0))
+        DAAL_CHECK_STATUS(s, covPartialResult->get(covariance::sum)->assign((algorithmFPType)0.0))
+    }
+    return s;
+}
+
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
+
+#endif
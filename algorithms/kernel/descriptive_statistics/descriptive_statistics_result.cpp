@@ -0,0 +1,211 @@
+/* file: descriptive_statistics_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm result class.
+//--
+*/
+
+#include "algorithms/descriptive_statistics/descriptive_statistics_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_DESCRIPTIVE_STATISTICS_RESULT_ID);
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the low order %moments algorithm
+ * \param[in] id   Identifier of the result, \ref LowOrderMomentsResultId
+ * \return         Result that corresponds to the given identifier
+ */
+low_order_moments::ResultPtr Result::get(LowOrderMomentsResultId id) const
+{
+    return staticPointerCast<low_order_moments::Result, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the result of the covariance algorithm
+ * \param[in] id   Identifier of the result, \ref CovarianceResultId
+ * \return         Result that corresponds to the given identifier
+ */
+covariance::ResultPtr Result::get(CovarianceResultId id) const
+{
+    return staticPointerCast<covariance::Result, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the result of the quantiles algorithm
+ * \param[in] id   Identifier of the result, \ref QuantilesResultId
+ * \return         Result that corresponds to the given identifier
+ */
+quantiles::ResultPtr Result::get(QuantilesResultId id) const
+{
+    return staticPointerCast<quantiles::Result, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the result of the sorting algorithm
+ * \param[in] id   Identifier of the result, \ref SortingResultId
+ * \return         Result that corresponds to the given identifier
+ */
+sorting::ResultPtr Result::get(SortingResultId id) const
+{
+    return staticPointerCast<sorting::Result, SerializationIface>(Argument::get(id));
+}
+
+void Result::set(LowOrderMomentsResultId id, const low_order_moments::ResultPtr &value)
+{
+    Argument::set(id, value);
+}
+
+void Result::set(CovarianceResultId id, const covariance::ResultPtr &value)
+{
+    Argument::set(id, value);
+}
+
+void Result::set(QuantilesResultId id, const quantiles::ResultPtr &value)
+{
+    Argument::set(id, value);
+}
+
+void Result::set(SortingResultId id, const sorting::ResultPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of result
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           %Parameter of the algorithm
+ * \param[in] method        Computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK_EX(!(parameter->statisticsToCompute & (quantileEstimates | sortedObservations)),
+        ErrorIncorrectParameter, ParameterName, statisticsToComputeStr());
+
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, 0, par);
+}
+
+/**
+ * Checks the correctness of result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] par       Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    NumericTablePtr dataTable = static_cast<const Input *>(input)->get(data);
+    return checkImpl(dataTable->getNumberOfColumns(), dataTable->getNumberOfRows(), par);
+}
+
+Status Result::checkImpl(size_t nFeatures, size_t nVectors, const daal::algorithms::Parameter *par) const
+{
+    Status s;
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const DAAL_UINT64 statisticsToCompute = parameter->statisticsToCompute;
+
+    const int packedLayouts = (int)packed_mask;
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray | packedLayouts;
+
+    if(statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::ResultPtr momentsResult = get(lowOrderMomentsResult);
+        DAAL_CHECK_EX(momentsResult, ErrorNullResult, ArgumentName, lowOrderMomentsResultStr());
+
+        const char* errorMessages[] = {minimumStr(), maximumStr(), sumStr(), sumSquaresStr(), sumSquaresCenteredStr(), meanStr(),
+            secondOrderRawMomentStr(), varianceStr(), standardDeviationStr(), variationStr() };
+
+        for(size_t i = 0; i < low_order_moments::lastResultId + 1; i++)
+        {
+            DAAL_CHECK_STATUS(s, checkNumericTable(momentsResult->get((low_order_moments::ResultId)i).get(), errorMessages[i],
+                packedLayouts, 0, nFeatures, 1));
+        }
+    }
+
+    if(statisticsToCompute & covarianceMatrix)
+    {
+        covariance::ResultPtr covResult = get(covarianceResult);
+        DAAL_CHECK_EX(covResult, ErrorNullResult, ArgumentName, covarianceResultStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(covResult->get(covariance::covariance).get(), covarianceStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(covResult->get(covariance::mean).get(), meanStr(), unexpectedLayouts, 0, nFeatures, 1));
+    }
+
+    if(statisticsToCompute & quantileEstimates)
+    {
+        quantiles::ResultPtr quantilesRes = get(quantilesResult);
+        DAAL_CHECK_EX(quantilesRes, ErrorNullResult, ArgumentName, quantilesResultStr());
+        const size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
+        DAAL_CHECK_STATUS(s, checkNumericTable(quantilesRes->get(quantiles::quantiles).get(), quantilesStr(), unexpectedLayouts, 0,
+            nQuantileOrders, nFeatures));
+    }
+
+    if(statisticsToCompute & sortedObservations)
+    {
+        sorting::ResultPtr sortingRes = get(sortingResult);
+        DAAL_CHECK_EX(sortingRes, ErrorNullResult, ArgumentName, sortingResultStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(sortingRes->get(sorting::sortedData).get(), sortedDataStr(), unexpectedLayouts, 0,
+            nFeatures, nVectors));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,145 @@
+/* file: descriptive_statistics_result.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the descriptive statistics algorithm result methods
+//--
+*/
+
+#ifndef __DESCRIPTIVE_STATISTICS_RESULT_
+#define __DESCRIPTIVE_STATISTICS_RESULT_
+
+#include "descriptive_statistics_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace descriptive_statistics
+{
+
+template <typename algorithmFPType>
+static services::Status allocateMomentsAndCovariance(Result *result, const Parameter *par, size_t nFeatures)
+{
+    services::Status s;
+    if(par->statisticsToCompute & lowOrderMoments)
+    {
+        low_order_moments::ResultPtr momentsResult(new low_order_moments::Result());
+        DAAL_CHECK_MALLOC(momentsResult.get());
+        for(size_t i = 0; i < low_order_moments::lastResultId + 1; i++)
+        {
+            momentsResult->set((low_order_moments::ResultId)i,
+                HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        }
+        result->set(lowOrderMomentsResult, momentsResult);
+    }
+
+    if(par->statisticsToCompute & covarianceMatrix)
+    {
+        covariance::ResultPtr covResult(new covariance::Result());
+        DAAL_CHECK_MALLOC(covResult.get());
+        covResult->set(covariance::covariance, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+        covResult->set(covariance::mean, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        result->set(covarianceResult, covResult);
+    }
+    return s;
+}
+
+/**
+ * Allocates memory for storing final results of the descriptive statistics algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    NumericTablePtr dataTable = static_cast<const Input *>(input)->get(data);
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    services::Status s = allocateMomentsAndCovariance<algorithmFPType>(this, par, nFeatures);
+
+    if(par->statisticsToCompute & quantileEstimates)
+    {
+        quantiles::ResultPtr quantilesRes(new quantiles::Result());
+        DAAL_CHECK_MALLOC(quantilesRes.get());
+        const size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+        quantilesRes->set(quantiles::quantiles,
+            HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, NumericTable::doAllocate, &s));
+        set(quantilesResult, quantilesRes);
+    }
+
+    if(par->statisticsToCompute & sortedObservations)
+    {
+        sorting::ResultPtr sortingRes(new sorting::Result());
+        DAAL_CHECK_MALLOC(sortingRes.get());
+        sortingRes->set(sorting::sortedData, HomogenNumericTable<algorithmFPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &s));
+        set(sortingResult, sortingRes);
+    }
+    return s;
+}
+
+/**
+ * Allocates memory for storing final results of the descriptive statistics algorithm
+ * \param[in] partialResult     Pointer to the structure with partial result objects
+ * \param[in] parameter         Pointer to the structure of algorithm parameters
+ * \param[in] method            Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    return allocateMomentsAndCovariance<algorithmFPType>(this, static_cast<const Parameter *>(parameter), nFeatures);
+}
+
+} // namespace descriptive_statistics
+} // namespace algorithms
+} // namespace daal
+
+#endif
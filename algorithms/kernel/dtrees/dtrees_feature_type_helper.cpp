@@ -63,7 +63,30 @@ SortedFeaturesHelper::~SortedFeaturesHelper()
 
 services::Status SortedFeaturesHelper::alloc(size_t nC, size_t nR)
 {
-    const size_t newCapacity = nC*(nR + 1);
+    services::Status s = reserve(nC*(nR + 1));
+    if(!s)
+        return s;
+    _nCols = nC;
+    _nRows = nR;
+    _bSparse = false;
+    _nNonZeros = 0;
+    return s;
+}
+
+services::Status SortedFeaturesHelper::allocSparse(size_t nC, size_t nR, size_t nNonZeros)
+{
+    services::Status s = reserve(3*nC + 1 + 2*nNonZeros);
+    if(!s)
+        return s;
+    _nCols = nC;
+    _nRows = nR;
+    _bSparse = true;
+    _nNonZeros = nNonZeros;
+    return s;
+}
+
+services::Status SortedFeaturesHelper::reserve(size_t newCapacity)
+{
     if(_data)
     {
         if(newCapacity > _capacity)
@@ -82,8 +105,6 @@ services::Status SortedFeaturesHelper::alloc(size_t nC, size_t nR)
         DAAL_CHECK_MALLOC(_data);
         _capacity = newCapacity;
     }
-    _nCols = nC;
-    _nRows = nR;
     return services::Status();
 }
 
@@ -60,6 +60,50 @@ namespace dtrees
 namespace internal
 {
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Returns the value of the feature of an observation stored in CSR format.
+// Column indices of the observation are one-based and sorted in increasing order,
+// the features that are not stored are zeros
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+inline algorithmFPType getSparseFeatureValue(const algorithmFPType* values, const size_t* cols, size_t nValues, size_t iFeature)
+{
+    const size_t key = iFeature + 1;
+    size_t left = 0;
+    size_t right = nValues;
+    while(left < right)
+    {
+        const size_t mid = left + (right - left) / 2;
+        if(cols[mid] < key)
+            left = mid + 1;
+        else
+            right = mid;
+    }
+    return ((left < nValues) && (cols[left] == key)) ? values[left] : algorithmFPType(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// SparseFeatureRow, provides access to the features of an observation stored in
+// the sparse (CSR) format. Observations in the dense format are accessed by pointer
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+class SparseFeatureRow
+{
+public:
+    SparseFeatureRow(const algorithmFPType* values, const size_t* cols, size_t nValues) :
+        _values(values), _cols(cols), _nValues(nValues){}
+
+    algorithmFPType operator[](size_t iFeature) const
+    {
+        return getSparseFeatureValue<algorithmFPType>(_values, _cols, _nValues, iFeature);
+    }
+
+private:
+    const algorithmFPType* _values;
+    const size_t* _cols;
+    size_t _nValues;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // FeatureTypeHelper, provides optimal access to the feature types
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -126,13 +170,17 @@ private:
 //////////////////////////////////////////////////////////////////////////////////////////
 // SortedFeaturesHelper. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
-// in the sorted array of unique values of the feature in increasing order
+// in the sorted array of unique values of the feature in increasing order.
+// The index of a sparse (CSR) numeric table keeps the nonzero values only: rows of the
+// nonzero values of every feature in increasing order of the values along with the indices
+// of the values. Zero has its own index, between the indices of negative and positive values
 //////////////////////////////////////////////////////////////////////////////////////////
 class SortedFeaturesHelper
 {
 public:
     typedef size_t IndexType;
-    SortedFeaturesHelper() : _data(nullptr), _nCols(0), _nRows(0), _capacity(0), _maxNumDiffValues(0){}
+    SortedFeaturesHelper() : _data(nullptr), _nCols(0), _nRows(0), _capacity(0), _maxNumDiffValues(0),
+        _bSparse(false), _nNonZeros(0){}
     ~SortedFeaturesHelper();
 
     template <typename algorithmFPType, CpuType cpu>
@@ -140,27 +188,49 @@ public:
 
     IndexType getMaxNumberOfDiffValues(size_t iCol) const
     {
-        return _data[iCol*(_nRows + 1)];
+        return _bSparse ? _data[2*_nCols + 1 + iCol] : _data[iCol*(_nRows + 1)];
     }
 
     //get number of different values for all features
     IndexType getMaxNumberOfDiffValues() const { return _maxNumDiffValues;  }
 
+    //number of entries of the index of the feature visited by the split search
+    IndexType getIndexSize(size_t iCol) const { return _bSparse ? nNonZeros(iCol) : getMaxNumberOfDiffValues(iCol); }
+
     //for low-level optimization
-    const IndexType* data(size_t iFeature) const { return _data + (_nRows + 1)*iFeature + 1; }
+    const IndexType* data(size_t iFeature) const { DAAL_ASSERT(!_bSparse); return _data + (_nRows + 1)*iFeature + 1; }
+
+    //sparse index only
+    bool isSparse() const { return _bSparse; }
+    IndexType nNonZeros(size_t iFeature) const { return _data[iFeature + 1] - _data[iFeature]; }
+    //rows of the nonzero values of the feature in increasing order of the values
+    const IndexType* nonZeroRows(size_t iFeature) const { return _data + 3*_nCols + 1 + _data[iFeature]; }
+    //indices of the nonzero values of the feature in the sorted array of its unique values
+    const IndexType* nonZeroData(size_t iFeature) const { return _data + 3*_nCols + 1 + _nNonZeros + _data[iFeature]; }
+    //index of zero in the sorted array of unique values of the feature
+    IndexType zeroIndex(size_t iFeature) const { return _data[_nCols + 1 + iFeature]; }
 
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
 protected:
     services::Status alloc(size_t nCols, size_t nRows);
+    services::Status allocSparse(size_t nCols, size_t nRows, size_t nNonZeros);
+    services::Status reserve(size_t capacity);
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status initSparse(const NumericTable& nt, CSRNumericTableIface& csr);
 
 protected:
+    //dense index: for every feature the number of its unique values followed by the indices of its values in all rows
+    //sparse index: offsets of the features in the arrays of nonzero values, indices of zero and numbers of unique values
+    //of the features followed by the rows and the indices of the nonzero values of all features
     IndexType* _data;
     size_t _nRows;
     size_t _nCols;
     size_t _capacity;
     size_t _maxNumDiffValues;
+    bool _bSparse;
+    size_t _nNonZeros;
 };
 
 } /* namespace internal */
@@ -124,6 +124,9 @@ template <typename algorithmFPType, CpuType cpu>
 services::Status SortedFeaturesHelper::init(const NumericTable& nt)
 {
     _maxNumDiffValues = 0;
+    CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(&nt));
+    if(csr)
+        return initSparse<algorithmFPType, cpu>(nt, *csr);
     services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows());
     if(!s)
         return s;
@@ -158,6 +161,96 @@ services::Status SortedFeaturesHelper::init(const NumericTable& nt)
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status SortedFeaturesHelper::initSparse(const NumericTable& nt, CSRNumericTableIface& csr)
+{
+    const size_t nC = nt.getNumberOfColumns();
+    const size_t nR = nt.getNumberOfRows();
+    daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(&csr, 0, nR);
+    DAAL_CHECK_BLOCK_STATUS(block);
+    const algorithmFPType* values = block.values();
+    const size_t* cols = block.cols();
+    const size_t* rowOffsets = block.rows();
+    const size_t nValues = rowOffsets[nR] - rowOffsets[0];
+
+    //zeros stored explicitly are not kept in the index
+    size_t nNonZeros = 0;
+    for(size_t i = 0; i < nValues; ++i)
+        nNonZeros += (values[i] != 0);
+    services::Status s = allocSparse(nC, nR, nNonZeros);
+    if(!s)
+        return s;
+
+    IndexType* colOffsets = _data;
+    for(size_t i = 0; i <= nC; ++i)
+        colOffsets[i] = 0;
+    for(size_t i = 0; i < nValues; ++i)
+    {
+        if(values[i] != 0)
+            ++colOffsets[cols[i]]; //column indices are one-based
+    }
+    for(size_t i = 1; i <= nC; ++i)
+        colOffsets[i] += colOffsets[i - 1];
+
+    //values of the features in the order of the index, they are sorted along with the rows below
+    daal::internal::TArray<algorithmFPType, cpu> aSortedValues(nNonZeros);
+    daal::internal::TArray<IndexType, cpu> aPos(nC);
+    DAAL_CHECK_MALLOC((aSortedValues.get() || !nNonZeros) && aPos.get());
+    algorithmFPType* sortedValues = aSortedValues.get();
+    IndexType* pos = aPos.get();
+    for(size_t i = 0; i < nC; ++i)
+        pos[i] = colOffsets[i];
+    IndexType* rows = _data + 3*nC + 1;
+    for(size_t iRow = 0; iRow < nR; ++iRow)
+    {
+        for(size_t i = rowOffsets[iRow] - 1; i < rowOffsets[iRow + 1] - 1; ++i)
+        {
+            if(values[i] == 0)
+                continue;
+            const size_t iPos = pos[cols[i] - 1]++;
+            rows[iPos] = iRow;
+            sortedValues[iPos] = values[i];
+        }
+    }
+
+    IndexType* zeroIdx = _data + nC + 1;
+    IndexType* nDiffValues = _data + 2*nC + 1;
+    IndexType* idx = rows + nNonZeros;
+    daal::threader_for(nC, nC, [&](size_t iCol)
+    {
+        const size_t iFirst = colOffsets[iCol];
+        const size_t n = colOffsets[iCol + 1] - iFirst;
+        algorithmFPType* featureVal = sortedValues + iFirst;
+        IndexType* featureIdx = idx + iFirst;
+        if(n > 1)
+            daal::algorithms::internal::qSort<algorithmFPType, IndexType, cpu>(n, featureVal, rows + iFirst);
+        //indices of unique values, zero index follows the indices of negative values
+        size_t iUnique = 0;
+        size_t i = 0;
+        for(; (i < n) && (featureVal[i] < 0); ++i)
+        {
+            if(i && (featureVal[i] != featureVal[i - 1]))
+                ++iUnique;
+            featureIdx[i] = iUnique;
+        }
+        zeroIdx[iCol] = (i ? iUnique + 1 : 0);
+        iUnique = zeroIdx[iCol];
+        for(size_t iStart = i; i < n; ++i)
+        {
+            if((i == iStart) || (featureVal[i] != featureVal[i - 1]))
+                ++iUnique;
+            featureIdx[i] = iUnique;
+        }
+        nDiffValues[iCol] = iUnique + 1;
+    });
+    for(size_t i = 0; i < nC; ++i)
+    {
+        if(_maxNumDiffValues < nDiffValues[i])
+            _maxNumDiffValues = nDiffValues[i];
+    }
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
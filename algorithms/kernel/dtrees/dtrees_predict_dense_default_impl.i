@@ -51,6 +51,7 @@
 
 #include "dtrees_model_impl.h"
 #include "service_data_utils.h"
+#include "service_numeric_table.h"
 #include "dtrees_feature_type_helper.h"
 
 using namespace daal::internal;
@@ -71,8 +72,8 @@ using namespace dtrees::internal;
 //////////////////////////////////////////////////////////////////////////////////////////
 // Common service function. Finds node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, typename TreeType, CpuType cpu>
-const typename TreeType::NodeType::Base* findNode(const dtrees::internal::Tree& t, const algorithmFPType* x)
+template <typename algorithmFPType, typename TreeType, CpuType cpu, typename FeatureRowType>
+const typename TreeType::NodeType::Base* findNode(const dtrees::internal::Tree& t, const FeatureRowType& x)
 {
     const TreeType& tree = static_cast<const TreeType&>(t);
     const typename TreeType::NodeType::Base* pNode = tree.top();
@@ -101,9 +102,9 @@ const typename TreeType::NodeType::Base* findNode(const dtrees::internal::Tree&
 //////////////////////////////////////////////////////////////////////////////////////////
 // Common service function. Finds a node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, typename TreeType, CpuType cpu>
+template <typename algorithmFPType, typename TreeType, CpuType cpu, typename FeatureRowType>
 const DecisionTreeNode* findNode(const dtrees::internal::DecisionTreeTable& t,
-    const FeatureTypeHelper<cpu>& featHelper, const algorithmFPType* x)
+    const FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x)
 {
     const DecisionTreeNode* aNode = (const DecisionTreeNode*)t.getArray();
     const DecisionTreeNode* pNode = aNode;
@@ -133,6 +134,65 @@ const DecisionTreeNode* findNode(const dtrees::internal::DecisionTreeTable& t,
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service class. Reads a block of observations. Sparse (CSR) numeric table
+// is read without conversion to the dense format. Callers choose the row accessor once
+// per observation, so that the tree traversal of dense data works on a plain pointer
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class ObservationsBlock
+{
+public:
+    ObservationsBlock(const NumericTable* data, size_t iStartRow, size_t nRows) :
+        _nCols(data->getNumberOfColumns()), _bSparse(false), _dense(nullptr), _values(nullptr), _cols(nullptr), _rows(nullptr)
+    {
+        CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(data));
+        if(csr)
+        {
+            _bSparse = true;
+            _sparseBD.set(csr, iStartRow, nRows);
+            _status = _sparseBD.status();
+            _values = _sparseBD.values();
+            _cols = _sparseBD.cols();
+            _rows = _sparseBD.rows();
+        }
+        else
+        {
+            _denseBD.set(const_cast<NumericTable*>(data), iStartRow, nRows);
+            _status = _denseBD.status();
+            _dense = _denseBD.get();
+        }
+    }
+
+    const services::Status& status() const { return _status; }
+
+    bool isSparse() const { return _bSparse; }
+
+    const algorithmFPType* denseRow(size_t iRow) const
+    {
+        DAAL_ASSERT(!_bSparse);
+        return _dense + iRow*_nCols;
+    }
+
+    SparseFeatureRow<algorithmFPType> sparseRow(size_t iRow) const
+    {
+        DAAL_ASSERT(_bSparse);
+        const size_t iFirst = _rows[iRow] - _rows[0];
+        return SparseFeatureRow<algorithmFPType>(_values + iFirst, _cols + iFirst, _rows[iRow + 1] - _rows[iRow]);
+    }
+
+private:
+    ReadRows<algorithmFPType, cpu> _denseBD;
+    ReadRowsCSR<algorithmFPType, cpu> _sparseBD;
+    services::Status _status;
+    const size_t _nCols;
+    bool _bSparse;
+    const algorithmFPType* _dense;
+    const algorithmFPType* _values;
+    const size_t* _cols;
+    const size_t* _rows;
+};
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace dtrees */
@@ -123,6 +123,42 @@ void shuffle(void* state, size_t n, IndexType* dst)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Service function, sorts feature values along with the given indices.
+// Zero values are gathered in one group first, so that only nonzero values are sorted.
+// Used for the sparse features, where most of the values are zeros, when the index of
+// sorted features is not available or the node is too small to use it
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename IndexType, CpuType cpu>
+void sortSparseFeatureValues(size_t n, algorithmFPType* featureVal, IndexType* aIdx)
+{
+    //three-way partition: negative values, zeros, positive values
+    size_t iNeg = 0;
+    size_t iPos = n;
+    for(size_t i = 0; i < iPos;)
+    {
+        if(featureVal[i] < 0)
+        {
+            daal::services::internal::swap<cpu, algorithmFPType>(featureVal[i], featureVal[iNeg]);
+            daal::services::internal::swap<cpu, IndexType>(aIdx[i], aIdx[iNeg]);
+            ++iNeg;
+            ++i;
+        }
+        else if(featureVal[i] > 0)
+        {
+            --iPos;
+            daal::services::internal::swap<cpu, algorithmFPType>(featureVal[i], featureVal[iPos]);
+            daal::services::internal::swap<cpu, IndexType>(aIdx[i], aIdx[iPos]);
+        }
+        else
+            ++i;
+    }
+    if(iNeg > 1)
+        daal::algorithms::internal::qSort<algorithmFPType, IndexType, cpu>(iNeg, featureVal, aIdx);
+    if(n - iPos > 1)
+        daal::algorithms::internal::qSort<algorithmFPType, IndexType, cpu>(n - iPos, featureVal + iPos, aIdx + iPos);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Service structure, keeps response-dependent split data
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +195,10 @@ struct SResponse
 //////////////////////////////////////////////////////////////////////////////////////////
 // DataHelper. Base class for response-specific services classes.
 // Keeps indices of the bootstrap samples and provides optimal access to columns in case
-// of homogenious numeric table
+// of homogenious numeric table. Sparse (CSR) numeric table is accessed by rows without
+// conversion to the dense format. With the sparse index of sorted features it also keeps
+// the node every row belongs to, so that only the nonzero values of the feature are
+// visited by the split search in the node
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, typename TResponse, CpuType cpu>
 class DataHelper
@@ -169,8 +208,12 @@ public:
 
 public:
     DataHelper(const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper):
-        _sortedFeatHelper(sortedFeatHelper), _data(nullptr), _dataDirect(nullptr), _nCols(0){}
+        _sortedFeatHelper(sortedFeatHelper), _data(nullptr), _dataDirect(nullptr), _nCols(0),
+        _csrValues(nullptr), _csrCols(nullptr), _csrRows(nullptr){}
     const NumericTable* data() const { return _data; }
+    bool isSparse() const { return _csrRows != nullptr; }
+    bool hasSortedFeatures() const { return _sortedFeatHelper != nullptr; }
+    bool hasSparseSortedFeatures() const { return _sortedFeatHelper && _sortedFeatHelper->isSparse(); }
     size_t size() const { return _aResponse.size(); }
     TResponse response(size_t i) const { return _aResponse[i].val; }
     const Response* responses() const { return _aResponse.get(); }
@@ -187,6 +230,8 @@ public:
         _nCols = data->getNumberOfColumns();
         const HomogenNumericTable<algorithmFPType>* hmg = dynamic_cast<const HomogenNumericTable<algorithmFPType>*>(data);
         _dataDirect = (hmg ? hmg->getArray() : nullptr);
+        if(!_dataDirect && !initSparse())
+            return false;
         const IndexType firstRow = aSample[0];
         const IndexType lastRow = aSample[_aResponse.size() - 1];
         ReadRows<algorithmFPType, cpu> bd(const_cast<NumericTable*>(resp), firstRow, lastRow - firstRow + 1);
@@ -195,13 +240,15 @@ public:
             _aResponse[i].idx = aSample[i];
             _aResponse[i].val = TResponse(bd.get()[aSample[i] - firstRow]);
         }
-        return true;
+        return !hasSparseSortedFeatures() || initRows();
     }
 
     algorithmFPType getValue(size_t iCol, size_t iRow) const
     {
         if(_dataDirect)
             return _dataDirect[iRow*_nCols + iCol];
+        if(_csrRows)
+            return getSparseValue(iCol, iRow);
 
         data_management::BlockDescriptor<algorithmFPType> bd;
         _data->getBlockOfColumnValues(iCol, iRow, 1, readOnly, bd);
@@ -220,6 +267,13 @@ public:
                 aVal[i] = _dataDirect[iRow*_nCols + iCol];
             }
         }
+        else if(_csrRows)
+        {
+            //every value is looked up by binary search in the column indices of its row,
+            //used when the sparse index of sorted features is not available or the node is small
+            for(size_t i = 0; i < n; ++i)
+                aVal[i] = getSparseValue(iCol, getObsIdx(aIdx[i]));
+        }
         else
         {
             data_management::BlockDescriptor<algorithmFPType> bd;
@@ -271,6 +325,8 @@ public:
 
     bool hasDiffFeatureValues(IndexType iFeature, const IndexType* aIdx, size_t n) const
     {
+        if(hasSparseSortedFeatures())
+            return true; //checked by the split search on the nonzero values
         const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->sortedFeatures().data(iFeature);
         const auto aResponse = this->_aResponse.get();
         const SortedFeaturesHelper::IndexType idx0 = sortedFeaturesIdx[aResponse[aIdx[0]].idx];
@@ -287,15 +343,137 @@ public:
         return (i != n);
     }
 
+    //returns the mapping: row -> index of the feature value in the sorted array of unique values of the feature.
+    //In case of the sparse index it is filled for the rows of the node of the given samples only
+    const SortedFeaturesHelper::IndexType* featureIndex(IndexType iFeature, const IndexType* aIdx, size_t n) const
+    {
+        if(!hasSparseSortedFeatures())
+            return sortedFeatures().data(iFeature);
+        SortedFeaturesHelper::IndexType* res = _aRowFeatureIdx.get();
+        const SortedFeaturesHelper::IndexType zeroIdx = sortedFeatures().zeroIndex(iFeature);
+        for(size_t i = 0; i < n; ++i)
+            res[getObsIdx(aIdx[i])] = zeroIdx;
+        const IndexType iNode = _aRowNode[getObsIdx(aIdx[0])];
+        const size_t nNonZeros = sortedFeatures().nNonZeros(iFeature);
+        const SortedFeaturesHelper::IndexType* rows = sortedFeatures().nonZeroRows(iFeature);
+        const SortedFeaturesHelper::IndexType* idx = sortedFeatures().nonZeroData(iFeature);
+        for(size_t i = 0; i < nNonZeros; ++i)
+        {
+            if(_aRowCount[rows[i]] && (_aRowNode[rows[i]] == iNode))
+                res[rows[i]] = idx[i];
+        }
+        return res;
+    }
+
+    //calls func(idx, iSample, count) for every nonzero value of the feature in the rows of the node of the given
+    //samples, where idx is the index of the value in the sorted array of unique values of the feature, iSample is
+    //the first sample of the row and count is the number of the samples of the row
+    template <typename Func>
+    void forEachNonZero(IndexType iFeature, const IndexType* aIdx, Func func) const
+    {
+        DAAL_ASSERT(hasSparseSortedFeatures());
+        const IndexType iNode = _aRowNode[getObsIdx(aIdx[0])];
+        const size_t nNonZeros = sortedFeatures().nNonZeros(iFeature);
+        const SortedFeaturesHelper::IndexType* rows = sortedFeatures().nonZeroRows(iFeature);
+        const SortedFeaturesHelper::IndexType* idx = sortedFeatures().nonZeroData(iFeature);
+        for(size_t i = 0; i < nNonZeros; ++i)
+        {
+            const SortedFeaturesHelper::IndexType iRow = rows[i];
+            if(_aRowCount[iRow] && (_aRowNode[iRow] == iNode))
+                func(idx[i], _aRowSample[iRow], _aRowCount[iRow]);
+        }
+    }
+
+    //all rows of the samples belong to the root node
+    void resetNodes()
+    {
+        if(!hasSparseSortedFeatures())
+            return;
+        for(size_t i = 0; i < _aResponse.size(); ++i)
+            _aRowNode[_aResponse[i].idx] = 0;
+    }
+
+    //moves the rows of the given samples to the node, the node is identified by the position of its first sample
+    //in the array of samples. Nodes processed at the same time have different rows, samples of one row always
+    //belong to one node since they have the same feature values
+    void setNode(const IndexType* aIdx, size_t n, IndexType iNode)
+    {
+        if(!hasSparseSortedFeatures())
+            return;
+        for(size_t i = 0; i < n; ++i)
+            _aRowNode[getObsIdx(aIdx[i])] = iNode;
+    }
+
 protected:
     IndexType getObsIdx(size_t i) const { DAAL_ASSERT(i < _aResponse.size());  return _aResponse.get()[i].idx; }
 
+    bool initSparse()
+    {
+        CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(_data);
+        if(!csr)
+        {
+            _csrRows = nullptr;
+            return true;
+        }
+        if(!_csrRows)
+        {
+            //the whole table is read once, the block is kept until the helper is destroyed
+            _csrBlock.set(csr, 0, _data->getNumberOfRows());
+            if(!_csrBlock.status())
+                return false;
+            _csrValues = _csrBlock.values();
+            _csrCols = _csrBlock.cols();
+            _csrRows = _csrBlock.rows();
+        }
+        return true;
+    }
+
+    bool initRows()
+    {
+        const size_t nRows = _data->getNumberOfRows();
+        if(_aRowCount.size() != nRows)
+        {
+            _aRowCount.reset(nRows);
+            _aRowSample.reset(nRows);
+            _aRowNode.reset(nRows);
+            _aRowFeatureIdx.reset(nRows);
+            if(!_aRowCount.get() || !_aRowSample.get() || !_aRowNode.get() || !_aRowFeatureIdx.get())
+                return false;
+        }
+        for(size_t i = 0; i < nRows; ++i)
+            _aRowCount[i] = 0;
+        for(size_t i = 0; i < _aResponse.size(); ++i)
+        {
+            const IndexType iRow = _aResponse[i].idx;
+            if(!_aRowCount[iRow]++)
+                _aRowSample[iRow] = i;
+        }
+        return true;
+    }
+
+    algorithmFPType getSparseValue(size_t iCol, size_t iRow) const
+    {
+        const size_t iFirst = _csrRows[iRow] - 1;
+        return dtrees::internal::getSparseFeatureValue<algorithmFPType>(_csrValues + iFirst, _csrCols + iFirst,
+            _csrRows[iRow + 1] - _csrRows[iRow], iCol);
+    }
+
 protected:
     const dtrees::internal::SortedFeaturesHelper* _sortedFeatHelper;
     TArray<Response, cpu> _aResponse;
     const algorithmFPType* _dataDirect;
     NumericTable* _data;
     size_t _nCols;
+    ReadRowsCSR<algorithmFPType, cpu> _csrBlock;
+    const algorithmFPType* _csrValues;
+    const size_t* _csrCols;
+    const size_t* _csrRows;
+    //used with the sparse index of sorted features only: number of the samples of every row, its first sample,
+    //the node the row belongs to and a buffer for the indices of the feature values of the rows
+    TArray<IndexType, cpu> _aRowCount;
+    TArray<IndexType, cpu> _aRowSample;
+    TArray<IndexType, cpu> _aRowNode;
+    mutable TArray<SortedFeaturesHelper::IndexType, cpu> _aRowFeatureIdx;
 };
 
 //partition given set of indices into the left and right parts
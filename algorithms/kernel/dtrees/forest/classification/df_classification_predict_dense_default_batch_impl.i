@@ -91,6 +91,21 @@ public:
 
     Status run(size_t nClasses);
 
+protected:
+    //votes of all trees for the classes
+    template <typename FeatureRowType>
+    void predictByTrees(const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x, ClassIndexType* val) const
+    {
+        const auto size = _model->size();
+        for(size_t iTree = 0; iTree < size; ++iTree)
+        {
+            const dtrees::internal::DecisionTreeNode* pNode =
+                dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*_model->at(iTree), featHelper, x);
+            DAAL_ASSERT(pNode);
+            val[pNode->leftIndexOrClass]++;
+        }
+    }
+
 protected:
     const NumericTable* _data;
     NumericTable* _res;
@@ -119,13 +134,11 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(size_t nClasses)
     DAAL_CHECK(featHelper.init(_data), services::ErrorMemoryAllocationFailed);
 
     const auto nRows = _data->getNumberOfRows();
-    const auto nCols = _data->getNumberOfColumns();
     size_t nBlocks = nRows / nRowsInBlock;
     nBlocks += (nBlocks * nRowsInBlock != nRows);
 
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
-    const auto size = _model->size();
     daal::tls<ClassIndexType *> lsData([=]()-> ClassIndexType*
     {
         return service_scalable_malloc<ClassIndexType, cpu>(nClasses);
@@ -136,7 +149,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(size_t nClasses)
     {
         const size_t iStartRow = iBlock*nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        dtrees::prediction::internal::ObservationsBlock<algorithmFPType, cpu> xBD(_data, iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
         algorithmFPType* res = resBD.get() + iStartRow;
         daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow)
@@ -146,14 +159,10 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(size_t nClasses)
             PRAGMA_VECTOR_ALWAYS
             for(size_t i = 0; i < nClasses; ++i)
                 val[i] = 0;
-            for(size_t iTree = 0; iTree < size; ++iTree)
-            {
-                const dtrees::internal::DecisionTreeNode* pNode =
-                    dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*_model->at(iTree),
-                    featHelper, xBD.get() + iRow*nCols);
-                DAAL_ASSERT(pNode);
-                val[pNode->leftIndexOrClass]++;
-            }
+            if(xBD.isSparse())
+                predictByTrees(featHelper, xBD.sparseRow(iRow), val);
+            else
+                predictByTrees(featHelper, xBD.denseRow(iRow), val);
 
             algorithmFPType maxVal = val[0];
             size_t maxIdx = 0;
@@ -96,6 +96,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
+    NumericTable *w = input->get(classifier::training::weights).get();
 
     decision_forest::classification::Model *m = result->get(classifier::training::model).get();
 
@@ -104,7 +105,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, *m, *result, *par);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, w, *m, *result, *par);
 }
 
 }
@@ -79,6 +79,9 @@ DAAL_EXPORT services::Status Batch<DAAL_FPTYPE, decision_forest::classification:
     const size_t nSamplesPerTree(parameter.observationsPerTreeFraction*x->getNumberOfRows());
     DAAL_CHECK_EX(nSamplesPerTree > 0,
         services::ErrorIncorrectParameter, services::ParameterName, observationsPerTreeFractionStr());
+    /* Weights of observations are used only to resample the bootstrap sets */
+    DAAL_CHECK_EX(parameter.bootstrap || !input.get(classifier::training::weights),
+        services::ErrorIncorrectOptionalInput, services::OptionalInput, weightsStr());
     return s;
 }
 }
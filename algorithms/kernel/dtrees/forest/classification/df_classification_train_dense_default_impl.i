@@ -246,6 +246,8 @@ private:
         size_t n, size_t nMinSplitPart, const algorithmFPType accuracy, const ImpurityData& curImpurity, TSplitData& split) const;
     bool findBestSplitCategoricalFeature(const algorithmFPType* featureVal, const IndexType* aIdx,
         size_t n, size_t nMinSplitPart, const algorithmFPType accuracy, const ImpurityData& curImpurity, TSplitData& split) const;
+    void countResponsesSparse(IndexType iFeature, const IndexType* aIdx, size_t n, const ImpurityData& curImpurity,
+        IndexType* nFeatIdx, float* nSamplesPerClass) const;
 private:
     const size_t _nClasses;
     //set of buffers for pre-sorted features processing, used in findBestSplitForFeatureSorted only
@@ -477,6 +479,28 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
     return bFound;
 }
 
+//count number of responses in each class for each index of feature value using the sparse index of sorted features:
+//only nonzero feature values are visited, the counts of zero value are the node totals minus the counts of nonzero values
+template <typename algorithmFPType, CpuType cpu>
+void UnorderedRespHelper<algorithmFPType, cpu>::countResponsesSparse(IndexType iFeature, const IndexType* aIdx, size_t n,
+    const ImpurityData& curImpurity, IndexType* nFeatIdx, float* nSamplesPerClass) const
+{
+    const SortedFeaturesHelper::IndexType zeroIdx = this->sortedFeatures().zeroIndex(iFeature);
+    float* nZeroSamplesPerClass = nSamplesPerClass + zeroIdx*_nClasses;
+    for(size_t iClass = 0; iClass < _nClasses; ++iClass)
+        nZeroSamplesPerClass[iClass] = curImpurity.hist[iClass];
+    nFeatIdx[zeroIdx] = n;
+    const auto aResponse = this->_aResponse.get();
+    this->forEachNonZero(iFeature, aIdx, [&](SortedFeaturesHelper::IndexType idx, IndexType iSample, IndexType count)
+    {
+        const ClassIndexType iClass = aResponse[iSample].val;
+        nFeatIdx[idx] += count;
+        nFeatIdx[zeroIdx] -= count;
+        nSamplesPerClass[idx*_nClasses + iClass] += count;
+        nZeroSamplesPerClass[iClass] -= count;
+    });
+}
+
 #ifdef OPT_SKX
 //count number of responses in each class for each index of feature value
 template <typename ResponseType, typename IndexType, typename FeatureIndexType, typename SizeType, CpuType cpu>
@@ -509,11 +533,14 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
     auto nFeatIdx = _idxFeatureBuf.get();
     auto nSamplesPerClass = _samplesPerClassBuf.get();
 
-    countResponses<typename super::Response, IndexType, typename SortedFeaturesHelper::IndexType, size_t, cpu>(_nClasses,
-        n, aIdx, this->_aResponse.get(),
-        this->sortedFeatures().data(iFeature),
-        nFeatIdx,
-        nSamplesPerClass);
+    if(this->hasSparseSortedFeatures())
+        countResponsesSparse(iFeature, aIdx, n, curImpurity, nFeatIdx, nSamplesPerClass);
+    else
+        countResponses<typename super::Response, IndexType, typename SortedFeaturesHelper::IndexType, size_t, cpu>(_nClasses,
+            n, aIdx, this->_aResponse.get(),
+            this->sortedFeatures().data(iFeature),
+            nFeatIdx,
+            nSamplesPerClass);
 
     algorithmFPType bestImpDecrease = split.impurityDecrease < 0 ? split.impurityDecrease :
         algorithmFPType(n)*(split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
@@ -589,7 +616,7 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     IndexType* bestSplitIdxRight = bestSplitIdx + bestSplit.nLeft;
     const int iRowSplitVal = doPartition<typename super::Response, IndexType, typename SortedFeaturesHelper::IndexType, size_t, cpu>(
         n, aIdx, this->_aResponse.get(),
-        this->sortedFeatures().data(iFeature), bestSplit.featureUnordered,
+        this->featureIndex(iFeature, aIdx, n), bestSplit.featureUnordered,
         idxFeatureValueBestSplit,
         bestSplitIdxRight, bestSplitIdx,
         bestSplit.nLeft);
@@ -612,6 +639,9 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
 
     algorithmFPType bestImpDecrease = split.impurityDecrease < 0 ? split.impurityDecrease :
         algorithmFPType(n)*(split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
+    if(this->hasSparseSortedFeatures())
+        countResponsesSparse(iFeature, aIdx, n, curImpurity, nFeatIdx, nSamplesPerClass);
+    else
     {
         //direct access to sorted features data in order to facilitate vectorization
         const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->sortedFeatures().data(iFeature);
@@ -700,7 +730,7 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     size_t iRight = 0;
     int iRowSplitVal = -1;
     const auto aResponse = this->_aResponse.get();
-    const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->sortedFeatures().data(iFeature);
+    const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->featureIndex(iFeature, aIdx, n);
     for(size_t i = 0; i < n; ++i)
     {
         const IndexType iSample = aIdx[i];
@@ -808,12 +838,12 @@ class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, UnorderedRespH
     typedef TrainBatchTaskBase<algorithmFPType, UnorderedRespHelper<algorithmFPType, cpu>, cpu> super;
 public:
     typedef TreeThreadCtx<algorithmFPType, cpu> ThreadCtxType;
-    TrainBatchTask(const NumericTable *x, const NumericTable *y,
+    TrainBatchTask(const NumericTable *x, const NumericTable *y, const algorithmFPType *aWeightsCdf,
         const decision_forest::training::Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         typename super::ThreadCtxType& ctx, size_t dummy) :
-        super(x, y, par, featHelper, sortedFeatHelper, ctx, dummy)
+        super(x, y, aWeightsCdf, par, featHelper, sortedFeatHelper, ctx, dummy)
     {
         if(!this->_nFeaturesPerNode)
         {
@@ -828,7 +858,7 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    const NumericTable *x, const NumericTable *y, decision_forest::classification::Model& m,
+    const NumericTable *x, const NumericTable *y, const NumericTable *w, decision_forest::classification::Model& m,
     Result& res,
     const decision_forest::classification::training::Parameter& par)
 {
@@ -836,7 +866,7 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     return computeImpl<algorithmFPType, cpu,
         daal::algorithms::decision_forest::classification::internal::ModelImpl,
         TrainBatchTask<algorithmFPType, method, cpu> >
-        (x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
+        (x, y, w, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
         rd, par, par.nClasses);
 }
 
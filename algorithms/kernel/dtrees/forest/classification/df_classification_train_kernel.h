@@ -73,7 +73,7 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 class ClassificationTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable *x, const NumericTable *y, decision_forest::classification::Model& m,
+    services::Status compute(const NumericTable *x, const NumericTable *y, const NumericTable *w, decision_forest::classification::Model& m,
         Result& res, const decision_forest::classification::training::Parameter& par);
 };
 
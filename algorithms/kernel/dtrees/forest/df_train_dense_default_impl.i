@@ -218,16 +218,36 @@ Ctx* createTlsContext(const NumericTable *x, const Parameter& par, size_t nClass
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
-services::Status computeImpl(const NumericTable *x, const NumericTable *y, ModelType& md, ResultData& res,
+services::Status computeImpl(const NumericTable *x, const NumericTable *y, const NumericTable *w, ModelType& md, ResultData& res,
     const Parameter& par, size_t nClasses)
 {
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
+    //cumulative sums of the weights of observations, used to sample observations proportionally to their weights
+    TArray<algorithmFPType, cpu> aWeightsCdf;
+    if(w)
+    {
+        const size_t nRows = x->getNumberOfRows();
+        ReadRows<algorithmFPType, cpu> wBD(const_cast<NumericTable*>(w), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(wBD);
+        aWeightsCdf.reset(nRows);
+        DAAL_CHECK_MALLOC(aWeightsCdf.get());
+        const algorithmFPType* pw = wBD.get();
+        algorithmFPType sum(0);
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            sum += pw[i];
+            aWeightsCdf[i] = sum;
+        }
+        DAAL_CHECK(sum > 0, ErrorIncorrectOptionalInput);
+    }
     dtrees::internal::FeatureTypeHelper<cpu> featHelper;
     DAAL_CHECK(featHelper.init(x), ErrorMemoryAllocationFailed);
 
     dtrees::internal::SortedFeaturesHelper sortedFeatHelper;
     services::Status s;
-    if(!par.memorySavingMode)
+    //index of sorted features has nRows x nColumns size, in case of sparse data it keeps nonzero values only
+    const bool bUseSortedFeatures = !par.memorySavingMode;
+    if(bUseSortedFeatures)
     {
         s = sortedFeatHelper.init<algorithmFPType, cpu>(*x);
         if(!s)
@@ -259,7 +279,7 @@ services::Status computeImpl(const NumericTable *x, const NumericTable *y, Model
     {
         //in case of single thread no need to allocate
         Ctx* ctx = tlsCtx.local();
-        return ctx ? new TaskType(x, y, par, featHelper, par.memorySavingMode ? nullptr : &sortedFeatHelper, *ctx, nClasses) : nullptr;
+        return ctx ? new TaskType(x, y, aWeightsCdf.get(), par, featHelper, bUseSortedFeatures ? &sortedFeatHelper : nullptr, *ctx, nClasses) : nullptr;
     });
 
     bool bMemoryAllocationFailed = false;
@@ -318,11 +338,11 @@ public:
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu, DefaultAllocator<cpu>> algorithmFPTypeArray;
     typedef dtrees::internal::TVector<IndexType, cpu, DefaultAllocator<cpu>> IndexTypeArray;
-    TrainBatchTaskBase(const NumericTable *x, const NumericTable *y, const Parameter& par,
+    TrainBatchTaskBase(const NumericTable *x, const NumericTable *y, const algorithmFPType *aWeightsCdf, const Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         ThreadCtxType& threadCtx, size_t nClasses):
-        _data(x), _resp(y), _par(par), _brng(nullptr), _nClasses(nClasses),
+        _data(x), _resp(y), _aWeightsCdf(aWeightsCdf), _par(par), _brng(nullptr), _nClasses(nClasses),
         _nSamples(par.observationsPerTreeFraction*x->getNumberOfRows()),
         _nFeaturesPerNode(par.featuresPerNode),
         _helper(sortedFeatHelper, nClasses),
@@ -370,7 +390,10 @@ protected:
     void featureValuesToBuf(size_t iFeature, algorithmFPType* featureVal, IndexType* aIdx, size_t n)
     {
         _helper.getColumnValues(iFeature, aIdx, n, featureVal);
-        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
+        if(_helper.isSparse())
+            sortSparseFeatureValues<algorithmFPType, IndexType, cpu>(n, featureVal, aIdx);
+        else
+            daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
     }
 
     //find features to check in the current split node
@@ -389,6 +412,9 @@ protected:
         }
     }
 
+    //draw observations with replacement with probabilities proportional to their weights
+    void weightedSample(IndexType* aSample, algorithmFPType* buf);
+
     bool computeResults(const dtrees::internal::Tree& t);
 
     algorithmFPType computeOOBError(const dtrees::internal::Tree& t, size_t n, const IndexType* aInd);
@@ -400,6 +426,7 @@ protected:
     BaseRNGs<cpu>* _brng;
     const NumericTable *_data;
     const NumericTable *_resp;
+    const algorithmFPType *_aWeightsCdf; //cumulative weights of observations, null if observations are not weighted
     const Parameter& _par;
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
@@ -418,6 +445,30 @@ protected:
     size_t _nClasses;
 };
 
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::weightedSample(IndexType* aSample, algorithmFPType* buf)
+{
+    const size_t nRows = _data->getNumberOfRows();
+    RNGs<algorithmFPType, cpu> rng;
+    rng.uniform(_nSamples, buf, *_brng, algorithmFPType(0), _aWeightsCdf[nRows - 1]);
+    for(size_t i = 0; i < _nSamples; ++i)
+    {
+        //binary search of the first observation with cumulative weight greater than the generated value
+        size_t iLeft = 0;
+        size_t iRight = nRows - 1;
+        while(iLeft < iRight)
+        {
+            const size_t iMid = (iLeft + iRight) / 2;
+            if(_aWeightsCdf[iMid] > buf[i])
+                iRight = iMid;
+            else
+                iLeft = iMid + 1;
+        }
+        aSample[i] = iLeft;
+    }
+    daal::algorithms::internal::qSort<int, cpu>(_nSamples, aSample);
+}
+
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 dtrees::internal::Tree* TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(size_t seed)
 {
@@ -436,10 +487,12 @@ dtrees::internal::Tree* TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::ru
     if(!_aSample.get() || !_helper.reset(_nSamples) || !_aFeatureBuf.get() || !_aFeatureIndexBuf.get() || !_aFeatureIdx.get())
         return nullptr;
 
-    //allocate temporary bufs
+    //allocate temporary bufs, feature buffer also keeps values per index of sorted feature values
+    const size_t nFeatureBuf = (_helper.hasSortedFeatures() && (_helper.sortedFeatures().getMaxNumberOfDiffValues() > _nSamples)) ?
+        _helper.sortedFeatures().getMaxNumberOfDiffValues() : _nSamples;
     for(size_t i = 0; i < _nFeatureBufs; ++i)
     {
-        _aFeatureBuf[i].reset(_nSamples);
+        _aFeatureBuf[i].reset(nFeatureBuf);
         if(!_aFeatureBuf[i].get())
             return nullptr;
         _aFeatureIndexBuf[i].reset(_nSamples);
@@ -447,7 +500,11 @@ dtrees::internal::Tree* TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::ru
             return nullptr;
     }
 
-    if(_par.bootstrap)
+    if(_aWeightsCdf)
+    {
+        weightedSample(_aSample.get(), _aFeatureBuf[0].get());
+    }
+    else if(_par.bootstrap)
     {
         RNGs<int, cpu> rng;
         rng.uniform(_nSamples, _aSample.get(), *_brng, 0, _data->getNumberOfRows());
@@ -465,6 +522,7 @@ dtrees::internal::Tree* TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::ru
 
     //use _aSample as an array of response indices stored by helper from now on
     for(size_t i = 0; i < _aSample.size(); _aSample[i] = i, ++i);
+    _helper.resetNodes();
 
     typename DataHelper::ImpurityData initialImpurity;
     _helper.calcImpurity(_aSample.get(), _nSamples, initialImpurity);
@@ -599,8 +657,8 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     for(size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
         const auto iFeature = _aFeatureIdx[i];
-        const bool bUseSortedFeatures = (!_par.memorySavingMode) &&
-            (fact > qMax*float(_helper.sortedFeatures().getMaxNumberOfDiffValues(iFeature)));
+        const bool bUseSortedFeatures = _helper.hasSortedFeatures() &&
+            (fact > qMax*float(_helper.sortedFeatures().getIndexSize(iFeature)));
 
         if(bUseSortedFeatures)
         {
@@ -671,6 +729,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
                                                            //then aIdx already contains the best split, no need to copy
     if(bCopyToIdx)
         tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+    _helper.setNode(_aSample.get() + iStart + bestSplit.nLeft, n - bestSplit.nLeft, iStart + bestSplit.nLeft);
     return true;
 }
 
@@ -91,8 +91,9 @@ public:
     services::Status run();
 
 protected:
+    template <typename FeatureRowType>
     static algorithmFPType predict(const dtrees::internal::DecisionTreeTable& t,
-        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const algorithmFPType* x)
+        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x)
     {
         const typename dtrees::internal::DecisionTreeNode* pNode =
             dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, featHelper, x);
@@ -100,6 +101,21 @@ protected:
         return pNode ? pNode->featureValueOrResponse : 0.;
     }
 
+    template <typename FeatureRowType>
+    algorithmFPType predictByTrees(const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x) const
+    {
+        const auto size = _model->size();
+        algorithmFPType res = predict(*_model->at(0), featHelper, x);
+        for(size_t iTree = 1; iTree < size; ++iTree)
+        {
+            const algorithmFPType val = predict(*_model->at(iTree), featHelper, x);
+            //recalculate response incrementally, as a mean of all trees responses
+            algorithmFPType delta = val - res;
+            res += delta / algorithmFPType(iTree + 1);
+        }
+        return res;
+    }
+
 protected:
     const NumericTable* _data;
     NumericTable* _res;
@@ -126,7 +142,6 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run()
     DAAL_CHECK(featHelper.init(_data), services::ErrorMemoryAllocationFailed);
 
     const auto nRows = _data->getNumberOfRows();
-    const auto nCols = _data->getNumberOfColumns();
     size_t nBlocks = nRows / nRowsInBlock;
     nBlocks += (nBlocks * nRowsInBlock != nRows);
 
@@ -134,26 +149,19 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run()
     DAAL_CHECK_BLOCK_STATUS(resBD);
     daal::services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, nRows);
 
-    const auto size = _model->size();
     const data_management::DataCollection& aTreeTables = *_model->serializationData();
     SafeStatus safeStat;
     daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
     {
         const size_t iStartRow = iBlock*nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        dtrees::prediction::internal::ObservationsBlock<algorithmFPType, cpu> xBD(_data, iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
         algorithmFPType* res = resBD.get() + iStartRow;
         daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow)
         {
-            res[iRow] = predict(*_model->at(0), featHelper, xBD.get() + iRow*nCols);
-            for(size_t iTree = 1; iTree < size; ++iTree)
-            {
-                const algorithmFPType val = predict(*_model->at(iTree), featHelper, xBD.get() + iRow*nCols);
-                //recalculate response incrementally, as a mean of all trees responses
-                algorithmFPType delta = val - res[iRow];
-                res[iRow] += delta / algorithmFPType(iTree + 1);
-            }
+            res[iRow] = xBD.isSparse() ? predictByTrees(featHelper, xBD.sparseRow(iRow)) :
+                predictByTrees(featHelper, xBD.denseRow(iRow));
         });
     });
     return safeStat.detach();
@@ -96,6 +96,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     const NumericTable *x = input->get(data).get();
     const NumericTable *y = input->get(dependentVariable).get();
+    const NumericTable *w = input->get(weights).get();
 
     decision_forest::regression::Model *m = result->get(model).get();
 
@@ -103,7 +104,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, *m, *result, *par);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, w, *m, *result, *par);
 }
 
 }
@@ -326,7 +326,7 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType*
     size_t iRight = 0;
     int iRowSplitVal = -1;
     const auto aResponse = this->_aResponse.get();
-    const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->sortedFeatures().data(iFeature);
+    const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->featureIndex(iFeature, aIdx, n);
     for(size_t i = 0; i < n; ++i)
     {
         const auto iSample = aIdx[i];
@@ -372,6 +372,24 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
 
     auto nFeatIdx = _idxFeatureBuf.get(); //number of indexed feature values, array
     algorithmFPType sumTotal = 0; //total sum of responses in the set being split
+    if(this->hasSparseSortedFeatures())
+    {
+        //only nonzero feature values are visited, the sums of zero value are the node totals minus the sums of nonzero values
+        const SortedFeaturesHelper::IndexType zeroIdx = this->sortedFeatures().zeroIndex(iFeature);
+        sumTotal = curImpurity.mean*algorithmFPType(n);
+        nFeatIdx[zeroIdx] = n;
+        buf[zeroIdx] = sumTotal;
+        auto aResponse = this->_aResponse.get();
+        this->forEachNonZero(iFeature, aIdx, [&](SortedFeaturesHelper::IndexType idx, IndexType iSample, IndexType count)
+        {
+            const algorithmFPType sum = aResponse[iSample].val*algorithmFPType(count);
+            nFeatIdx[idx] += count;
+            nFeatIdx[zeroIdx] -= count;
+            buf[idx] += sum;
+            buf[zeroIdx] -= sum;
+        });
+    }
+    else
     {
         const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = this->sortedFeatures().data(iFeature);
         auto aResponse = this->_aResponse.get();
@@ -601,12 +619,12 @@ class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, OrderedRespHel
     typedef TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, cpu>, cpu> super;
 public:
     typedef TreeThreadCtx<algorithmFPType, cpu> ThreadCtxType;
-    TrainBatchTask(const NumericTable *x, const NumericTable *y,
+    TrainBatchTask(const NumericTable *x, const NumericTable *y, const algorithmFPType *aWeightsCdf,
         const decision_forest::training::Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         typename super::ThreadCtxType& ctx, size_t dummy) :
-        super(x, y, par, featHelper, sortedFeatHelper, ctx, dummy)
+        super(x, y, aWeightsCdf, par, featHelper, sortedFeatHelper, ctx, dummy)
     {
         if(!this->_nFeaturesPerNode)
         {
@@ -621,13 +639,14 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, decision_forest::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    const NumericTable *x, const NumericTable *y, decision_forest::regression::Model& m, Result& res, const Parameter& par)
+    const NumericTable *x, const NumericTable *y, const NumericTable *w, decision_forest::regression::Model& m,
+    Result& res, const Parameter& par)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get());
     return computeImpl<algorithmFPType, cpu,
         daal::algorithms::decision_forest::regression::internal::ModelImpl,
         TrainBatchTask<algorithmFPType, method, cpu> >
-        (x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
+        (x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
         rd, par, 0);
 }
 
@@ -73,7 +73,7 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable *x, const NumericTable *y,
+    services::Status compute(const NumericTable *x, const NumericTable *y, const NumericTable *w,
         decision_forest::regression::Model& m, Result& res, const Parameter& par);
 };
 
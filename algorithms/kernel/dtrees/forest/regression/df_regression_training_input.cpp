@@ -47,6 +47,7 @@
 
 #include "algorithms/decision_forest/decision_forest_regression_training_types.h"
 #include "daal_strings.h"
+#include "service_numeric_table.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -117,6 +118,14 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures,
         ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+    NumericTablePtr weightsTable = get(weights);
+    if(weightsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(weightsTable.get(), weightsStr(), 0, 0, 1, dataTable->getNumberOfRows()));
+        DAAL_CHECK_STATUS(s, daal::internal::checkWeights(weightsTable.get(), weightsStr()));
+        /* Weights of observations are used only to resample the bootstrap sets */
+        DAAL_CHECK_EX(parameter->bootstrap, ErrorIncorrectOptionalInput, OptionalInput, weightsStr());
+    }
     return s;
 }
 
@@ -96,8 +96,9 @@ protected:
         dtrees::internal::FeatureTypeHelper<cpu>& featHelper, algorithmFPType* aRes);
     services::Status runMulticlass(size_t nClasses, size_t nRows, size_t nCols, size_t nBlocks,
         dtrees::internal::FeatureTypeHelper<cpu>& featHelper, algorithmFPType* aRes);
+    template <typename FeatureRowType>
     static algorithmFPType predict(const dtrees::internal::DecisionTreeTable& t,
-        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const algorithmFPType* x)
+        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x)
     {
         const typename dtrees::internal::DecisionTreeNode* pNode =
             dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, featHelper, x);
@@ -105,6 +106,26 @@ protected:
         return pNode ? pNode->featureValueOrResponse : 0.;
     }
 
+    //raw boosted value of the binary classification
+    template <typename FeatureRowType>
+    algorithmFPType predictByTrees(size_t nTrees, const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x) const
+    {
+        algorithmFPType f = 0;
+        //recalculate response incrementally, as a sum of all trees responses
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            f += predict(*_model->at(iTree), featHelper, x);
+        return f;
+    }
+
+    //raw boosted values of the multiclass classification, tree iTree contributes to the class iTree%nClasses
+    template <typename FeatureRowType>
+    void predictByTrees(size_t nTrees, size_t nClasses, const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
+        const FeatureRowType& x, algorithmFPType* val) const
+    {
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            val[iTree%nClasses] += predict(*_model->at(iTree), featHelper, x);
+    }
+
 protected:
     const NumericTable* _data;
     NumericTable* _res;
@@ -155,18 +176,13 @@ services::Status PredictClassificationTask<algorithmFPType, cpu>::runBinary(size
     {
         const size_t iStartRow = iBlock*nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        dtrees::prediction::internal::ObservationsBlock<algorithmFPType, cpu> xBD(_data, iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
         algorithmFPType* res = aRes + iStartRow;
         daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow)
         {
-            algorithmFPType f = 0; //raw boosted value
-            const auto ptr = xBD.get() + iRow*nCols;
-            for(size_t iTree = 0; iTree < size; ++iTree)
-            {
-                //recalculate response incrementally, as a sum of all trees responses
-                f += predict(*_model->at(iTree), featHelper, ptr);
-            }
+            const algorithmFPType f = xBD.isSparse() ? predictByTrees(size, featHelper, xBD.sparseRow(iRow)) :
+                predictByTrees(size, featHelper, xBD.denseRow(iRow));
             //probablity is a sigmoid(f) hence sign(f) can be checked
             res[iRow] = label[daal::data_feature_utils::internal::SignBit<algorithmFPType, cpu>::get(f)];
         });
@@ -193,20 +209,21 @@ services::Status PredictClassificationTask<algorithmFPType, cpu>::runMulticlass(
     {
         const size_t iStartRow = iBlock*nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        dtrees::prediction::internal::ObservationsBlock<algorithmFPType, cpu> xBD(_data, iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
         algorithmFPType* res = aRes + iStartRow;
         daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow)
         {
-            const auto ptr = xBD.get() + iRow*nCols;
             algorithmFPType buf[s_cMaxClassesBufSize];
             algorithmFPType* val = bUseTLS ? lsData.local() : buf;
             PRAGMA_VECTOR_ALWAYS
             for(size_t i = 0; i < nClasses; ++i)
                 val[i] = 0;
 
-            for(size_t iTree = 0; iTree < size; ++iTree)
-                val[iTree%nClasses] += predict(*_model->at(iTree), featHelper, ptr);
+            if(xBD.isSparse())
+                predictByTrees(size, nClasses, featHelper, xBD.sparseRow(iRow), val);
+            else
+                predictByTrees(size, nClasses, featHelper, xBD.denseRow(iRow), val);
 
             algorithmFPType maxVal = val[0];
             size_t maxIdx = 0;
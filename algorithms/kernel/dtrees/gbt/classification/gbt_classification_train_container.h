@@ -84,6 +84,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
+    NumericTable *w = input->get(classifier::training::weights).get();
 
     gbt::classification::Model *m = result->get(classifier::training::model).get();
 
@@ -93,7 +94,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, w, *m, *result, *par, *engine);
 }
 }
 }
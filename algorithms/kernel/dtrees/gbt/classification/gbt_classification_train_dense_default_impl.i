@@ -219,12 +219,12 @@ class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, OrderedRespHel
 {
     typedef TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, cpu>, AlgoType, cpu> super;
 public:
-    TrainBatchTask(const NumericTable *x, const NumericTable *y,
+    TrainBatchTask(const NumericTable *x, const NumericTable *y, const NumericTable *w,
         const gbt::training::Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         engines::internal::BatchBaseImpl& engine, size_t nClasses) :
-        super(x, y, par, featHelper, sortedFeatHelper, engine, nClasses)
+        super(x, y, w, par, featHelper, sortedFeatHelper, engine, nClasses)
     {
     }
     bool done() { return false; }
@@ -251,12 +251,12 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, Result& res, const Parameter& par,
+    const NumericTable *x, const NumericTable *y, const NumericTable *w, gbt::classification::Model& m, Result& res, const Parameter& par,
     engines::internal::BatchBaseImpl& engine)
 {
     return computeImpl<algorithmFPType, cpu,
         TrainBatchTask<algorithmFPType, method, AlgoXBoost<algorithmFPType, cpu>, cpu> >
-        (x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses);
+        (x, y, w, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses);
 }
 
 } /* namespace internal */
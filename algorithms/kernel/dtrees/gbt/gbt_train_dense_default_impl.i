@@ -536,12 +536,12 @@ protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu, DefaultAllocator<cpu>> algorithmFPTypeArray;
     typedef dtrees::internal::TVector<IndexType, cpu, DefaultAllocator<cpu>> IndexTypeArray;
 
-    TrainBatchTaskBase(const NumericTable *x, const NumericTable *y, const Parameter& par,
+    TrainBatchTaskBase(const NumericTable *x, const NumericTable *y, const NumericTable *w, const Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         engines::internal::BatchBaseImpl& engine,
         size_t nClasses) :
-        _data(x), _resp(y), _par(par), _engine(engine), _nClasses(nClasses),
+        _data(x), _resp(y), _weights(w), _par(par), _engine(engine), _nClasses(nClasses),
         _nSamples(par.observationsPerTreeFraction*x->getNumberOfRows()),
         _nFeaturesPerNode(par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns()),
         _dataHelper(sortedFeatHelper, nClasses),
@@ -581,7 +581,8 @@ protected:
 
 protected:
     virtual void initLossFunc() = 0;
-    virtual bool getInitialF(const algorithmFPType* py, size_t n, algorithmFPType& val) { return false; }
+    //pw is either null or the weights of the n observations
+    virtual bool getInitialF(const algorithmFPType* py, const algorithmFPType* pw, size_t n, algorithmFPType& val) { return false; }
     bool initMemHelper();
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     bool isThreaded() const { return _bThreaded; }
@@ -595,6 +596,7 @@ protected:
     {
         ImpurityType imp;
         _algo.setCurrentTree(iTree);
+        _dataHelper.resetNodes();
         _algo.getInitialImpurity(imp, _nSamples);
         typename NodeType::Base* res = buildLeaf(0, _nSamples, 0, imp);
         if(res)
@@ -653,7 +655,10 @@ protected:
     void featureValuesToBuf(size_t iFeature, algorithmFPType* featureVal, IndexType* aIdx, size_t n)
     {
         _dataHelper.getColumnValues(iFeature, aIdx, n, featureVal);
-        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
+        if(_dataHelper.isSparse())
+            sortSparseFeatureValues<algorithmFPType, IndexType, cpu>(n, featureVal, aIdx);
+        else
+            daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featureVal, aIdx);
     }
 
     //find features to check in the current split node
@@ -679,6 +684,7 @@ protected:
 
     const NumericTable *_data;
     const NumericTable *_resp;
+    const NumericTable *_weights;
     const Parameter& _par;
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
@@ -719,7 +725,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, AlgoType, cpu>::initMemHelp
         _memHelper = new MemHelperThr<algorithmFPType, cpu>(nFeaturesSample);
     else
         _memHelper = new MemHelperSeq<algorithmFPType, cpu>(nFeaturesSample,
-            _par.memorySavingMode ? 0 : _dataHelper.sortedFeatures().getMaxNumberOfDiffValues(),
+            _dataHelper.hasSortedFeatures() ? _dataHelper.sortedFeatures().getMaxNumberOfDiffValues() : 0,
             _nSamples); //TODO
     return _memHelper && _memHelper->init();
 }
@@ -771,17 +777,35 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, AlgoType, cpu>:
             py[i] = response[i].val;
             aSample[i] = i;
         }
+        TVector<algorithmFPType, cpu, DefaultAllocator<cpu>> sampleWeights;
+        if(_weights)
+        {
+            //weights of the observations in the order of the responses
+            ReadRows<algorithmFPType, cpu> w(const_cast<NumericTable*>(_weights), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(w);
+            sampleWeights.reset(_nSamples);
+            DAAL_CHECK_MALLOC(sampleWeights.get());
+            const algorithmFPType* pw = w.get();
+            auto psw = sampleWeights.get();
+            for(size_t i = 0; i < _nSamples; ++i)
+                psw[i] = pw[response[i].idx];
+        }
         if(iIteration)
         {
             _initialF = 0;
         }
         else
         {
-            if(!getInitialF(py, _nSamples, _initialF))
+            if(!getInitialF(py, sampleWeights.get(), _nSamples, _initialF))
                 _initialF = algorithmFPType(0);
             initializeF(_initialF);
         }
         _algo.step(_nSamples, py, f(), _aSampleToF.get(), *lossFunc());
+        if(_weights)
+        {
+            //weighted loss: gradients and hessians of the observations are scaled by their weights
+            _algo.scaleGradients(_nSamples, sampleWeights.get());
+        }
     }
     //boost trees
     for(size_t i = 0; i < nTrees; ++i)
@@ -938,6 +962,8 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, AlgoType, cpu>::findBestSpl
 
     if(bCopyToIdx)
         tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, job.n);
+    const size_t iRight = job.iStart + bestSplit.nLeft;
+    _dataHelper.setNode(_aSample.get() + iRight, job.n - bestSplit.nLeft, iRight);
     return true;
 }
 
@@ -974,7 +1000,7 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, AlgoType, cpu>::finalizeBes
     IndexType* bestSplitIdxRight = bestSplitIdx + split.nLeft;
     const int iRowSplitVal = doPartition<typename DataHelper::super::Response, IndexType, typename SortedFeaturesHelper::IndexType, size_t, cpu>(
         n, aIdx, _dataHelper.responses(),
-        _dataHelper.sortedFeatures().data(iFeature), split.featureUnordered,
+        _dataHelper.featureIndex(iFeature, aIdx, n), split.featureUnordered,
         idxFeatureValueBestSplit,
         bestSplitIdxRight, bestSplitIdx,
         split.nLeft);
@@ -990,8 +1016,8 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, AlgoType, cpu>::findSplitOn
 {
     const float qMax = 0.02; //min fracture of observations to be handled as indexed feature values
     const IndexType iFeature = featureSample ? featureSample[iFeatureInSample] : (IndexType)iFeatureInSample;
-    const bool bUseSortedFeatures = (!_par.memorySavingMode) &&
-        (float(job.n) > qMax*float(_dataHelper.sortedFeatures().getMaxNumberOfDiffValues(iFeature)));
+    const bool bUseSortedFeatures = _dataHelper.hasSortedFeatures() &&
+        (float(job.n) > qMax*float(_dataHelper.sortedFeatures().getIndexSize(iFeature)));
     IndexType* aIdx = _aSample.get() + job.iStart;
 
     if(bUseSortedFeatures)
@@ -1133,6 +1159,22 @@ public:
         func.getGradients(n, y, f, aSample, (algorithmFPType*)_aGH.get());
     }
 
+    //multiply gradients and hessians of all trees of the iteration by the weights of the observations
+    void scaleGradients(size_t n, const algorithmFPType* w)
+    {
+        for(size_t iTree = 0; iTree < this->_nTrees; ++iTree)
+        {
+            ghType* pgh = grad(iTree);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < n; ++i)
+            {
+                pgh[i].g *= w[i];
+                pgh[i].h *= w[i];
+            }
+        }
+    }
+
     virtual double computeLeafWeightUpdateF(const IndexType* idx, size_t n, algorithmFPType* f,
         const IndexType* sampleInd, const ImpurityType& imp, const Parameter& par) DAAL_C11_OVERRIDE
     {
@@ -1234,6 +1276,27 @@ int AlgoXBoost<algorithmFPType, cpu>::findBestSplitFeatIndexed(const DataHelperT
     algorithmFPType bestImpDecrease = split.impurityDecrease;
     algorithmFPType gTotal = 0; //total sum of g in the set being split
     algorithmFPType hTotal = 0; //total sum of h in the set being split
+    if(inputData.hasSparseSortedFeatures())
+    {
+        //only nonzero feature values are visited, the sums of zero value are the node totals minus the sums of nonzero values
+        const typename SortedFeaturesHelper::IndexType zeroIdx = inputData.sortedFeatures().zeroIndex(iFeature);
+        gTotal = imp.g;
+        hTotal = imp.h;
+        nFeatIdx[zeroIdx] = n;
+        pBuf[zeroIdx] = imp;
+        const ghType* pgh = grad(this->_curTree);
+        inputData.forEachNonZero(iFeature, aIdx, [&](SortedFeaturesHelper::IndexType idx, IndexType iSample, IndexType count)
+        {
+            //samples are drawn without replacement, every row has one sample
+            DAAL_ASSERT(count == 1);
+            ++nFeatIdx[idx];
+            --nFeatIdx[zeroIdx];
+            pBuf[idx].add(pgh[iSample]);
+            pBuf[zeroIdx].g -= pgh[iSample].g;
+            pBuf[zeroIdx].h -= pgh[iSample].h;
+        });
+    }
+    else
     {
         const SortedFeaturesHelper::IndexType* sortedFeaturesIdx = inputData.sortedFeatures().data(iFeature);
         const auto aResponse = inputData.responses();
@@ -1378,7 +1441,7 @@ bool AlgoXBoost<algorithmFPType, cpu>::findBestSplitFeatSortedCategorical(const
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename TaskType>
-services::Status computeImpl(const NumericTable *x, const NumericTable *y, gbt::internal::ModelImpl& md,
+services::Status computeImpl(const NumericTable *x, const NumericTable *y, const NumericTable *w, gbt::internal::ModelImpl& md,
     const gbt::training::Parameter& par, engines::internal::BatchBaseImpl& engine, size_t nClasses)
 {
     const size_t nTrees = nClasses > 2 ? nClasses : 1;
@@ -1388,9 +1451,11 @@ services::Status computeImpl(const NumericTable *x, const NumericTable *y, gbt::
 
     dtrees::internal::SortedFeaturesHelper sortedFeatHelper;
     services::Status s;
-    if(!par.memorySavingMode)
+    //index of sorted features has nRows x nColumns size, in case of sparse data it keeps nonzero values only
+    const bool bUseSortedFeatures = !par.memorySavingMode;
+    if(bUseSortedFeatures)
         DAAL_CHECK_STATUS(s, (sortedFeatHelper.init<algorithmFPType, cpu>(*x)));
-    TaskType task(x, y, par, featHelper, par.memorySavingMode ? nullptr : &sortedFeatHelper, engine, nClasses);
+    TaskType task(x, y, w, par, featHelper, bUseSortedFeatures ? &sortedFeatHelper : nullptr, engine, nClasses);
     DAAL_CHECK_STATUS(s, task.init());
     TVector<dtrees::internal::DecisionTreeTable*, cpu, DefaultAllocator<cpu> > aTables;
     typename dtrees::internal::DecisionTreeTable* pTbl = nullptr;
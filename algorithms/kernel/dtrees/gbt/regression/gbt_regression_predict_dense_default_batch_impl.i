@@ -91,8 +91,9 @@ public:
     services::Status run(size_t nIterations);
 
 protected:
+    template <typename FeatureRowType>
     static algorithmFPType predict(const dtrees::internal::DecisionTreeTable& t,
-        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const algorithmFPType* x)
+        const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x)
     {
         const typename dtrees::internal::DecisionTreeNode* pNode =
             dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, featHelper, x);
@@ -100,6 +101,16 @@ protected:
         return pNode ? pNode->featureValueOrResponse : 0.;
     }
 
+    template <typename FeatureRowType>
+    algorithmFPType predictByTrees(size_t nTrees, const dtrees::internal::FeatureTypeHelper<cpu>& featHelper, const FeatureRowType& x) const
+    {
+        algorithmFPType res = 0;
+        //recalculate response incrementally, as a sum of all trees responses
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            res += predict(*_model->at(iTree), featHelper, x);
+        return res;
+    }
+
 protected:
     const NumericTable* _data;
     NumericTable* _res;
@@ -126,7 +137,6 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(size_t nIterat
     DAAL_CHECK(featHelper.init(_data), services::ErrorMemoryAllocationFailed);
 
     const auto nRows = _data->getNumberOfRows();
-    const auto nCols = _data->getNumberOfColumns();
     size_t nBlocks = nRows / nRowsInBlock;
     nBlocks += (nBlocks * nRowsInBlock != nRows);
 
@@ -141,18 +151,13 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(size_t nIterat
     {
         const size_t iStartRow = iBlock*nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        dtrees::prediction::internal::ObservationsBlock<algorithmFPType, cpu> xBD(_data, iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(xBD);
         algorithmFPType* res = resBD.get() + iStartRow;
         daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow)
         {
-            res[iRow] = 0;
-            const auto ptr = xBD.get() + iRow*nCols;
-            for(size_t iTree = 0; iTree < size; ++iTree)
-            {
-                //recalculate response incrementally, as a sum of all trees responses
-                res[iRow] += predict(*_model->at(iTree), featHelper, ptr);
-            }
+            res[iRow] = xBD.isSparse() ? predictByTrees(size, featHelper, xBD.sparseRow(iRow)) :
+                predictByTrees(size, featHelper, xBD.denseRow(iRow));
         });
     });
     return safeStat.detach();
@@ -96,6 +96,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     const NumericTable *x = input->get(data).get();
     const NumericTable *y = input->get(dependentVariable).get();
+    const NumericTable *w = input->get(weights).get();
 
     gbt::regression::Model *m = result->get(model).get();
 
@@ -104,7 +105,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, w, *m, *result, *par, *engine);
 }
 
 }
@@ -77,12 +77,12 @@ class TrainBatchTask : public TrainBatchTaskBase<algorithmFPType, OrderedRespHel
 {
     typedef TrainBatchTaskBase<algorithmFPType, OrderedRespHelper<algorithmFPType, cpu>, AlgoType, cpu> super;
 public:
-    TrainBatchTask(const NumericTable *x, const NumericTable *y,
+    TrainBatchTask(const NumericTable *x, const NumericTable *y, const NumericTable *w,
         const gbt::training::Parameter& par,
         const dtrees::internal::FeatureTypeHelper<cpu>& featHelper,
         const dtrees::internal::SortedFeaturesHelper* sortedFeatHelper,
         engines::internal::BatchBaseImpl& engine, size_t dummy) :
-        super(x, y, par, featHelper, sortedFeatHelper, engine, 1)
+        super(x, y, w, par, featHelper, sortedFeatHelper, engine, 1)
     {
     }
     bool done() { return false; }
@@ -98,12 +98,26 @@ protected:
             DAAL_ASSERT(false);
         }
     }
-    virtual bool getInitialF(const algorithmFPType* py, size_t n, algorithmFPType& val) DAAL_C11_OVERRIDE
+    virtual bool getInitialF(const algorithmFPType* py, const algorithmFPType* pw, size_t n, algorithmFPType& val) DAAL_C11_OVERRIDE
     {
-        const algorithmFPType div = algorithmFPType(1.) / algorithmFPType(n);
         val = algorithmFPType(0);
+        if(!pw)
+        {
+            const algorithmFPType div = algorithmFPType(1.) / algorithmFPType(n);
+            for(size_t i = 0; i < n; ++i)
+                val += div*py[i];
+            return true;
+        }
+        //weighted mean of the responses minimizes the weighted squared loss
+        algorithmFPType sumW(0);
         for(size_t i = 0; i < n; ++i)
-            val += div*py[i];
+        {
+            val += pw[i]*py[i];
+            sumW += pw[i];
+        }
+        if(!(sumW > 0))
+            return false;
+        val /= sumW;
         return true;
     }
 };
@@ -113,12 +127,12 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    const NumericTable *x, const NumericTable *y, gbt::regression::Model& m, Result& res, const Parameter& par,
+    const NumericTable *x, const NumericTable *y, const NumericTable *w, gbt::regression::Model& m, Result& res, const Parameter& par,
     engines::internal::BatchBaseImpl& engine)
 {
     return computeImpl<algorithmFPType, cpu,
         TrainBatchTask<algorithmFPType, method, AlgoXBoost<algorithmFPType, cpu>, cpu> >
-        (x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1);
+        (x, y, w, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1);
 }
 
 } /* namespace internal */
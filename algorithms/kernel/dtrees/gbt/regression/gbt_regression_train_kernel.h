@@ -74,7 +74,7 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable *x, const NumericTable *y,
+    services::Status compute(const NumericTable *x, const NumericTable *y, const NumericTable *w,
         gbt::regression::Model& m, Result& res, const Parameter& par,
         engines::internal::BatchBaseImpl& engine);
 };
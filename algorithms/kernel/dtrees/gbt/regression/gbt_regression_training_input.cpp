@@ -47,6 +47,7 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "daal_strings.h"
+#include "service_numeric_table.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -119,6 +120,12 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures,
         ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+    NumericTablePtr weightsTable = get(weights);
+    if(weightsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(weightsTable.get(), weightsStr(), 0, 0, 1, dataTable->getNumberOfRows()));
+        DAAL_CHECK_STATUS(s, daal::internal::checkWeights(weightsTable.get(), weightsStr()));
+    }
     return s;
 }
 
@@ -104,7 +104,7 @@ services::Status Parameter::check() const
 }
 
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(lastInputValuesId + 1)
+Input::Input() : InputIface(lastInputValuesId + 1)
 {}
 
 /**
@@ -142,6 +142,22 @@ void Input::set(InputValuesId id, const init::ResultPtr &ptr)
     }
 }
 
+/**
+ * Sets input objects for the EM for GMM algorithm
+ * \param[in] id    Identifier of the input values object. Result of the EM for GMM algorithm
+ *                  in the batch or distributed processing mode can be used.
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputValuesId id, const ResultPtr &ptr)
+{
+    if(ptr)
+    {
+        set(inputWeights,     ptr->get(weights));
+        set(inputMeans,       ptr->get(means));
+        set(inputCovariances, ptr->get(covariances));
+    }
+}
+
 /**
  * Returns the input numeric table for the EM for GMM algorithm
  * \param[in] id    Identifier of the input numeric table
@@ -174,6 +190,16 @@ NumericTablePtr Input::get(InputCovariancesId id, size_t index) const
     return staticPointerCast<NumericTable, SerializationIface>((*covCollection)[index]);
 }
 
+/**
+ * Returns the number of features in the input data table
+ * \return Number of features in the input data table
+ */
+size_t Input::getNumberOfFeatures() const
+{
+    NumericTablePtr dataTable = get(data);
+    return (dataTable ? dataTable->getNumberOfColumns() : 0);
+}
+
 /**
  * Checks the correctness of the input result
  * \param[in] par       Pointer to the structure of the algorithm parameters
@@ -285,11 +311,26 @@ NumericTablePtr Result::get(ResultCovariancesId id, size_t index) const
 */
 services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
-    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    Parameter *algParameter = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
+    const Input *algInput = static_cast<const Input *>(input);
+    return checkImpl(algInput->get(data)->getNumberOfColumns(), par);
+}
+
+/**
+* Checks the result parameter of the EM for GMM algorithm in the distributed processing mode
+* \param[in] pres    Partial results of the algorithm
+* \param[in] par     %Parameter of algorithm
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(pres);
+    return checkImpl(algPartialResult->getNumberOfFeatures(), par);
+}
 
+services::Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
     size_t nComponents = algParameter->nComponents;
-    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
 
     services::Status s;
     int unexpectedLayouts = packed_mask;
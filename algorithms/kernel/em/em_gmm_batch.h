@@ -69,9 +69,26 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    return allocateImpl<algorithmFPType>(algInput->get(data)->getNumberOfColumns(), parameter);
+}
 
-    size_t nFeatures   = algInput->get(data)->getNumberOfColumns();
+/**
+ * Allocates memory for storing results of the EM for GMM algorithm in the distributed processing mode
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the parameter structure
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    return allocateImpl<algorithmFPType>(algPartialResult->getNumberOfFeatures(), parameter);
+}
+
+template <typename algorithmFPType>
+services::Status Result::allocateImpl(size_t nFeatures, const daal::algorithms::Parameter *parameter)
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nComponents = algParameter->nComponents;
 
     services::Status status;
@@ -186,22 +186,23 @@ template<>                         inline float           exp_threshold<float> (
 template<>                         inline double          exp_threshold<double>(void) { return double(-650.0); }
 
 /**
- * Function computes t.w values that stores weight of each data point belongs to each cluster.
- * t.s is computed by numeric stable log-sum-exp trick.
+ * Function computes logarithms of the weighted densities of the components without the normalizing constant
+ * for the block of data points. Values for the k-th component are stored in p[k * nVectorsInCurrentBlock + i].
  */
-template<typename algorithmFPType, Method method, CpuType cpu>
-void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> &t, const em_gmm::CovarianceStorageId covType)
+template<typename algorithmFPType, CpuType cpu>
+void computeLogWeightedDensities(const size_t nVectorsInCurrentBlock, const size_t nFeatures, const size_t nComponents,
+                                 const algorithmFPType *dataBlock, const algorithmFPType *logAlpha, const algorithmFPType *means,
+                                 const algorithmFPType *logSqrtInvDetSigma, GmmModel<algorithmFPType, cpu> *covs,
+                                 const em_gmm::CovarianceStorageId covType,
+                                 algorithmFPType *x_mu, algorithmFPType *Ax_mu, algorithmFPType *p)
 {
-    const size_t nComponents = t.nComponents;
-    const size_t nFeatures   = t.nFeatures;
-
     if(covType == diagonal)
     {
         for(size_t k = 0; k < nComponents; k++)
         {
-            const algorithmFPType *curMean  = &t.means[k * nFeatures];
-            const algorithmFPType *invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition  = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+            const algorithmFPType *curMean  = &means[k * nFeatures];
+            const algorithmFPType *invSigma = (covs->getSigma())[k];
+            const algorithmFPType addition  = logAlpha[k] + logSqrtInvDetSigma[k];
 
             for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
@@ -210,11 +211,11 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
                 PRAGMA_VECTOR_ALWAYS
                 for(size_t j = 0; j < nFeatures; j++)
                 {
-                    algorithmFPType x_mu  = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp                   += x_mu * x_mu * invSigma[j];
+                    algorithmFPType x_mu_j  = dataBlock[i * nFeatures + j] - curMean[j];
+                    tp                     += x_mu_j * x_mu_j * invSigma[j];
                 }
 
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
+                p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
             }
         }
     }
@@ -222,30 +223,45 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
     {
         for(size_t k = 0; k < nComponents; k++)
         {
-            algorithmFPType *curMean = &t.means[k * nFeatures];
+            const algorithmFPType *curMean = &means[k * nFeatures];
 
             for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
                 for(size_t j = 0; j < nFeatures; j++)
                 {
-                    t.x_mu[i * nFeatures + j] = t.dataBlock[i * nFeatures + j] - curMean[j];
+                    x_mu[i * nFeatures + j] = dataBlock[i * nFeatures + j] - curMean[j];
                 }
             }
 
-            t.covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, t.x_mu, t.Ax_mu);
+            covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, x_mu, Ax_mu);
 
-            algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+            algorithmFPType addition = logAlpha[k] + logSqrtInvDetSigma[k];
             for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                t.p[k * nVectorsInCurrentBlock + i] = 0.0;
+                p[k * nVectorsInCurrentBlock + i] = 0.0;
                 for(size_t j = 0; j < nFeatures; j++)
                 {
-                    t.p[k * nVectorsInCurrentBlock + i] += t.x_mu[i * nFeatures + j] * t.Ax_mu[i * nFeatures + j];
+                    p[k * nVectorsInCurrentBlock + i] += x_mu[i * nFeatures + j] * Ax_mu[i * nFeatures + j];
                 }
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * t.p[k * nVectorsInCurrentBlock + i];
+                p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * p[k * nVectorsInCurrentBlock + i];
             }
         }
     }
+}
+
+/**
+ * Function computes t.w values that stores weight of each data point belongs to each cluster.
+ * t.s is computed by numeric stable log-sum-exp trick.
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> &t, const em_gmm::CovarianceStorageId covType)
+{
+    const size_t nComponents = t.nComponents;
+    const size_t nFeatures   = t.nFeatures;
+
+    computeLogWeightedDensities<algorithmFPType, cpu>(nVectorsInCurrentBlock, nFeatures, nComponents,
+                                                      t.dataBlock, t.logAlpha, t.means, t.logSqrtInvDetSigma, t.covs, covType,
+                                                      t.x_mu, t.Ax_mu, t.p);
 
     t.partLogLikelyhood = 0;
     algorithmFPType *maxInRow = t.rowSum;
@@ -428,6 +428,78 @@ struct Task
     size_t nComponents;
 };
 
+/**
+ * Gaussian mixture model with fixed weights, means and inverted covariances of the components.
+ * It is used to compute the E-step outside of the iterations of the batch algorithm
+ */
+template<typename algorithmFPType, CpuType cpu>
+class GmmScoringModel
+{
+public:
+    typedef SharedPtr<GmmModel<algorithmFPType, cpu> > GmmModelPtr;
+
+    GmmScoringModel(size_t _nFeatures, size_t _nComponents) :
+        nFeatures(_nFeatures), nComponents(_nComponents), logAlpha(nullptr), means(nullptr) {}
+
+    Status init(NumericTable &weightsTable, NumericTable &meansTable, NumericTable **covariancesTables,
+                const CovarianceStorageId covarianceStorage, const double regularizationFactor)
+    {
+        if(covarianceStorage == diagonal)
+        {
+            covs = GmmModelPtr(new GmmModelDiag<algorithmFPType, cpu>(nFeatures, nComponents));
+        }
+        else
+        {
+            covs = GmmModelPtr(new GmmModelFull<algorithmFPType, cpu>(nFeatures, nComponents));
+        }
+        DAAL_CHECK_MALLOC(covs && covs->getSigma() && covs->getLogSqrtInvDetSigma())
+        covs->setCovRegularizer(regularizationFactor);
+
+        const size_t sizeOfOneCov = covs->getOneCovSize();
+        const size_t nRowsInCov   = covs->getNumberOfRowsInCov();
+        modelBufferPtr.reset(nComponents + nComponents * nFeatures + nComponents * sizeOfOneCov);
+        DAAL_CHECK_MALLOC(modelBufferPtr.get())
+        logAlpha = modelBufferPtr.get();
+        means    = &logAlpha[nComponents];
+        algorithmFPType *sigmaBuffer = &means[nComponents * nFeatures];
+
+        ReadRows<algorithmFPType, cpu, NumericTable> weightsBD(weightsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(weightsBD)
+        const size_t weightsSize = nComponents * sizeof(algorithmFPType);
+        daal_memcpy_s(logAlpha, weightsSize, weightsBD.get(), weightsSize);
+
+        ReadRows<algorithmFPType, cpu, NumericTable> meansBD(meansTable, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(meansBD)
+        const size_t meansSize = nComponents * nFeatures * sizeof(algorithmFPType);
+        daal_memcpy_s(means, meansSize, meansBD.get(), meansSize);
+
+        algorithmFPType **sigma = covs->getSigma();
+        const size_t covSize = sizeOfOneCov * sizeof(algorithmFPType);
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            sigma[k] = &sigmaBuffer[k * sizeOfOneCov];
+            ReadRows<algorithmFPType, cpu, NumericTable> covBD(covariancesTables[k], 0, nRowsInCov);
+            DAAL_CHECK_BLOCK_STATUS(covBD)
+            daal_memcpy_s(sigma[k], covSize, covBD.get(), covSize);
+        }
+
+        Status s;
+        DAAL_CHECK_STATUS(s, covs->computeSigmaInverse(0))
+        Math<algorithmFPType, cpu>::vLog(nComponents, covs->getLogSqrtInvDetSigma(), covs->getLogSqrtInvDetSigma());
+        Math<algorithmFPType, cpu>::vLog(nComponents, logAlpha, logAlpha);
+        return s;
+    }
+
+    size_t nFeatures;
+    size_t nComponents;
+    algorithmFPType *logAlpha;      /* Logarithms of the weights of the components */
+    algorithmFPType *means;
+    GmmModelPtr covs;               /* Inverted covariances and logarithms of square roots of their inverted determinants */
+
+private:
+    TArray<algorithmFPType, cpu> modelBufferPtr;
+};
+
 } // namespace internal
 
 } // namespace em_gmm
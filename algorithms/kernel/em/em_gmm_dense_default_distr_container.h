@@ -0,0 +1,217 @@
+/* file: em_gmm_dense_default_distr_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM algorithm container in the distributed processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_DISTR_CONTAINER_H__
+#define __EM_GMM_DENSE_DEFAULT_DISTR_CONTAINER_H__
+
+#include "em_gmm_distributed.h"
+#include "em_gmm_dense_default_distr_kernel.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+/**
+ *  \brief Initialize list of EM for GMM kernels with implementations for supported architectures
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::EMDistributedStep1Kernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    NumericTable *dataTable = input->get(data).get();
+    NumericTable *inWeights = input->get(inputWeights).get();
+    NumericTable *inMeans   = input->get(inputMeans).get();
+    daal::internal::TArray<NumericTable *, cpu> inCovariancesPtr(nComponents);
+    daal::internal::TArray<NumericTable *, cpu> crossProductsPtr(nComponents);
+    NumericTable **inCovariances = inCovariancesPtr.get();
+    NumericTable **crossProducts = crossProductsPtr.get();
+    DAAL_CHECK_MALLOC(inCovariances && crossProducts)
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        inCovariances[i] = input->get(inputCovariances, i).get();
+        crossProducts[i] = pres->get(partialCrossProducts, i).get();
+    }
+
+    NumericTable *sumOfWeights = pres->get(partialSumOfWeights).get();
+    NumericTable *means        = pres->get(partialMeans).get();
+    NumericTable *goal         = pres->get(partialGoalFunction).get();
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMDistributedStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       *dataTable, *inWeights, *inMeans, inCovariances, *sumOfWeights, *means, crossProducts, *goal, *emPar)
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::EMDistributedStep2Kernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput *input = static_cast<DistributedStep2MasterInput *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    data_management::DataCollection *dcInput = input->get(partialResults).get();
+    size_t nBlocks = dcInput->size();
+
+    daal::internal::TArray<NumericTable *, cpu> inSumOfWeightsPtr(nBlocks);
+    daal::internal::TArray<NumericTable *, cpu> inMeansPtr(nBlocks);
+    daal::internal::TArray<NumericTable *, cpu> inGoalPtr(nBlocks);
+    daal::internal::TArray<NumericTable *, cpu> inCrossProductsPtr(nBlocks * nComponents);
+    daal::internal::TArray<NumericTable *, cpu> crossProductsPtr(nComponents);
+    NumericTable **inSumOfWeights  = inSumOfWeightsPtr.get();
+    NumericTable **inMeans         = inMeansPtr.get();
+    NumericTable **inGoal          = inGoalPtr.get();
+    NumericTable **inCrossProducts = inCrossProductsPtr.get();
+    NumericTable **crossProducts   = crossProductsPtr.get();
+    DAAL_CHECK_MALLOC(inSumOfWeights && inMeans && inGoal && inCrossProducts && crossProducts)
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResult *inPres = static_cast<PartialResult *>((*dcInput)[i].get());
+        inSumOfWeights[i] = inPres->get(partialSumOfWeights).get();
+        inMeans[i]        = inPres->get(partialMeans).get();
+        inGoal[i]         = inPres->get(partialGoalFunction).get();
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            inCrossProducts[i * nComponents + k] = inPres->get(partialCrossProducts, k).get();
+        }
+    }
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        crossProducts[k] = pres->get(partialCrossProducts, k).get();
+    }
+
+    NumericTable *sumOfWeights = pres->get(partialSumOfWeights).get();
+    NumericTable *means        = pres->get(partialMeans).get();
+    NumericTable *goal         = pres->get(partialGoalFunction).get();
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       nBlocks, inSumOfWeights, inMeans, inCrossProducts, inGoal, *sumOfWeights, *means, crossProducts, *goal, *emPar)
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    Result *pRes = static_cast<Result *>(_res);
+    const Parameter *emPar = static_cast<Parameter *>(_par);
+    size_t nComponents = emPar->nComponents;
+
+    daal::internal::TArray<NumericTable *, cpu> crossProductsPtr(nComponents);
+    daal::internal::TArray<NumericTable *, cpu> resultCovariancesPtr(nComponents);
+    NumericTable **crossProducts     = crossProductsPtr.get();
+    NumericTable **resultCovariances = resultCovariancesPtr.get();
+    DAAL_CHECK_MALLOC(crossProducts && resultCovariances)
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        crossProducts[k]     = pres->get(partialCrossProducts, k).get();
+        resultCovariances[k] = pRes->get(covariances, k).get();
+    }
+
+    NumericTable *sumOfWeights = pres->get(partialSumOfWeights).get();
+    NumericTable *means        = pres->get(partialMeans).get();
+    NumericTable *goal         = pres->get(partialGoalFunction).get();
+
+    NumericTable *resultWeights      = pRes->get(weights).get();
+    NumericTable *resultMeans        = pRes->get(em_gmm::means).get();
+    NumericTable *resultGoalFunction = pRes->get(goalFunction).get();
+    NumericTable *resultNIterations  = pRes->get(nIterations).get();
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::EMDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       *sumOfWeights, *means, crossProducts, *goal,
+                       *resultWeights, *resultMeans, resultCovariances, *resultNIterations, *resultGoalFunction, *emPar)
+}
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,403 @@
+/* file: em_gmm_dense_default_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of the EM for GMM algorithm in the distributed processing mode
+//--
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "em_gmm_dense_default_distr_kernel.h"
+#include "em_gmm_dense_default_batch_impl.i"
+#include "threading.h"
+#include "service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+/**
+ * Function copies the lower triangle of the full cross-product matrix into its upper triangle
+ */
+template<typename algorithmFPType>
+void symmetrizeCrossProduct(algorithmFPType *cp, size_t nFeatures)
+{
+    for(size_t i = 0; i < nFeatures; i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            cp[j * nFeatures + i] = cp[i * nFeatures + j];
+        }
+    }
+}
+
+/**
+ * Sufficient statistics of the M-step stored in the partial result tables
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct PartialSums
+{
+    PartialSums(size_t _nComponents) : nComponents(_nComponents), cpBD(_nComponents), cpPtr(_nComponents) {}
+
+    Status set(NumericTable &sumOfWeightsTable, NumericTable &meansTable, NumericTable **crossProductsTables,
+               NumericTable &goalFunctionTable, size_t nRowsInCov)
+    {
+        sumOfWeights = sumOfWeightsBD.set(sumOfWeightsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sumOfWeightsBD)
+        means = meansBD.set(meansTable, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(meansBD)
+        goalFunction = goalFunctionBD.set(goalFunctionTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(goalFunctionBD)
+
+        DAAL_CHECK_MALLOC(cpBD.get() && cpPtr.get())
+        crossProducts = cpPtr.get();
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            crossProducts[k] = cpBD[k].set(crossProductsTables[k], 0, nRowsInCov);
+            DAAL_CHECK_BLOCK_STATUS(cpBD[k])
+        }
+        return Status();
+    }
+
+    void setToZero(size_t nFeatures, size_t sizeOfOneCov)
+    {
+        for(size_t k = 0; k < nComponents; k++) { sumOfWeights[k] = 0; }
+        for(size_t i = 0; i < nComponents * nFeatures; i++) { means[i] = 0; }
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            for(size_t i = 0; i < sizeOfOneCov; i++) { crossProducts[k][i] = 0; }
+        }
+        goalFunction[0] = 0;
+    }
+
+    size_t nComponents;
+    algorithmFPType *sumOfWeights;
+    algorithmFPType *means;
+    algorithmFPType **crossProducts;
+    algorithmFPType *goalFunction;
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> sumOfWeightsBD;
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> meansBD;
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> goalFunctionBD;
+    TArray<WriteOnlyRows<algorithmFPType, cpu, NumericTable>, cpu> cpBD;
+    TArray<algorithmFPType *, cpu> cpPtr;
+};
+
+/**
+ * Function computes the E-step on the local data and sufficient statistics of the M-step:
+ * sums of responsibilities, weighted means and weighted cross-products centered on the means
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMDistributedStep1Kernel<algorithmFPType, method, cpu>::compute(
+    NumericTable &dataTable,
+    NumericTable &inputWeights, NumericTable &inputMeans, NumericTable **inputCovariances,
+    NumericTable &partialSumOfWeights, NumericTable &partialMeans, NumericTable **partialCrossProducts,
+    NumericTable &partialGoalFunction,
+    const Parameter &par)
+{
+    typedef EMKernelTask<algorithmFPType, method, cpu> EMTask;
+
+    const size_t nFeatures   = dataTable.getNumberOfColumns();
+    const size_t nVectors    = dataTable.getNumberOfRows();
+    const size_t nComponents = par.nComponents;
+    const CovarianceStorageId covType = par.covarianceStorage;
+
+    GmmScoringModel<algorithmFPType, cpu> model(nFeatures, nComponents);
+    Status s;
+    DAAL_CHECK_STATUS(s, model.init(inputWeights, inputMeans, inputCovariances, covType, par.regularizationFactor))
+
+    GmmModel<algorithmFPType, cpu> *covs = model.covs.get();
+    algorithmFPType *logAlpha = model.logAlpha;
+    algorithmFPType *means    = model.means;
+    const size_t sizeOfOneCov = covs->getOneCovSize();
+
+    size_t blockSizeDefault = 512;
+    size_t nBlocks = nVectors / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != nVectors);
+    if(nBlocks == 1)
+    {
+        blockSizeDefault = nVectors;
+    }
+
+    NumericTable *dataTablePtr = &dataTable;
+    daal::tls<Task<algorithmFPType, cpu> *> threadBuffer( [ = ]()-> Task<algorithmFPType, cpu> *
+    {
+        return new Task<algorithmFPType, cpu>(*dataTablePtr, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs);
+    } );
+
+    SafeStatus safeStat;
+    daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &safeStat](size_t iBlock)
+    {
+        size_t j0 = iBlock * blockSizeDefault;
+        size_t nVectorsInCurrentBlock = blockSizeDefault;
+        if( iBlock == nBlocks - 1 )
+        {
+            nVectorsInCurrentBlock = nVectors - iBlock * blockSizeDefault;
+        }
+
+        Task<algorithmFPType, cpu> *tPtr = threadBuffer.local();
+        DAAL_CHECK_THR(tPtr && tPtr->localBuffer, ErrorMemoryAllocationFailed)
+        Task<algorithmFPType, cpu> &t = *tPtr;
+
+        Status localStatus = t.next(j0, nVectorsInCurrentBlock);
+        DAAL_CHECK_STATUS_THR(localStatus);
+
+        EMTask::stepE(nVectorsInCurrentBlock, t, covType);
+
+        t.logLikelyhood += EMTask::computePartialLogLikelyhood(nVectorsInCurrentBlock, t);
+
+        localStatus |= EMTask::stepM_partial(nVectorsInCurrentBlock, t);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    } );
+
+    PartialSums<algorithmFPType, cpu> sums(nComponents);
+    if(safeStat)
+    {
+        safeStat |= sums.set(partialSumOfWeights, partialMeans, partialCrossProducts, partialGoalFunction, covs->getNumberOfRowsInCov());
+    }
+
+    const bool mergeFlag = safeStat.ok();
+    if(mergeFlag)
+    {
+        sums.setToZero(nFeatures, sizeOfOneCov);
+    }
+
+    threadBuffer.reduce( [ =, &sums ](Task<algorithmFPType, cpu> *e)-> void
+    {
+        if(mergeFlag)
+        {
+            sums.goalFunction[0] += e->logLikelyhood;
+            for(size_t k = 0; k < nComponents; k++)
+            {
+                if(e->mergedWSums[k] > MinVal<algorithmFPType, cpu>::get())
+                {
+                    EMTask::stepM_mergePartialSums(
+                        sums.crossProducts[k],          &e->mergedPartialCP[k * sizeOfOneCov],
+                        &sums.means[k * nFeatures],     &e->mergedPartialMeans[k * nFeatures],
+                        sums.sumOfWeights[k],           e->mergedWSums[k],
+                        nFeatures, covs
+                    );
+                }
+            }
+        }
+        delete e;
+    } );
+    DAAL_CHECK_SAFE_STATUS()
+
+    algorithmFPType pi = 3.1415926535897932384626433;
+    sums.goalFunction[0] -= 0.5 * nVectors * nFeatures * Math<algorithmFPType, cpu>::sLog(2 * pi);
+
+    if(covType == full)
+    {
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            symmetrizeCrossProduct<algorithmFPType>(sums.crossProducts[k], nFeatures);
+        }
+    }
+    return s;
+}
+
+/**
+ * Function merges sufficient statistics computed on local nodes
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(
+    size_t nBlocks,
+    NumericTable **inSumOfWeights, NumericTable **inMeans, NumericTable **inCrossProducts, NumericTable **inGoalFunction,
+    NumericTable &partialSumOfWeights, NumericTable &partialMeans, NumericTable **partialCrossProducts,
+    NumericTable &partialGoalFunction,
+    const Parameter &par)
+{
+    typedef EMKernelTask<algorithmFPType, method, cpu> EMTask;
+
+    const size_t nFeatures   = partialMeans.getNumberOfColumns();
+    const size_t nComponents = par.nComponents;
+
+    UniquePtr<GmmModel<algorithmFPType, cpu>, cpu> covsPtr;
+    if(par.covarianceStorage == diagonal)
+    {
+        covsPtr.reset(new GmmModelDiag<algorithmFPType, cpu>(nFeatures, nComponents));
+    }
+    else
+    {
+        covsPtr.reset(new GmmModelFull<algorithmFPType, cpu>(nFeatures, nComponents));
+    }
+    GmmModel<algorithmFPType, cpu> *covs = covsPtr.get();
+    DAAL_CHECK_MALLOC(covs)
+    const size_t sizeOfOneCov = covs->getOneCovSize();
+    const size_t nRowsInCov   = covs->getNumberOfRowsInCov();
+
+    Status s;
+    PartialSums<algorithmFPType, cpu> sums(nComponents);
+    DAAL_CHECK_STATUS(s, sums.set(partialSumOfWeights, partialMeans, partialCrossProducts, partialGoalFunction, nRowsInCov))
+    sums.setToZero(nFeatures, sizeOfOneCov);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> sumOfWeightsBD(inSumOfWeights[i], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sumOfWeightsBD)
+        ReadRows<algorithmFPType, cpu, NumericTable> meansBD(inMeans[i], 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(meansBD)
+        ReadRows<algorithmFPType, cpu, NumericTable> goalFunctionBD(inGoalFunction[i], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(goalFunctionBD)
+
+        algorithmFPType *blockSumOfWeights = const_cast<algorithmFPType *>(sumOfWeightsBD.get());
+        algorithmFPType *blockMeans        = const_cast<algorithmFPType *>(meansBD.get());
+        sums.goalFunction[0] += goalFunctionBD.get()[0];
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            if(blockSumOfWeights[k] > MinVal<algorithmFPType, cpu>::get())
+            {
+                ReadRows<algorithmFPType, cpu, NumericTable> cpBD(inCrossProducts[i * nComponents + k], 0, nRowsInCov);
+                DAAL_CHECK_BLOCK_STATUS(cpBD)
+                EMTask::stepM_mergePartialSums(
+                    sums.crossProducts[k],      const_cast<algorithmFPType *>(cpBD.get()),
+                    &sums.means[k * nFeatures], &blockMeans[k * nFeatures],
+                    sums.sumOfWeights[k],       blockSumOfWeights[k],
+                    nFeatures, covs
+                );
+            }
+        }
+    }
+
+    if(par.covarianceStorage == full)
+    {
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            symmetrizeCrossProduct<algorithmFPType>(sums.crossProducts[k], nFeatures);
+        }
+    }
+    return s;
+}
+
+/**
+ * Function computes the M-step from the merged sufficient statistics
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMDistributedStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(
+    NumericTable &partialSumOfWeights, NumericTable &partialMeans, NumericTable **partialCrossProducts,
+    NumericTable &partialGoalFunction,
+    NumericTable &resultWeights, NumericTable &resultMeans, NumericTable **resultCovariances,
+    NumericTable &resultNIterations, NumericTable &resultGoalFunction,
+    const Parameter &par)
+{
+    const size_t nFeatures   = partialMeans.getNumberOfColumns();
+    const size_t nComponents = par.nComponents;
+    const size_t nRowsInCov  = (par.covarianceStorage == diagonal ? 1 : nFeatures);
+    const size_t sizeOfOneCov = nRowsInCov * nFeatures;
+
+    ReadRows<algorithmFPType, cpu, NumericTable> sumOfWeightsBD(partialSumOfWeights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumOfWeightsBD)
+    ReadRows<algorithmFPType, cpu, NumericTable> meansBD(partialMeans, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(meansBD)
+    ReadRows<algorithmFPType, cpu, NumericTable> goalFunctionBD(partialGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(goalFunctionBD)
+    const algorithmFPType *sumOfWeights = sumOfWeightsBD.get();
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> weightsBD(resultWeights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(weightsBD)
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> resultMeansBD(resultMeans, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(resultMeansBD)
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> resultGoalFunctionBD(resultGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resultGoalFunctionBD)
+    WriteOnlyRows<int, cpu, NumericTable> nIterationsBD(resultNIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD)
+
+    algorithmFPType totalSumOfWeights = 0;
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        if(sumOfWeights[k] < MinVal<algorithmFPType, cpu>::get())
+        {
+            return Status(Error::create(ErrorEMCovariance, Component, k));
+        }
+        totalSumOfWeights += sumOfWeights[k];
+    }
+
+    algorithmFPType *alpha = weightsBD.get();
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        alpha[k] = sumOfWeights[k] / totalSumOfWeights;
+    }
+
+    const size_t meansSize = nComponents * nFeatures * sizeof(algorithmFPType);
+    daal_memcpy_s(resultMeansBD.get(), meansSize, meansBD.get(), meansSize);
+
+    for(size_t k = 0; k < nComponents; k++)
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> cpBD(partialCrossProducts[k], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS(cpBD)
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> covBD(resultCovariances[k], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS(covBD)
+
+        const algorithmFPType *cp = cpBD.get();
+        algorithmFPType *cov = covBD.get();
+        const algorithmFPType multiplier = 1.0 / sumOfWeights[k];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < sizeOfOneCov; i++)
+        {
+            cov[i] = cp[i] * multiplier;
+        }
+    }
+
+    resultGoalFunctionBD.get()[0] = goalFunctionBD.get()[0];
+    nIterationsBD.get()[0] = 1;
+    return Status();
+}
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,124 @@
+/* file: em_gmm_dense_default_distr_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template functions that compute the EM for GMM algorithm in the distributed processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_DISTR_KERNEL_H__
+#define __EM_GMM_DENSE_DEFAULT_DISTR_KERNEL_H__
+
+#include "em_gmm_types.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "em_gmm_dense_default_batch_task.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+
+/**
+ * Computes one E-step on the local data for the given weights, means and covariances of the components
+ * and returns sufficient statistics of the M-step
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class EMDistributedStep1Kernel : public Kernel
+{
+public:
+    services::Status compute(NumericTable &dataTable,
+                             NumericTable &inputWeights,
+                             NumericTable &inputMeans,
+                             NumericTable **inputCovariances,
+                             NumericTable &partialSumOfWeights,
+                             NumericTable &partialMeans,
+                             NumericTable **partialCrossProducts,
+                             NumericTable &partialGoalFunction,
+                             const Parameter &par);
+};
+
+/**
+ * Merges sufficient statistics computed on local nodes and computes the M-step
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class EMDistributedStep2Kernel : public Kernel
+{
+public:
+    services::Status compute(size_t nBlocks,
+                             NumericTable **inSumOfWeights,
+                             NumericTable **inMeans,
+                             NumericTable **inCrossProducts,
+                             NumericTable **inGoalFunction,
+                             NumericTable &partialSumOfWeights,
+                             NumericTable &partialMeans,
+                             NumericTable **partialCrossProducts,
+                             NumericTable &partialGoalFunction,
+                             const Parameter &par);
+
+    services::Status finalizeCompute(NumericTable &partialSumOfWeights,
+                                     NumericTable &partialMeans,
+                                     NumericTable **partialCrossProducts,
+                                     NumericTable &partialGoalFunction,
+                                     NumericTable &resultWeights,
+                                     NumericTable &resultMeans,
+                                     NumericTable **resultCovariances,
+                                     NumericTable &resultNIterations,
+                                     NumericTable &resultGoalFunction,
+                                     const Parameter &par);
+};
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,96 @@
+/* file: em_gmm_partialresult.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM partial result.
+//--
+*/
+
+#ifndef __EM_GMM_PARTIALRESULT_
+#define __EM_GMM_PARTIALRESULT_
+
+#include "em_gmm_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+/**
+ * Allocates memory for storing partial results of the EM for GMM algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures   = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+    size_t nComponents = algParameter->nComponents;
+    size_t nRowsInCov  = (algParameter->covarianceStorage == diagonal ? 1 : nFeatures);
+
+    services::Status status;
+
+    set(partialSumOfWeights, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, 0, &status));
+    set(partialMeans, HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, 0, &status));
+    set(partialGoalFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, 0, &status));
+
+    DataCollectionPtr crossProductsCollection = DataCollectionPtr(new DataCollection());
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        crossProductsCollection->push_back(HomogenNumericTable<algorithmFPType>::create(nFeatures, nRowsInCov, NumericTable::doAllocate, 0, &status));
+    }
+    set(partialCrossProducts, crossProductsCollection);
+    return status;
+}
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,188 @@
+/* file: em_gmm_partialresult_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM partial result.
+//--
+*/
+
+#include "em_gmm_types.h"
+#include "daal_defines.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID);
+
+/** Default constructor */
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultCrossProductsId + 1)
+{
+    Argument::set(partialCrossProducts, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Sets the partial result of the EM for GMM algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the numeric table with the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the collection of partial cross-products of the EM for GMM algorithm
+ * \param[in] id    Identifier of the collection of partial cross-products
+ * \param[in] ptr   Pointer to the collection of partial cross-products
+ */
+void PartialResult::set(PartialResultCrossProductsId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the partial result of the EM for GMM algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the collection of partial cross-products of the EM for GMM algorithm
+ * \param[in] id   Identifier of the collection of partial cross-products
+ * \return         Collection of partial cross-products that corresponds to the given identifier
+ */
+DataCollectionPtr PartialResult::get(PartialResultCrossProductsId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the partial cross-product with a given index from the collection of partial cross-products
+ * \param[in] id    Identifier of the collection of partial cross-products
+ * \param[in] index Index of the partial cross-product to be returned
+ * \return          Pointer to the table with the partial cross-product
+ */
+NumericTablePtr PartialResult::get(PartialResultCrossProductsId id, size_t index) const
+{
+    DataCollectionPtr crossProductsCollection = this->get(id);
+    return staticPointerCast<NumericTable, SerializationIface>((*crossProductsCollection)[index]);
+}
+
+/**
+ * Returns the number of features in the partial results
+ * \return Number of features in the partial results
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    NumericTablePtr meansTable = get(partialMeans);
+    return (meansTable ? meansTable->getNumberOfColumns() : 0);
+}
+
+/**
+ * Checks partial results of the EM for GMM algorithm
+ * \param[in] input   %Input of the algorithm
+ * \param[in] par     %Parameter of algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    return checkImpl(static_cast<const InputIface *>(input)->getNumberOfFeatures(), par);
+}
+
+/**
+ * Checks partial results of the EM for GMM algorithm
+ * \param[in] par     %Parameter of algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    return checkImpl(getNumberOfFeatures(), par);
+}
+
+services::Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    size_t nComponents = algParameter->nComponents;
+    DAAL_CHECK(nFeatures > 0, ErrorIncorrectNumberOfFeatures);
+
+    services::Status s;
+    int unexpectedLayouts = packed_mask;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSumOfWeights).get(), partialSumOfWeightsStr(), unexpectedLayouts, 0, nComponents, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMeans).get(), partialMeansStr(), unexpectedLayouts, 0, nFeatures, nComponents));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialGoalFunction).get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1));
+
+    DataCollectionPtr crossProductsCollection = get(partialCrossProducts);
+    DAAL_CHECK(crossProductsCollection, ErrorNullPartialResultDataCollection);
+    DAAL_CHECK(crossProductsCollection->size() == nComponents, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    size_t nRowsInCov = (algParameter->covarianceStorage == diagonal ? 1 : nFeatures);
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        SerializationIfacePtr collectionElement = (*crossProductsCollection)[i];
+        DAAL_CHECK_EX(collectionElement, ErrorNullNumericTable, ArgumentName, partialCrossProductsStr());
+
+        NumericTablePtr nt = NumericTable::cast(collectionElement);
+        DAAL_CHECK_EX(nt, ErrorIncorrectElementInCollection, ArgumentName, partialCrossProductsStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(nt.get(), partialCrossProductsStr(), unexpectedLayouts, 0, nFeatures, nRowsInCov));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
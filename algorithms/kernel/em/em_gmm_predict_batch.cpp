@@ -0,0 +1,249 @@
+/* file: em_gmm_predict_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM prediction algorithm interface.
+//--
+*/
+
+#include "em_gmm_predict_types.h"
+#include "daal_defines.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace prediction
+{
+namespace interface1
+{
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_EM_GMM_PREDICTION_RESULT_ID);
+
+/**
+ * Constructs the parameter of the EM for GMM prediction algorithm
+ * \param[in] nComponents              Number of components in the Gaussian mixture model
+ * \param[in] regularizationFactor     Factor for covariance regularization in case of ill-conditional data
+ * \param[in] covarianceStorage        Type of covariance in the Gaussian mixture model.
+ */
+Parameter::Parameter(const size_t _nComponents,
+                     const double _regularizationFactor,
+                     const CovarianceStorageId _covarianceStorage) :
+    nComponents(_nComponents),
+    regularizationFactor(_regularizationFactor),
+    covarianceStorage(_covarianceStorage)
+{}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(nComponents > 0, ErrorEMIncorrectNumberOfComponents, ParameterName, nComponentsStr());
+    DAAL_CHECK(regularizationFactor >= 0, ErrorIncorrectParameter);
+    return services::Status();
+}
+
+/** Default constructor */
+Input::Input() : daal::algorithms::Input(lastInputValuesId + 1)
+{}
+
+/**
+ * Sets one input object for the EM for GMM prediction algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the input covariance object for the EM for GMM prediction algorithm
+ * \param[in] id    Identifier of the input covariance collection object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputCovariancesId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets weights, means and covariances of the components for the EM for GMM prediction algorithm
+ * \param[in] id    Identifier of the input values object. Result of the EM for GMM algorithm
+ *                  in the batch or distributed processing mode can be used.
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputValuesId id, const em_gmm::ResultPtr &ptr)
+{
+    if(ptr)
+    {
+        set(inputWeights,     ptr->get(em_gmm::weights));
+        set(inputMeans,       ptr->get(em_gmm::means));
+        set(inputCovariances, ptr->get(em_gmm::covariances));
+    }
+}
+
+/**
+ * Returns the input numeric table for the EM for GMM prediction algorithm
+ * \param[in] id    Identifier of the input numeric table
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the collection of input covariances for the EM for GMM prediction algorithm
+ * \param[in] id    Identifier of the collection of input covariances
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr Input::get(InputCovariancesId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns a covariance with a given index from the collection of input covariances
+ * \param[in] id    Identifier of the collection of input covariances
+ * \param[in] index Index of the covariance to be returned
+ * \return          Pointer to the table with the input covariance
+ */
+NumericTablePtr Input::get(InputCovariancesId id, size_t index) const
+{
+    DataCollectionPtr covCollection = this->get(id);
+    return staticPointerCast<NumericTable, SerializationIface>((*covCollection)[index]);
+}
+
+/**
+ * Checks the correctness of the input
+ * \param[in] par       Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    services::Status s;
+    s |= checkNumericTable(get(data).get(), dataStr());
+    if(!s) return s;
+
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    size_t nComponents = algParameter->nComponents;
+    size_t nFeatures = get(data)->getNumberOfColumns();
+
+    s |= checkNumericTable(get(inputWeights).get(), inputWeightsStr(), 0, 0, nComponents, 1);
+    if(!s) return s;
+    s |= checkNumericTable(get(inputMeans).get(), inputMeansStr(), 0, 0, nFeatures, nComponents);
+    if(!s) return s;
+
+    DataCollectionPtr inputCovCollection = get(inputCovariances);
+    DAAL_CHECK(inputCovCollection, ErrorNullInputDataCollection);
+    DAAL_CHECK(inputCovCollection->size() == nComponents, ErrorIncorrectNumberOfInputNumericTables);
+
+    int unexpectedLayoutCovariance = (int)(NumericTableIface::upperPackedTriangularMatrix | NumericTableIface::lowerPackedTriangularMatrix);
+    size_t nCovColumns = (algParameter->covarianceStorage == full ? nFeatures : 1);
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        SerializationIfacePtr collectionElement = (*inputCovCollection)[i];
+        DAAL_CHECK_EX(collectionElement, ErrorNullNumericTable, ArgumentName, inputCovariancesStr());
+
+        NumericTablePtr nt = NumericTable::cast(collectionElement);
+        DAAL_CHECK_EX(nt, ErrorIncorrectElementInCollection, ArgumentName, inputCovariancesStr());
+        s |= checkNumericTable(nt.get(), inputCovariancesStr(), unexpectedLayoutCovariance, 0, nFeatures, nCovColumns);
+        if(!s) return s;
+    }
+    return s;
+}
+
+/** Default constructor */
+Result::Result() : daal::algorithms::Result(lastResultId + 1)
+{}
+
+/**
+ * Sets the result of the EM for GMM prediction algorithm
+ * \param[in] id    %Result identifier
+ * \param[in] ptr   Pointer to the numeric table with the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the result of the EM for GMM prediction algorithm
+ * \param[in] id   %Result identifier
+ * \return         %Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+* Checks the result of the EM for GMM prediction algorithm
+* \param[in] input   %Input of the algorithm
+* \param[in] par     %Parameter of algorithm
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    size_t nVectors = algInput->get(data)->getNumberOfRows();
+
+    services::Status s;
+    int unexpectedLayouts = packed_mask;
+    s |= checkNumericTable(get(responsibilities).get(), responsibilitiesStr(), unexpectedLayouts, 0, algParameter->nComponents, nVectors);
+    if(!s) return s;
+    s |= checkNumericTable(get(logLikelihood).get(), logLikelihoodStr(), unexpectedLayouts, 0, 1, nVectors);
+    return s;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
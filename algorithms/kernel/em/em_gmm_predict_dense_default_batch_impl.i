@@ -0,0 +1,254 @@
+/* file: em_gmm_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of the EM for GMM prediction algorithm
+//--
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "em_gmm_predict_dense_default_batch_kernel.h"
+#include "em_gmm_dense_default_batch_impl.i"
+#include "threading.h"
+#include "service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace prediction
+{
+namespace internal
+{
+
+/**
+ * Thread local buffers used to score one block of observations
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct PredictTask
+{
+    DAAL_NEW_DELETE()
+
+    PredictTask(size_t blockSizeDefault, size_t nFeatures, size_t nComponents)
+    {
+        size_t memorySizeForOneThread = blockSizeDefault * nFeatures   + /* x_mu     */
+                                        blockSizeDefault * nFeatures   + /* Ax_mu    */
+                                        blockSizeDefault * nComponents + /* p        */
+                                        blockSizeDefault               + /* maxInRow */
+                                        blockSizeDefault               ; /* rowSum   */
+        threadBufferPtr.reset(memorySizeForOneThread);
+        localBuffer = threadBufferPtr.get();
+        if(!localBuffer) {return;}
+
+        x_mu     = localBuffer;
+        Ax_mu    = &x_mu    [blockSizeDefault * nFeatures  ];
+        p        = &Ax_mu   [blockSizeDefault * nFeatures  ];
+        maxInRow = &p       [blockSizeDefault * nComponents];
+        rowSum   = &maxInRow[blockSizeDefault              ];
+    }
+
+    TArray<algorithmFPType, cpu> threadBufferPtr;
+    algorithmFPType *localBuffer;
+    algorithmFPType *x_mu;
+    algorithmFPType *Ax_mu;
+    algorithmFPType *p;
+    algorithmFPType *maxInRow;
+    algorithmFPType *rowSum;
+};
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status EMPredictKernel<algorithmFPType, method, cpu>::compute(
+    NumericTable &dataTable,
+    NumericTable &inputWeights, NumericTable &inputMeans, NumericTable **inputCovariances,
+    NumericTable &resultResponsibilities, NumericTable &resultLogLikelihood,
+    const Parameter &par)
+{
+    const size_t nFeatures   = dataTable.getNumberOfColumns();
+    const size_t nVectors    = dataTable.getNumberOfRows();
+    const size_t nComponents = par.nComponents;
+    const CovarianceStorageId covType = par.covarianceStorage;
+
+    em_gmm::internal::GmmScoringModel<algorithmFPType, cpu> model(nFeatures, nComponents);
+    Status s;
+    DAAL_CHECK_STATUS(s, model.init(inputWeights, inputMeans, inputCovariances, covType, par.regularizationFactor))
+
+    em_gmm::internal::GmmModel<algorithmFPType, cpu> *covs = model.covs.get();
+    const algorithmFPType *logAlpha = model.logAlpha;
+    const algorithmFPType *means    = model.means;
+    const algorithmFPType *logSqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
+
+    algorithmFPType pi = 3.1415926535897932384626433;
+    const algorithmFPType logNormConst = 0.5 * nFeatures * Math<algorithmFPType, cpu>::sLog(2 * pi);
+
+    size_t blockSizeDefault = 512;
+    size_t nBlocks = nVectors / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != nVectors);
+    if(nBlocks == 1)
+    {
+        blockSizeDefault = nVectors;
+    }
+
+    daal::tls<PredictTask<algorithmFPType, cpu> *> threadBuffer( [ = ]()-> PredictTask<algorithmFPType, cpu> *
+    {
+        return new PredictTask<algorithmFPType, cpu>(blockSizeDefault, nFeatures, nComponents);
+    } );
+
+    NumericTable *dataTablePtr = &dataTable;
+    NumericTable *responsibilitiesPtr = &resultResponsibilities;
+    NumericTable *logLikelihoodPtr = &resultLogLikelihood;
+
+    SafeStatus safeStat;
+    daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &safeStat](size_t iBlock)
+    {
+        size_t j0 = iBlock * blockSizeDefault;
+        size_t nVectorsInCurrentBlock = blockSizeDefault;
+        if( iBlock == nBlocks - 1 )
+        {
+            nVectorsInCurrentBlock = nVectors - iBlock * blockSizeDefault;
+        }
+
+        PredictTask<algorithmFPType, cpu> *tPtr = threadBuffer.local();
+        DAAL_CHECK_THR(tPtr && tPtr->localBuffer, ErrorMemoryAllocationFailed)
+        PredictTask<algorithmFPType, cpu> &t = *tPtr;
+
+        ReadRows<algorithmFPType, cpu, NumericTable> dataBD(dataTablePtr, j0, nVectorsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBD)
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> respBD(responsibilitiesPtr, j0, nVectorsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(respBD)
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> logLikBD(logLikelihoodPtr, j0, nVectorsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(logLikBD)
+
+        em_gmm::internal::computeLogWeightedDensities<algorithmFPType, cpu>(nVectorsInCurrentBlock, nFeatures, nComponents,
+                dataBD.get(), logAlpha, means, logSqrtInvDetSigma, covs, covType, t.x_mu, t.Ax_mu, t.p);
+
+        algorithmFPType *p = t.p;
+        algorithmFPType *maxInRow = t.maxInRow;
+        algorithmFPType *rowSum = t.rowSum;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            maxInRow[i] = p[i];
+            rowSum[i] = 0;
+        }
+
+        for(size_t k = 1; k < nComponents; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                if(p[k * nVectorsInCurrentBlock + i] > maxInRow[i])
+                {
+                    maxInRow[i] = p[k * nVectorsInCurrentBlock + i];
+                }
+            }
+        }
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                p[k * nVectorsInCurrentBlock + i] -= maxInRow[i];
+                if( p[k * nVectorsInCurrentBlock + i] < em_gmm::internal::exp_threshold<algorithmFPType>() )
+                {
+                    p[k * nVectorsInCurrentBlock + i] = em_gmm::internal::exp_threshold<algorithmFPType>();
+                }
+            }
+        }
+
+        Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock * nComponents, p, p);
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                rowSum[i] += p[k * nVectorsInCurrentBlock + i];
+            }
+        }
+
+        /* Responsibilities are stored row-major: one row of nComponents posteriors per observation */
+        algorithmFPType *resp = respBD.get();
+        for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            const algorithmFPType invRowSum = 1.0 / rowSum[i];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t k = 0; k < nComponents; k++)
+            {
+                resp[i * nComponents + k] = p[k * nVectorsInCurrentBlock + i] * invRowSum;
+            }
+        }
+
+        Math<algorithmFPType, cpu>::vLog(nVectorsInCurrentBlock, rowSum, rowSum);
+
+        algorithmFPType *logLik = logLikBD.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            logLik[i] = maxInRow[i] + rowSum[i] - logNormConst;
+        }
+    } );
+
+    threadBuffer.reduce( [ = ](PredictTask<algorithmFPType, cpu> *t)-> void
+    {
+        delete t;
+    } );
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
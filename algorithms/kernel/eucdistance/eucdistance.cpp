@@ -0,0 +1,166 @@
+/* file: eucdistance.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Euclidean distance algorithm and types methods.
+//--
+*/
+
+#include "euclidean_distance_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace euclidean_distance
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_EUCLIDEAN_DISTANCE_RESULT_ID);
+
+Parameter::Parameter(bool squared) : daal::algorithms::Parameter(), squared(squared) {}
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+
+/**
+* Returns the input object of the Euclidean distance algorithm
+* \param[in] id    Identifier of the input object
+* \return          %Input object that corresponds to the given identifier
+*/
+data_management::NumericTablePtr Input::get(InputId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+* Sets the input object for the Euclidean distance algorithm
+* \param[in] id    Identifier of the input object
+* \param[in] ptr   Pointer to the object
+*/
+void Input::set(InputId id, const data_management::NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+* Checks the parameters of the Euclidean distance algorithm
+* \param[in] par     %Parameter of the algorithm
+* \param[in] method  computation method
+*/
+services::Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    NumericTablePtr dataTable = get(data);
+    services::Status s = data_management::checkNumericTable(dataTable.get(), dataStr());
+    if(!s) return s;
+
+    NumericTablePtr otherDataTable = get(otherData);
+    if(otherDataTable)
+    {
+        s |= data_management::checkNumericTable(otherDataTable.get(), otherDataStr(), 0, 0, dataTable->getNumberOfColumns());
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+
+/**
+ * Returns the result of the Euclidean distance algorithm
+ * \param[in] id   Identifier of the result
+ * \return         %Result that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Result::get(ResultId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the Euclidean distance algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the result object
+ */
+void Result::set(ResultId id, const data_management::NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+* Checks the result of the Euclidean distance algorithm
+* \param[in] input   %Input of the algorithm
+* \param[in] par     %Parameter of the algorithm
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+
+    size_t nVectors  = algInput->get(data)->getNumberOfRows();
+    NumericTablePtr otherDataTable = algInput->get(otherData);
+    if(otherDataTable)
+    {
+        /* Distances between two different sets of vectors can be stored in a full matrix only */
+        int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
+                                (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::upperPackedSymmetricMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedSymmetricMatrix;
+
+        return data_management::checkNumericTable(get(euclideanDistance).get(), euclideanDistanceStr(), unexpectedLayouts, 0,
+                                                  otherDataTable->getNumberOfRows(), nVectors);
+    }
+
+    int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
+                            (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
+                            (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
+
+    return data_management::checkNumericTable(get(euclideanDistance).get(), euclideanDistanceStr(), unexpectedLayouts, 0, nVectors, nVectors);
+}
+
+}// namespace interface1
+}// namespace euclidean_distance
+}// namespace algorithms
+}// namespace daal
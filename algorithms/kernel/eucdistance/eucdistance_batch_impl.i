@@ -0,0 +1,421 @@
+/* file: eucdistance_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Euclidean distance.
+//
+//  Distances are computed block-wise via the decomposition
+//      ||x - y||^2 = ||x||^2 + ||y||^2 - 2 * x * y'
+//  where the squared norms of the rows are computed once and the cross products
+//  of each pair of row blocks are computed with a single GEMM call.
+//--
+*/
+
+#include "daal_defines.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "threading.h"
+#include "service_error_handling.h"
+#include "service_numeric_table.h"
+#include "service_defines.h"
+
+static const int blockSizeDefault = 128;
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace euclidean_distance
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSquaredNorms(const NumericTable *xTable, algorithmFPType *norms)
+{
+    const size_t p = xTable->getNumberOfColumns();
+    const size_t n = xTable->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t k)
+    {
+        const size_t shift     = k * blockSizeDefault;
+        const size_t blockSize = (k == nBlocks - 1) ? n - shift : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType *x = xBlock.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            algorithmFPType sum = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                sum += x[i * p + j] * x[i * p + j];
+            }
+            norms[shift + i] = sum;
+        }
+    } );
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes distances between blockSize1 rows of x1 and blockSize2 rows of x2
+ *         and stores them in buf as a blockSize1 x blockSize2 row-major matrix
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeDistanceBlock(const algorithmFPType *x1, DAAL_INT blockSize1, const algorithmFPType *norms1,
+                          const algorithmFPType *x2, DAAL_INT blockSize2, const algorithmFPType *norms2,
+                          DAAL_INT p, bool squared, algorithmFPType *buf)
+{
+    algorithmFPType alpha = -2.0, beta = 0.0;
+    char transa = 'T', transb = 'N';
+    DAAL_INT m = blockSize2, nn = blockSize1, k = p;
+    DAAL_INT lda = p, ldb = p, ldc = blockSize2;
+
+    /* buf[i * blockSize2 + j] = -2 * <x1[i], x2[j]> */
+    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, x2, &lda, x1, &ldb, &beta, buf, &ldc);
+
+    const algorithmFPType zero = 0.0;
+    for (DAAL_INT i = 0; i < blockSize1; i++)
+    {
+        algorithmFPType *bufRow = buf + i * blockSize2;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < blockSize2; j++)
+        {
+            const algorithmFPType d = bufRow[j] + norms1[i] + norms2[j];
+            /* rounding errors may produce small negative values for close vectors */
+            bufRow[j] = (d > zero ? d : zero);
+        }
+    }
+
+    if (!squared)
+    {
+        Math<algorithmFPType, cpu>::vSqrt(blockSize1 * blockSize2, buf, buf);
+    }
+}
+
+/**
+ *  \brief Computes the full n x n matrix of distances between rows of xTable.
+ *         Only the blocks on and above the main diagonal are computed, the rest are mirrored
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status eucDistanceFull(const NumericTable *xTable, const algorithmFPType *norms, bool squared, NumericTable *rTable)
+{
+    const size_t p = xTable->getNumberOfColumns();
+    const size_t n = xTable->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+
+    /* compute the blocks on and above the main diagonal of the distance matrix */
+    daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t k1)
+    {
+        const size_t shift1     = k1 * blockSizeDefault;
+        const size_t blockSize1 = (k1 == nBlocks - 1) ? n - shift1 : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> xBlock1(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock1)
+        const algorithmFPType *x1 = xBlock1.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> rBlock(rTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock)
+        algorithmFPType *r = rBlock.get();
+
+        daal::threader_for(nBlocks - k1, nBlocks - k1, [ =, &safeStat ](size_t k3)
+        {
+            const size_t k2         = k1 + k3;
+            const size_t shift2     = k2 * blockSizeDefault;
+            const size_t blockSize2 = (k2 == nBlocks - 1) ? n - shift2 : blockSizeDefault;
+
+            ReadRows<algorithmFPType, cpu> xBlock2(*const_cast<NumericTable *>(xTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBlock2)
+            const algorithmFPType *x2 = xBlock2.get();
+
+            algorithmFPType buf[blockSizeDefault * blockSizeDefault];
+            computeDistanceBlock<algorithmFPType, cpu>(x1, blockSize1, norms + shift1, x2, blockSize2, norms + shift2, p, squared, buf);
+
+            if (k2 == k1)
+            {
+                for (size_t i = 0; i < blockSize1; i++)
+                {
+                    buf[i * blockSize2 + i] = 0.0;
+                }
+            }
+
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < blockSize2; j++)
+                {
+                    r[i * n + shift2 + j] = buf[i * blockSize2 + j];
+                }
+            }
+        } );
+    } );
+    DAAL_CHECK_SAFE_STATUS()
+
+    /* copy the blocks above the main diagonal into the blocks below it */
+    daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t k2)
+    {
+        const size_t shift2     = k2 * blockSizeDefault;
+        const size_t blockSize2 = (k2 == nBlocks - 1) ? n - shift2 : blockSizeDefault;
+
+        WriteRows<algorithmFPType, cpu> rBlock2(rTable, shift2, blockSize2);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock2)
+        algorithmFPType *r2 = rBlock2.get();
+
+        for (size_t k1 = 0; k1 < k2; k1++)
+        {
+            const size_t shift1 = k1 * blockSizeDefault;
+
+            ReadRows<algorithmFPType, cpu> rBlock1(*rTable, shift1, blockSizeDefault);
+            DAAL_CHECK_BLOCK_STATUS_THR(rBlock1)
+            const algorithmFPType *r1 = rBlock1.get();
+
+            for (size_t j = 0; j < blockSize2; j++)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < blockSizeDefault; i++)
+                {
+                    r2[j * n + shift1 + i] = r1[i * n + shift2 + j];
+                }
+            }
+        }
+    } );
+
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes the n x n matrix of distances between rows of xTable in packed format.
+ *         Only the blocks on and below the main diagonal are computed
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status eucDistancePacked(const NumericTable *xTable, const algorithmFPType *norms, bool squared, bool isUpper, NumericTable *rTable)
+{
+    const size_t p = xTable->getNumberOfColumns();
+    const size_t n = xTable->getNumberOfRows();
+
+    WritePacked<algorithmFPType, cpu> rBlock(rTable);
+    DAAL_CHECK_BLOCK_STATUS(rBlock)
+    algorithmFPType *r = rBlock.get();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+
+    daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t k1)
+    {
+        const size_t shift1     = k1 * blockSizeDefault;
+        const size_t blockSize1 = (k1 == nBlocks - 1) ? n - shift1 : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> xBlock1(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock1)
+        const algorithmFPType *x1 = xBlock1.get();
+
+        daal::threader_for(k1 + 1, k1 + 1, [ =, &safeStat ](size_t k2)
+        {
+            const size_t shift2     = k2 * blockSizeDefault;
+            const size_t blockSize2 = (k2 == nBlocks - 1) ? n - shift2 : blockSizeDefault;
+
+            ReadRows<algorithmFPType, cpu> xBlock2(*const_cast<NumericTable *>(xTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBlock2)
+            const algorithmFPType *x2 = xBlock2.get();
+
+            algorithmFPType buf[blockSizeDefault * blockSizeDefault];
+            computeDistanceBlock<algorithmFPType, cpu>(x1, blockSize1, norms + shift1, x2, blockSize2, norms + shift2, p, squared, buf);
+
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                const size_t gi = shift1 + i;
+                /* only the elements with column index not greater than the row index are stored */
+                const size_t nCols = (k2 == k1) ? i + 1 : blockSize2;
+                if (k2 == k1)
+                {
+                    buf[i * blockSize2 + i] = 0.0;
+                }
+
+                if (isUpper)
+                {
+                    /* element (gi, gj) is stored as (gj, gi) of the upper triangle */
+                    for (size_t j = 0; j < nCols; j++)
+                    {
+                        const size_t gj = shift2 + j;
+                        r[(2 * n - gj + 1) * gj / 2 + (gi - gj)] = buf[i * blockSize2 + j];
+                    }
+                }
+                else
+                {
+                    algorithmFPType *rr = r + gi * (gi + 1) / 2 + shift2;
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nCols; j++)
+                    {
+                        rr[j] = buf[i * blockSize2 + j];
+                    }
+                }
+            }
+        } );
+    } );
+
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes the nx x ny matrix of distances between rows of xTable and rows of yTable
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status eucDistanceCross(const NumericTable *xTable, const algorithmFPType *xNorms,
+                                  const NumericTable *yTable, const algorithmFPType *yNorms, bool squared, NumericTable *rTable)
+{
+    const size_t p  = xTable->getNumberOfColumns();
+    const size_t nx = xTable->getNumberOfRows();
+    const size_t ny = yTable->getNumberOfRows();
+
+    size_t nBlocksX = nx / blockSizeDefault;
+    nBlocksX += (nBlocksX * blockSizeDefault != nx);
+    size_t nBlocksY = ny / blockSizeDefault;
+    nBlocksY += (nBlocksY * blockSizeDefault != ny);
+
+    SafeStatus safeStat;
+
+    daal::threader_for(nBlocksX, nBlocksX, [ =, &safeStat ](size_t k1)
+    {
+        const size_t shift1     = k1 * blockSizeDefault;
+        const size_t blockSize1 = (k1 == nBlocksX - 1) ? nx - shift1 : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType *x = xBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> rBlock(rTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock)
+        algorithmFPType *r = rBlock.get();
+
+        daal::threader_for(nBlocksY, nBlocksY, [ =, &safeStat ](size_t k2)
+        {
+            const size_t shift2     = k2 * blockSizeDefault;
+            const size_t blockSize2 = (k2 == nBlocksY - 1) ? ny - shift2 : blockSizeDefault;
+
+            ReadRows<algorithmFPType, cpu> yBlock(*const_cast<NumericTable *>(yTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(yBlock)
+            const algorithmFPType *y = yBlock.get();
+
+            algorithmFPType buf[blockSizeDefault * blockSizeDefault];
+            computeDistanceBlock<algorithmFPType, cpu>(x, blockSize1, xNorms + shift1, y, blockSize2, yNorms + shift2, p, squared, buf);
+
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < blockSize2; j++)
+                {
+                    r[i * ny + shift2 + j] = buf[i * blockSize2 + j];
+                }
+            }
+        } );
+    } );
+
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Kernel for Euclidean distances calculation
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const size_t na, const NumericTable *const *a,
+        const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    const NumericTable *xTable = a[0];                  /* Input data */
+    const NumericTable *yTable = (na > 1 ? a[1] : 0);   /* Optional second input data */
+    NumericTable *rTable = r[0];                        /* Output data */
+    const bool squared = static_cast<const Parameter *>(par)->squared;
+
+    const size_t nx = xTable->getNumberOfRows();
+    TArray<algorithmFPType, cpu> xNormsArray(nx);
+    DAAL_CHECK_MALLOC(xNormsArray.get())
+    algorithmFPType *xNorms = xNormsArray.get();
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (computeSquaredNorms<algorithmFPType, cpu>(xTable, xNorms)))
+
+    if (yTable)
+    {
+        TArray<algorithmFPType, cpu> yNormsArray(yTable->getNumberOfRows());
+        DAAL_CHECK_MALLOC(yNormsArray.get())
+        algorithmFPType *yNorms = yNormsArray.get();
+        DAAL_CHECK_STATUS(s, (computeSquaredNorms<algorithmFPType, cpu>(yTable, yNorms)))
+
+        return eucDistanceCross<algorithmFPType, cpu>(xTable, xNorms, yTable, yNorms, squared, rTable);
+    }
+
+    const NumericTableIface::StorageLayout rLayout = rTable->getDataLayout();
+    if (!(packed_mask & (int)rLayout))
+    {
+        return eucDistanceFull<algorithmFPType, cpu>(xTable, xNorms, squared, rTable);
+    }
+    if (rLayout == NumericTableIface::lowerPackedSymmetricMatrix || rLayout == NumericTableIface::lowerPackedTriangularMatrix)
+    {
+        return eucDistancePacked<algorithmFPType, cpu>(xTable, xNorms, squared, false, rTable);
+    }
+    if (rLayout == NumericTableIface::upperPackedSymmetricMatrix || rLayout == NumericTableIface::upperPackedTriangularMatrix)
+    {
+        return eucDistancePacked<algorithmFPType, cpu>(xTable, xNorms, squared, true, rTable);
+    }
+    return services::Status(services::ErrorIncorrectTypeOfOutputNumericTable);
+}
+
+} // namespace internal
+
+} // namespace euclidean_distance
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,88 @@
+/* file: eucdistance_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Euclidean distance algorithm and types methods.
+//--
+*/
+
+#include "euclidean_distance_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace euclidean_distance
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store results of the Euclidean distance algorithm
+ * \param[in] input  Pointer to input structure
+ * \param[in] par    Pointer to parameter structure
+ * \param[in] method Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
+{
+    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    size_t dim = algInput->get(data)->getNumberOfRows();
+    data_management::NumericTablePtr otherDataTable = algInput->get(otherData);
+    services::Status status;
+    if(otherDataTable)
+    {
+        Argument::set(euclideanDistance, data_management::HomogenNumericTable<algorithmFPType>::create(
+                          otherDataTable->getNumberOfRows(), dim, data_management::NumericTable::doAllocate, &status));
+        return status;
+    }
+    Argument::set(euclideanDistance, data_management::SerializationIfacePtr(
+                      new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
+                          dim, data_management::NumericTable::doAllocate)));
+    return status;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace euclidean_distance
+}// namespace algorithms
+}// namespace daal
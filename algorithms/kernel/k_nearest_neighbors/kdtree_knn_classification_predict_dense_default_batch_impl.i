@@ -249,14 +249,15 @@ template <typename T, CpuType cpu>
 class Heap
 {
 public:
-    Heap() : _elements(nullptr), _count(0) {}
+    Heap() : _elements(nullptr), _count(0), _workspace(nullptr) {}
 
-    ~Heap() { services::daal_free(_elements); }
+    ~Heap() { daal::internal::workspaceFree(_workspace, _elements); }
 
-    bool init(size_t size)
+    bool init(size_t size, services::Workspace * workspace = nullptr)
     {
         _count = 0;
-        _elements = static_cast<T *>(services::daal_malloc(size * sizeof(T)));
+        _workspace = workspace;
+        _elements = static_cast<T *>(daal::internal::workspaceMalloc(_workspace, size * sizeof(T)));
         return _elements;
     }
 
@@ -264,7 +265,7 @@ public:
     {
         if (_elements)
         {
-            services::daal_free(_elements);
+            daal::internal::workspaceFree(_workspace, _elements);
             _elements = nullptr;
         }
     }
@@ -301,6 +302,7 @@ public:
 private:
     T * _elements;
     size_t _count;
+    services::Workspace * _workspace;
 };
 
 template <typename algorithmFpType, CpuType cpu>
@@ -352,22 +354,24 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
         MaxHeap heap;
         SearchStack stack;
     };
+    /* Thread-local heaps and stacks are kept in the workspace of the algorithm between the calls */
+    services::Workspace * const workspace = currentWorkspace();
     daal::tls<Local *> localTLS([=, &status]()-> Local *
     {
-        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        Local * const ptr = workspace_calloc<Local, cpu>(workspace, 1);
         if (ptr)
         {
-            if (!ptr->heap.init(heapSize))
+            if (!ptr->heap.init(heapSize, workspace))
             {
                 status.add(services::ErrorMemoryAllocationFailed);
-                service_scalable_free<Local, cpu>(ptr);
+                workspace_free<Local, cpu>(workspace, ptr);
                 return nullptr;
             }
-            if (!ptr->stack.init(stackSize))
+            if (!ptr->stack.init(stackSize, workspace))
             {
                 status.add(services::ErrorMemoryAllocationFailed);
                 ptr->heap.clear();
-                service_scalable_free<Local, cpu>(ptr);
+                workspace_free<Local, cpu>(workspace, ptr);
                 return nullptr;
             }
         }
@@ -413,7 +417,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
         {
             ptr->stack.clear();
             ptr->heap.clear();
-            service_scalable_free<Local, cpu>(ptr);
+            workspace_free<Local, cpu>(workspace, ptr);
         }
     } );
     return status;
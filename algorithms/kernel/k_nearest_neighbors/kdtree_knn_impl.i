@@ -48,6 +48,8 @@
 #ifndef __KDTREE_KNN_IMPL_I__
 #define __KDTREE_KNN_IMPL_I__
 
+#include "service_workspace.h"
+
 #if defined(_MSC_VER) || defined(__INTEL_COMPILER)
     #include <immintrin.h>
 #endif
@@ -115,13 +117,14 @@ template <typename T, CpuType cpu>
 class Stack
 {
 public:
-    Stack() : _data(nullptr) {}
+    Stack() : _data(nullptr), _workspace(nullptr) {}
 
-    ~Stack() { services::daal_free(_data); }
+    ~Stack() { daal::internal::workspaceFree(_workspace, _data); }
 
-    bool init(size_t size)
+    bool init(size_t size, services::Workspace * workspace = nullptr)
     {
-        _data = static_cast<T *>(services::daal_malloc(size * sizeof(T)));
+        _workspace = workspace;
+        _data = static_cast<T *>(daal::internal::workspaceMalloc(_workspace, size * sizeof(T)));
         _size = size;
         _top = _sizeMinus1 = size - 1;
         _count = 0;
@@ -132,7 +135,7 @@ public:
     {
         if (_data)
         {
-            services::daal_free(_data);
+            daal::internal::workspaceFree(_workspace, _data);
             _data = nullptr;
         }
     }
@@ -170,7 +173,7 @@ public:
     void grow()
     {
         _size *= 2;
-        T * const newData = static_cast<T *>(services::daal_malloc(_size * sizeof(T)));
+        T * const newData = static_cast<T *>(daal::internal::workspaceMalloc(_workspace, _size * sizeof(T)));
         if (_top == _sizeMinus1)
         {
             _top = _size - 1;
@@ -179,11 +182,12 @@ public:
         services::daal_memcpy_s(newData, _size * sizeof(T), _data, _count * sizeof(T));
         T * const oldData = _data;
         _data = newData;
-        services::daal_free(oldData);
+        daal::internal::workspaceFree(_workspace, oldData);
     }
 
 private:
     T * _data;
+    services::Workspace * _workspace;
     size_t _top;
     size_t _count;
     size_t _size;
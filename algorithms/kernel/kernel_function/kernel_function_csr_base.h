@@ -99,6 +99,21 @@ struct KernelCSRImplBase : public Kernel
 protected:
     inline algorithmFPType computeDotProduct(const size_t startIndex1, const size_t endIndex1, const algorithmFPType *dataA1, const size_t *colIndicesA1,
                                              const size_t startIndex2, const size_t endIndex2, const algorithmFPType *dataA2, const size_t *colIndicesA2);
+
+    inline algorithmFPType computeDotProduct(const size_t startIndex1, const size_t endIndex1, const algorithmFPType *dataA1, const unsigned int *colIndicesA1,
+                                             const size_t startIndex2, const size_t endIndex2, const algorithmFPType *dataA2, const unsigned int *colIndicesA2);
+
+    /* Returns true if both tables provide blocks with 32-bit column indices */
+    static bool hasCompactIndices(const NumericTable *a1, const NumericTable *a2)
+    {
+        return dynamic_cast<const CSR32NumericTableIface *>(a1) && dynamic_cast<const CSR32NumericTableIface *>(a2);
+    }
+
+    template <typename IndexType>
+    static typename CSRIfaceByIndexType<IndexType>::type *csrIface(const NumericTable *a)
+    {
+        return dynamic_cast<typename CSRIfaceByIndexType<IndexType>::type *>(const_cast<NumericTable *>(a));
+    }
 };
 
 } // namespace internal
@@ -61,18 +61,18 @@ namespace kernel_function
 namespace internal
 {
 
-template <typename algorithmFPType, CpuType cpu>
+template <typename algorithmFPType, CpuType cpu, typename IndexType>
 algorithmFPType computeDotProductBaseline(
-    const size_t startIndexA, const size_t endIndexA, const algorithmFPType *valuesA, const size_t *indicesA,
-    const size_t startIndexB, const size_t endIndexB, const algorithmFPType *valuesB, const size_t *indicesB)
+    const size_t startIndexA, const size_t endIndexA, const algorithmFPType *valuesA, const IndexType *indicesA,
+    const size_t startIndexB, const size_t endIndexB, const algorithmFPType *valuesB, const IndexType *indicesB)
 {
     size_t offsetA = startIndexA;
     size_t offsetB = startIndexB;
     algorithmFPType sum = 0.0;
     while ((offsetA < endIndexA) && (offsetB < endIndexB))
     {
-        size_t colIndex1 = indicesA[offsetA];
-        size_t colIndex2 = indicesB[offsetB];
+        IndexType colIndex1 = indicesA[offsetA];
+        IndexType colIndex2 = indicesB[offsetB];
         if (colIndex1 == colIndex2)
         {
             sum += valuesA[offsetA] * valuesB[offsetB];
@@ -100,6 +100,15 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                                                            startIndexB, endIndexB, valuesB, indicesB);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
+    const size_t startIndexA, const size_t endIndexA, const algorithmFPType *valuesA, const unsigned int *indicesA,
+    const size_t startIndexB, const size_t endIndexB, const algorithmFPType *valuesB, const unsigned int *indicesB)
+{
+    return computeDotProductBaseline<algorithmFPType, cpu>(startIndexA, endIndexA, valuesA, indicesA,
+                                                           startIndexB, endIndexB, valuesB, indicesB);
+}
+
 #if defined (__INTEL_COMPILER)
 
   #undef __DAAL_IA32e
@@ -99,15 +99,29 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     const NumericTable *a1,
     const NumericTable *a2,
     NumericTable *r, const ParameterBase *par)
+{
+    if (hasCompactIndices(a1, a2))
+    {
+        return computeMatrixVectorImpl<unsigned int>(a1, a2, r, par);
+    }
+    return computeMatrixVectorImpl<size_t>(a1, a2, r, par);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename IndexType>
+services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeMatrixVectorImpl(
+    const NumericTable *a1,
+    const NumericTable *a2,
+    NumericTable *r, const ParameterBase *par)
 {
     //prepareData
     const size_t nVectors1 = a1->getNumberOfRows();
 
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), 0, nVectors1);
+    GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, IndexType> mtA1(this->template csrIface<IndexType>(a1), 0, nVectors1);
     DAAL_CHECK_BLOCK_STATUS(mtA1);
     const size_t *rowOffsetsA1 = mtA1.rows();
 
-    ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), par->rowIndexY, 1);
+    GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, IndexType> mtA2(this->template csrIface<IndexType>(a2), par->rowIndexY, 1);
     DAAL_CHECK_BLOCK_STATUS(mtA2);
     const size_t *rowOffsetsA2 = mtA2.rows();
 
@@ -135,15 +149,29 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     const NumericTable *a1,
     const NumericTable *a2,
     NumericTable *r, const ParameterBase *par)
+{
+    if (hasCompactIndices(a1, a2))
+    {
+        return computeMatrixMatrixImpl<unsigned int>(a1, a2, r, par);
+    }
+    return computeMatrixMatrixImpl<size_t>(a1, a2, r, par);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename IndexType>
+services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeMatrixMatrixImpl(
+    const NumericTable *a1,
+    const NumericTable *a2,
+    NumericTable *r, const ParameterBase *par)
 {
     //prepareData
     const size_t nVectors1 = a1->getNumberOfRows();
     const size_t nVectors2 = a2->getNumberOfRows();
 
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), 0, nVectors1);
+    GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, IndexType> mtA1(this->template csrIface<IndexType>(a1), 0, nVectors1);
     DAAL_CHECK_BLOCK_STATUS(mtA1);
     const algorithmFPType *dataA1 = mtA1.values();
-    const size_t *colIndicesA1 = mtA1.cols();
+    const IndexType *colIndicesA1 = mtA1.cols();
     const size_t *rowOffsetsA1 = mtA1.rows();
 
     WriteOnlyRows<algorithmFPType, cpu> mtR(r, 0, nVectors1);
@@ -176,10 +204,10 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     }
     else
     {
-        ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), 0, nVectors2);
+        GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, IndexType> mtA2(this->template csrIface<IndexType>(a2), 0, nVectors2);
         DAAL_CHECK_BLOCK_STATUS(mtA2);
         const algorithmFPType *dataA2 = mtA2.values();
-        const size_t *colIndicesA2 = mtA2.cols();
+        const IndexType *colIndicesA2 = mtA2.cols();
         const size_t *rowOffsetsA2 = mtA2.rows();
 
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
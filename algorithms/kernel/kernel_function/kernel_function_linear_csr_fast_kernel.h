@@ -73,6 +73,14 @@ struct KernelImplLinear<fastCSR, algorithmFPType, cpu> :
     virtual services::Status computeInternalVectorVector(const NumericTable *a1, const NumericTable *a2, NumericTable *r, const ParameterBase *par);
     virtual services::Status computeInternalMatrixVector(const NumericTable *a1, const NumericTable *a2, NumericTable *r, const ParameterBase *par);
     virtual services::Status computeInternalMatrixMatrix(const NumericTable *a1, const NumericTable *a2, NumericTable *r, const ParameterBase *par);
+
+protected:
+    using daal::algorithms::kernel_function::internal::KernelCSRImplBase<algorithmFPType, cpu>::hasCompactIndices;
+
+    template <typename IndexType>
+    services::Status computeMatrixVectorImpl(const NumericTable *a1, const NumericTable *a2, NumericTable *r, const ParameterBase *par);
+    template <typename IndexType>
+    services::Status computeMatrixMatrixImpl(const NumericTable *a1, const NumericTable *a2, NumericTable *r, const ParameterBase *par);
 };
 
 } // namespace internal
@@ -79,7 +79,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable *a[lastInputId + 1] =
     {
         input->get(data).get(),
-        input->get(inputCentroids).get()
+        input->get(inputCentroids).get(),
+        input->get(weights).get()
     };
 
     NumericTable *r[lastResultId + 1] =
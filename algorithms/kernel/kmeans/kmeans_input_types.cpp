@@ -48,6 +48,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "daal_defines.h"
 #include "daal_strings.h"
+#include "service_numeric_table.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -105,7 +106,14 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     const int expectedLayout = (method == lloydCSR ? (int)NumericTableIface::csrArray : 0);
     DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), 0, expectedLayout));
     const size_t inputFeatures = get(data)->getNumberOfColumns();
-    return checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters);
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters));
+    NumericTablePtr weightsTable = get(weights);
+    if(weightsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(weightsTable.get(), weightsStr(), 0, 0, 1, get(data)->getNumberOfRows()));
+        DAAL_CHECK_STATUS(s, daal::internal::checkWeights(weightsTable.get(), weightsStr()));
+    }
+    return s;
 }
 
 } // namespace interface1
@@ -73,6 +73,7 @@ services::Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const
     const NumericTable *const *r, const Parameter *par)
 {
     NumericTable *ntData     = const_cast<NumericTable *>( a[0] );
+    const NumericTable *ntWeights = a[2];
     const size_t nIter = par->maxIterations;
     const size_t p = ntData->getNumberOfColumns();
     const size_t n = ntData->getNumberOfRows();
@@ -80,7 +81,9 @@ services::Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const
 
     TArray<size_t, cpu> clusterS0(nClusters);
     TArray<algorithmFPType, cpu> clusterS1(nClusters*p);
+    TArray<algorithmFPType, cpu> clusterW(ntWeights ? nClusters : 0);
     DAAL_CHECK(clusterS0.get() && clusterS1.get(), services::ErrorMemoryAllocationFailed);
+    DAAL_CHECK(!ntWeights || clusterW.get(), services::ErrorMemoryAllocationFailed);
 
     /* Categorial variables check and support: begin */
     int catFlag = 0;
@@ -127,7 +130,7 @@ services::Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const
         DAAL_CHECK_STATUS(s, s1);
         DAAL_ASSERT(task);
 
-        s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get());
+        s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get(), 0, ntWeights);
         if(!s)
         {
             kmeansClearClusters<algorithmFPType, cpu>(task, &oldTargetFunc);
@@ -141,13 +144,17 @@ services::Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const
             }
 
             clusterS0[i] = kmeansUpdateCluster<algorithmFPType, cpu>( task, i, &clusterS1[i * p] );
+            if ( ntWeights )
+            {
+                clusterW[i] = kmeansUpdateClusterWeight<algorithmFPType, cpu>( task, i );
+            }
         }
 
         for (size_t i = 0; i < nClusters; i++)
         {
-            if ( clusterS0[i] > 0 )
+            if ( ntWeights ? clusterW[i] > 0 : clusterS0[i] > 0 )
             {
-                algorithmFPType coeff = 1.0 / clusterS0[i];
+                algorithmFPType coeff = 1.0 / ( ntWeights ? clusterW[i] : clusterS0[i] );
 
                 for (size_t j = 0; j < p; j++)
                 {
@@ -50,6 +50,7 @@
 #include "service_numeric_table.h"
 #include "service_defines.h"
 #include "service_error_handling.h"
+#include "service_workspace.h"
 
 #include "threading.h"
 #include "service_blas.h"
@@ -80,6 +81,7 @@ struct tls_task_t
     algorithmFPType *mkl_buff;
     algorithmFPType *cS1;
     int    *cS0;
+    algorithmFPType *cW;
     algorithmFPType goalFunc;
 };
 
@@ -87,6 +89,7 @@ template<typename algorithmFPType, CpuType cpu>
 struct task_t
 {
     daal::tls<tls_task_t<algorithmFPType, cpu>*> *tls_task;
+    services::Workspace *workspace;
     algorithmFPType *clSq;
     algorithmFPType *cCenters;
 
@@ -108,6 +111,7 @@ services::Status kmeansInitTask(int dim, int clNum, algorithmFPType *centroids,
     t->clNum     = clNum;
     t->cCenters  = centroids;
     t->max_block_size = 512;
+    t->workspace = currentWorkspace();
 
     /* Allocate memory for all arrays inside TLS */
     t->tls_task = new daal::tls<tls_task_t<algorithmFPType, cpu>*>([=]()-> tls_task_t<algorithmFPType, cpu> *
@@ -116,24 +120,36 @@ services::Status kmeansInitTask(int dim, int clNum, algorithmFPType *centroids,
         if(!tt)
             return nullptr;
 
-        tt->mkl_buff = service_calloc<algorithmFPType, cpu>(t->max_block_size * t->clNum);
+        tt->mkl_buff = workspace_calloc<algorithmFPType, cpu>(t->workspace, t->max_block_size * t->clNum);
         if(!tt->mkl_buff)
         {
             delete tt;
             return nullptr;
         }
 
-        tt->cS1      = service_calloc<algorithmFPType, cpu>(t->clNum * t->dim);
+        tt->cS1      = workspace_calloc<algorithmFPType, cpu>(t->workspace, t->clNum * t->dim);
         if(!tt->cS1)
         {
-            service_free<algorithmFPType, cpu>(tt->mkl_buff);
+            workspace_free<algorithmFPType, cpu>(t->workspace, tt->mkl_buff);
             delete tt;
             return nullptr;
         }
 
-        tt->cS0      = service_calloc<int,cpu>(t->clNum);
+        tt->cS0      = workspace_calloc<int,cpu>(t->workspace, t->clNum);
         if(!tt->cS0)
         {
+            workspace_free<algorithmFPType, cpu>(t->workspace, tt->cS1);
+            workspace_free<algorithmFPType, cpu>(t->workspace, tt->mkl_buff);
+            delete tt;
+            return nullptr;
+        }
+
+        tt->cW       = workspace_calloc<algorithmFPType, cpu>(t->workspace, t->clNum);
+        if(!tt->cW)
+        {
+            workspace_free<int, cpu>(t->workspace, tt->cS0);
+            workspace_free<algorithmFPType, cpu>(t->workspace, tt->cS1);
+            workspace_free<algorithmFPType, cpu>(t->workspace, tt->mkl_buff);
             delete tt;
             return nullptr;
         }
@@ -149,7 +165,7 @@ services::Status kmeansInitTask(int dim, int clNum, algorithmFPType *centroids,
         return services::Status(services::ErrorMemoryAllocationFailed);
     }
 
-    t->clSq      = service_calloc<algorithmFPType, cpu>(clNum);
+    t->clSq      = workspace_calloc<algorithmFPType, cpu>(t->workspace, clNum);
     if(!t->clSq)
     {
         daal::services::daal_free(t);
@@ -177,7 +193,8 @@ template<> struct Fp2IntSize<float>  { typedef int IntT;     };
 template<> struct Fp2IntSize<double> { typedef __int64 IntT; };
 
 template<typename algorithmFPType, CpuType cpu, int assignFlag>
-services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0)
+services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0,
+    const NumericTable *ntWeights = 0)
 {
     struct task_t<algorithmFPType, cpu> *t  = static_cast<task_t<algorithmFPType, cpu> *>(task_id);
 
@@ -208,9 +225,18 @@ services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntD
         algorithmFPType *clustersSq = t->clSq;
         int    *cS0        = tt->cS0;
         algorithmFPType *cS1        = tt->cS1;
+        algorithmFPType *cW         = tt->cW;
         algorithmFPType *trg        = &(tt->goalFunc);
         algorithmFPType *x_clusters = tt->mkl_buff;
 
+        ReadRows<algorithmFPType, cpu> weightsBlock(const_cast<NumericTable *>(ntWeights), k*blockSizeDeafult, blockSize);
+        const algorithmFPType* weights = nullptr;
+        if(ntWeights)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(weightsBlock);
+            weights = weightsBlock.get();
+        }
+
         WriteOnlyRows<int, cpu> assignBlock(assignFlag ? const_cast<NumericTable *>(ntAssign) : nullptr, k*blockSizeDeafult, blockSize);
         int* assignments = nullptr;
         if(assignFlag)
@@ -271,17 +297,19 @@ services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntD
         {
             size_t minIdx = *((algIntType*)&(x_clusters[i]));
             algorithmFPType minGoalVal = x_clusters[i+blockSize];
+            const algorithmFPType w = (weights ? weights[i] : (algorithmFPType)1.0);
 
           PRAGMA_ICC_NO16(omp simd reduction(+:minGoalVal))
             for (size_t j = 0; j < p; j++)
             {
-                cS1[minIdx * p + j] += data[i*p + j];
+                cS1[minIdx * p + j] += w * data[i*p + j];
                 minGoalVal += data[ i*p + j ] * data[ i*p + j ];
             }
 
             cS0[minIdx]++;
+            cW[minIdx] += w;
 
-            goal += minGoalVal;
+            goal += w * minGoalVal;
 
             if(assignFlag)
             {
@@ -295,7 +323,8 @@ services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntD
 }
 
 template<typename algorithmFPType, CpuType cpu, int assignFlag>
-services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDataGen, algorithmFPType *catCoef, NumericTable *ntAssign = 0)
+services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDataGen, algorithmFPType *catCoef, NumericTable *ntAssign = 0,
+    const NumericTable *ntWeights = 0)
 {
     CSRNumericTableIface *ntData  = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntDataGen));
 
@@ -331,9 +360,18 @@ services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDat
         algorithmFPType *clustersSq = t->clSq;
         int    *cS0        = tt->cS0;
         algorithmFPType *cS1        = tt->cS1;
+        algorithmFPType *cW         = tt->cW;
         algorithmFPType *trg        = &(tt->goalFunc);
         algorithmFPType *x_clusters = tt->mkl_buff;
 
+        ReadRows<algorithmFPType, cpu> weightsBlock(const_cast<NumericTable *>(ntWeights), k*blockSizeDeafult, blockSize);
+        const algorithmFPType* weights = nullptr;
+        if(ntWeights)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(weightsBlock);
+            weights = weightsBlock.get();
+        }
+
         WriteOnlyRows<int, cpu> assignBlock(assignFlag ? ntAssign : nullptr, k*blockSizeDeafult, blockSize);
         int* assignments = nullptr;
         if(assignFlag)
@@ -372,18 +410,20 @@ services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDat
             }
 
             minGoalVal *= 2.0;
+            const algorithmFPType w = (weights ? weights[i] : (algorithmFPType)1.0);
 
             size_t valuesNum = rowIdx[i+1]-rowIdx[i];
             for (size_t j = 0; j < valuesNum; j++)
             {
-                cS1[minIdx * p + colIdx[csrCursor]-1] += data[csrCursor];
+                cS1[minIdx * p + colIdx[csrCursor]-1] += w * data[csrCursor];
                 minGoalVal += data[csrCursor]*data[csrCursor];
                 csrCursor++;
             }
 
-            *trg += minGoalVal;
+            *trg += w * minGoalVal;
 
             cS0[minIdx]++;
+            cW[minIdx] += w;
 
             if(assignFlag)
             {
@@ -395,15 +435,16 @@ services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDat
 }
 
 template<Method method, typename algorithmFPType, CpuType cpu, int assignFlag>
-services::Status addNTToTaskThreaded(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0 )
+services::Status addNTToTaskThreaded(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0,
+    const NumericTable *ntWeights = 0 )
 {
     if(method == lloydDense)
     {
-        return addNTToTaskThreadedDense<algorithmFPType, cpu, assignFlag>( task_id, ntData, catCoef, ntAssign );
+        return addNTToTaskThreadedDense<algorithmFPType, cpu, assignFlag>( task_id, ntData, catCoef, ntAssign, ntWeights );
     }
     else if(method == lloydCSR)
     {
-        return addNTToTaskThreadedCSR<algorithmFPType, cpu, assignFlag>( task_id, ntData, catCoef, ntAssign );
+        return addNTToTaskThreadedCSR<algorithmFPType, cpu, assignFlag>( task_id, ntData, catCoef, ntAssign, ntWeights );
     }
     DAAL_ASSERT(false);
     return services::Status();
@@ -509,6 +550,21 @@ int kmeansUpdateCluster(void *task_id, int jidx, algorithmFPType *s1)
     return s0;
 }
 
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType kmeansUpdateClusterWeight(void *task_id, int jidx)
+{
+    struct task_t<algorithmFPType, cpu> *t = static_cast<task_t<algorithmFPType, cpu> *>(task_id);
+
+    algorithmFPType w = (algorithmFPType)0.0;
+
+    t->tls_task->reduce( [&](tls_task_t<algorithmFPType, cpu> *tt)-> void
+    {
+        w += tt->cW[jidx];
+    } );
+
+    return w;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void kmeansClearClusters(void *task_id, algorithmFPType *goalFunc)
 {
@@ -531,14 +587,15 @@ void kmeansClearClusters(void *task_id, algorithmFPType *goalFunc)
 
         t->tls_task->reduce( [ = ](tls_task_t<algorithmFPType, cpu> *tt)-> void
         {
-            service_free<int, cpu>( tt->cS0 );
-            service_free<algorithmFPType, cpu>( tt->cS1 );
-            service_free<algorithmFPType, cpu>( tt->mkl_buff );
+            workspace_free<algorithmFPType, cpu>( t->workspace, tt->cW );
+            workspace_free<int, cpu>( t->workspace, tt->cS0 );
+            workspace_free<algorithmFPType, cpu>( t->workspace, tt->cS1 );
+            workspace_free<algorithmFPType, cpu>( t->workspace, tt->mkl_buff );
             delete tt;
         } );
         delete t->tls_task;
 
-        service_free<algorithmFPType, cpu>( t->clSq );
+        workspace_free<algorithmFPType, cpu>( t->workspace, t->clSq );
 
     }
 
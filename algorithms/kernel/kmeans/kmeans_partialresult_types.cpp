@@ -107,6 +107,10 @@ services::Status PartialResult::check(const daal::algorithms::Input *input, cons
     const Parameter *kmPar = static_cast<const Parameter *>(par);
     const int unexpectedLayouts = (int)packed_mask;
 
+    /* Weights of observations are not supported in the distributed processing mode */
+    const Input *kmInput = dynamic_cast<const Input *>(input);
+    DAAL_CHECK_EX(!kmInput || !kmInput->get(weights), ErrorIncorrectOptionalInput, OptionalInput, weightsStr());
+
     services::Status s;
     DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, kmPar->nClusters));
     DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSums).get(), partialSumsStr(), unexpectedLayouts, 0, inputFeatures, kmPar->nClusters));
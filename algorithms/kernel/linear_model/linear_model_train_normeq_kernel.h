@@ -168,9 +168,11 @@ public:
      * \param[in] nRows     Number of rows in the block of data
      * \param[in] xTable    Input data set of size N x P
      * \param[in] yTable    Input array of responses of size N x Ny
+     * \param[in] wTable    Optional input array of weights of the observations of size N x 1
      * \return Status of the computations
      */
-    Status update(DAAL_INT startRow, DAAL_INT nRows, const NumericTable &xTable, const NumericTable &yTable);
+    Status update(DAAL_INT startRow, DAAL_INT nRows, const NumericTable &xTable, const NumericTable &yTable,
+                  const NumericTable *wTable = NULL);
 
     /**
      * Reduces thread local partial results into global partial result
@@ -187,10 +189,27 @@ protected:
      * \param[out] st               Status of the object construction
      */
     ThreadingTask(size_t nBetasIntercept, size_t nResponses, Status &st);
+
+    /**
+     * Updates local partial result with the new block of weighted data
+     * \param[in] nFeatures Number of features in the input data set
+     * \param[in] nRows     Number of rows in the block of data
+     * \param[in] x         Block of the input data set of size nRows x P
+     * \param[in] y         Block of the input array of responses of size nRows x Ny
+     * \param[in] w         Block of the input array of weights of size nRows
+     * \return Status of the computations
+     */
+    Status updateWeighted(DAAL_INT nFeatures, DAAL_INT nRows, const algorithmFPType *x, const algorithmFPType *y,
+                          const algorithmFPType *w);
+
     algorithmFPType *_xtx;      /*!< Partial result of size P' x P' */
     algorithmFPType *_xty;      /*!< Partial result of size Ny x P' */
     ReadRowsType _xBlock;       /*!< Object that manages memory block of the input data set */
     ReadRowsType _yBlock;       /*!< Object that manages memory block of the input array of responses */
+    ReadRowsType _wBlock;       /*!< Object that manages memory block of the input array of weights */
+    TArrayScalable<algorithmFPType, cpu> _xWeighted;    /*!< Block of the input data set scaled by square roots of weights */
+    TArrayScalable<algorithmFPType, cpu> _yWeighted;    /*!< Block of the input array of responses scaled by weights */
+    DAAL_INT _nWeightedRows;    /*!< Number of rows allocated in the blocks scaled by weights */
     DAAL_INT _nBetasIntercept;  /*!< P' - number of columns in the partial result */
     DAAL_INT _nResponses;       /*!< Ny - number of responses */
 };
@@ -216,10 +235,12 @@ public:
      * \param[in]  interceptFlag    Flag.
      *                              - True if it is required to compute an intercept term and P' = P + 1
      *                              - False otherwis, P' = P
+     * \param[in]  w        Optional weights of the observations of size N x 1.
+     *                      If provided, \f$X'^T W X'\f$ and \f$X'^T W Y\f$ are accumulated
      * \return Status of the computations
      */
     static Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-                          bool initializeResult, bool interceptFlag);
+                          bool initializeResult, bool interceptFlag, const NumericTable *w = NULL);
 };
 
 /**
@@ -47,7 +47,9 @@
 
 #include "linear_model_train_normeq_kernel.h"
 #include "service_blas.h"
+#include "service_math.h"
 #include "service_error_handling.h"
+#include "service_tracing.h"
 #include "threading.h"
 
 namespace daal
@@ -69,7 +71,7 @@ using namespace daal::services::internal;
 
 template <typename algorithmFPType, CpuType cpu>
 ThreadingTask<algorithmFPType, cpu>::ThreadingTask(size_t nBetasIntercept, size_t nResponses, Status &st) :
-    _nBetasIntercept(nBetasIntercept), _nResponses(nResponses)
+    _nWeightedRows(0), _nBetasIntercept(nBetasIntercept), _nResponses(nResponses)
 {
     _xtx = service_scalable_calloc<algorithmFPType, cpu>(nBetasIntercept * nBetasIntercept);
     _xty = service_scalable_calloc<algorithmFPType, cpu>(nBetasIntercept * nResponses);
@@ -93,8 +95,10 @@ ThreadingTask<algorithmFPType, cpu> * ThreadingTask<algorithmFPType, cpu>::creat
 
 template <typename algorithmFPType, CpuType cpu>
 Status ThreadingTask<algorithmFPType, cpu>::update(DAAL_INT startRow, DAAL_INT nRows,
-                                                   const NumericTable &xTable, const NumericTable &yTable)
+                                                   const NumericTable &xTable, const NumericTable &yTable,
+                                                   const NumericTable *wTable)
 {
+    DAAL_TRACE_SCOPE("linear_model.normeq.update_block");
     DAAL_INT nFeatures(xTable.getNumberOfColumns());
 
     /* SYRK and GEMM parameters */
@@ -111,6 +115,13 @@ Status ThreadingTask<algorithmFPType, cpu>::update(DAAL_INT startRow, DAAL_INT n
     DAAL_CHECK_BLOCK_STATUS(_yBlock);
     const algorithmFPType *y = _yBlock.get();
 
+    if (wTable)
+    {
+        _wBlock.set(const_cast<NumericTable &>(*wTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_wBlock);
+        return updateWeighted(nFeatures, nRows, x, y, _wBlock.get());
+    }
+
     Blas<algorithmFPType, cpu>::xxsyrk(&up, &notrans, &nFeatures, &nRows, &alpha,
                                        const_cast<algorithmFPType *>(x), &nFeatures, &alpha,
                                        _xtx, &_nBetasIntercept);
@@ -152,6 +163,73 @@ Status ThreadingTask<algorithmFPType, cpu>::update(DAAL_INT startRow, DAAL_INT n
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ThreadingTask<algorithmFPType, cpu>::updateWeighted(DAAL_INT nFeatures, DAAL_INT nRows, const algorithmFPType *x,
+                                                           const algorithmFPType *y, const algorithmFPType *w)
+{
+    if (nRows > _nWeightedRows)
+    {
+        _xWeighted.reset(nRows * nFeatures);
+        _yWeighted.reset(nRows * _nResponses);
+        DAAL_CHECK_MALLOC(_xWeighted.get() && _yWeighted.get());
+        _nWeightedRows = nRows;
+    }
+
+    /* X'^T W X' = (sqrt(W) X')^T (sqrt(W) X') is updated by SYRK, X'^T W Y = X'^T (W Y) - by GEMM */
+    algorithmFPType *xw = _xWeighted.get();
+    algorithmFPType *yw = _yWeighted.get();
+    for (DAAL_INT i = 0; i < nRows; i++)
+    {
+        const algorithmFPType sqrtW = daal::internal::Math<algorithmFPType, cpu>::sSqrt(w[i]);
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < nFeatures; j++)
+        {
+            xw[i * nFeatures + j] = sqrtW * x[i * nFeatures + j];
+        }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < _nResponses; j++)
+        {
+            yw[i * _nResponses + j] = w[i] * y[i * _nResponses + j];
+        }
+    }
+
+    char up      = 'U';
+    char trans   = 'T';
+    char notrans = 'N';
+    algorithmFPType alpha(1.0);
+
+    Blas<algorithmFPType, cpu>::xxsyrk(&up, &notrans, &nFeatures, &nRows, &alpha, xw, &nFeatures, &alpha,
+                                       _xtx, &_nBetasIntercept);
+
+    Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &nFeatures, &_nResponses, &nRows, &alpha, x,
+                                       &nFeatures, yw, &_nResponses, &alpha, _xty, &_nBetasIntercept);
+
+    if (nFeatures < _nBetasIntercept)
+    {
+        algorithmFPType *xtxPtr = _xtx + nFeatures * _nBetasIntercept;
+        for (DAAL_INT i = 0; i < nRows; i++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < nFeatures; j++)
+            {
+                xtxPtr[j] += w[i] * x[i * nFeatures + j];
+            }
+            xtxPtr[nFeatures] += w[i];
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < _nResponses; j++)
+            {
+                _xty[j * _nBetasIntercept + nFeatures] += yw[i * _nResponses + j];
+            }
+        }
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ThreadingTask<algorithmFPType, cpu>::reduce(algorithmFPType *xtx, algorithmFPType *xty)
 {
@@ -180,7 +258,8 @@ ThreadingTask<algorithmFPType, cpu>::~ThreadingTask()
 template <typename algorithmFPType, CpuType cpu>
 Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable &xTable, const NumericTable &yTable,
                                                    NumericTable &xtxTable, NumericTable &xtyTable,
-                                                   bool initializeResult, bool interceptFlag)
+                                                   bool initializeResult, bool interceptFlag,
+                                                   const NumericTable *wTable)
 {
     DAAL_INT nRows     (xTable.getNumberOfRows());          /* observations */
     DAAL_INT nResponses(yTable.getNumberOfColumns());       /* responses */
@@ -230,7 +309,7 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable &xTable, c
         size_t endRow = startRow + nRowsInBlock;
         if (endRow > nRows) { endRow = nRows; }
 
-        Status localSt = tlsLocal->update(startRow, endRow - startRow, xTable, yTable);
+        Status localSt = tlsLocal->update(startRow, endRow - startRow, xTable, yTable, wTable);
         DAAL_CHECK_STATUS_THR(localSt);
     } );
 
@@ -95,9 +95,11 @@ public:
      * \param[in] nRows     Number of rows in the block of data
      * \param[in] xTable    Input data set of size N x P
      * \param[in] yTable    Input array of responses of size N x Ny
+     * \param[in] wTable    Optional input array of weights of the observations of size N x 1
      * \return Status of the computations
      */
-    Status update(DAAL_INT startRow, DAAL_INT nRows, const NumericTable &xTable, const NumericTable &yTable);
+    Status update(DAAL_INT startRow, DAAL_INT nRows, const NumericTable &xTable, const NumericTable &yTable,
+                  const NumericTable *wTable = NULL);
 
     /**
      * Reduces thread local partial results into global partial result
@@ -129,6 +131,7 @@ protected:
                                                              qrQTY and qrQTYNew merged by rows */
     ReadRowsType _xBlock;       /*!< Object that manages memory block of the input data set */
     ReadRowsType _yBlock;       /*!< Object that manages memory block of the input array of responses */
+    ReadRowsType _wBlock;       /*!< Object that manages memory block of the input array of weights */
 
     DAAL_INT _nBetasIntercept;  /*!< Number of rows and columns in the matrix R */
     DAAL_INT _nRows;            /*!< Npart, number of rows in the input data set part */
@@ -150,15 +153,17 @@ protected:
     Status allocateWorkBuffer();
 
     /**
-     * Copy block of rows from input data set into thread local storage
+     * Copy block of rows from input data set into thread local storage.
+     * If weights are provided, the rows are scaled by square roots of the weights
      * \param[in] startRow  Index of the starting row of the block
      * \param[in] nRows     Number of rows in the block of data
      * \param[in] xTable    Input data set of size N x P
      * \param[in] yTable    Input array of responses of size N x Ny
+     * \param[in] wTable    Optional input array of weights of the observations of size N x 1
      * \return Status of the computations
      */
     Status copyDataToBuffer(DAAL_INT startRow, DAAL_INT nRows,
-                            const NumericTable &xTable, const NumericTable &yTable);
+                            const NumericTable &xTable, const NumericTable &yTable, const NumericTable *wTable);
 };
 
 /**
@@ -243,10 +248,12 @@ public:
      * \param[in]  interceptFlag    Flag.
      *                              - True if it is required to compute an intercept term and P' = P + 1
      *                              - False otherwis, P' = P
+     * \param[in]  w        Optional weights of the observations of size N x 1.
+     *                      If provided, QR decomposition of \f$W^{1/2} X'\f$ is updated
      * \return Status of the computations
      */
     static Status compute(const NumericTable &x, const NumericTable &y, NumericTable &r, NumericTable &qty,
-                          bool initializeResult, bool interceptFlag);
+                          bool initializeResult, bool interceptFlag, const NumericTable *w = NULL);
 };
 
 /**
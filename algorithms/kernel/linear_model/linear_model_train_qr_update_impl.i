@@ -47,6 +47,7 @@
 
 #include "linear_model_train_qr_kernel.h"
 #include "service_lapack.h"
+#include "service_math.h"
 #include "service_error_handling.h"
 #include "threading.h"
 
@@ -141,7 +142,8 @@ Status ThreadingTask<algorithmFPType, cpu>::allocateWorkBuffer()
 template <typename algorithmFPType, CpuType cpu>
 Status ThreadingTask<algorithmFPType, cpu>::copyDataToBuffer(DAAL_INT startRow, DAAL_INT nRows,
                                                              const NumericTable &xTable,
-                                                             const NumericTable &yTable)
+                                                             const NumericTable &yTable,
+                                                             const NumericTable *wTable)
 {
     const size_t nFeatures = xTable.getNumberOfColumns();
     _xBlock.set(const_cast<NumericTable &>(xTable), startRow, nRows);
@@ -178,6 +180,33 @@ Status ThreadingTask<algorithmFPType, cpu>::copyDataToBuffer(DAAL_INT startRow,
     const size_t ySize = _nResponses * nRows * sizeof(algorithmFPType);
     daal_memcpy_s(qtyBuffer.get(), ySize, y, ySize);
 
+    if (wTable)
+    {
+        /* Weighted least squares problem is equivalent to the ordinary one for W^(1/2) X' and W^(1/2) Y */
+        _wBlock.set(const_cast<NumericTable &>(*wTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_wBlock);
+        const algorithmFPType *w = _wBlock.get();
+
+        algorithmFPType *qr  = qrBuffer.get();
+        algorithmFPType *qty = qtyBuffer.get();
+        for (DAAL_INT i = 0; i < nRows; i++)
+        {
+            const algorithmFPType sqrtW = daal::internal::Math<algorithmFPType, cpu>::sSqrt(w[i]);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < _nBetasIntercept; j++)
+            {
+                qr[i * _nBetasIntercept + j] *= sqrtW;
+            }
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < _nResponses; j++)
+            {
+                qty[i * _nResponses + j] *= sqrtW;
+            }
+        }
+    }
+
     return Status();
 }
 
@@ -192,9 +221,10 @@ Status ThreadingTask<algorithmFPType, cpu>::reduce(algorithmFPType* r, algorithm
 template <typename algorithmFPType, CpuType cpu>
 Status ThreadingTask<algorithmFPType, cpu>::update(DAAL_INT startRow, DAAL_INT nRows,
                                                    const NumericTable &xTable,
-                                                   const NumericTable &yTable)
+                                                   const NumericTable &yTable,
+                                                   const NumericTable *wTable)
 {
-    Status st = copyDataToBuffer(startRow, nRows, xTable, yTable);
+    Status st = copyDataToBuffer(startRow, nRows, xTable, yTable, wTable);
 
     if (st)
     {
@@ -210,7 +240,8 @@ template <typename algorithmFPType, CpuType cpu>
 Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable &xTable,
                                                    const NumericTable &yTable,
                                                    NumericTable &rTable, NumericTable &qtyTable,
-                                                   bool initializeResult, bool interceptFlag)
+                                                   bool initializeResult, bool interceptFlag,
+                                                   const NumericTable *wTable)
 {
     DAAL_INT nRows      = (DAAL_INT)xTable.getNumberOfRows();     /* vectors */
     DAAL_INT nFeatures  = (DAAL_INT)xTable.getNumberOfColumns();  /* features */
@@ -267,7 +298,7 @@ Status UpdateKernel<algorithmFPType, cpu>::compute(const NumericTable &xTable,
         size_t startRow  = iBlock * nRowsInBlock;
         size_t blockSize = (iBlock == nBlocks - 1) ? nRows - startRow : nRowsInBlock;
 
-        Status localSt = tlsLocal->update(startRow, blockSize, xTable, yTable);
+        Status localSt = tlsLocal->update(startRow, blockSize, xTable, yTable, wTable);
         DAAL_CHECK_STATUS_THR(localSt);
     } );
 
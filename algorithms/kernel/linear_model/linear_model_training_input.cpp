@@ -47,6 +47,8 @@
 */
 
 #include "algorithms/linear_model/linear_model_training_types.h"
+#include "daal_strings.h"
+#include "service_numeric_table.h"
 
 namespace daal
 {
@@ -75,6 +77,19 @@ void Input::set(InputId id, const data_management::NumericTablePtr &value)
     regression::training::Input::set(regression::training::InputId(id), value);
 }
 
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, regression::training::Input::check(par, method));
+
+    /* Weights of the observations are optional */
+    if (size() <= weights || !get(weights))
+        return s;
+    const size_t nRowsInData = get(data)->getNumberOfRows();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(weights).get(), weightsStr(), 0, 0, 1, nRowsInData));
+    return daal::internal::checkWeights(get(weights).get(), weightsStr());
+}
+
 }
 }
 }
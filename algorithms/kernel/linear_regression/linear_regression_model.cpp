@@ -48,6 +48,7 @@
 #include "algorithms/linear_regression/linear_regression_model.h"
 #include "algorithms/linear_regression/linear_regression_ne_model.h"
 #include "algorithms/linear_regression/linear_regression_qr_model.h"
+#include "algorithms/linear_regression/linear_regression_elastic_net_model.h"
 #include "algorithms/linear_regression/linear_regression_training_types.h"
 #include "daal_strings.h"
 
@@ -60,6 +61,24 @@ namespace algorithms
 {
 namespace linear_regression
 {
+namespace interface1
+{
+Parameter::Parameter() : linear_model::Parameter(), l1Penalty(0.1), l2Penalty(0.0), pathLength(10), maxIterations(1000),
+    accuracyThreshold(1.0e-5) {}
+
+Parameter::Parameter(const Parameter &other) : linear_model::Parameter(other), l1Penalty(other.l1Penalty), l2Penalty(other.l2Penalty),
+    pathLength(other.pathLength), maxIterations(other.maxIterations), accuracyThreshold(other.accuracyThreshold) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(l1Penalty >= 0, ErrorIncorrectParameter, ParameterName, l1PenaltyStr());
+    DAAL_CHECK_EX(l2Penalty >= 0, ErrorIncorrectParameter, ParameterName, l2PenaltyStr());
+    DAAL_CHECK_EX(pathLength > 0, ErrorIncorrectParameter, ParameterName, pathLengthStr());
+    DAAL_CHECK_EX(maxIterations > 0, ErrorIncorrectParameter, ParameterName, maxIterationsStr());
+    DAAL_CHECK_EX(accuracyThreshold > 0, ErrorIncorrectParameter, ParameterName, accuracyThresholdStr());
+    return Status();
+}
+} // namespace interface1
 
 Status checkModel(
     linear_regression::Model* model, const daal::algorithms::Parameter &par, size_t nBeta, size_t nResponses, int method)
@@ -85,6 +104,10 @@ Status checkModel(
         DAAL_CHECK_STATUS(s, checkNumericTable(modelQR->getRTable().get(), RTableStr(), 0, 0, dimWithoutBeta, dimWithoutBeta));
         DAAL_CHECK_STATUS(s, checkNumericTable(modelQR->getQTYTable().get(), QTYTableStr(), 0, 0, dimWithoutBeta, nResponses));
     }
+    else if(method == linear_regression::training::elasticNetDense)
+    {
+        DAAL_CHECK(dynamic_cast<linear_regression::ModelElasticNet*>(model), ErrorIncorrectTypeOfModel);
+    }
 
     return s;
 }
@@ -55,6 +55,7 @@
 #include "linear_regression_train_kernel.h"
 #include "linear_regression_ne_model.h"
 #include "linear_regression_qr_model.h"
+#include "linear_regression_elastic_net_model.h"
 #include "service_numeric_table.h"
 
 namespace daal
@@ -108,7 +109,16 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
         __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense), \
                            compute, *(input->get(data)), *(input->get(dependentVariables)),                             \
-                           *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag);
+                           *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag,               \
+                           input->get(weights).get());
+    }
+    else if (method == training::elasticNetDense)
+    {
+        linear_regression::ModelElasticNetPtr m = linear_regression::ModelElasticNet::cast(result->get(model));
+
+        __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::elasticNetDense), \
+                           compute, *(input->get(data)), *(input->get(dependentVariables)), *(m->getBeta()),         \
+                           *(result->get(nIterations)), *par);
     }
     else
     {
@@ -116,7 +126,8 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
         __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense),    \
                            compute, *(input->get(data)), *(input->get(dependentVariables)),                            \
-                           *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()), par->interceptFlag);
+                           *(m->getRTable()), *(m->getQTYTable()), *(m->getBeta()), par->interceptFlag,                \
+                           input->get(weights).get());
     }
 }
 
@@ -160,7 +171,7 @@ Status OnlineContainer<algorithmFPType, method, cpu>::compute()
                 partialResult->get(training::partialModel));
         __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense),\
                        compute, *(input->get(data)), *(input->get(dependentVariables)),                                 \
-                       *(m->getXTXTable()), *(m->getXTYTable()), par->interceptFlag);
+                       *(m->getXTXTable()), *(m->getXTYTable()), par->interceptFlag, input->get(weights).get());
     }
     else
     {
@@ -169,7 +180,7 @@ Status OnlineContainer<algorithmFPType, method, cpu>::compute()
 
         __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::qrDense),    \
                        compute, *(input->get(data)), *(input->get(dependentVariables)),                                 \
-                       *(m->getRTable()), *(m->getQTYTable()), par->interceptFlag);
+                       *(m->getRTable()), *(m->getQTYTable()), par->interceptFlag, input->get(weights).get());
     }
 }
 
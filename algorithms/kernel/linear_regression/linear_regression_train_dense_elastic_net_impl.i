@@ -0,0 +1,518 @@
+/* file: linear_regression_train_dense_elastic_net_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of linear regression training with elastic net penalty.
+//  Cyclic coordinate descent with covariance updates along a regularization
+//  path of decreasing L1 penalties.
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_TRAIN_DENSE_ELASTIC_NET_IMPL_I__
+#define __LINEAR_REGRESSION_TRAIN_DENSE_ELASTIC_NET_IMPL_I__
+
+#include "linear_regression_train_kernel.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+const size_t elasticNetRowsInBlock     = 256;
+const size_t elasticNetFeaturesInBlock = 1024;
+
+/**
+ *  Per-thread partial sums of the data statistics:
+ *  sums and sums of squares of the features, sums of the responses and X'Y
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ElasticNetStatisticsTask
+{
+public:
+    static ElasticNetStatisticsTask *create(size_t nFeatures, size_t nResponses)
+    {
+        ElasticNetStatisticsTask *res = new ElasticNetStatisticsTask(nFeatures, nResponses);
+        if (!res->_buffer.get())
+        {
+            delete res;
+            return nullptr;
+        }
+        return res;
+    }
+
+    Status update(size_t startRow, size_t nRows, const NumericTable &xTable, const NumericTable &yTable)
+    {
+        ReadRows<algorithmFPType, cpu> xBlock(const_cast<NumericTable &>(xTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xBlock);
+        ReadRows<algorithmFPType, cpu> yBlock(const_cast<NumericTable &>(yTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(yBlock);
+        const algorithmFPType *x = xBlock.get();
+        const algorithmFPType *y = yBlock.get();
+
+        algorithmFPType *sumX  = _buffer.get();
+        algorithmFPType *sumX2 = sumX + _nFeatures;
+        algorithmFPType *sumY  = sumX2 + _nFeatures;
+        algorithmFPType *xty   = sumY + _nResponses;
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *xRow = x + i * _nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                sumX[j]  += xRow[j];
+                sumX2[j] += xRow[j] * xRow[j];
+            }
+            const algorithmFPType *yRow = y + i * _nResponses;
+            for (size_t k = 0; k < _nResponses; k++)
+                sumY[k] += yRow[k];
+        }
+
+        /* xty is stored as nResponses x nFeatures */
+        char trans   = 'T';
+        char notrans = 'N';
+        algorithmFPType one(1.0);
+        DAAL_INT nFeatures (_nFeatures);
+        DAAL_INT nResponses(_nResponses);
+        DAAL_INT nRowsInt  (nRows);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &nFeatures, &nResponses, &nRowsInt, &one, x,
+                                           &nFeatures, y, &nResponses, &one, xty, &nFeatures);
+        return Status();
+    }
+
+    void reduce(algorithmFPType *buffer) const
+    {
+        const algorithmFPType *local = _buffer.get();
+        const size_t size = bufferSize();
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < size; i++)
+            buffer[i] += local[i];
+    }
+
+    size_t bufferSize() const { return _nFeatures * (2 + _nResponses) + _nResponses; }
+
+private:
+    ElasticNetStatisticsTask(size_t nFeatures, size_t nResponses) :
+        _nFeatures(nFeatures), _nResponses(nResponses), _buffer(nFeatures * (2 + nResponses) + nResponses, true) {}
+
+    size_t _nFeatures;
+    size_t _nResponses;
+    TArrayScalable<algorithmFPType, cpu> _buffer;
+};
+
+/**
+ *  Lazily computed columns of the (centered) Gram matrix X'X / n.
+ *  A column is computed the first time its feature gets a non-zero coefficient,
+ *  so memory is proportional to the number of features that were ever active.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ElasticNetGramCache
+{
+public:
+    ElasticNetGramCache(const NumericTable &xTable, const algorithmFPType *mean) :
+        _xTable(xTable), _mean(mean), _nFeatures(xTable.getNumberOfColumns()), _nRows(xTable.getNumberOfRows()),
+        _columns(_nFeatures, true) {}
+
+    ~ElasticNetGramCache()
+    {
+        algorithmFPType **columns = _columns.get();
+        if (!columns)
+            return;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            if (columns[j])
+                service_scalable_free<algorithmFPType, cpu>(columns[j]);
+        }
+    }
+
+    bool isValid() const { return _columns.get() != nullptr; }
+
+    const algorithmFPType *column(size_t iFeature, Status &st)
+    {
+        algorithmFPType *&col = _columns.get()[iFeature];
+        if (!col)
+            st |= computeColumn(iFeature, col);
+        return col;
+    }
+
+private:
+    Status computeColumn(size_t iFeature, algorithmFPType *&col)
+    {
+        const size_t nFeatures = _nFeatures;
+        col = service_scalable_calloc<algorithmFPType, cpu>(nFeatures);
+        DAAL_CHECK_MALLOC(col);
+
+        size_t nBlocks = _nRows / elasticNetRowsInBlock;
+        if (nBlocks * elasticNetRowsInBlock < _nRows) { nBlocks++; }
+        const size_t nRows = _nRows;
+
+        daal::tls<algorithmFPType *> tls([ = ]() -> algorithmFPType *
+        {
+            return service_scalable_calloc<algorithmFPType, cpu>(nFeatures);
+        });
+
+        const NumericTable &xTable = _xTable;
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &tls, &xTable, &safeStat ](int iBlock)
+        {
+            algorithmFPType *local = tls.local();
+            if (!local)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            const size_t startRow = iBlock * elasticNetRowsInBlock;
+            const size_t nRowsInBlock = (startRow + elasticNetRowsInBlock > nRows) ? (nRows - startRow) : elasticNetRowsInBlock;
+
+            ReadRows<algorithmFPType, cpu> xBlock(const_cast<NumericTable &>(xTable), startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBlock);
+            const algorithmFPType *x = xBlock.get();
+
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                const algorithmFPType *xRow = x + i * nFeatures;
+                const algorithmFPType xij = xRow[iFeature];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < nFeatures; k++)
+                    local[k] += xRow[k] * xij;
+            }
+        });
+
+        tls.reduce([ = ](algorithmFPType *local) -> void
+        {
+            if (!local)
+                return;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < nFeatures; k++)
+                col[k] += local[k];
+            service_scalable_free<algorithmFPType, cpu>(local);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        const algorithmFPType invN = algorithmFPType(1.0) / algorithmFPType(nRows);
+        const algorithmFPType meanJ = _mean[iFeature];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFeatures; k++)
+            col[k] = col[k] * invN - _mean[k] * meanJ;
+        return Status();
+    }
+
+    const NumericTable &_xTable;
+    const algorithmFPType *_mean;
+    size_t _nFeatures;
+    size_t _nRows;
+    TArrayScalable<algorithmFPType *, cpu> _columns;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType softThreshold(algorithmFPType z, algorithmFPType threshold)
+{
+    if (z > threshold)  { return z - threshold; }
+    if (z < -threshold) { return z + threshold; }
+    return algorithmFPType(0);
+}
+
+/**
+ *  g -= gram * delta, split by blocks of features for large problems
+ */
+template <typename algorithmFPType, CpuType cpu>
+void updateGradient(algorithmFPType *g, const algorithmFPType *gram, algorithmFPType delta, size_t nFeatures)
+{
+    if (nFeatures < 2 * elasticNetFeaturesInBlock)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFeatures; k++)
+            g[k] -= gram[k] * delta;
+        return;
+    }
+
+    size_t nBlocks = nFeatures / elasticNetFeaturesInBlock;
+    if (nBlocks * elasticNetFeaturesInBlock < nFeatures) { nBlocks++; }
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        const size_t start = iBlock * elasticNetFeaturesInBlock;
+        const size_t end = (start + elasticNetFeaturesInBlock > nFeatures) ? nFeatures : start + elasticNetFeaturesInBlock;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t k = start; k < end; k++)
+            g[k] -= gram[k] * delta;
+    });
+}
+
+/**
+ *  One cyclic pass of coordinate descent over the given features.
+ *  Returns the largest absolute change of a coefficient.
+ */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType coordinateDescentPass(size_t nFeatures, const size_t *features, size_t nFeaturesInPass,
+                                      const algorithmFPType *variance, algorithmFPType l1, algorithmFPType l2,
+                                      algorithmFPType *b, algorithmFPType *g,
+                                      ElasticNetGramCache<algorithmFPType, cpu> &gram, Status &st)
+{
+    algorithmFPType maxDelta(0);
+    for (size_t i = 0; i < nFeaturesInPass; i++)
+    {
+        const size_t j = (features ? features[i] : i);
+        if (variance[j] <= algorithmFPType(0))
+            continue;
+
+        const algorithmFPType z    = g[j] + variance[j] * b[j];
+        const algorithmFPType bNew = softThreshold<algorithmFPType, cpu>(z, l1) / (variance[j] + l2);
+        const algorithmFPType delta = bNew - b[j];
+        if (delta == algorithmFPType(0))
+            continue;
+
+        const algorithmFPType *gramColumn = gram.column(j, st);
+        if (!st)
+            return maxDelta;
+
+        updateGradient<algorithmFPType, cpu>(g, gramColumn, delta, nFeatures);
+        b[j] = bNew;
+
+        const algorithmFPType absDelta = (delta > 0 ? delta : -delta);
+        if (absDelta > maxDelta)
+            maxDelta = absDelta;
+    }
+    return maxDelta;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::elasticNetDense, cpu>::compute(const NumericTable &x,
+                                                                             const NumericTable &y,
+                                                                             NumericTable &beta,
+                                                                             NumericTable &nIterationsTable,
+                                                                             const linear_regression::Parameter &par) const
+{
+    const size_t nRows      = x.getNumberOfRows();
+    const size_t nFeatures  = x.getNumberOfColumns();
+    const size_t nResponses = y.getNumberOfColumns();
+    const bool interceptFlag = par.interceptFlag;
+
+    /* Compute sums of the features, their squares, responses and X'Y in one pass over the data */
+    const size_t statSize = nFeatures * (2 + nResponses) + nResponses;
+    TArrayScalable<algorithmFPType, cpu> statArray(statSize, true);
+    DAAL_CHECK_MALLOC(statArray.get());
+    algorithmFPType *stat = statArray.get();
+
+    {
+        size_t nBlocks = nRows / elasticNetRowsInBlock;
+        if (nBlocks * elasticNetRowsInBlock < nRows) { nBlocks++; }
+
+        typedef ElasticNetStatisticsTask<algorithmFPType, cpu> TaskType;
+        daal::tls<TaskType *> tls([ = ]() -> TaskType *
+        {
+            return TaskType::create(nFeatures, nResponses);
+        });
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &tls, &x, &y, &safeStat ](int iBlock)
+        {
+            TaskType *tlsLocal = tls.local();
+            if (!tlsLocal)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            const size_t startRow = iBlock * elasticNetRowsInBlock;
+            const size_t endRow = (startRow + elasticNetRowsInBlock > nRows) ? nRows : startRow + elasticNetRowsInBlock;
+            Status localSt = tlsLocal->update(startRow, endRow - startRow, x, y);
+            DAAL_CHECK_STATUS_THR(localSt);
+        });
+
+        tls.reduce([ = ](TaskType *tlsLocal) -> void
+        {
+            if (!tlsLocal)
+                return;
+            tlsLocal->reduce(stat);
+            delete tlsLocal;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    const algorithmFPType invN = algorithmFPType(1.0) / algorithmFPType(nRows);
+    const algorithmFPType *sumX  = stat;
+    const algorithmFPType *sumX2 = sumX + nFeatures;
+    const algorithmFPType *sumY  = sumX2 + nFeatures;
+    const algorithmFPType *xty   = sumY + nResponses;
+
+    /* Means are used for centering only when the intercept term is computed */
+    TArrayScalable<algorithmFPType, cpu> meanArray(nFeatures, true);
+    TArrayScalable<algorithmFPType, cpu> varianceArray(nFeatures);
+    DAAL_CHECK_MALLOC(meanArray.get() && varianceArray.get());
+    algorithmFPType *mean     = meanArray.get();
+    algorithmFPType *variance = varianceArray.get();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (interceptFlag)
+            mean[j] = sumX[j] * invN;
+        variance[j] = sumX2[j] * invN - mean[j] * mean[j];
+    }
+
+    ElasticNetGramCache<algorithmFPType, cpu> gram(x, mean);
+    DAAL_CHECK_MALLOC(gram.isValid());
+
+    TArrayScalable<algorithmFPType, cpu> gArray(nFeatures);
+    TArrayScalable<algorithmFPType, cpu> bArray(nFeatures);
+    TArrayScalable<size_t, cpu> activeArray(nFeatures);
+    DAAL_CHECK_MALLOC(gArray.get() && bArray.get() && activeArray.get());
+    algorithmFPType *g = gArray.get();
+    algorithmFPType *b = bArray.get();
+    size_t *active = activeArray.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> betaRows(beta, 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(betaRows);
+    algorithmFPType *betaArray = betaRows.get();
+
+    WriteOnlyRows<int, cpu> nIterationsRows(nIterationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsRows);
+    int *nIterationsArray = nIterationsRows.get();
+
+    const algorithmFPType l1Target(par.l1Penalty);
+    const algorithmFPType l2(par.l2Penalty);
+    const algorithmFPType accuracyThreshold(par.accuracyThreshold);
+    const size_t maxIterations = par.maxIterations;
+
+    Status st;
+    for (size_t r = 0; r < nResponses; r++)
+    {
+        const algorithmFPType meanY = (interceptFlag ? sumY[r] * invN : algorithmFPType(0));
+
+        /* g_j = x_j'(y - Xb) / n for centered data, b = 0 at start */
+        algorithmFPType l1Max(0);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            g[j] = xty[r * nFeatures + j] * invN - mean[j] * meanY;
+            b[j] = algorithmFPType(0);
+            const algorithmFPType absG = (g[j] > 0 ? g[j] : -g[j]);
+            if (absG > l1Max)
+                l1Max = absG;
+        }
+
+        /* Geometric sequence of L1 penalties from the smallest one giving zero solution down to l1Penalty */
+        size_t pathLength = par.pathLength;
+        if (l1Target <= algorithmFPType(0) || l1Target >= l1Max)
+            pathLength = 1;
+        const algorithmFPType pathRatio = (pathLength > 1 ?
+            Math<algorithmFPType, cpu>::sPowx(l1Target / l1Max, algorithmFPType(1.0) / algorithmFPType(pathLength - 1)) : algorithmFPType(1));
+
+        /* Every value of the path gets its own budget of iterations, so the final l1Target step is always solved */
+        size_t nIterations = 0;
+        algorithmFPType l1 = (pathLength > 1 ? l1Max : l1Target);
+        for (size_t iPath = 0; iPath < pathLength; iPath++)
+        {
+            if (iPath + 1 == pathLength)
+                l1 = l1Target;
+
+            /* Full pass defines the active set, then iterate over the active set only until it converges */
+            nIterations = 0;
+            while (nIterations < maxIterations)
+            {
+                algorithmFPType maxDelta = coordinateDescentPass<algorithmFPType, cpu>(nFeatures, nullptr, nFeatures,
+                                                                                       variance, l1, l2, b, g, gram, st);
+                DAAL_CHECK_STATUS_VAR(st);
+                nIterations++;
+                if (maxDelta < accuracyThreshold)
+                    break;
+
+                size_t nActive = 0;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    if (b[j] != algorithmFPType(0))
+                        active[nActive++] = j;
+                }
+
+                while (nIterations < maxIterations)
+                {
+                    maxDelta = coordinateDescentPass<algorithmFPType, cpu>(nFeatures, active, nActive,
+                                                                           variance, l1, l2, b, g, gram, st);
+                    DAAL_CHECK_STATUS_VAR(st);
+                    nIterations++;
+                    if (maxDelta < accuracyThreshold)
+                        break;
+                }
+            }
+            l1 *= pathRatio;
+        }
+        /* maxIterations iterations for the final L1 penalty mean that the method has not converged */
+        nIterationsArray[r] = (int)nIterations;
+
+        /* Intercept restores the centering of the data */
+        algorithmFPType *betaR = betaArray + r * (nFeatures + 1);
+        algorithmFPType intercept = meanY;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            betaR[j + 1] = b[j];
+            intercept -= mean[j] * b[j];
+        }
+        betaR[0] = (interceptFlag ? intercept : algorithmFPType(0));
+    }
+
+    return st;
+}
+
+} // internal
+} // training
+} // linear_regression
+} // algorithms
+} // daal
+
+#endif
@@ -66,9 +66,10 @@ template <typename algorithmFPType, CpuType cpu>
 Status BatchKernel<algorithmFPType, training::qrDense, cpu>::compute(const NumericTable &x,
                                                                      const NumericTable &y,
                                                                      NumericTable &r, NumericTable &qty,
-                                                                     NumericTable &beta, bool interceptFlag) const
+                                                                     NumericTable &beta, bool interceptFlag,
+                                                                     const NumericTable *w) const
 {
-    Status st = UpdateKernelType::compute(x, y, r, qty, true, interceptFlag);
+    Status st = UpdateKernelType::compute(x, y, r, qty, true, interceptFlag, w);
     if (st)
      st = FinalizeKernelType::compute(r, qty, r, qty, beta, interceptFlag);
     return st;
@@ -78,9 +79,10 @@ template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::qrDense, cpu>::compute(const NumericTable &x,
                                                                       const NumericTable &y,
                                                                       NumericTable &r, NumericTable &qty,
-                                                                      bool interceptFlag) const
+                                                                      bool interceptFlag,
+                                                                      const NumericTable *w) const
 {
-    return UpdateKernelType::compute(x, y, r, qty, false, interceptFlag);
+    return UpdateKernelType::compute(x, y, r, qty, false, interceptFlag, w);
 }
 
 template <typename algorithmFPType, CpuType cpu>
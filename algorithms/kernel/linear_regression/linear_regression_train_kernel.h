@@ -90,7 +90,7 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
     typedef linear_model::normal_equations::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx,
-                   NumericTable &xty, NumericTable &beta, bool interceptFlag) const;
+                   NumericTable &xty, NumericTable &beta, bool interceptFlag, const NumericTable *w) const;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -100,7 +100,15 @@ class BatchKernel<algorithmFPType, training::qrDense, cpu> : public daal::algori
     typedef linear_model::qr::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &r,
-                   NumericTable &qty, NumericTable &beta, bool interceptFlag) const;
+                   NumericTable &qty, NumericTable &beta, bool interceptFlag, const NumericTable *w) const;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class BatchKernel<algorithmFPType, training::elasticNetDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    Status compute(const NumericTable &x, const NumericTable &y, NumericTable &beta, NumericTable &nIterations,
+                   const linear_regression::Parameter &par) const;
 };
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
@@ -114,7 +122,7 @@ class OnlineKernel<algorithmFPType, training::normEqDense, cpu> : public daal::a
     typedef linear_model::normal_equations::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-                   bool interceptFlag) const;
+                   bool interceptFlag, const NumericTable *w) const;
     Status finalizeCompute(const NumericTable &xtx, const NumericTable &xty, NumericTable &xtxFinal, NumericTable &xtyFinal,
                            NumericTable &beta, bool interceptFlag) const;
 };
@@ -126,7 +134,7 @@ class OnlineKernel<algorithmFPType, training::qrDense, cpu> : public daal::algor
     typedef linear_model::qr::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &r, NumericTable &qty,
-                   bool interceptFlag) const;
+                   bool interceptFlag, const NumericTable *w) const;
     Status finalizeCompute(const NumericTable &r, const NumericTable &qty, NumericTable &rFinal,
                            NumericTable &qtyFinal, NumericTable &beta, bool interceptFlag) const;
 };
@@ -46,6 +46,7 @@
 */
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -106,7 +107,16 @@ services::Status Input::check(const daal::algorithms::Parameter *par, int method
     size_t nRowsInData = dataTable->getNumberOfRows();
     size_t nColumnsInData = dataTable->getNumberOfColumns();
 
-    DAAL_CHECK(nRowsInData >= nColumnsInData, ErrorIncorrectNumberOfObservations);
+    /* Penalized elastic net problem has a solution when the number of features exceeds the number of observations */
+    if(method != elasticNetDense)
+    {
+        DAAL_CHECK(nRowsInData >= nColumnsInData, ErrorIncorrectNumberOfObservations);
+    }
+    else
+    {
+        /* Coordinate descent of the elastic net method does not support weights of the observations */
+        DAAL_CHECK_EX(!get(weights), ErrorIncorrectOptionalInput, OptionalInput, weightsStr());
+    }
     return s;
 }
 
@@ -47,6 +47,7 @@
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -62,7 +63,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LINEAR_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultId + 1)
+Result::Result() : linear_model::training::Result(lastResultNumericTableId + 1)
 {}
 
 /**
@@ -85,6 +86,26 @@ void Result::set(ResultId id, const linear_regression::ModelPtr &value)
     linear_model::training::Result::set(linear_model::training::ResultId(id), value);
 }
 
+/**
+ * Returns the numeric table result of linear regression model-based training
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultNumericTableId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the numeric table result of linear regression model-based training
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Result
+ */
+void Result::set(ResultNumericTableId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of linear regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -108,7 +129,12 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
 
     const linear_regression::ModelPtr model = get(training::model);
 
-    return linear_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+    DAAL_CHECK_STATUS(s, linear_regression::checkModel(model.get(), *par, nBeta, nResponses, method));
+    if(method == elasticNetDense)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(nIterations).get(), nIterationsStr(), 0, 0, nResponses, 1));
+    }
+    return s;
 }
 
 /**
@@ -121,7 +147,7 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
  */
 services::Status Result::check(const daal::algorithms::PartialResult *pr, const daal::algorithms::Parameter *par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastResultNumericTableId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     const PartialResult *partRes = static_cast<const PartialResult *>(pr);
 
     size_t nBeta = partRes->getNumberOfFeatures() + 1;
@@ -49,8 +49,10 @@
 #define __LINEAR_REGRESSION_TRAINING_RESULT_
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "linear_regression_ne_model_impl.h"
 #include "linear_regression_qr_model_impl.h"
+#include "linear_regression_elastic_net_model_impl.h"
 
 namespace daal
 {
@@ -83,6 +85,11 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     {
         set(model, linear_regression::ModelPtr(new linear_regression::internal::ModelNormEqImpl(in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s)));
     }
+    else if(method == elasticNetDense)
+    {
+        set(model, linear_regression::ModelPtr(new linear_regression::internal::ModelElasticNetImpl(in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s)));
+        set(nIterations, data_management::HomogenNumericTable<int>::create(in->getNumberOfDependentVariables(), 1, data_management::NumericTable::doAllocate, &s));
+    }
 
     return s;
 }
@@ -0,0 +1,214 @@
+/* file: logistic_regression_data_helper.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the access to blocks of dense and CSR data
+//  used by logistic regression training and prediction.
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_DATA_HELPER_I__
+#define __LOGISTIC_REGRESSION_DATA_HELPER_I__
+
+#include "numeric_table.h"
+#include "csr_numeric_table.h"
+#include "service_numeric_table.h"
+#include "service_blas.h"
+#include "service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+
+const size_t logisticRegressionRowsInBlock = 256;
+
+/**
+ *  Block of observations of a dense or CSR numeric table.
+ *  Coefficients are stored as nBetaRows x (nFeatures + 1) array with the intercept term in the first column.
+ *  Column indices of CSR data are one-based, so they directly address the coefficients of the features.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class DataBlock
+{
+public:
+    DataBlock(const NumericTable &x) : _x(const_cast<NumericTable &>(x)), _nFeatures(x.getNumberOfColumns()), _nRows(0),
+        _csrIface(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&x))) {}
+
+    services::Status set(size_t startRow, size_t nRows)
+    {
+        _nRows = nRows;
+        if (_csrIface)
+        {
+            _csrBlock.set(_csrIface, startRow, nRows);
+            return _csrBlock.status();
+        }
+        _denseBlock.set(_x, startRow, nRows);
+        return _denseBlock.status();
+    }
+
+    size_t getNumberOfRows() const { return _nRows; }
+
+    /* z = [1 X] * beta^T, z is nRows x nBetaRows */
+    void linearPredictor(const algorithmFPType *beta, size_t nBetaRows, algorithmFPType *z)
+    {
+        const size_t nBetas = _nFeatures + 1;
+        if (_csrIface)
+        {
+            const algorithmFPType *values = _csrBlock.values();
+            const size_t *cols = _csrBlock.cols();
+            const size_t *rows = _csrBlock.rows();
+            for (size_t i = 0; i < _nRows; i++)
+            {
+                algorithmFPType *zi = z + i * nBetaRows;
+                for (size_t k = 0; k < nBetaRows; k++)
+                    zi[k] = beta[k * nBetas];
+                for (size_t idx = rows[i] - rows[0]; idx < rows[i + 1] - rows[0]; idx++)
+                {
+                    for (size_t k = 0; k < nBetaRows; k++)
+                        zi[k] += values[idx] * beta[k * nBetas + cols[idx]];
+                }
+            }
+            return;
+        }
+
+        char trans   = 'T';
+        char notrans = 'N';
+        algorithmFPType one(1.0);
+        algorithmFPType zero(0.0);
+        DAAL_INT nFeatures (_nFeatures);
+        DAAL_INT nBetasInt (nBetas);
+        DAAL_INT nBetaRowsInt(nBetaRows);
+        DAAL_INT nRows     (_nRows);
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &nBetaRowsInt, &nRows, &nFeatures, &one, beta + 1, &nBetasInt,
+                                           _denseBlock.get(), &nFeatures, &zero, z, &nBetaRowsInt);
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            algorithmFPType *zi = z + i * nBetaRows;
+            for (size_t k = 0; k < nBetaRows; k++)
+                zi[k] += beta[k * nBetas];
+        }
+    }
+
+    /* g += r^T * [1 X], r is nRows x nBetaRows, g is nBetaRows x (nFeatures + 1) */
+    void addTransposedProduct(const algorithmFPType *r, size_t nBetaRows, algorithmFPType *g)
+    {
+        const size_t nBetas = _nFeatures + 1;
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            const algorithmFPType *ri = r + i * nBetaRows;
+            for (size_t k = 0; k < nBetaRows; k++)
+                g[k * nBetas] += ri[k];
+        }
+
+        if (_csrIface)
+        {
+            const algorithmFPType *values = _csrBlock.values();
+            const size_t *cols = _csrBlock.cols();
+            const size_t *rows = _csrBlock.rows();
+            for (size_t i = 0; i < _nRows; i++)
+            {
+                const algorithmFPType *ri = r + i * nBetaRows;
+                for (size_t idx = rows[i] - rows[0]; idx < rows[i + 1] - rows[0]; idx++)
+                {
+                    for (size_t k = 0; k < nBetaRows; k++)
+                        g[k * nBetas + cols[idx]] += values[idx] * ri[k];
+                }
+            }
+            return;
+        }
+
+        char trans   = 'T';
+        char notrans = 'N';
+        algorithmFPType one(1.0);
+        DAAL_INT nFeatures (_nFeatures);
+        DAAL_INT nBetasInt (nBetas);
+        DAAL_INT nBetaRowsInt(nBetaRows);
+        DAAL_INT nRows     (_nRows);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &nFeatures, &nBetaRowsInt, &nRows, &one, _denseBlock.get(), &nFeatures,
+                                           r, &nBetaRowsInt, &one, g + 1, &nBetasInt);
+    }
+
+private:
+    NumericTable &_x;
+    size_t _nFeatures;
+    size_t _nRows;
+    CSRNumericTableIface *_csrIface;
+    ReadRows<algorithmFPType, cpu> _denseBlock;
+    ReadRowsCSR<algorithmFPType, cpu> _csrBlock;
+};
+
+/* Logarithm of the sum of exponents of the row of size n, the exponents are written to expZ */
+template <typename algorithmFPType, CpuType cpu>
+inline algorithmFPType logSumExp(const algorithmFPType *z, size_t n, algorithmFPType *expZ)
+{
+    algorithmFPType zMax = z[0];
+    for (size_t k = 1; k < n; k++)
+    {
+        if (z[k] > zMax)
+            zMax = z[k];
+    }
+    for (size_t k = 0; k < n; k++)
+    {
+        expZ[k] = z[k] - zMax;
+        if (expZ[k] < Math<algorithmFPType, cpu>::vExpThreshold())
+            expZ[k] = Math<algorithmFPType, cpu>::vExpThreshold();
+    }
+    Math<algorithmFPType, cpu>::vExp(n, expZ, expZ);
+    algorithmFPType sum(0);
+    for (size_t k = 0; k < n; k++)
+        sum += expZ[k];
+    return zMax + Math<algorithmFPType, cpu>::sLog(sum);
+}
+
+} // namespace internal
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
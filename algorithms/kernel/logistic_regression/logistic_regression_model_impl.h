@@ -0,0 +1,129 @@
+/* file: logistic_regression_model_impl.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the logistic regression model
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_MODEL_IMPL__
+#define __LOGISTIC_REGRESSION_MODEL_IMPL__
+
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "../classifier/classifier_model_impl.h"
+
+#ifndef __DAAL_REGISTER_SERIALIZATION_CLASS2
+#define __DAAL_REGISTER_SERIALIZATION_CLASS2(ClassName, ImplClassName, Tag)                         \
+    static data_management::SerializationIface* creator##ClassName() { return new ImplClassName(); }\
+    data_management::SerializationDesc ClassName::_desc(creator##ClassName, Tag);                   \
+    int ClassName::serializationTag() { return _desc.tag(); }                                       \
+    int ClassName::getSerializationTag() const { return _desc.tag(); }
+#endif
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace internal
+{
+
+class ModelImpl : public logistic_regression::Model,
+    public algorithms::classifier::internal::ModelInternal
+{
+public:
+    typedef algorithms::classifier::internal::ModelInternal ClassificationImplType;
+
+    ModelImpl(size_t nFeatures = 0, bool interceptFlag = true) : ClassificationImplType(nFeatures), _interceptFlag(interceptFlag) {}
+
+    /**
+     * Constructs the logistic regression model
+     * \param[in]  nFeatures      Number of features in the training data
+     * \param[in]  nClasses       Number of classes
+     * \param[in]  interceptFlag  Flag that indicates whether the intercept term is computed
+     * \param[in]  dummy          Dummy variable for the templated constructor
+     * \param[out] st             Status of the model construction
+     */
+    template<typename modelFPType>
+    ModelImpl(size_t nFeatures, size_t nClasses, bool interceptFlag, modelFPType dummy, services::Status &st) :
+        ClassificationImplType(nFeatures), _interceptFlag(interceptFlag)
+    {
+        const size_t nBetaRows = (nClasses == 2 ? 1 : nClasses);
+        _beta = data_management::HomogenNumericTable<modelFPType>::create(nFeatures + 1, nBetaRows,
+                                                                          data_management::NumericTable::doAllocate, modelFPType(0), &st);
+    }
+
+    ~ModelImpl() {}
+
+    virtual size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return ClassificationImplType::getNumberOfFeatures(); }
+
+    //Implementation of logistic_regression::Model
+    virtual size_t getNumberOfBetas() const DAAL_C11_OVERRIDE { return ClassificationImplType::getNumberOfFeatures() + 1; }
+    virtual bool getInterceptFlag() const DAAL_C11_OVERRIDE { return _interceptFlag; }
+    virtual data_management::NumericTablePtr getBeta() DAAL_C11_OVERRIDE { return _beta; }
+    virtual const data_management::NumericTablePtr getBeta() const DAAL_C11_OVERRIDE { return _beta; }
+
+    virtual services::Status serializeImpl(data_management::InputDataArchive * arch) DAAL_C11_OVERRIDE;
+    virtual services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        arch->set(ClassificationImplType::_nFeatures);
+        arch->set(_interceptFlag);
+        arch->setSharedPtrObj(_beta);
+        return services::Status();
+    }
+
+    bool _interceptFlag;
+    data_management::NumericTablePtr _beta;
+};
+
+} // namespace internal
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
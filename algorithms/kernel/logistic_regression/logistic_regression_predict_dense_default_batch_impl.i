@@ -0,0 +1,247 @@
+/* file: logistic_regression_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for logistic regression predictions calculation
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __LOGISTIC_REGRESSION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "logistic_regression_predict_kernel.h"
+#include "logistic_regression_data_helper.i"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::algorithms::logistic_regression::internal;
+
+/**
+ *  Per-thread buffers of the prediction
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PredictTask
+{
+public:
+    static PredictTask *create(const NumericTable &x, size_t nBetaRows)
+    {
+        PredictTask *res = new PredictTask(x, nBetaRows);
+        if (!res->_z.get() || !res->_e.get())
+        {
+            delete res;
+            return nullptr;
+        }
+        return res;
+    }
+
+    DataBlock<algorithmFPType, cpu> xBlock;
+    /* Linear predictor of the block, in the binary case followed by the buffer of the same size */
+    algorithmFPType *z() { return _z.get(); }
+    algorithmFPType *e() { return _e.get(); }
+
+private:
+    PredictTask(const NumericTable &x, size_t nBetaRows) : xBlock(x),
+        _z(logisticRegressionRowsInBlock * (nBetaRows == 1 ? 2 : nBetaRows)), _e(nBetaRows) {}
+
+    TArrayScalable<algorithmFPType, cpu> _z;
+    TArrayScalable<algorithmFPType, cpu> _e;
+};
+
+template <typename algorithmFPType, logistic_regression::prediction::Method method, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, const logistic_regression::Model *m,
+    size_t nClasses, NumericTable *prediction, NumericTable *probabilities, NumericTable *logProbabilities)
+{
+    typedef PredictTask<algorithmFPType, cpu> TaskType;
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nBetaRows = (nClasses == 2 ? 1 : nClasses);
+
+    ReadRows<algorithmFPType, cpu> betaBlock(m->getBeta().get(), 0, nBetaRows);
+    DAAL_CHECK_BLOCK_STATUS(betaBlock);
+    const algorithmFPType *beta = betaBlock.get();
+
+    size_t nBlocks = nRows / logisticRegressionRowsInBlock;
+    if (nBlocks * logisticRegressionRowsInBlock < nRows) { nBlocks++; }
+
+    daal::tls<TaskType *> tls([ = ]() -> TaskType *
+    {
+        return TaskType::create(*x, nBetaRows);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ =, &tls, &safeStat ](int iBlock)
+    {
+        TaskType *task = tls.local();
+        if (!task)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        const size_t startRow = iBlock * logisticRegressionRowsInBlock;
+        const size_t nRowsInBlock = (startRow + logisticRegressionRowsInBlock > nRows) ? (nRows - startRow) : logisticRegressionRowsInBlock;
+
+        services::Status localSt = task->xBlock.set(startRow, nRowsInBlock);
+        DAAL_CHECK_STATUS_THR(localSt);
+
+        algorithmFPType *z = task->z();
+        task->xBlock.linearPredictor(beta, nBetaRows, z);
+
+        WriteOnlyRows<algorithmFPType, cpu> labelsBlock;
+        WriteOnlyRows<algorithmFPType, cpu> probBlock;
+        WriteOnlyRows<algorithmFPType, cpu> logProbBlock;
+        algorithmFPType *labels = nullptr;
+        algorithmFPType *prob = nullptr;
+        algorithmFPType *logProb = nullptr;
+        if (prediction)
+        {
+            labels = labelsBlock.set(prediction, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(labelsBlock);
+        }
+        if (probabilities)
+        {
+            prob = probBlock.set(probabilities, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(probBlock);
+        }
+        if (logProbabilities)
+        {
+            logProb = logProbBlock.set(logProbabilities, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(logProbBlock);
+        }
+
+        if (nBetaRows == 1)
+        {
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                if (labels)
+                    labels[i] = (z[i] > 0 ? algorithmFPType(1) : algorithmFPType(0));
+            }
+            if (!prob && !logProb)
+                return;
+
+            /* log(1 + exp(-|z|)) is used to compute both probabilities without overflow */
+            algorithmFPType *t = task->z() + nRowsInBlock;
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                t[i] = (z[i] > 0 ? -z[i] : z[i]);
+                if (t[i] < Math<algorithmFPType, cpu>::vExpThreshold())
+                    t[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+            }
+            Math<algorithmFPType, cpu>::vExp(nRowsInBlock, t, t);
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                const algorithmFPType e = t[i];
+                const algorithmFPType p1 = (z[i] > 0 ? algorithmFPType(1) / (algorithmFPType(1) + e) : e / (algorithmFPType(1) + e));
+                if (prob)
+                {
+                    prob[2 * i]     = algorithmFPType(1) - p1;
+                    prob[2 * i + 1] = p1;
+                }
+                if (logProb)
+                {
+                    const algorithmFPType l = Math<algorithmFPType, cpu>::sLog(algorithmFPType(1) + e);
+                    logProb[2 * i]     = -(z[i] > 0 ? z[i] : algorithmFPType(0)) - l;
+                    logProb[2 * i + 1] = -(z[i] > 0 ? algorithmFPType(0) : -z[i]) - l;
+                }
+            }
+            return;
+        }
+
+        algorithmFPType *e = task->e();
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            const algorithmFPType *zi = z + i * nBetaRows;
+            if (labels)
+            {
+                size_t iMax = 0;
+                for (size_t k = 1; k < nBetaRows; k++)
+                {
+                    if (zi[k] > zi[iMax])
+                        iMax = k;
+                }
+                labels[i] = algorithmFPType(iMax);
+            }
+            if (!prob && !logProb)
+                continue;
+
+            const algorithmFPType lse = logSumExp<algorithmFPType, cpu>(zi, nBetaRows, e);
+            if (prob)
+            {
+                algorithmFPType sum(0);
+                for (size_t k = 0; k < nBetaRows; k++)
+                    sum += e[k];
+                const algorithmFPType invSum = algorithmFPType(1) / sum;
+                for (size_t k = 0; k < nBetaRows; k++)
+                    prob[i * nBetaRows + k] = e[k] * invSum;
+            }
+            if (logProb)
+            {
+                for (size_t k = 0; k < nBetaRows; k++)
+                    logProb[i * nBetaRows + k] = zi[k] - lse;
+            }
+        }
+    });
+
+    tls.reduce([](TaskType *task) -> void
+    {
+        delete task;
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,94 @@
+/* file: logistic_regression_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes logistic regression
+//  prediction results.
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_PREDICT_KERNEL_H__
+#define __LOGISTIC_REGRESSION_PREDICT_KERNEL_H__
+
+#include "logistic_regression_predict.h"
+#include "service_memory.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+namespace internal
+{
+
+template <typename algorithmFPType, logistic_regression::prediction::Method method, CpuType cpu>
+class PredictKernel : public daal::algorithms::Kernel
+{
+public:
+    /**
+     *  \brief Compute logistic regression prediction results.
+     *
+     *  \param x[in]                    Matrix of input variables X
+     *  \param m[in]                    Logistic regression model obtained on training stage
+     *  \param nClasses[in]             Number of classes
+     *  \param prediction[out]          Labels of the classes, not computed if NULL
+     *  \param probabilities[out]       Probabilities of the classes, not computed if NULL
+     *  \param logProbabilities[out]    Logarithms of probabilities of the classes, not computed if NULL
+     */
+    services::Status compute(const NumericTable *x, const logistic_regression::Model *m, size_t nClasses,
+        NumericTable *prediction, NumericTable *probabilities, NumericTable *logProbabilities);
+};
+
+} // namespace internal
+}
+}
+}
+} // namespace daal
+
+#endif
@@ -0,0 +1,101 @@
+/* file: logistic_regression_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the logistic regression algorithm prediction result.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory for storing the results requested in Parameter::resultsToCompute
+ * \tparam  algorithmFPType     Data type for storing prediction results
+ * \param[in] input     Pointer to the input objects of the classification algorithm
+ * \param[in] parameter Pointer to the parameters of the classification algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status st;
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+    const Parameter *prm = static_cast<const Parameter *>(parameter);
+    if(prm->resultsToCompute & computeClassesLabels)
+    {
+        set(classifier::prediction::prediction, data_management::HomogenNumericTable<algorithmFPType>::create(1, nRows,
+            data_management::NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if(prm->resultsToCompute & computeClassesProbabilities)
+    {
+        set(probabilities, data_management::HomogenNumericTable<algorithmFPType>::create(prm->nClasses, nRows,
+            data_management::NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if(prm->resultsToCompute & computeClassesLogProbabilities)
+    {
+        set(logProbabilities, data_management::HomogenNumericTable<algorithmFPType>::create(prm->nClasses, nRows,
+            data_management::NumericTableIface::doAllocate, &st));
+    }
+    return st;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+} // namespace interface1
+} // namespace prediction
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,174 @@
+/* file: logistic_regression_predict_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression algorithm classes.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_predict_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LOGISTIC_REGRESSION_PREDICTION_RESULT_ID);
+
+/**
+ * Returns an input object for making logistic regression model-based prediction
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(classifier::prediction::NumericTableInputId id) const
+{
+    return algorithms::classifier::prediction::Input::get(id);
+}
+
+/**
+ * Returns an input object for making logistic regression model-based prediction
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+logistic_regression::ModelPtr Input::get(classifier::prediction::ModelInputId id) const
+{
+    return staticPointerCast<logistic_regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object for making logistic regression model-based prediction
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   %Input object
+ */
+void Input::set(classifier::prediction::NumericTableInputId id, const NumericTablePtr &value)
+{
+    algorithms::classifier::prediction::Input::set(id, value);
+}
+
+/**
+ * Sets an input object for making logistic regression model-based prediction
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   %Input object
+ */
+void Input::set(classifier::prediction::ModelInputId id, const logistic_regression::ModelPtr &value)
+{
+    algorithms::classifier::prediction::Input::set(id, value);
+}
+
+/**
+ * Checks an input object for making logistic regression model-based prediction
+ */
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, algorithms::classifier::prediction::Input::check(parameter, method));
+    const logistic_regression::Model *m = dynamic_cast<const logistic_regression::Model *>(Argument::get(classifier::prediction::model).get());
+    DAAL_CHECK(m, ErrorIncorrectTypeOfModel);
+
+    const Parameter *prm = static_cast<const Parameter *>(parameter);
+    const size_t nBetaRows = (prm->nClasses == 2 ? 1 : prm->nClasses);
+    DAAL_CHECK_STATUS(s, checkNumericTable(m->getBeta().get(), betaStr(), 0, 0, m->getNumberOfBetas(), nBetaRows));
+    return s;
+}
+
+Result::Result() : classifier::prediction::Result(lastResultNumericTableId + 1) {}
+
+/**
+ * Returns the prediction result of the logistic regression algorithm
+ * \param[in] id   Identifier of the prediction result, \ref ResultNumericTableId
+ * \return         Prediction result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultNumericTableId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the prediction result of the logistic regression algorithm
+ * \param[in] id    Identifier of the prediction result, \ref ResultNumericTableId
+ * \param[in] value Pointer to the prediction result
+ */
+void Result::set(ResultNumericTableId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] input     Pointer to the the input object
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                               int method) const
+{
+    const Parameter *prm = static_cast<const Parameter *>(parameter);
+    DAAL_CHECK_EX(prm->resultsToCompute & (computeClassesLabels | computeClassesProbabilities | computeClassesLogProbabilities),
+                  ErrorIncorrectParameter, ParameterName, resultsToComputeStr());
+
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    Status s;
+    if(prm->resultsToCompute & computeClassesLabels)
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(classifier::prediction::prediction).get(), predictionStr(), unexpectedLayouts, 0, 1, nRows));
+    if(prm->resultsToCompute & computeClassesProbabilities)
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(probabilities).get(), probabilitiesStr(), unexpectedLayouts, 0, prm->nClasses, nRows));
+    if(prm->resultsToCompute & computeClassesLogProbabilities)
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(logProbabilities).get(), logProbabilitiesStr(), unexpectedLayouts, 0, prm->nClasses, nRows));
+    return s;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,97 @@
+/* file: logistic_regression_train_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression training functions
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAIN_IMPL_I__
+#define __LOGISTIC_REGRESSION_TRAIN_IMPL_I__
+
+#include "logistic_regression_train_kernel.h"
+#include "logistic_regression_train_newton_cg_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, const NumericTable *y,
+    logistic_regression::Model &m, const Parameter &par)
+{
+    CrossEntropyLoss<algorithmFPType, cpu> loss(*x, *y, par.nClasses, par.interceptFlag, algorithmFPType(par.l2Penalty));
+    Status s = loss.init();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* Start from zero coefficients */
+    const size_t dim = loss.dimension();
+    TArrayScalable<algorithmFPType, cpu> betaArr(dim, true);
+    DAAL_CHECK_MALLOC(betaArr.get());
+    algorithmFPType *beta = betaArr.get();
+
+    if (method == newtonCG)
+        s = minimizeNewtonCG<algorithmFPType, cpu>(loss, par, beta);
+    else
+        s = minimizeLbfgs<algorithmFPType, cpu>(loss, par, beta);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    WriteOnlyRows<algorithmFPType, cpu> betaBlock(m.getBeta().get(), 0, loss.nBetaRows());
+    DAAL_CHECK_BLOCK_STATUS(betaBlock);
+    daal::services::daal_memcpy_s(betaBlock.get(), dim * sizeof(algorithmFPType), beta, dim * sizeof(algorithmFPType));
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,276 @@
+/* file: logistic_regression_train_lbfgs_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the limited-memory BFGS method used for training of the logistic regression model.
+//  L1 penalty is handled by the orthant-wise modification of the method (OWL-QN).
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAIN_LBFGS_IMPL_I__
+#define __LOGISTIC_REGRESSION_TRAIN_LBFGS_IMPL_I__
+
+#include "logistic_regression_train_loss_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFPType>
+inline algorithmFPType dotProduct(const algorithmFPType *a, const algorithmFPType *b, size_t n)
+{
+    algorithmFPType res(0);
+    for (size_t j = 0; j < n; j++)
+        res += a[j] * b[j];
+    return res;
+}
+
+template <typename algorithmFPType>
+inline algorithmFPType maxAbs(const algorithmFPType *a, size_t n)
+{
+    algorithmFPType res(0);
+    for (size_t j = 0; j < n; j++)
+    {
+        const algorithmFPType v = (a[j] < 0 ? -a[j] : a[j]);
+        if (v > res)
+            res = v;
+    }
+    return res;
+}
+
+/**
+ *  Minimizes loss(beta) + l1Penalty * ||w||_1, where w are the coefficients of the features.
+ *  On input beta contains the starting point, on output - the solution
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status minimizeLbfgs(CrossEntropyLoss<algorithmFPType, cpu> &loss, const Parameter &par, algorithmFPType *beta)
+{
+    const size_t dim = loss.dimension();
+    const size_t nBetas = loss.nBetas();
+    const size_t m = par.nCorrectionPairs;
+    const algorithmFPType l1 = algorithmFPType(par.l1Penalty);
+    const algorithmFPType eps = algorithmFPType(par.accuracyThreshold);
+    const algorithmFPType c1 = algorithmFPType(1.0e-4);
+    const size_t maxLineSearchSteps = 30;
+
+    TArrayScalable<algorithmFPType, cpu> sArr(m * dim), yArr(m * dim), rhoArr(m), alphaArr(m);
+    TArrayScalable<algorithmFPType, cpu> gArr(dim), pgArr(dim), dArr(dim), betaNewArr(dim), gNewArr(dim);
+    DAAL_CHECK_MALLOC(sArr.get() && yArr.get() && rhoArr.get() && alphaArr.get() &&
+                      gArr.get() && pgArr.get() && dArr.get() && betaNewArr.get() && gNewArr.get());
+    algorithmFPType *s = sArr.get();
+    algorithmFPType *y = yArr.get();
+    algorithmFPType *rho = rhoArr.get();
+    algorithmFPType *alpha = alphaArr.get();
+    algorithmFPType *g = gArr.get();
+    algorithmFPType *pg = pgArr.get();
+    algorithmFPType *d = dArr.get();
+    algorithmFPType *betaNew = betaNewArr.get();
+    algorithmFPType *gNew = gNewArr.get();
+
+    /* Objective including the L1 penalty */
+    auto l1Norm = [ = ](const algorithmFPType *b) -> algorithmFPType
+    {
+        algorithmFPType res(0);
+        for (size_t j = 0; j < dim; j++)
+        {
+            if (j % nBetas)
+                res += (b[j] < 0 ? -b[j] : b[j]);
+        }
+        return res;
+    };
+
+    /* Pseudo-gradient of the objective, equal to the gradient if L1 penalty is not used */
+    auto pseudoGradient = [ = ]() -> void
+    {
+        for (size_t j = 0; j < dim; j++)
+        {
+            if (l1 == 0 || (j % nBetas) == 0)
+                pg[j] = g[j];
+            else if (beta[j] > 0)
+                pg[j] = g[j] + l1;
+            else if (beta[j] < 0)
+                pg[j] = g[j] - l1;
+            else if (g[j] + l1 < 0)
+                pg[j] = g[j] + l1;
+            else if (g[j] - l1 > 0)
+                pg[j] = g[j] - l1;
+            else
+                pg[j] = 0;
+        }
+    };
+
+    algorithmFPType f(0);
+    Status s0 = loss.compute(beta, f, g, false);
+    DAAL_CHECK_STATUS_VAR(s0);
+    f += l1 * l1Norm(beta);
+
+    size_t nPairs = 0;
+    size_t iFirst = 0;
+    for (size_t iter = 0; iter < par.maxIterations; iter++)
+    {
+        pseudoGradient();
+        const algorithmFPType pgNorm = maxAbs(pg, dim);
+        if (pgNorm < eps)
+            break;
+
+        /* Two-loop recursion: d = -H * pg */
+        for (size_t j = 0; j < dim; j++)
+            d[j] = -pg[j];
+        for (size_t i = 0; i < nPairs; i++)
+        {
+            const size_t k = (iFirst + nPairs - 1 - i) % m;
+            alpha[k] = rho[k] * dotProduct(s + k * dim, d, dim);
+            for (size_t j = 0; j < dim; j++)
+                d[j] -= alpha[k] * y[k * dim + j];
+        }
+        if (nPairs)
+        {
+            const size_t k = (iFirst + nPairs - 1) % m;
+            const algorithmFPType gamma = dotProduct(s + k * dim, y + k * dim, dim) / dotProduct(y + k * dim, y + k * dim, dim);
+            for (size_t j = 0; j < dim; j++)
+                d[j] *= gamma;
+        }
+        for (size_t i = 0; i < nPairs; i++)
+        {
+            const size_t k = (iFirst + i) % m;
+            const algorithmFPType b = rho[k] * dotProduct(y + k * dim, d, dim);
+            for (size_t j = 0; j < dim; j++)
+                d[j] += (alpha[k] - b) * s[k * dim + j];
+        }
+        loss.maskIntercept(d);
+
+        /* Keep the direction in the orthant defined by the pseudo-gradient */
+        if (l1 > 0)
+        {
+            for (size_t j = 0; j < dim; j++)
+            {
+                if (d[j] * pg[j] >= 0)
+                    d[j] = 0;
+            }
+        }
+        algorithmFPType slope = dotProduct(d, pg, dim);
+        if (!(slope < 0))
+        {
+            for (size_t j = 0; j < dim; j++)
+                d[j] = -pg[j];
+            slope = dotProduct(d, pg, dim);
+        }
+
+        /* Backtracking line search with the Armijo condition */
+        algorithmFPType step = (nPairs ? algorithmFPType(1) : algorithmFPType(1) / pgNorm);
+        if (step > 1)
+            step = 1;
+        algorithmFPType fNew(0);
+        bool accepted = false;
+        for (size_t ls = 0; ls < maxLineSearchSteps && !accepted; ls++, step *= algorithmFPType(0.5))
+        {
+            for (size_t j = 0; j < dim; j++)
+            {
+                betaNew[j] = beta[j] + step * d[j];
+                if (l1 > 0 && (j % nBetas))
+                {
+                    /* Orthant projection */
+                    const algorithmFPType orthant = (beta[j] != 0 ? beta[j] : -pg[j]);
+                    if (betaNew[j] * orthant <= 0)
+                        betaNew[j] = 0;
+                }
+            }
+            Status st = loss.compute(betaNew, fNew, gNew, false);
+            DAAL_CHECK_STATUS_VAR(st);
+            fNew += l1 * l1Norm(betaNew);
+
+            algorithmFPType decrease(0);
+            for (size_t j = 0; j < dim; j++)
+                decrease += pg[j] * (betaNew[j] - beta[j]);
+            accepted = (fNew <= f + c1 * decrease);
+        }
+        if (!accepted)
+            break;
+
+        /* Update the correction pairs if the curvature condition holds */
+        algorithmFPType sy(0), yy(0);
+        for (size_t j = 0; j < dim; j++)
+        {
+            sy += (betaNew[j] - beta[j]) * (gNew[j] - g[j]);
+            yy += (gNew[j] - g[j]) * (gNew[j] - g[j]);
+        }
+        const bool storePair = (sy > algorithmFPType(1.0e-10) * yy);
+        const size_t k = (nPairs < m ? (iFirst + nPairs) % m : iFirst);
+        algorithmFPType *sk = s + k * dim;
+        algorithmFPType *yk = y + k * dim;
+        for (size_t j = 0; j < dim; j++)
+        {
+            if (storePair)
+            {
+                sk[j] = betaNew[j] - beta[j];
+                yk[j] = gNew[j] - g[j];
+            }
+            beta[j] = betaNew[j];
+            g[j] = gNew[j];
+        }
+        if (storePair)
+        {
+            rho[k] = algorithmFPType(1) / sy;
+            if (nPairs < m)
+                nPairs++;
+            else
+                iFirst = (iFirst + 1) % m;
+        }
+        f = fNew;
+    }
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,399 @@
+/* file: logistic_regression_train_loss_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the cross-entropy loss of the logistic regression model:
+//  value, gradient and Hessian-vector products computed in parallel over blocks of rows.
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAIN_LOSS_IMPL_I__
+#define __LOGISTIC_REGRESSION_TRAIN_LOSS_IMPL_I__
+
+#include "logistic_regression_data_helper.i"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::algorithms::logistic_regression::internal;
+
+/**
+ *  Per-thread buffers of the loss computation
+ */
+template <typename algorithmFPType, CpuType cpu>
+class LossTask
+{
+public:
+    static LossTask *create(const NumericTable &x, size_t nBetaRows, size_t dim)
+    {
+        LossTask *res = new LossTask(x, nBetaRows, dim);
+        if (!res->_z.get() || !res->_r.get() || !res->_g.get())
+        {
+            delete res;
+            return nullptr;
+        }
+        return res;
+    }
+
+    DataBlock<algorithmFPType, cpu> xBlock;
+    algorithmFPType *z() { return _z.get(); }
+    algorithmFPType *r() { return _r.get(); }
+    algorithmFPType *g() { return _g.get(); }
+    algorithmFPType value;
+
+private:
+    LossTask(const NumericTable &x, size_t nBetaRows, size_t dim) : xBlock(x), value(0),
+        _z(logisticRegressionRowsInBlock * nBetaRows), _r(logisticRegressionRowsInBlock * nBetaRows), _g(dim, true) {}
+
+    TArrayScalable<algorithmFPType, cpu> _z;
+    TArrayScalable<algorithmFPType, cpu> _r;
+    TArrayScalable<algorithmFPType, cpu> _g;
+};
+
+/**
+ *  Average cross-entropy loss with L2 penalty on the coefficients of the features.
+ *  For two classes the binary logistic loss with one vector of coefficients is used,
+ *  for more classes the multinomial loss with one vector of coefficients per class
+ */
+template <typename algorithmFPType, CpuType cpu>
+class CrossEntropyLoss
+{
+    typedef LossTask<algorithmFPType, cpu> TaskType;
+public:
+    CrossEntropyLoss(const NumericTable &x, const NumericTable &y, size_t nClasses, bool interceptFlag, algorithmFPType l2Penalty) :
+        _x(x), _y(y), _nRows(x.getNumberOfRows()), _nBetas(x.getNumberOfColumns() + 1), _nClasses(nClasses),
+        _nBetaRows(nClasses == 2 ? 1 : nClasses), _interceptFlag(interceptFlag), _l2Penalty(l2Penalty) {}
+
+    /* Reads class labels and allocates the buffer of probabilities used in Hessian-vector products */
+    Status init()
+    {
+        _labels.reset(_nRows);
+        _probabilities.reset(_nRows * _nBetaRows);
+        DAAL_CHECK_MALLOC(_labels.get() && _probabilities.get());
+
+        ReadRows<algorithmFPType, cpu> yBlock(const_cast<NumericTable &>(_y), 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS(yBlock);
+        const algorithmFPType *y = yBlock.get();
+        size_t *labels = _labels.get();
+        for (size_t i = 0; i < _nRows; i++)
+        {
+            const size_t label = size_t(y[i]);
+            DAAL_CHECK(y[i] >= 0 && label < _nClasses && algorithmFPType(label) == y[i], ErrorIncorrectClassLabels);
+            labels[i] = label;
+        }
+        return Status();
+    }
+
+    size_t dimension() const { return _nBetaRows * _nBetas; }
+    size_t nBetas() const { return _nBetas; }
+    size_t nBetaRows() const { return _nBetaRows; }
+    bool interceptFlag() const { return _interceptFlag; }
+
+    /**
+     *  Computes the value and the gradient of the loss at beta.
+     *  If storeProbabilities is true, probabilities at beta are kept for the following Hessian-vector products
+     */
+    Status compute(const algorithmFPType *beta, algorithmFPType &value, algorithmFPType *gradient, bool storeProbabilities)
+    {
+        const size_t dim = dimension();
+        const size_t nBetaRows = _nBetaRows;
+        const size_t nRows = _nRows;
+        const size_t *labels = _labels.get();
+        algorithmFPType *probabilities = (storeProbabilities ? _probabilities.get() : nullptr);
+
+        service_memset<algorithmFPType, cpu>(gradient, 0, dim);
+        value = 0;
+
+        const NumericTable &x = _x;
+        daal::tls<TaskType *> tls([ =, &x ]() -> TaskType *
+        {
+            return TaskType::create(x, nBetaRows, dim);
+        });
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks(), nBlocks(), [ =, &tls, &safeStat ](int iBlock)
+        {
+            TaskType *task = tls.local();
+            if (!task)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            const size_t startRow = iBlock * logisticRegressionRowsInBlock;
+            const size_t nRowsInBlock = (startRow + logisticRegressionRowsInBlock > nRows) ? (nRows - startRow) : logisticRegressionRowsInBlock;
+
+            Status localSt = task->xBlock.set(startRow, nRowsInBlock);
+            DAAL_CHECK_STATUS_THR(localSt);
+
+            algorithmFPType *z = task->z();
+            algorithmFPType *r = task->r();
+            task->xBlock.linearPredictor(beta, nBetaRows, z);
+            task->value += residuals(z, labels + startRow, nRowsInBlock, r,
+                                     (probabilities ? probabilities + startRow * nBetaRows : nullptr));
+            task->xBlock.addTransposedProduct(r, nBetaRows, task->g());
+        });
+
+        tls.reduce([ =, &value ](TaskType *task) -> void
+        {
+            if (!task)
+                return;
+            const algorithmFPType *g = task->g();
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < dim; j++)
+                gradient[j] += g[j];
+            value += task->value;
+            delete task;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        value /= algorithmFPType(nRows);
+        scaleAndPenalize(beta, gradient);
+        for (size_t k = 0; k < nBetaRows; k++)
+        {
+            for (size_t j = 1; j < _nBetas; j++)
+                value += _l2Penalty * beta[k * _nBetas + j] * beta[k * _nBetas + j];
+        }
+        return Status();
+    }
+
+    /**
+     *  Computes the product of the Hessian of the loss and the vector v.
+     *  Hessian is taken at the point of the last call of compute() with storeProbabilities == true
+     */
+    Status hessianProduct(const algorithmFPType *v, algorithmFPType *hv)
+    {
+        const size_t dim = dimension();
+        const size_t nBetaRows = _nBetaRows;
+        const size_t nRows = _nRows;
+        const algorithmFPType *probabilities = _probabilities.get();
+
+        service_memset<algorithmFPType, cpu>(hv, 0, dim);
+
+        const NumericTable &x = _x;
+        daal::tls<TaskType *> tls([ =, &x ]() -> TaskType *
+        {
+            return TaskType::create(x, nBetaRows, dim);
+        });
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks(), nBlocks(), [ =, &tls, &safeStat ](int iBlock)
+        {
+            TaskType *task = tls.local();
+            if (!task)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            const size_t startRow = iBlock * logisticRegressionRowsInBlock;
+            const size_t nRowsInBlock = (startRow + logisticRegressionRowsInBlock > nRows) ? (nRows - startRow) : logisticRegressionRowsInBlock;
+
+            Status localSt = task->xBlock.set(startRow, nRowsInBlock);
+            DAAL_CHECK_STATUS_THR(localSt);
+
+            algorithmFPType *u = task->z();
+            task->xBlock.linearPredictor(v, nBetaRows, u);
+
+            const algorithmFPType *p = probabilities + startRow * nBetaRows;
+            if (nBetaRows == 1)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRowsInBlock; i++)
+                    u[i] *= p[i] * (algorithmFPType(1) - p[i]);
+            }
+            else
+            {
+                for (size_t i = 0; i < nRowsInBlock; i++)
+                {
+                    const algorithmFPType *pi = p + i * nBetaRows;
+                    algorithmFPType *ui = u + i * nBetaRows;
+                    algorithmFPType pu(0);
+                    for (size_t k = 0; k < nBetaRows; k++)
+                        pu += pi[k] * ui[k];
+                    for (size_t k = 0; k < nBetaRows; k++)
+                        ui[k] = pi[k] * (ui[k] - pu);
+                }
+            }
+            task->xBlock.addTransposedProduct(u, nBetaRows, task->g());
+        });
+
+        tls.reduce([ = ](TaskType *task) -> void
+        {
+            if (!task)
+                return;
+            const algorithmFPType *g = task->g();
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < dim; j++)
+                hv[j] += g[j];
+            delete task;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        scaleAndPenalize(v, hv);
+        return Status();
+    }
+
+    /* Sets the components of the intercept term to zero if it is not computed */
+    void maskIntercept(algorithmFPType *a) const
+    {
+        if (_interceptFlag)
+            return;
+        for (size_t k = 0; k < _nBetaRows; k++)
+            a[k * _nBetas] = 0;
+    }
+
+private:
+    size_t nBlocks() const
+    {
+        size_t n = _nRows / logisticRegressionRowsInBlock;
+        if (n * logisticRegressionRowsInBlock < _nRows) { n++; }
+        return n;
+    }
+
+    /* a = a / n + 2 * l2Penalty * b for the coefficients of the features */
+    void scaleAndPenalize(const algorithmFPType *b, algorithmFPType *a) const
+    {
+        const algorithmFPType invN = algorithmFPType(1) / algorithmFPType(_nRows);
+        const algorithmFPType l2 = 2 * _l2Penalty;
+        for (size_t k = 0; k < _nBetaRows; k++)
+        {
+            algorithmFPType *ak = a + k * _nBetas;
+            const algorithmFPType *bk = b + k * _nBetas;
+            ak[0] *= invN;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 1; j < _nBetas; j++)
+                ak[j] = ak[j] * invN + l2 * bk[j];
+        }
+        maskIntercept(a);
+    }
+
+    /**
+     *  Computes residuals r = p - y of the block from the linear predictor z,
+     *  optionally stores probabilities p and returns the sum of the losses of the block
+     */
+    algorithmFPType residuals(algorithmFPType *z, const size_t *labels, size_t nRowsInBlock,
+                              algorithmFPType *r, algorithmFPType *p) const
+    {
+        const size_t nBetaRows = _nBetaRows;
+        algorithmFPType loss(0);
+        if (nBetaRows == 1)
+        {
+            /* log(1 + exp(z)) - y * z = max(z, 0) + log(1 + exp(-|z|)) - y * z */
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                r[i] = (z[i] > 0 ? -z[i] : z[i]);
+                if (r[i] < Math<algorithmFPType, cpu>::vExpThreshold())
+                    r[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+            }
+            Math<algorithmFPType, cpu>::vExp(nRowsInBlock, r, r);
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                const algorithmFPType e = r[i];
+                const algorithmFPType sigma = (z[i] > 0 ? algorithmFPType(1) / (algorithmFPType(1) + e) : e / (algorithmFPType(1) + e));
+                const algorithmFPType yi = algorithmFPType(labels[i]);
+                loss += (z[i] > 0 ? z[i] : algorithmFPType(0)) + Math<algorithmFPType, cpu>::sLog(algorithmFPType(1) + e) - yi * z[i];
+                if (p)
+                    p[i] = sigma;
+                r[i] = sigma - yi;
+            }
+            return loss;
+        }
+
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            algorithmFPType *zi = z + i * nBetaRows;
+            algorithmFPType *ri = r + i * nBetaRows;
+            const algorithmFPType lse = logSumExp<algorithmFPType, cpu>(zi, nBetaRows, ri);
+            loss += lse - zi[labels[i]];
+
+            algorithmFPType sum(0);
+            for (size_t k = 0; k < nBetaRows; k++)
+                sum += ri[k];
+            const algorithmFPType invSum = algorithmFPType(1) / sum;
+            for (size_t k = 0; k < nBetaRows; k++)
+            {
+                ri[k] *= invSum;
+                if (p)
+                    p[i * nBetaRows + k] = ri[k];
+            }
+            ri[labels[i]] -= algorithmFPType(1);
+        }
+        return loss;
+    }
+
+    const NumericTable &_x;
+    const NumericTable &_y;
+    size_t _nRows;
+    size_t _nBetas;
+    size_t _nClasses;
+    size_t _nBetaRows;
+    bool _interceptFlag;
+    algorithmFPType _l2Penalty;
+    TArrayScalable<size_t, cpu> _labels;
+    TArrayScalable<algorithmFPType, cpu> _probabilities;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,178 @@
+/* file: logistic_regression_train_newton_cg_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the truncated Newton (Newton-CG) method used for training of the logistic regression model
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAIN_NEWTON_CG_IMPL_I__
+#define __LOGISTIC_REGRESSION_TRAIN_NEWTON_CG_IMPL_I__
+
+#include "logistic_regression_train_lbfgs_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace internal
+{
+
+/**
+ *  Minimizes loss(beta). Newton direction is found by conjugate gradients
+ *  using Hessian-vector products, so the Hessian is never formed explicitly.
+ *  On input beta contains the starting point, on output - the solution
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status minimizeNewtonCG(CrossEntropyLoss<algorithmFPType, cpu> &loss, const Parameter &par, algorithmFPType *beta)
+{
+    const size_t dim = loss.dimension();
+    const algorithmFPType eps = algorithmFPType(par.accuracyThreshold);
+    const algorithmFPType c1 = algorithmFPType(1.0e-4);
+    const size_t maxLineSearchSteps = 30;
+    const size_t maxCGIterations = (dim < 200 ? dim : 200);
+
+    TArrayScalable<algorithmFPType, cpu> gArr(dim), dArr(dim), rArr(dim), pArr(dim), hpArr(dim), betaNewArr(dim), gNewArr(dim);
+    DAAL_CHECK_MALLOC(gArr.get() && dArr.get() && rArr.get() && pArr.get() && hpArr.get() && betaNewArr.get() && gNewArr.get());
+    algorithmFPType *g = gArr.get();
+    algorithmFPType *d = dArr.get();
+    algorithmFPType *r = rArr.get();
+    algorithmFPType *p = pArr.get();
+    algorithmFPType *hp = hpArr.get();
+    algorithmFPType *betaNew = betaNewArr.get();
+    algorithmFPType *gNew = gNewArr.get();
+
+    algorithmFPType f(0);
+    Status st = loss.compute(beta, f, g, true);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    for (size_t iter = 0; iter < par.maxIterations; iter++)
+    {
+        if (maxAbs(g, dim) < eps)
+            break;
+
+        /* Solve H * d = -g approximately by conjugate gradients */
+        const algorithmFPType gNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(dotProduct(g, g, dim));
+        const algorithmFPType forcing = daal::internal::Math<algorithmFPType, cpu>::sSqrt(gNorm);
+        const algorithmFPType tolerance = (forcing < algorithmFPType(0.5) ? forcing : algorithmFPType(0.5)) * gNorm;
+        for (size_t j = 0; j < dim; j++)
+        {
+            d[j] = 0;
+            r[j] = -g[j];
+            p[j] = r[j];
+        }
+        algorithmFPType rr = dotProduct(r, r, dim);
+        for (size_t cgIter = 0; cgIter < maxCGIterations; cgIter++)
+        {
+            if (daal::internal::Math<algorithmFPType, cpu>::sSqrt(rr) <= tolerance)
+                break;
+            st = loss.hessianProduct(p, hp);
+            DAAL_CHECK_STATUS_VAR(st);
+            const algorithmFPType curvature = dotProduct(p, hp, dim);
+            if (curvature <= 0)
+            {
+                /* Negative curvature: use the current iterate or the steepest descent direction */
+                if (cgIter == 0)
+                {
+                    for (size_t j = 0; j < dim; j++)
+                        d[j] = -g[j];
+                }
+                break;
+            }
+            const algorithmFPType alpha = rr / curvature;
+            for (size_t j = 0; j < dim; j++)
+            {
+                d[j] += alpha * p[j];
+                r[j] -= alpha * hp[j];
+            }
+            const algorithmFPType rrNew = dotProduct(r, r, dim);
+            const algorithmFPType b = rrNew / rr;
+            for (size_t j = 0; j < dim; j++)
+                p[j] = r[j] + b * p[j];
+            rr = rrNew;
+        }
+        loss.maskIntercept(d);
+
+        algorithmFPType slope = dotProduct(d, g, dim);
+        if (!(slope < 0))
+        {
+            for (size_t j = 0; j < dim; j++)
+                d[j] = -g[j];
+            slope = dotProduct(d, g, dim);
+        }
+
+        /* Backtracking line search with the Armijo condition */
+        algorithmFPType step(1);
+        algorithmFPType fNew(0);
+        bool accepted = false;
+        for (size_t ls = 0; ls < maxLineSearchSteps && !accepted; ls++, step *= algorithmFPType(0.5))
+        {
+            for (size_t j = 0; j < dim; j++)
+                betaNew[j] = beta[j] + step * d[j];
+            st = loss.compute(betaNew, fNew, gNew, true);
+            DAAL_CHECK_STATUS_VAR(st);
+            accepted = (fNew <= f + c1 * step * slope);
+        }
+        if (!accepted)
+            break;
+
+        for (size_t j = 0; j < dim; j++)
+        {
+            beta[j] = betaNew[j];
+            g[j] = gNew[j];
+        }
+        f = fNew;
+    }
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,115 @@
+/* file: logistic_regression_training_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression training algorithm classes.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LOGISTIC_REGRESSION_TRAINING_RESULT_ID);
+Result::Result() : algorithms::classifier::training::Result(classifier::training::lastResultId + 1) {};
+
+logistic_regression::ModelPtr Result::get(classifier::training::ResultId id) const
+{
+    return logistic_regression::Model::cast(algorithms::classifier::training::Result::get(id));
+}
+
+void Result::set(classifier::training::ResultId id, const logistic_regression::ModelPtr &value)
+{
+    algorithms::classifier::training::Result::set(id, value);
+}
+
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, algorithms::classifier::training::Result::check(input, par, method));
+
+    /* Newton-CG method requires smooth objective function */
+    const Parameter *prm = static_cast<const Parameter *>(par);
+    if(method == newtonCG)
+    {
+        DAAL_CHECK_EX(prm->l1Penalty == 0, ErrorIncorrectParameter, ParameterName, l1PenaltyStr());
+    }
+
+    const classifier::training::Input *in = static_cast<const classifier::training::Input *>(input);
+    const size_t nFeatures = in->get(classifier::training::data)->getNumberOfColumns();
+    const size_t nBetaRows = (prm->nClasses == 2 ? 1 : prm->nClasses);
+    ModelPtr m = get(classifier::training::model);
+    DAAL_CHECK(m, ErrorIncorrectTypeOfModel);
+    DAAL_CHECK_STATUS(s, checkNumericTable(m->getBeta().get(), betaStr(), 0, 0, nFeatures + 1, nBetaRows));
+    return s;
+}
+
+Status Parameter::check() const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::Parameter::check());
+    DAAL_CHECK_EX(l1Penalty >= 0, ErrorIncorrectParameter, ParameterName, l1PenaltyStr());
+    DAAL_CHECK_EX(l2Penalty >= 0, ErrorIncorrectParameter, ParameterName, l2PenaltyStr());
+    DAAL_CHECK_EX(maxIterations > 0, ErrorIncorrectParameter, ParameterName, maxIterationsStr());
+    DAAL_CHECK_EX(accuracyThreshold > 0, ErrorIncorrectParameter, ParameterName, accuracyThresholdStr());
+    DAAL_CHECK_EX(nCorrectionPairs > 0, ErrorIncorrectParameter, ParameterName, nCorrectionPairsStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
@@ -68,6 +68,7 @@
 #include "service_threading.h"
 #include "logitboost_impl.i"
 #include "logitboost_train_friedman_aux.i"
+#include "stump_train_sorted_indices.i"
 
 using namespace daal::algorithms::logitboost::internal;
 using namespace daal::internal;
@@ -97,7 +98,7 @@ struct LogitBoostLs
 
     LogitBoostLs(const size_t n): _nRows(n), _isInit(false) {}
 
-    services::Status allocate(NumericTablePtr& x, TrainLernerPtr& train, PredictLernerPtr& predict)
+    services::Status allocate(NumericTablePtr& x, const NumericTablePtr& sortedIndices, TrainLernerPtr& train, PredictLernerPtr& predict)
     {
         services::Status status;
         if (!_isInit)
@@ -118,6 +119,9 @@ struct LogitBoostLs
                 input->set(classifier::training::weights, wArray);
                 input->set(classifier::training::data,    x);
                 predInput->set(classifier::prediction::data, x);
+
+                stump::training::Input *stumpInput = stump::training::internal::getStumpInput(input);
+                if (stumpInput) stumpInput->set(stump::training::sortedIndices, sortedIndices);
             }
         }
         _isInit = true;
@@ -217,6 +221,14 @@ services::Status LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(
     services::SharedPtr<weak_learner::training::Batch> learnerTrain = parameter->weakLearnerTraining;
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
 
+    /* Every weak learner is trained on the same data set, so the features are sorted once per training
+       and the indices are shared by the learners of all threads */
+    NumericTablePtr sortedIndices;
+    if (stump::training::internal::getStumpInput(learnerTrain->getInput()))
+    {
+        DAAL_CHECK_STATUS(s, stump::training::internal::computeSortedIndices<cpu>(*x, sortedIndices));
+    }
+
     /* Clear the collection of weak learners models in the boosting model */
     r->clearWeakLearnerModels();
     data_management::DataCollection models(nc);
@@ -244,7 +256,7 @@ services::Status LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(
             if(!lsLocal)
                 return;
 
-            services::Status localStatus = lsLocal->allocate(x, learnerTrain, learnerPredict);
+            services::Status localStatus = lsLocal->allocate(x, sortedIndices, learnerTrain, learnerPredict);
             DAAL_CHECK_STATUS_THR(localStatus);
 
             initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P.get(), thrW, lsLocal->wArray->getArray(),
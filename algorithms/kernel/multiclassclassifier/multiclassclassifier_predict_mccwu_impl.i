@@ -100,45 +100,122 @@ compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r
     const size_t nFeatures = a->getNumberOfColumns();
     const size_t nVectors = a->getNumberOfRows();
 
-    size_t nRowsInBlock = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
-    /* Calculate number of blocks of rows including tail block */
-    size_t nBlocks = nVectors / nRowsInBlock;
-    if (nBlocks * nRowsInBlock < nVectors) { nBlocks++; }
+    /* Indices of the two-class models for all pairs of non-empty classes */
+    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
+    TArray<size_t, cpu> modelIndexBuffer(nModels);
+    size_t *modelIndex = modelIndexBuffer.get();
+    if (nModels) { DAAL_CHECK_MALLOC(modelIndex); }
+    for(size_t i = 1, iModel = 0; i < nClasses; i++)
+    {
+        for(size_t j = 0; j < i; j++, iModel++)
+        {
+            modelIndex[iModel] = ((nonEmptyClassMap[i] - 1) * nonEmptyClassMap[i]) / 2 + nonEmptyClassMap[j];
+        }
+    }
+
+    /* Each two-class model is evaluated on large blocks of rows at once,
+       the pairwise coupling is then done in parallel over smaller blocks of rows */
+    const size_t nRowsInPairBlock = getMultiClassClassifierPredictPairBlockSize<algorithmFPType, cpu>(nModels, nVectors);
+    const size_t nRowsInBlock = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
+
+    /* Probabilities of the negative class computed by each two-class model for a block of rows */
+    TArray<algorithmFPType, cpu> negativeProbBuffer(nModels * nRowsInPairBlock);
+    algorithmFPType *negativeProb = negativeProbBuffer.get();
+    if (nModels * nRowsInPairBlock) { DAAL_CHECK_MALLOC(negativeProb); }
 
-    /* Allocate data for storing of intermediate results and subsets of input data*/
     typedef SubTask<algorithmFPType, cpu> TSubTask;
     daal::ls<TSubTask *> lsTask([=]()
     {
-        if(a->getDataLayout() == NumericTableIface::csrArray)
-            return (TSubTask*)SubTaskCSR<algorithmFPType, cpu>::create(nClasses, nRowsInBlock, a, r, mccPar->prediction);
-        return (TSubTask*)SubTaskDense<algorithmFPType, cpu>::create(nClasses, nRowsInBlock, a, r, mccPar->prediction);
+        return TSubTask::create(nRowsInPairBlock, mccPar->prediction);
+    });
+
+    typedef CouplingTask<algorithmFPType, cpu> TCouplingTask;
+    daal::ls<TCouplingTask *> lsCouplingTask([=]()
+    {
+        return TCouplingTask::create(nClasses);
     });
 
+    ReadRows<algorithmFPType, cpu> mtX;
+    ReadRowsCSR<algorithmFPType, cpu> mtXCSR;
     daal::SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    for (size_t startPairRow = 0; startPairRow < nVectors; startPairRow += nRowsInPairBlock)
     {
-        const size_t startRow = iBlock * nRowsInBlock;
-        size_t nRows = nRowsInBlock;
-        if (startRow + nRows > nVectors)
-            nRows = nVectors - startRow;
+        const size_t nPairRows = (startPairRow + nRowsInPairBlock > nVectors ? nVectors - startPairRow : nRowsInPairBlock);
+
+        NumericTablePtr xTable;
+        s = getInput(a, nFeatures, startPairRow, nPairRows, mtX, mtXCSR, xTable);
+        if (!s) { break; }
 
-        TSubTask *local = lsTask.local();
-        if(!local)
+        daal::threader_for(nModels, nModels, [&](size_t iModel)
         {
-            safeStat.add(services::ErrorMemoryAllocationFailed);
-            return;
-        }
-        DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+            TSubTask *local = lsTask.local();
+            if(!local)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
-        safeStat |= local->getBlockOfRowsOfResults(r, nFeatures, startRow, nRows, nClasses, nonEmptyClassMap,
-                                model, nIter, eps);
-    } );
+            safeStat |= local->predictSimpleClassifier(xTable, nPairRows, model->getTwoClassClassifierModel(modelIndex[iModel]),
+                                                       negativeProb + iModel * nRowsInPairBlock);
+        } );
+        if (!safeStat) { break; }
+
+        /* Calculate number of blocks of rows including tail block */
+        size_t nBlocks = nPairRows / nRowsInBlock;
+        if (nBlocks * nRowsInBlock < nPairRows) { nBlocks++; }
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t startRow = iBlock * nRowsInBlock;
+            size_t nRows = nRowsInBlock;
+            if (startRow + nRows > nPairRows)
+                nRows = nPairRows - startRow;
+
+            TCouplingTask *local = lsCouplingTask.local();
+            if(!local)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            DAAL_LS_RELEASE(TCouplingTask, lsCouplingTask, local); //releases local storage when leaving this scope
 
-    lsTask.reduce([=](SubTask<algorithmFPType, cpu> *local)
+            safeStat |= local->getBlockOfRowsOfResults(r, startPairRow + startRow, nRows, nClasses, nonEmptyClassMap,
+                                                       negativeProb + startRow, nRowsInPairBlock, nIter, eps);
+        } );
+        if (!safeStat) { break; }
+    }
+
+    lsTask.reduce([=](TSubTask *local)
+    {
+        delete local;
+    } );
+    lsCouplingTask.reduce([=](TCouplingTask *local)
     {
         delete local;
     } );
-    return safeStat.detach();
+    s |= safeStat.detach();
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
+    getInput(const NumericTable *a, size_t nFeatures, size_t startRow, size_t nRows,
+             ReadRows<algorithmFPType, cpu>& mtX, ReadRowsCSR<algorithmFPType, cpu>& mtXCSR, NumericTablePtr& res) const
+{
+    services::Status s;
+    if(a->getDataLayout() == NumericTableIface::csrArray)
+    {
+        mtXCSR.set(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a)), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(mtXCSR);
+        res = CSRNumericTable::create(const_cast<algorithmFPType*>(mtXCSR.values()), mtXCSR.cols(), mtXCSR.rows(), nFeatures, nRows,
+                                      CSRNumericTableIface::CSRIndexing::oneBased, &s);
+        return s;
+    }
+    mtX.set(const_cast<NumericTable *>(a), startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(mtX);
+    res = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType*>(mtX.get()), nFeatures, nRows, &s);
+    return s;
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -256,26 +333,35 @@ inline void updateProbabilities(size_t nClasses, const algorithmFPType *Q, algor
 }
 
 template<typename algorithmFPType, CpuType cpu>
-services::Status SubTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericTable *r, size_t nFeatures, size_t startRow, size_t nRows,
-    size_t nClasses, const size_t *nonEmptyClassMap, Model *model, size_t nIter, double eps)
+services::Status CouplingTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericTable *r, size_t startRow, size_t nRows,
+    size_t nClasses, const size_t *nonEmptyClassMap, const algorithmFPType *negativeProb, size_t nRowsInPairBlock,
+    size_t nIter, double eps)
 {
     const algorithmFPType one(1.0);
     const algorithmFPType invNClasses(one / algorithmFPType(nClasses));
 
     algorithmFPType *rProb = _buffer.get();
-    algorithmFPType *Q     = rProb + nRows * nClasses * nClasses;
+    algorithmFPType *Q     = rProb + nClasses * nClasses;
     algorithmFPType *Qp    = Q     + nClasses * nClasses;
     algorithmFPType *p     = Qp    + nClasses;
-    algorithmFPType *y     = p     + nClasses;
 
-    /* Get 2-class probabilities */
-    services::Status s;
-    DAAL_CHECK_STATUS(s, get2ClassProbabilities(nFeatures, startRow, nRows, nClasses, nonEmptyClassMap, y, model, rProb));
+    _mtR.set(r, 0, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(_mtR);
+    int *labels = _mtR.get();
 
-    algorithmFPType *rProbPtr = rProb;
-    size_t nClassesSq = nClasses * nClasses;
-    for (size_t k = 0; k < nRows; k++, rProbPtr += nClassesSq)
+    for (size_t k = 0; k < nRows; k++)
     {
+        /* Collect 2-class probabilities of the observation */
+        for(size_t i = 1, iModel = 0; i < nClasses; i++)
+        {
+            for(size_t j = 0; j < i; j++, iModel++)
+            {
+                const algorithmFPType pNegative = negativeProb[iModel * nRowsInPairBlock + k];
+                rProb[i * nClasses + j] = one - pNegative;
+                rProb[j * nClasses + i] = pNegative;
+            }
+        }
+
         /* Set initial probabilities */
         for (size_t j = 0; j < nClasses; j++)
         {
@@ -283,14 +369,14 @@ services::Status SubTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericT
         }
 
         /* Calculate matrix Q */
-        computeQ<algorithmFPType, cpu>(nClasses, rProbPtr, Q);
+        computeQ<algorithmFPType, cpu>(nClasses, rProb, Q);
 
         algorithmFPType objFuncPrev;
         objFuncPrev = daal::DataFeatureUtils::internal::MaxVal<algorithmFPType, cpu>::get();
         for (size_t it = 0; it < nIter; it++)
         {
             /* Check convergence criteria */
-            algorithmFPType objFunc = computeObjFunc<algorithmFPType, cpu>(nClasses, p, rProbPtr);
+            algorithmFPType objFunc = computeObjFunc<algorithmFPType, cpu>(nClasses, p, rProb);
             if (daal::internal::Math<algorithmFPType, cpu>::sFabs(objFunc - objFuncPrev) < eps)
                 break;
             objFuncPrev = objFunc;
@@ -300,11 +386,8 @@ services::Status SubTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericT
         }
 
         /* Calculate resulting classes labels */
-        _mtR.set(r, 0, startRow + k, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtR);
-        int& label = *_mtR.get();
         algorithmFPType maxProb = p[0];
-        label = (int)nonEmptyClassMap[0];
+        int label = (int)nonEmptyClassMap[0];
         for (int j = 1; j < nClasses; j++)
         {
             if (p[j] > maxProb)
@@ -313,83 +396,44 @@ services::Status SubTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericT
                 label = (int)nonEmptyClassMap[j];
             }
         }
+        labels[k] = label;
     }
     return services::Status();
 }
 
 template<typename algorithmFPType, CpuType cpu>
-services::Status SubTask<algorithmFPType, cpu>::get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows,
-    size_t nClasses, const size_t *nonEmptyClassMap, algorithmFPType *y, Model *model, algorithmFPType *rProb)
-{
-    NumericTablePtr xTable;
-    services::Status s;
-    DAAL_CHECK_STATUS(s, getInput(nFeatures, startRow, nRows, xTable));
-    return predictSimpleClassifier(nFeatures, startRow, nRows, nClasses, nonEmptyClassMap, y, model, rProb, xTable);
-}
-
-template<typename algorithmFPType, CpuType cpu>
-services::Status SubTask<algorithmFPType, cpu>::predictSimpleClassifier(size_t nFeatures, size_t startRow, size_t nRows,
-    size_t nClasses, const size_t *nonEmptyClassMap, algorithmFPType *y, Model *model, algorithmFPType *rProb,
-    const NumericTablePtr& xTable)
+services::Status SubTask<algorithmFPType, cpu>::predictSimpleClassifier(const NumericTablePtr& xTable, size_t nRows,
+    const classifier::ModelPtr& simpleModel, algorithmFPType *negativeProb)
 {
+    algorithmFPType *y = _buffer.get();
     services::Status status;
     NumericTablePtr yTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(y, 1, nRows, &status);
     DAAL_CHECK_STATUS_VAR(status);
-    classifier::prediction::ResultPtr yRes(new classifier::prediction::Result());
-    DAAL_CHECK_MALLOC(yTable.get() && yRes.get());
-    yRes->set(classifier::prediction::prediction, yTable);
+    _yRes->set(classifier::prediction::prediction, yTable);
+
+    /* Compute prediction of the "simple" classifier for the block of observations */
+    classifier::prediction::Input *input = _simplePrediction->getInput();
+    DAAL_CHECK(input, services::ErrorNullInput);
+    input->set(classifier::prediction::data, xTable);
+    input->set(classifier::prediction::model, simpleModel);
+
+    _simplePrediction->setResult(_yRes);
+    services::Status s = _simplePrediction->computeNoThrow();
+    if(!s)
+        return services::Status(services::ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
+
+    /* Use sigmoid to calculate probabilities */
     const algorithmFPType one(1.0);
-    for(size_t i = 1; i < nClasses; i++)
+    daal::internal::Math<algorithmFPType, cpu>::vExp(nRows, y, y);
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for(size_t k = 0; k < nRows; k++)
     {
-        for(size_t j = 0; j < i; j++)
-        {
-            /* Compute prediction of the "simple" classifier for pair of labels (i, j) */
-
-            size_t imodel = ((nonEmptyClassMap[i] - 1) * nonEmptyClassMap[i]) / 2 + nonEmptyClassMap[j];
-            classifier::prediction::Input *input = _simplePrediction->getInput();
-            DAAL_CHECK(input, services::ErrorNullInput);
-            input->set(classifier::prediction::data, xTable);
-            input->set(classifier::prediction::model, model->getTwoClassClassifierModel(imodel));
-
-            _simplePrediction->setResult(yRes);
-            services::Status s = _simplePrediction->computeNoThrow();
-            if(!s)
-                return services::Status(services::ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
-
-            /* Use sigmoid to calculate probabilities */
-            daal::internal::Math<algorithmFPType, cpu>::vExp(nRows, y, y);
-            algorithmFPType *rProbPtr = rProb;
-            for(size_t k = 0; k < nRows; k++, rProbPtr += nClasses * nClasses)
-            {
-                algorithmFPType p = one / (one + y[k]);
-                rProbPtr[i * nClasses + j] = one - p;
-                rProbPtr[j * nClasses + i] = p;
-            }
-        }
+        negativeProb[k] = one / (one + y[k]);
     }
     return services::Status();
 }
 
-template<typename algorithmFPType, CpuType cpu>
-services::Status SubTaskCSR<algorithmFPType, cpu>::getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res)
-{
-    _mtX.next(startRow, nRows);
-    DAAL_CHECK_BLOCK_STATUS(_mtX);
-    services::Status s;
-    res = CSRNumericTable::create(const_cast<algorithmFPType*>(_mtX.values()), _mtX.cols(), _mtX.rows(), nFeatures, nRows, CSRNumericTableIface::CSRIndexing::oneBased, &s);
-    return s;
-}
-
-template<typename algorithmFPType, CpuType cpu>
-services::Status SubTaskDense<algorithmFPType, cpu>::getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res)
-{
-    _mtX.next(startRow, nRows);
-    DAAL_CHECK_BLOCK_STATUS(_mtX);
-    services::Status st;
-    res = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType*>(_mtX.get()), nFeatures, nRows, &st);
-    return st;
-}
-
 } // namespace internal
 } // namespace prediction
 } // namespace multi_class_classifier
@@ -82,7 +82,22 @@ size_t getMultiClassClassifierPredictBlockSize()
     return 128;
 }
 
-//Base class for binary classification subtask
+/**
+ * Returns the number of observations each two-class model is evaluated on at once.
+ * The buffer of two-class probabilities for the block is limited to about 4M elements
+ */
+template<typename algorithmFPType, CpuType cpu>
+size_t getMultiClassClassifierPredictPairBlockSize(size_t nModels, size_t nVectors)
+{
+    const size_t maxBufferSize = ((size_t)1 << 22);
+    const size_t minBlockSize = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
+    size_t blockSize = maxBufferSize / (nModels ? nModels : 1);
+    if (blockSize < minBlockSize) { blockSize = minBlockSize; }
+    if (blockSize > nVectors)     { blockSize = nVectors; }
+    return blockSize;
+}
+
+//Evaluates two-class classifiers on a block of observations
 template<typename algorithmFPType, CpuType cpu>
 class SubTask
 {
@@ -90,93 +105,62 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    /* Get multiclass classification results for a block of input observations */
-    services::Status getBlockOfRowsOfResults(NumericTable *r, size_t nFeatures, size_t startRow, size_t nRows,
-        size_t nClasses, const size_t *nonEmptyClassMap, Model *model, size_t nIter, double eps);
+    static SubTask* create(size_t nRowsInBlock, const services::SharedPtr<classifier::prediction::Batch>& sp)
+    {
+        auto val = new SubTask(nRowsInBlock, sp);
+        if(val && val->isValid())
+            return val;
+        delete val;
+        return nullptr;
+    }
+
+    /* Computes probabilities of the negative class of the two-class model for nRows observations of xTable */
+    services::Status predictSimpleClassifier(const NumericTablePtr& xTable, size_t nRows,
+        const classifier::ModelPtr& simpleModel, algorithmFPType *negativeProb);
 
 protected:
-    SubTask(size_t nClasses, size_t nRowsInBlock, NumericTable *rTable,
-        const services::SharedPtr<classifier::prediction::Batch>& sp) :
-        _simplePrediction(sp->clone())
+    SubTask(size_t nRowsInBlock, const services::SharedPtr<classifier::prediction::Batch>& sp) :
+        _simplePrediction(sp->clone()), _buffer(nRowsInBlock), _yRes(new classifier::prediction::Result())
     {
-        const size_t bufferSize = nRowsInBlock * nClasses * nClasses + nClasses * nClasses + 2 * nClasses + nRowsInBlock;
-        _buffer.reset(bufferSize);
     }
 
     bool isValid() const
     {
-        return _buffer.get() && _simplePrediction.get();
+        return _buffer.get() && _simplePrediction.get() && _yRes.get();
     }
 
-    services::Status predictSimpleClassifier(size_t nFeatures, size_t startRow, size_t nRows,
-        size_t nClasses, const size_t *nonEmptyClassMap, algorithmFPType *y, Model *model,
-        algorithmFPType *rProb, const NumericTablePtr& xTable);
-
-    /** Get 2-class classification probabilities for a block of observations */
-    services::Status get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t nClasses,
-        const size_t *nonEmptyClassMap, algorithmFPType *y,
-        Model *model, algorithmFPType *rProb);
-
-    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) = 0;
-
 protected:
-    WriteOnlyColumns<int, cpu> _mtR;
     services::SharedPtr<classifier::prediction::Batch> _simplePrediction;
     TArray<algorithmFPType, cpu> _buffer;
+    classifier::prediction::ResultPtr _yRes;
 };
 
+//Computes multi-class probabilities by pairwise coupling of two-class probabilities
 template<typename algorithmFPType, CpuType cpu>
-class SubTaskCSR : public SubTask<algorithmFPType, cpu>
+class CouplingTask
 {
 public:
-    typedef SubTask<algorithmFPType, cpu> super;
-    static SubTaskCSR* create(size_t nClasses, size_t nRowsInBlock, const NumericTable *xTable, NumericTable *rTable,
-        const services::SharedPtr<classifier::prediction::Batch>& sp)
-    {
-        auto val = new SubTaskCSR(nClasses, nRowsInBlock, dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable)), rTable, sp);
-        if(val && val->isValid())
-            return val;
-        delete val;
-        return nullptr;
-    }
+    DAAL_NEW_DELETE();
 
-private:
-    SubTaskCSR(size_t nClasses, size_t nRowsInBlock, CSRNumericTableIface *xTable, NumericTable *rTable,
-        const services::SharedPtr<classifier::prediction::Batch>& sp) :
-        super(nClasses, nRowsInBlock, rTable, sp), _mtX(xTable)
+    static CouplingTask* create(size_t nClasses)
     {
-    }
-    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) DAAL_C11_OVERRIDE;
-
-private:
-    ReadRowsCSR<algorithmFPType, cpu> _mtX;
-};
-
-template<typename algorithmFPType, CpuType cpu>
-class SubTaskDense : public SubTask<algorithmFPType, cpu>
-{
-public:
-    typedef SubTask<algorithmFPType, cpu> super;
-    static SubTaskDense* create(size_t nClasses, size_t nRowsInBlock, const NumericTable *xTable, NumericTable *rTable,
-        const services::SharedPtr<classifier::prediction::Batch>& sp)
-    {
-        auto val = new SubTaskDense(nClasses, nRowsInBlock, xTable, rTable, sp);
-        if(val && val->isValid())
+        auto val = new CouplingTask(nClasses);
+        if(val && val->_buffer.get())
             return val;
         delete val;
         return nullptr;
     }
 
-private:
-    SubTaskDense(size_t nClasses, size_t nRowsInBlock, const NumericTable *xTable, NumericTable *rTable,
-        const services::SharedPtr<classifier::prediction::Batch>& sp) :
-        super(nClasses, nRowsInBlock, rTable, sp), _mtX(const_cast<NumericTable *>(xTable))
-    {
-    }
-    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) DAAL_C11_OVERRIDE;
+    /* Get multiclass classification results for a block of input observations */
+    services::Status getBlockOfRowsOfResults(NumericTable *r, size_t startRow, size_t nRows, size_t nClasses,
+        const size_t *nonEmptyClassMap, const algorithmFPType *negativeProb, size_t nRowsInPairBlock,
+        size_t nIter, double eps);
 
 private:
-    ReadRows<algorithmFPType, cpu> _mtX;
+    CouplingTask(size_t nClasses) : _buffer(2 * nClasses * nClasses + 2 * nClasses) {}
+
+    WriteOnlyColumns<int, cpu> _mtR;
+    TArray<algorithmFPType, cpu> _buffer;
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -187,6 +171,9 @@ struct MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAg
                              const daal::algorithms::Parameter *par);
 protected:
     inline services::Status getNonEmptyClassMap(size_t &nClasses, const Model *model, size_t *nonEmptyClassMap) const;
+
+    services::Status getInput(const NumericTable *a, size_t nFeatures, size_t startRow, size_t nRows,
+        ReadRows<algorithmFPType, cpu>& mtX, ReadRowsCSR<algorithmFPType, cpu>& mtXCSR, NumericTablePtr& res) const;
 };
 
 } // namespace internal
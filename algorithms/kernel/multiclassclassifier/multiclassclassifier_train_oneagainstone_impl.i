@@ -89,26 +89,52 @@ compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms
     services::SharedPtr<classifier::training::Batch> simpleTrainingInit = mccPar->training->clone();
 
     const size_t nClasses = mccPar->nClasses;
+
+    /* Group indices of observations by classes, so that the training subset of each pair of classes
+       is gathered directly instead of scanning the whole data set */
+    TArray<size_t, cpu> classIndexBuffer(nClasses + 1 + nVectors);
+    DAAL_CHECK_MALLOC(classIndexBuffer.get());
+    size_t *classOffsets = classIndexBuffer.get();
+    size_t *classIndices = classOffsets + nClasses + 1;
+    Status s;
+    DAAL_CHECK_STATUS(s, computeClassIndices(nVectors, nClasses, y, classOffsets, classIndices));
+
     /* Compute data size needed to store the largest subset of input tables */
+    const bool isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
     size_t nSubsetVectors, dataSize;
-    {
-        Status s;
-        DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
-    }
+    DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, classOffsets, nSubsetVectors, dataSize));
 
     typedef SubTask<algorithmFPType, cpu> TSubTask;
-    /* Allocate memory for storing subsets of input data */
+    /* Allocate memory for storing subsets of input data. Each subtask reads only the rows of its pair of classes */
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]()
     {
-        if(xTable->getDataLayout() == NumericTableIface::csrArray)
+        if(isCSR)
             return (TSubTask*)SubTaskCSR<algorithmFPType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, simpleTrainingInit);
         return (TSubTask*)SubTaskDense<algorithmFPType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, simpleTrainingInit);
     });
 
-    SafeStatus safeStat;
+    /* Order the two-class problems by decreasing size so that the largest ones are started first
+       and the small ones balance the load between threads at the end */
     const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
-    daal::threader_for(nModels, nModels, [&](size_t imodel)
+    TArray<size_t, cpu> modelOrderBuffer(2 * nModels);
+    DAAL_CHECK_MALLOC(modelOrderBuffer.get());
+    size_t *modelCost  = modelOrderBuffer.get();
+    size_t *modelOrder = modelCost + nModels;
+    for (size_t i = 1, imodel = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, imodel++)
+        {
+            modelCost[imodel] = (classOffsets[i + 1] - classOffsets[i]) + (classOffsets[j + 1] - classOffsets[j]);
+            modelOrder[imodel] = imodel;
+        }
+    }
+    daal::algorithms::internal::qSort<size_t, size_t, cpu>(nModels, modelCost, modelOrder);
+
+    SafeStatus safeStat;
+    daal::threader_for(nModels, nModels, [&](size_t iTask)
     {
+        const size_t imodel = modelOrder[nModels - 1 - iTask];
+
         /* Find indices of positive and negative classes for current model */
         size_t i = 1;       /* index of the positive class */
         size_t j = 0;       /* index of the negative class */
@@ -129,7 +155,8 @@ compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
+        Status s = local->getDataSubset(nFeatures, classIndices + classOffsets[i], classOffsets[i + 1] - classOffsets[i],
+                                        classIndices + classOffsets[j], classOffsets[j + 1] - classOffsets[j], nRowsInSubset);
         DAAL_CHECK_STATUS_THR(s);
         classifier::ModelPtr pModel;
         if(nRowsInSubset)
@@ -156,40 +183,69 @@ compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms
 
 template<typename algorithmFPType, CpuType cpu>
 Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses,
-                    const NumericTable *xTable, const int *y, size_t& nSubsetVectors, size_t& dataSize)
+    computeClassIndices(size_t nVectors, size_t nClasses, const int *y, size_t *classOffsets, size_t *classIndices)
 {
-    TArray<size_t, cpu> buffer(4 * nClasses);
+    daal::services::internal::service_memset<size_t, cpu>(classOffsets, 0, nClasses + 1);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        DAAL_CHECK(y[i] >= 0 && size_t(y[i]) < nClasses, services::ErrorIncorrectClassLabels);
+        classOffsets[y[i] + 1]++;
+    }
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        classOffsets[i + 1] += classOffsets[i];
+    }
+
+    TArray<size_t, cpu> positionBuffer(nClasses);
+    DAAL_CHECK_MALLOC(positionBuffer.get());
+    size_t *position = positionBuffer.get();
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        position[i] = classOffsets[i];
+    }
+    /* Stable counting sort keeps the original order of observations within each class */
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        classIndices[position[y[i]]++] = i;
+    }
+    return Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
+    computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable *xTable,
+                    const int *y, const size_t *classOffsets, size_t& nSubsetVectors, size_t& dataSize)
+{
+    TArray<size_t, cpu> buffer(2 * nClasses);
     DAAL_CHECK_MALLOC(buffer.get());
-    daal::services::internal::service_memset<size_t, cpu>(buffer.get(), 0, buffer.size());
     size_t *classLabelsCount = buffer.get();
     size_t *classNonZeroValuesCount = buffer.get() + nClasses;
-    size_t *classDataSize = buffer.get() + 2 * nClasses;
-    size_t *classIndex = buffer.get() + 3 * nClasses;
-    for (size_t i = 0; i < nVectors; i++)
+    for (size_t i = 0; i < nClasses; i++)
     {
-        classLabelsCount[y[i]]++;
+        classLabelsCount[i] = classOffsets[i + 1] - classOffsets[i];
     }
     if (xTable->getDataLayout() == NumericTableIface::csrArray)
     {
+        /* Compute the number of non-zero values in the observations of each class.
+           Only the row offsets are needed, so the table is read block by block */
+        daal::services::internal::service_memset<size_t, cpu>(classNonZeroValuesCount, 0, nClasses);
         CSRNumericTableIface *csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable));
-        ReadRowsCSR<algorithmFPType, cpu> _mtX(*csrIface, 0, nVectors);
-        DAAL_CHECK_BLOCK_STATUS(_mtX);
-        const size_t *rowOffsets = _mtX.rows();
-        /* Compute data size needed to store the largest subset of input tables */
-        for (size_t i = 0; i < nVectors; i++)
-            classNonZeroValuesCount[y[i]] += (rowOffsets[i + 1] - rowOffsets[i]);
-
-        for (size_t i = 0; i < nClasses; i++)
+        ReadRowsCSR<algorithmFPType, cpu> mtX(csrIface);
+        for (size_t iStart = 0; iStart < nVectors; iStart += maxRowsInBlock)
         {
-            classDataSize[i] = classLabelsCount[i] + classNonZeroValuesCount[i];
-            classIndex[i] = i;
+            const size_t nRowsInBlock = (nVectors - iStart < maxRowsInBlock ? nVectors - iStart : maxRowsInBlock);
+            mtX.next(iStart, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            const size_t *rowOffsets = mtX.rows();
+            for (size_t ix = 0; ix < nRowsInBlock; ix++)
+                classNonZeroValuesCount[y[iStart + ix]] += (rowOffsets[ix + 1] - rowOffsets[ix]);
         }
-
-        daal::algorithms::internal::qSort<size_t, size_t, cpu>(nClasses, classDataSize, classIndex);
-        const auto idx1 = classIndex[nClasses - 1], idx2 = classIndex[nClasses - 2];
-        nSubsetVectors = classLabelsCount[idx1] + classLabelsCount[idx2];
-        dataSize = classNonZeroValuesCount[idx1] + classNonZeroValuesCount[idx2];
+        /* Row counts and non-zero counts are sorted independently, so the two largest
+         * values may come from different pairs of classes: the result is an upper bound */
+        daal::algorithms::internal::qSort<size_t, cpu>(nClasses, classLabelsCount);
+        daal::algorithms::internal::qSort<size_t, cpu>(nClasses, classNonZeroValuesCount);
+        nSubsetVectors = classLabelsCount[nClasses - 1] + classLabelsCount[nClasses - 2];
+        dataSize = classNonZeroValuesCount[nClasses - 1] + classNonZeroValuesCount[nClasses - 2];
     }
     else
     {
@@ -201,50 +257,57 @@ Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
 }
 
 template<typename algorithmFPType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-    const int *y, size_t& nRows)
+Status SubTaskDense<algorithmFPType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t *rows, size_t nRowsToCopy,
+    algorithmFPType label, size_t& nRows)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t k = 0; k < nRowsToCopy;)
     {
-        if(y[ix] != classIdx)
-            continue;
-        _mtX.next(ix, 1);
+        const size_t nRun = this->getRunLength(rows + k, nRowsToCopy - k);
+        _mtX.next(rows[k], nRun);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-            for (size_t jx = 0; jx < nFeatures; jx++)
-            this->_subsetX.get()[nRows * nFeatures + jx] = _mtX.get()[jx];
-        this->_subsetY[nRows] = label;
-        ++nRows;
-            }
+        const algorithmFPType *xBlock = _mtX.get();
+        algorithmFPType *subsetRows = this->_subsetX.get() + nRows * nFeatures;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t jx = 0; jx < nRun * nFeatures; jx++)
+            subsetRows[jx] = xBlock[jx];
+        for (size_t ix = 0; ix < nRun; ix++)
+            this->_subsetY[nRows + ix] = label;
+        nRows += nRun;
+        k += nRun;
+    }
     return Status();
 }
 
 template<typename algorithmFPType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors,
-    int classIdx, algorithmFPType label, const int *y, size_t& nRows)
+Status SubTaskCSR<algorithmFPType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t *rows, size_t nRowsToCopy,
+    algorithmFPType label, size_t& nRows)
 {
     _rowOffsetsX[0] = 1;
-    size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    size_t dataIndex = _rowOffsetsX[nRows] - _rowOffsetsX[0];
+    for (size_t k = 0; k < nRowsToCopy;)
     {
-        if(y[ix] != classIdx)
-            continue;
-        _mtX.next(ix, 1);
+        const size_t nRun = this->getRunLength(rows + k, nRowsToCopy - k);
+        _mtX.next(rows[k], nRun);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
-        const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
+        const size_t *rowOffsets = _mtX.rows();
+        const size_t nNonZeroValuesInRun = rowOffsets[nRun] - rowOffsets[0];
+        const algorithmFPType *values = _mtX.values();
         const size_t *colIndices = _mtX.cols();
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-        for(size_t jx = 0; jx < nNonZeroValuesInRow; ++jx, ++dataIndex)
-            {
-            this->_subsetX.get()[dataIndex] = _mtX.values()[jx];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t jx = 0; jx < nNonZeroValuesInRun; ++jx, ++dataIndex)
+        {
+            this->_subsetX.get()[dataIndex] = values[jx];
             _colIndicesX[dataIndex] = colIndices[jx];
-            }
-        _rowOffsetsX[nRows + 1] = _rowOffsetsX[nRows] + nNonZeroValuesInRow;
-        this->_subsetY[nRows] = label;
-        ++nRows;
         }
+        for (size_t ix = 0; ix < nRun; ix++, nRows++)
+        {
+            _rowOffsetsX[nRows + 1] = _rowOffsetsX[nRows] + (rowOffsets[ix + 1] - rowOffsets[ix]);
+            this->_subsetY[nRows] = label;
+        }
+        k += nRun;
+    }
     return Status();
 }
 
@@ -69,6 +69,9 @@ namespace training
 namespace internal
 {
 
+/* Maximal number of rows of the input table read at once */
+const size_t maxRowsInBlock = 512;
+
 //Base class for binary classification subtask
 template<typename algorithmFPType, CpuType cpu>
 class SubTask
@@ -77,14 +80,16 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const int *y, size_t& nRows)
+    /* Gathers the observations with given indices of the two classes into the training subset */
+    services::Status getDataSubset(size_t nFeatures, const size_t *rowsPositive, size_t nPositive,
+        const size_t *rowsNegative, size_t nNegative, size_t& nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
+        services::Status s = copyDataIntoSubtable(nFeatures, rowsPositive, nPositive, 1, nRows);
         if(s)
             /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
+            s = copyDataIntoSubtable(nFeatures, rowsNegative, nNegative, -1, nRows);
         return s;
     }
 
@@ -125,8 +130,18 @@ protected:
         return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get();
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) = 0;
+    /* Copies the observations with given indices into the training subset. The indices are in ascending order,
+       so each run of consecutive indices is read from the input table as one block of at most maxRowsInBlock rows */
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t *rows, size_t nRowsToCopy, algorithmFPType label,
+        size_t& nRows) = 0;
+
+    static size_t getRunLength(const size_t *rows, size_t nRowsToCopy)
+    {
+        size_t nRun = 1;
+        while (nRun < nRowsToCopy && nRun < maxRowsInBlock && rows[nRun] == rows[0] + nRun)
+            nRun++;
+        return nRun;
+    }
 
 protected:
     TArray<algorithmFPType, cpu> _subsetX;
@@ -144,7 +159,7 @@ public:
     static SubTaskCSR* create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
         const services::SharedPtr<classifier::training::Batch>& st)
     {
-        auto val = new SubTaskCSR(nFeatures, nSubsetVectors, dataSize, dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable)), st);
+        auto val = new SubTaskCSR(nFeatures, nSubsetVectors, dataSize, xTable, st);
         if(val && val->isValid())
             return val;
         delete val;
@@ -157,9 +172,10 @@ private:
         return super::isValid() && _colIndicesX.get() && this->_subsetXTable.get();
     }
 
-    SubTaskCSR(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, CSRNumericTableIface *xTable,
+    SubTaskCSR(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
         const services::SharedPtr<classifier::training::Batch>& st) :
-        super(nSubsetVectors, dataSize, st), _mtX(xTable), _colIndicesX(dataSize + nSubsetVectors + 1), _rowOffsetsX(nullptr)
+        super(nSubsetVectors, dataSize, st), _colIndicesX(dataSize + nSubsetVectors + 1), _rowOffsetsX(nullptr),
+        _mtX(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable)))
     {
         if(_colIndicesX.get())
         {
@@ -170,8 +186,8 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) DAAL_C11_OVERRIDE;
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t *rows, size_t nRowsToCopy, algorithmFPType label,
+        size_t& nRows) DAAL_C11_OVERRIDE;
 
 private:
     TArray<size_t, cpu> _colIndicesX;
@@ -212,8 +228,8 @@ private:
             return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) DAAL_C11_OVERRIDE;
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t *rows, size_t nRowsToCopy, algorithmFPType label,
+        size_t& nRows) DAAL_C11_OVERRIDE;
 
 private:
     ReadRows<algorithmFPType, cpu> _mtX;
@@ -227,8 +243,11 @@ public:
                              const daal::algorithms::Parameter *par);
 
 protected:
+    services::Status computeClassIndices(size_t nVectors, size_t nClasses, const int *y,
+        size_t *classOffsets, size_t *classIndices);
+
     services::Status computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable *xTable,
-        const int *y, size_t& nSubsetVectors, size_t& dataSize);
+        const int *y, const size_t *classOffsets, size_t& nSubsetVectors, size_t& dataSize);
 };
 
 } // namespace internal
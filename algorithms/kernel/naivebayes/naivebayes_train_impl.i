@@ -143,20 +143,21 @@ struct localDataCollector<algorithmFPType, defaultDense, cpu>
     }
 };
 
-template<typename algorithmFPType, CpuType cpu>
-struct localDataCollector<algorithmFPType, fastCSR, cpu>
+/* Collects the counters from CSR blocks; IndexType is the type of column indices in the blocks */
+template<typename algorithmFPType, typename IndexType, CpuType cpu>
+struct localCSRDataCollector
 {
     size_t _p;
     size_t _c;
 
-    ReadRowsCSR<algorithmFPType, cpu> rrData;
-    ReadRows   <int            , cpu> rrClass;
+    GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, IndexType> rrData;
+    ReadRows<int, cpu> rrClass;
 
     algorithmFPType *n_ci;
 
-    localDataCollector(size_t p, size_t c,
+    localCSRDataCollector(size_t p, size_t c,
         NumericTable *_ntData, NumericTable *_ntClass, algorithmFPType *local_n_ci) :
-        _p(p), _c(c), rrData(dynamic_cast<CSRNumericTableIface *>(_ntData)), rrClass(_ntClass),
+        _p(p), _c(c), rrData(dynamic_cast<typename CSRIfaceByIndexType<IndexType>::type *>(_ntData)), rrClass(_ntClass),
         n_ci(local_n_ci)
     {}
 
@@ -173,7 +174,7 @@ struct localDataCollector<algorithmFPType, fastCSR, cpu>
         DAAL_CHECK_BLOCK_STATUS(rrClass);
 
         const algorithmFPType *data = rrData.values();
-        const size_t *colIdx        = rrData.cols();
+        const IndexType *colIdx     = rrData.cols();
         const size_t *rowIdx        = rrData.rows();
         const int    *predefClass   = rrClass.get();
 
@@ -199,9 +200,18 @@ struct localDataCollector<algorithmFPType, fastCSR, cpu>
     }
 };
 
-template<typename algorithmFPType, Method method, CpuType cpu>
-Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTable *ntClass,
-                      algorithmFPType *n_c, algorithmFPType *n_ci )
+template<typename algorithmFPType, CpuType cpu>
+struct localDataCollector<algorithmFPType, fastCSR, cpu> : public localCSRDataCollector<algorithmFPType, size_t, cpu>
+{
+    localDataCollector(size_t p, size_t c,
+        NumericTable *_ntData, NumericTable *_ntClass, algorithmFPType *local_n_ci) :
+        localCSRDataCollector<algorithmFPType, size_t, cpu>(p, c, _ntData, _ntClass, local_n_ci)
+    {}
+};
+
+template<typename algorithmFPType, typename DataCollector, CpuType cpu>
+Status collectCountersImpl( const Parameter *nbPar, NumericTable *ntData, NumericTable *ntClass,
+                          algorithmFPType *n_c, algorithmFPType *n_ci )
 {
     size_t p = ntData->getNumberOfColumns();
     size_t n = ntData->getNumberOfRows();
@@ -215,7 +225,7 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
         algorithmFPType *local_n_ci = tls_n_ci.local();
         DAAL_CHECK_THR(local_n_ci, ErrorMemoryAllocationFailed);
 
-        localDataCollector<algorithmFPType, method, cpu> ldc(p, c, ntData, ntClass, local_n_ci);
+        DataCollector ldc(p, c, ntData, ntClass, local_n_ci);
 
         algorithmFPType block_size = ldc.getBlockSize(jn);
         int i;
@@ -252,6 +262,20 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
     return safeStat.detach();
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTable *ntClass,
+                      algorithmFPType *n_c, algorithmFPType *n_ci )
+{
+    /* Tables with 32-bit column indices are read without widening the indices to size_t */
+    if (method == fastCSR && dynamic_cast<CSR32NumericTableIface *>(ntData))
+    {
+        return collectCountersImpl<algorithmFPType, localCSRDataCollector<algorithmFPType, unsigned int, cpu>, cpu>(
+            nbPar, ntData, ntClass, n_c, n_ci);
+    }
+    return collectCountersImpl<algorithmFPType, localDataCollector<algorithmFPType, method, cpu>, cpu>(
+        nbPar, ntData, ntClass, n_c, n_ci);
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status mergeModels( const Parameter *nbPar, size_t p, size_t nModels, PartialModel *const *models,
                   algorithmFPType *n_c, algorithmFPType *n_ci, size_t &merged_n )
@@ -91,6 +91,10 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Tensor* bTensor      = input->get(layers::forward::biases).get();
     Tensor* resultTensor = result->get(layers::forward::value).get();
 
+    if (parameter->predictionStage && parameter->quantization.isEnabled())
+    {
+        __DAAL_CALL_KERNEL(env, internal::Convolution2dKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeQuantized, inputTensor, bTensor, *parameter, resultTensor);
+    }
     __DAAL_CALL_KERNEL(env, internal::Convolution2dKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, inputTensor, wTensor, bTensor, *parameter, resultTensor);
 }
 
@@ -107,7 +111,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
     daal::services::Environment::env &env = *_env;
 
     const services::Collection<size_t>& inDimsFull  = input->get(layers::forward::data)->getDimensions();
-    const services::Collection<size_t>& wDims       = input->get(layers::forward::weights)->getDimensions();
+    const TensorPtr wTensor = (parameter->quantization.isEnabled() ? parameter->quantization.weights : input->get(layers::forward::weights));
+    const services::Collection<size_t>& wDims       = wTensor->getDimensions();
     const services::Collection<size_t>& outDimsFull = result->get(layers::forward::value)->getDimensions();
 
     __DAAL_CALL_KERNEL(env, internal::Convolution2dKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), initialize, inDimsFull, wDims, *parameter, outDimsFull);
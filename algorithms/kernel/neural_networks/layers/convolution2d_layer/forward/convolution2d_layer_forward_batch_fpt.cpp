@@ -79,7 +79,8 @@ DAAL_EXPORT services::Status Input::allocate(const daal::algorithms::Parameter *
 
     const Parameter *param =  static_cast<const Parameter * >(parameter);
 
-    if( !get(layers::forward::weights) )
+    /* The quantized layer computes with the int8 weights only */
+    if( !get(layers::forward::weights) && !param->quantization.isEnabled() )
     {
         SharedPtr<Tensor> tensor(new MklTensor<algorithmFPType>(getWeightsSizes(param), Tensor::doAllocate));
         set(layers::forward::weights, tensor);
@@ -49,6 +49,8 @@
 #include "service_numeric_table.h"
 
 #include "service_mkl_tensor.h"
+#include "threading.h"
+#include "layers_quantization.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -243,6 +245,145 @@ Status Convolution2dKernel<algorithmFPType, method, cpu>::compute(Tensor *inputT
     return s;
 }
 
+/* Computation of 2D convolution with int8 data and weights and int32 accumulation */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::computeQuantized(Tensor *inputTensor, Tensor *bTensor,
+                                                                          const convolution2d::Parameter &parameter, Tensor *resultTensor)
+{
+    Status s;
+    const QuantizationParameter &quantization = parameter.quantization;
+
+    const services::Collection<size_t>& inDimsFull  = inputTensor->getDimensions();
+    const services::Collection<size_t>& outDimsFull = resultTensor->getDimensions();
+
+    const size_t nSamples = inDimsFull[0];
+    const size_t nChannels = inDimsFull[parameter.groupDimension];
+    const size_t inRows = inDimsFull[parameter.indices.dims[0]];
+    const size_t inCols = inDimsFull[parameter.indices.dims[1]];
+    const size_t outRows = outDimsFull[parameter.indices.dims[0]];
+    const size_t outCols = outDimsFull[parameter.indices.dims[1]];
+
+    const size_t kRows = parameter.kernelSizes.size[0];
+    const size_t kCols = parameter.kernelSizes.size[1];
+    const size_t sRows = parameter.strides.size[0];
+    const size_t sCols = parameter.strides.size[1];
+    const int pRows = parameter.paddings.size[0];
+    const int pCols = parameter.paddings.size[1];
+
+    const size_t nGroups = parameter.nGroups;
+    const size_t nKernels = parameter.nKernels;
+    const size_t nGroupKernels = nKernels / nGroups;
+    const size_t nGroupChannels = nChannels / nGroups;
+
+    const size_t inSize = inRows * inCols;
+    const size_t outSize = outRows * outCols;
+    const size_t patchSize = nGroupChannels * kRows * kCols;
+
+    const HomogenTensor<DAAL_INT8> *wQuantized = dynamic_cast<const HomogenTensor<DAAL_INT8> *>(quantization.weights.get());
+    DAAL_CHECK(wQuantized && wQuantized->getSize() == nKernels * patchSize, ErrorIncorrectQuantizedWeights);
+    DAAL_CHECK(quantization.weightsScales && quantization.weightsScales->getSize() == nKernels, ErrorIncorrectQuantizedWeights);
+    const DAAL_INT8 *wArray = wQuantized->getArray();
+
+    const size_t dimsArray[dimension] = { 0, parameter.groupDimension, parameter.indices.dims[0], parameter.indices.dims[1] };
+    TensorOffsetLayout targetInLayout = inputTensor->createDefaultSubtensorLayout();
+    DAAL_CHECK_STATUS(s, targetInLayout.shuffleDimensions( services::Collection<size_t>( dimension, dimsArray ) ) );
+
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(inputTensor, 0, 0, 0, nSamples, targetInLayout);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    const algorithmFPType *inputArray = inputBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> scalesBlock(quantization.weightsScales.get(), 0, 0, 0, nKernels);
+    DAAL_CHECK_BLOCK_STATUS(scalesBlock);
+    const algorithmFPType *wScales = scalesBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(bTensor, 0, 0, 0, nKernels);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+    const algorithmFPType *bArray = bBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+    algorithmFPType *resultArray = resultBlock.get();
+
+    const algorithmFPType dataScale = (algorithmFPType)quantization.dataScale;
+
+    /* Factors that map int32 products of the kernels back to the floating-point range */
+    TArrayScalable<algorithmFPType, cpu> requantization(nKernels);
+    algorithmFPType *requantizationArray = requantization.get();
+    DAAL_CHECK_MALLOC(requantizationArray);
+    for (size_t k = 0; k < nKernels; k++)
+    {
+        requantizationArray[k] = (algorithmFPType)1.0 / (dataScale * wScales[k]);
+    }
+
+    TArrayScalable<DAAL_INT8, cpu> inputQuantized(nSamples * nChannels * inSize);
+    DAAL_INT8 *inputQuantizedArray = inputQuantized.get();
+    DAAL_CHECK_MALLOC(inputQuantizedArray);
+
+    daal::threader_for(nSamples, nSamples, [&](size_t i)
+    {
+        layers::internal::quantizeToInt8<algorithmFPType, cpu>(inputArray + i * nChannels * inSize, nChannels * inSize, dataScale,
+                                                               inputQuantizedArray + i * nChannels * inSize);
+    } );
+
+    /* Each task lowers one group of one sample into the int8 patches matrix and multiplies it by the group kernels */
+    daal::tls<DAAL_INT8 *> tlsPatches([ & ]()
+    {
+        return services::internal::service_scalable_malloc<DAAL_INT8, cpu>(outSize * patchSize);
+    } );
+
+    SafeStatus safeStat;
+    daal::threader_for(nSamples * nGroups, nSamples * nGroups, [&](size_t task)
+    {
+        DAAL_INT8 *patches = tlsPatches.local();
+        DAAL_CHECK_MALLOC_THR(patches);
+
+        const size_t i = task / nGroups;
+        const size_t g = task % nGroups;
+        const DAAL_INT8 *groupInput = inputQuantizedArray + (i * nChannels + g * nGroupChannels) * inSize;
+
+        for (size_t oRow = 0; oRow < outRows; oRow++)
+        {
+            for (size_t oCol = 0; oCol < outCols; oCol++)
+            {
+                DAAL_INT8 *patch = patches + (oRow * outCols + oCol) * patchSize;
+                const int rowStart = (int)(oRow * sRows) - pRows;
+                const int colStart = (int)(oCol * sCols) - pCols;
+                for (size_t c = 0; c < nGroupChannels; c++)
+                {
+                    for (size_t fRow = 0; fRow < kRows; fRow++)
+                    {
+                        const int row = rowStart + (int)fRow;
+                        DAAL_INT8 *patchRow = patch + (c * kRows + fRow) * kCols;
+                        if (row < 0 || row >= (int)inRows)
+                        {
+                            for (size_t fCol = 0; fCol < kCols; fCol++) { patchRow[fCol] = 0; }
+                            continue;
+                        }
+                        const DAAL_INT8 *inputRow = groupInput + c * inSize + row * inCols;
+                        for (size_t fCol = 0; fCol < kCols; fCol++)
+                        {
+                            const int col = colStart + (int)fCol;
+                            patchRow[fCol] = (col < 0 || col >= (int)inCols ? 0 : inputRow[col]);
+                        }
+                    }
+                }
+            }
+        }
+
+        const size_t kernelStart = g * nGroupKernels;
+        layers::internal::gemmInt8<algorithmFPType, cpu>(outSize, nGroupKernels, patchSize, patches, wArray + kernelStart * patchSize,
+                                                         requantizationArray + kernelStart, bArray + kernelStart,
+                                                         resultArray + (i * nKernels + kernelStart) * outSize, 1, outSize);
+    } );
+
+    tlsPatches.reduce([ & ](DAAL_INT8 *patches)
+    {
+        services::internal::service_scalable_free<DAAL_INT8, cpu>(patches);
+    } );
+
+    return safeStat.detach();
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::reset()
 {
@@ -85,6 +85,8 @@ public:
     services::Status compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
                                                                 const convolution2d::Parameter &parameter, Tensor *resultTensor);
 
+    services::Status computeQuantized(Tensor *inputTensor, Tensor *bTensor, const convolution2d::Parameter &parameter, Tensor *resultTensor);
+
     services::Status initialize(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
                                                                 const convolution2d::Parameter &parameter, const services::Collection<size_t> &outDimsFull);
 
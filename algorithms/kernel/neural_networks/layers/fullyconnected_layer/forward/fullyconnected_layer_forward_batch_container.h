@@ -97,6 +97,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Tensor *bTensor       = input->get(layers::forward::biases).get();
     Tensor *resultTensor  = result->get(layers::forward::value).get();
 
+    if (parameter->predictionStage && parameter->quantization.isEnabled())
+    {
+        __DAAL_CALL_KERNEL(env, internal::FullyconnectedKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeQuantized, *inputTensor,
+                                                                                        *bTensor, *resultTensor, *parameter);
+    }
     __DAAL_CALL_KERNEL(env, internal::FullyconnectedKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *inputTensor, *wTensor,
                                                                                     *bTensor, *resultTensor, *parameter);
 }
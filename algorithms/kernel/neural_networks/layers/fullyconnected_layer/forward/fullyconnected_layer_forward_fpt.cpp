@@ -78,7 +78,8 @@ DAAL_EXPORT services::Status Input::allocate(const daal::algorithms::Parameter *
 
     services::Status s;
 
-    if( !get(layers::forward::weights) )
+    /* The quantized layer computes with the int8 weights only */
+    if( !get(layers::forward::weights) && !param->quantization.isEnabled() )
     {
         DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::weights, getWeightsSizes(param));
     }
@@ -51,10 +51,15 @@
 #include "service_blas.h"
 #include "threading.h"
 #include "service_memory.h"
+#include "service_numeric_table.h"
+#include "layers_quantization.h"
 
 #define _DEFAULT_BLOCKSIZE 256
 #define _SMALL_BLOCKSIZE   128
 
+#define _QUANTIZED_SAMPLES_BLOCKSIZE 32
+#define _QUANTIZED_OUTPUTS_BLOCKSIZE 64
+
 namespace daal
 {
 namespace algorithms
@@ -414,6 +419,79 @@ Status FullyconnectedKernel<algorithmFPType, method, cpu>::compute( const Tensor
     return Status();
 } /* void FullyconnectedKernel<algorithmFPType, method, cpu>::compute */
 
+/* Computation of fully connected layer with int8 data and weights and int32 accumulation */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status FullyconnectedKernel<algorithmFPType, method, cpu>::computeQuantized( const Tensor &inputTensor,
+                                                                           const Tensor &bTensor,
+                                                                           Tensor &resultTensor,
+                                                                           const fullyconnected::Parameter &parameter )
+{
+    const QuantizationParameter &quantization = parameter.quantization;
+
+    const size_t outs_num   = parameter.nOutputs;
+    const size_t batch_size = inputTensor.getDimensionSize(0);
+    const size_t data_size  = inputTensor.getSize() / batch_size;
+
+    const HomogenTensor<DAAL_INT8> *wQuantized = dynamic_cast<const HomogenTensor<DAAL_INT8> *>(quantization.weights.get());
+    DAAL_CHECK(wQuantized && wQuantized->getSize() == outs_num * data_size, ErrorIncorrectQuantizedWeights);
+    DAAL_CHECK(quantization.weightsScales && quantization.weightsScales->getSize() == outs_num, ErrorIncorrectQuantizedWeights);
+    const DAAL_INT8 *wArray = wQuantized->getArray();
+
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(const_cast<Tensor &>(inputTensor), 0, 0, 0, batch_size);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    const algorithmFPType *iArray = inputBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> scalesBlock(*quantization.weightsScales, 0, 0, 0, outs_num);
+    DAAL_CHECK_BLOCK_STATUS(scalesBlock);
+    const algorithmFPType *wScales = scalesBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor &>(bTensor), 0, 0, 0, outs_num);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+    const algorithmFPType *bArray = bBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, batch_size);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+    algorithmFPType *rArray = resultBlock.get();
+
+    const algorithmFPType dataScale = (algorithmFPType)quantization.dataScale;
+
+    /* Factors that map int32 products of the output channels back to the floating-point range */
+    TArrayScalable<algorithmFPType, cpu> requantization(outs_num);
+    algorithmFPType *requantizationArray = requantization.get();
+    DAAL_CHECK_MALLOC(requantizationArray);
+    for(size_t i = 0; i < outs_num; i++)
+    {
+        requantizationArray[i] = (algorithmFPType)1.0 / (dataScale * wScales[i]);
+    }
+
+    TArrayScalable<DAAL_INT8, cpu> iQuantized(batch_size * data_size);
+    DAAL_CHECK_MALLOC(iQuantized.get());
+
+    daal::threader_for( batch_size, batch_size, [&](size_t j)
+    {
+        layers::internal::quantizeToInt8<algorithmFPType, cpu>(iArray + j * data_size, data_size, dataScale, iQuantized.get() + j * data_size);
+    } );
+
+    /* Split the output into blocks of samples and output channels */
+    const size_t nSampleBlocks = (batch_size + _QUANTIZED_SAMPLES_BLOCKSIZE - 1) / _QUANTIZED_SAMPLES_BLOCKSIZE;
+    const size_t nOutputBlocks = (outs_num + _QUANTIZED_OUTPUTS_BLOCKSIZE - 1) / _QUANTIZED_OUTPUTS_BLOCKSIZE;
+
+    daal::threader_for( nSampleBlocks * nOutputBlocks, nSampleBlocks * nOutputBlocks, [&](size_t b)
+    {
+        const size_t sampleStart = (b / nOutputBlocks) * _QUANTIZED_SAMPLES_BLOCKSIZE;
+        const size_t outputStart = (b % nOutputBlocks) * _QUANTIZED_OUTPUTS_BLOCKSIZE;
+        const size_t nSamples = (sampleStart + _QUANTIZED_SAMPLES_BLOCKSIZE < batch_size ? _QUANTIZED_SAMPLES_BLOCKSIZE : batch_size - sampleStart);
+        const size_t nOutputs = (outputStart + _QUANTIZED_OUTPUTS_BLOCKSIZE < outs_num   ? _QUANTIZED_OUTPUTS_BLOCKSIZE : outs_num - outputStart);
+
+        layers::internal::gemmInt8<algorithmFPType, cpu>(nSamples, nOutputs, data_size,
+                                                         iQuantized.get() + sampleStart * data_size, wArray + outputStart * data_size,
+                                                         requantizationArray + outputStart, bArray + outputStart,
+                                                         rArray + sampleStart * outs_num + outputStart, outs_num, 1);
+    } );
+
+    return Status();
+}
+
 } // internal
 } // forward
 } // namespace fullyconnected
@@ -80,6 +80,8 @@ class FullyconnectedKernel : public Kernel
 {
 public:
     services::Status compute( const Tensor &inputTensor, const Tensor &wTensor, const Tensor &bTensor, Tensor &resultTensor, const fullyconnected::Parameter &parameter );
+
+    services::Status computeQuantized( const Tensor &inputTensor, const Tensor &bTensor, Tensor &resultTensor, const fullyconnected::Parameter &parameter );
 };
 } // internal
 } // forward
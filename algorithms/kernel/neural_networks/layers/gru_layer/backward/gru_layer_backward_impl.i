@@ -0,0 +1,236 @@
+/* file: gru_layer_backward_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of GRU algorithm
+//--
+*/
+
+#ifndef __GRU_LAYER_BACKWARD_IMPL_I__
+#define __GRU_LAYER_BACKWARD_IMPL_I__
+
+#include "threading.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_tensor.h"
+#include "service_numeric_table.h"
+#include "layers_recurrent.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace gru
+{
+namespace backward
+{
+namespace internal
+{
+
+/*
+ * Gradients with respect to the input and the recurrent projections of all time steps are computed in reverse time order
+ * with one GEMM per time step. Derivatives of the weights and the gradient with respect to the input data are then computed
+ * for the whole sequence with one GEMM each
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status GRUKernel<algorithmFPType, method, cpu>::compute(const Tensor &inGradTensor, const Tensor &xTensor, const Tensor &wTensor,
+                                                        const Tensor &gatesTensor, const Tensor &hiddenStatesTensor,
+                                                        Tensor &wDerTensor, Tensor &bDerTensor, Tensor *resultTensor,
+                                                        const gru::Parameter &parameter)
+{
+    const services::Collection<size_t> &xDims = xTensor.getDimensions();
+    const size_t nSamples   = xDims[0];
+    const size_t nTimeSteps = xDims[1];
+    const size_t nFeatures  = xDims[2];
+    const size_t nOutputs   = parameter.nOutputs;
+    const size_t nGateOutputs   = 3 * nOutputs;
+    const size_t nStoredOutputs = 4 * nOutputs;
+    const size_t nRows = nSamples * nTimeSteps;
+    const size_t gatesStride     = nTimeSteps * nStoredOutputs;
+    const size_t gatesGradStride = nTimeSteps * nGateOutputs;
+    const size_t statesStride    = nTimeSteps * nOutputs;
+    const algorithmFPType invBatchSize = (algorithmFPType)1.0 / nSamples;
+
+    ReadSubtensor<algorithmFPType, cpu> inGradBlock(const_cast<Tensor &>(inGradTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(inGradBlock);
+    const algorithmFPType *inGrad = inGradBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> xBlock(const_cast<Tensor &>(xTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType *x = xBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor), 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    const algorithmFPType *wx = wBlock.get();
+    const algorithmFPType *wh = wx + nFeatures * nGateOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> gatesBlock(const_cast<Tensor &>(gatesTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(gatesBlock);
+    const algorithmFPType *gates = gatesBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> hiddenBlock(const_cast<Tensor &>(hiddenStatesTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(hiddenBlock);
+    const algorithmFPType *hiddenStates = hiddenBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> wDerBlock(wDerTensor, 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wDerBlock);
+    algorithmFPType *wxDer = wDerBlock.get();
+    algorithmFPType *whDer = wxDer + nFeatures * nGateOutputs;
+
+    WriteOnlySubtensor<algorithmFPType, cpu> bDerBlock(bDerTensor, 0, 0, 0, nGateOutputs);
+    DAAL_CHECK_BLOCK_STATUS(bDerBlock);
+    algorithmFPType *bDer = bDerBlock.get();
+
+    /* Gradients with respect to the input and the recurrent projections of all time steps */
+    TArrayScalable<algorithmFPType, cpu> xProjGradBuffer(nRows * nGateOutputs);
+    TArrayScalable<algorithmFPType, cpu> hProjGradBuffer(nRows * nGateOutputs);
+    DAAL_CHECK_MALLOC(xProjGradBuffer.get() && hProjGradBuffer.get());
+    algorithmFPType *xProjGrad = xProjGradBuffer.get();
+    algorithmFPType *hProjGrad = hProjGradBuffer.get();
+
+    /* Gradient with respect to the hidden state propagated from the next time step */
+    TArrayScalable<algorithmFPType, cpu> hGradBuffer(nSamples * nOutputs);
+    DAAL_CHECK_MALLOC(hGradBuffer.get());
+    algorithmFPType *hGrad = hGradBuffer.get();
+
+    for (size_t i = 0; i < nSamples * nOutputs; i++)
+    {
+        hGrad[i] = (algorithmFPType)0.0;
+    }
+
+    for (size_t tt = nTimeSteps; tt > 0; tt--)
+    {
+        const size_t t = tt - 1;
+
+        daal::threader_for(nSamples, nSamples, [ & ](size_t s)
+        {
+            const algorithmFPType *g  = gates + s * gatesStride + t * nStoredOutputs;
+            const algorithmFPType *gz = g;
+            const algorithmFPType *gr = g + nOutputs;
+            const algorithmFPType *gn = g + 2 * nOutputs;
+            const algorithmFPType *hn = g + 3 * nOutputs;
+
+            algorithmFPType *dx  = xProjGrad + s * gatesGradStride + t * nGateOutputs;
+            algorithmFPType *dhp = hProjGrad + s * gatesGradStride + t * nGateOutputs;
+
+            const algorithmFPType *dv = inGrad + s * statesStride + t * nOutputs;
+            algorithmFPType *dh = hGrad + s * nOutputs;
+
+            /* Hidden state before the first time step is zero */
+            const algorithmFPType hPrevScale = (t > 0 ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+            const algorithmFPType *hPrev = hiddenStates + s * statesStride + (t > 0 ? t - 1 : 0) * nOutputs;
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nOutputs; j++)
+            {
+                const algorithmFPType dhj = dv[j] + dh[j];
+                const algorithmFPType dz = dhj * (hPrevScale * hPrev[j] - gn[j]) * gz[j] * ((algorithmFPType)1.0 - gz[j]);
+                const algorithmFPType dn = dhj * ((algorithmFPType)1.0 - gz[j]) * ((algorithmFPType)1.0 - gn[j] * gn[j]);
+                const algorithmFPType dr = dn * hn[j] * gr[j] * ((algorithmFPType)1.0 - gr[j]);
+
+                dx[j]                 = dz;
+                dx[nOutputs + j]      = dr;
+                dx[2 * nOutputs + j]  = dn;
+                dhp[j]                = dz;
+                dhp[nOutputs + j]     = dr;
+                dhp[2 * nOutputs + j] = dn * gr[j];
+                dh[j] = dhj * gz[j];
+            }
+        } );
+
+        /* Gradient with respect to the previous hidden state of the whole batch: dh_{t-1} += dhProj_t * Wh' */
+        if (t > 0)
+        {
+            layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, true, nSamples, nOutputs, nGateOutputs, (algorithmFPType)1.0,
+                                                                  hProjGrad + t * nGateOutputs, gatesGradStride, wh, nGateOutputs,
+                                                                  (algorithmFPType)1.0, hGrad, nOutputs);
+        }
+    }
+
+    /* Derivatives of the input weights: dWx = x' * dxProj / nSamples */
+    layers::internal::rowMajorGemm<algorithmFPType, cpu>(true, false, nFeatures, nGateOutputs, nRows, invBatchSize,
+                                                          x, nFeatures, xProjGrad, nGateOutputs, (algorithmFPType)0.0, wxDer, nGateOutputs);
+
+    /* Derivatives of the recurrent weights: dWh = h_{t-1}' * dhProj_t / nSamples summed over time steps */
+    {
+        TArrayScalable<algorithmFPType, cpu> hPrevBuffer(nRows * nOutputs);
+        DAAL_CHECK_MALLOC(hPrevBuffer.get());
+        algorithmFPType *hPrev = hPrevBuffer.get();
+
+        layers::internal::shiftTimeSteps<algorithmFPType, cpu>(nSamples, nTimeSteps, nOutputs, hiddenStates, hPrev);
+        layers::internal::rowMajorGemm<algorithmFPType, cpu>(true, false, nOutputs, nGateOutputs, nRows, invBatchSize,
+                                                              hPrev, nOutputs, hProjGrad, nGateOutputs, (algorithmFPType)0.0, whDer, nGateOutputs);
+    }
+
+    layers::internal::sumRows<algorithmFPType, cpu>(nRows, nGateOutputs, xProjGrad, invBatchSize, bDer);
+
+    /* Gradient with respect to the input data: dx = dxProj * Wx' */
+    if (parameter.propagateGradient)
+    {
+        WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(resultBlock);
+        algorithmFPType *result = resultBlock.get();
+
+        layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, true, nRows, nFeatures, nGateOutputs, (algorithmFPType)1.0,
+                                                              xProjGrad, nGateOutputs, wx, nGateOutputs, (algorithmFPType)0.0, result, nFeatures);
+    }
+    return Status();
+}
+
+} // internal
+} // backward
+} // gru
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -0,0 +1,254 @@
+/* file: gru_layer_forward.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gru calculation algorithm and types methods.
+//--
+*/
+
+#include "gru_layer_forward_types.h"
+#include "gru_layer_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace gru
+{
+namespace forward
+{
+namespace interface1
+{
+static const size_t nGates = 3;
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NEURAL_NETWORKS_LAYERS_GRU_FORWARD_RESULT_ID);
+/**
+ * Default constructor
+ */
+Input::Input() {};
+Input::Input(const Input& other) : super(other) {}
+
+/**
+ * Returns dimensions of weights tensor
+ * \return Dimensions of weights tensor
+ */
+const services::Collection<size_t> Input::getWeightsSizes(const layers::Parameter *parameter) const
+{
+    using daal::services::Collection;
+
+    const Parameter *param =  static_cast<const Parameter *>(parameter);
+
+    const Collection<size_t> &dataDims = get(layers::forward::data)->getDimensions();
+
+    /* Input weights of all gates followed by their recurrent weights */
+    Collection<size_t> wDims;
+    wDims.push_back(dataDims[dataDims.size() - 1] + param->nOutputs);
+    wDims.push_back(nGates * param->nOutputs);
+
+    return wDims;
+}
+
+/**
+ * Returns dimensions of biases tensor
+ * \return Dimensions of biases tensor
+ */
+const services::Collection<size_t> Input::getBiasesSizes(const layers::Parameter *parameter) const
+{
+    using daal::services::Collection;
+
+    const Parameter *param =  static_cast<const Parameter *>(parameter);
+    Collection<size_t> bDims;
+    bDims.push_back(nGates * param->nOutputs);
+
+    return bDims;
+}
+
+/**
+ * Checks input object of the forward GRU layer
+ * \param[in] parameter %Parameter of layer
+ * \param[in] method    Computation method of the layer
+ */
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, layers::forward::Input::check(parameter, method));
+
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    DAAL_CHECK_EX(algParameter->nOutputs > 0, services::ErrorIncorrectParameter, services::ParameterName, nOutputsStr());
+
+    /* Data is a batch of sequences of size nSamples x nTimeSteps x nFeatures */
+    data_management::TensorPtr dataTensor = get(layers::forward::data);
+    DAAL_CHECK_STATUS(s, data_management::checkTensor(dataTensor.get(), dataStr()));
+    DAAL_CHECK_EX(dataTensor->getNumberOfDimensions() == 3, services::ErrorIncorrectNumberOfDimensionsInTensor, services::ArgumentName, dataStr());
+
+    data_management::TensorPtr wTensor = get(layers::forward::weights);
+    data_management::TensorPtr bTensor = get(layers::forward::biases);
+
+    if( wTensor )
+    {
+        services::Collection<size_t> wDims = getWeightsSizes(algParameter);
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(wTensor.get(), weightsStr(), &wDims));
+    }
+
+    if( bTensor )
+    {
+        services::Collection<size_t> bDims = getBiasesSizes(algParameter);
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(bTensor.get(), biasesStr(), &bDims));
+    }
+    return s;
+}
+
+/**
+ * Default constructor
+ */
+Result::Result() {}
+
+/**
+ * Sets the result that is used in backward GRU layer
+ * \param[in] input     Pointer to an object containing the input data
+ */
+services::Status Result::setResultForBackward(const daal::algorithms::Input *input)
+{
+    const Input *in = static_cast<const Input *>(input);
+    set(auxData,    in->get(layers::forward::data));
+    set(auxWeights, in->get(layers::forward::weights));
+    return services::Status();
+}
+
+/**
+ * Returns dimensions of value tensor
+ * \return Dimensions of value tensor
+ */
+const services::Collection<size_t> Result::getValueSize(const services::Collection<size_t> &inputSize,
+                                                        const daal::algorithms::Parameter *par, const int method) const
+{
+    const Parameter *param =  static_cast<const Parameter *>(par);
+
+    services::Collection<size_t> valueDims;
+    valueDims.push_back(inputSize[0]);
+    valueDims.push_back(inputSize[1]);
+    valueDims.push_back(param->nOutputs);
+    return valueDims;
+}
+
+/**
+ * Returns the result of forward GRU layer
+ * \param[in] id   Identifier of the result
+ * \return         Result that corresponds to the given identifier
+ */
+data_management::TensorPtr Result::get(LayerDataId id) const
+{
+    layers::LayerDataPtr layerData =
+        services::staticPointerCast<layers::LayerData, data_management::SerializationIface>(Argument::get(layers::forward::resultForBackward));
+    if(!layerData)
+        return data_management::TensorPtr();
+    return services::staticPointerCast<data_management::Tensor, data_management::SerializationIface>((*layerData)[id]);
+}
+
+/**
+ * Sets the result of forward GRU layer
+ * \param[in] id     Identifier of the result
+ * \param[in] value  Result
+ */
+void Result::set(LayerDataId id, const data_management::TensorPtr &value)
+{
+    layers::LayerDataPtr layerData =
+        services::staticPointerCast<layers::LayerData, data_management::SerializationIface>(Argument::get(layers::forward::resultForBackward));
+    if(layerData)
+        (*layerData)[id] = value;
+}
+
+/**
+ * Checks the result of the forward GRU layer
+ * \param[in] input   %Input object of the layer
+ * \param[in] par     %Parameter of the layer
+ * \param[in] method  Computation method of the layer
+ */
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, layers::forward::Result::check(input, par, method));
+
+    const Input     *algInput     = static_cast<const Input *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+
+    LayerDataPtr layerData = get(layers::forward::resultForBackward);
+    if (!layerData && algParameter->predictionStage == false) return services::Status(services::ErrorNullLayerData);
+
+    data_management::TensorPtr dataTensor  = algInput->get(layers::forward::data);
+
+    const services::Collection<size_t> &dataDims = dataTensor->getDimensions();
+    const services::Collection<size_t>     wDims = algInput->getWeightsSizes(algParameter);
+    const services::Collection<size_t>   valDims = getValueSize(dataDims, algParameter, defaultDense);
+
+    DAAL_CHECK_STATUS(s, data_management::checkTensor(get(layers::forward::value).get(), valueStr(), &valDims));
+
+    if(!algParameter->predictionStage)
+    {
+        services::Collection<size_t> statesDims;
+        statesDims.push_back(dataDims[0]);
+        statesDims.push_back(dataDims[1]);
+        statesDims.push_back(algParameter->nOutputs);
+        services::Collection<size_t> gatesDims = statesDims;
+        gatesDims[2] = (nGates + 1) * algParameter->nOutputs;
+
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(get(auxData).get(), auxDataStr(), &dataDims));
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(get(auxWeights).get(), auxWeightsStr(), &wDims));
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(get(auxGates).get(), auxGatesStr(), &gatesDims));
+        DAAL_CHECK_STATUS(s, data_management::checkTensor(get(auxHiddenStates).get(), auxHiddenStatesStr(), &statesDims));
+    }
+    return s;
+}
+
+}// namespace interface1
+}// namespace forward
+}// namespace gru
+}// namespace layers
+}// namespace neural_networks
+}// namespace algorithms
+}// namespace daal
@@ -0,0 +1,241 @@
+/* file: gru_layer_forward_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of GRU algorithm
+//--
+*/
+
+#ifndef __GRU_LAYER_FORWARD_IMPL_I__
+#define __GRU_LAYER_FORWARD_IMPL_I__
+
+#include "threading.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_tensor.h"
+#include "service_numeric_table.h"
+#include "layers_recurrent.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace gru
+{
+namespace forward
+{
+namespace internal
+{
+
+/*
+ * Gates of each sample and time step are stored contiguously in the order: update, reset, candidate,
+ * followed by the recurrent projection of the candidate that is required at the backward stage.
+ * The input projections of all time steps are computed with one GEMM before the recurrence,
+ * after that each time step requires one GEMM with the recurrent weights for the whole batch
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status GRUKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, const Tensor &wTensor, const Tensor &bTensor, Tensor &resultTensor,
+                                                        Tensor *gatesTensor, Tensor *hiddenStatesTensor, const gru::Parameter &parameter)
+{
+    const services::Collection<size_t> &xDims = inputTensor.getDimensions();
+    const size_t nSamples   = xDims[0];
+    const size_t nTimeSteps = xDims[1];
+    const size_t nFeatures  = xDims[2];
+    const size_t nOutputs   = parameter.nOutputs;
+    const size_t nGateOutputs   = 3 * nOutputs;
+    const size_t nStoredOutputs = 4 * nOutputs;
+    const size_t nRows = nSamples * nTimeSteps;
+    const bool isTraining = (gatesTensor && hiddenStatesTensor);
+
+    ReadSubtensor<algorithmFPType, cpu> xBlock(const_cast<Tensor &>(inputTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType *x = xBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor), 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    const algorithmFPType *wx = wBlock.get();
+    const algorithmFPType *wh = wx + nFeatures * nGateOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor &>(bTensor), 0, 0, 0, nGateOutputs);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+    const algorithmFPType *b = bBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+    algorithmFPType *h = resultBlock.get();
+
+    /* At the prediction stage the gates of all time steps are kept in a scratch buffer */
+    TArrayScalable<algorithmFPType, cpu> gatesBuffer;
+    WriteOnlySubtensor<algorithmFPType, cpu> gatesBlock;
+    algorithmFPType *gates = nullptr;
+    if (isTraining)
+    {
+        gatesBlock.set(*gatesTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(gatesBlock);
+        gates = gatesBlock.get();
+    }
+    else
+    {
+        gatesBuffer.reset(nRows * nStoredOutputs);
+        DAAL_CHECK_MALLOC(gatesBuffer.get());
+        gates = gatesBuffer.get();
+    }
+
+    /* Recurrent projections of the current time step */
+    TArrayScalable<algorithmFPType, cpu> hProjBuffer(nSamples * nGateOutputs);
+    DAAL_CHECK_MALLOC(hProjBuffer.get());
+    algorithmFPType *hProj = hProjBuffer.get();
+
+    /* Input projections of all time steps: gates = x * Wx + b */
+    for (size_t i = 0; i < nRows; i++)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nGateOutputs; j++)
+        {
+            gates[i * nStoredOutputs + j] = b[j];
+        }
+    }
+    layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, false, nRows, nGateOutputs, nFeatures, (algorithmFPType)1.0,
+                                                          x, nFeatures, wx, nGateOutputs, (algorithmFPType)1.0, gates, nStoredOutputs);
+
+    const size_t gatesStride  = nTimeSteps * nStoredOutputs;
+    const size_t statesStride = nTimeSteps * nOutputs;
+
+    for (size_t t = 0; t < nTimeSteps; t++)
+    {
+        /* Recurrent projections of the whole batch: hProj = h_{t-1} * Wh */
+        if (t > 0)
+        {
+            layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, false, nSamples, nGateOutputs, nOutputs, (algorithmFPType)1.0,
+                                                                  h + (t - 1) * nOutputs, statesStride, wh, nGateOutputs,
+                                                                  (algorithmFPType)0.0, hProj, nGateOutputs);
+        }
+
+        daal::threader_for(nSamples, nSamples, [ & ](size_t s)
+        {
+            algorithmFPType *g  = gates + s * gatesStride + t * nStoredOutputs;
+            algorithmFPType *gz = g;
+            algorithmFPType *gr = g + nOutputs;
+            algorithmFPType *gn = g + 2 * nOutputs;
+            algorithmFPType *hn = g + 3 * nOutputs;
+            algorithmFPType *hs = h + s * statesStride + t * nOutputs;
+
+            if (t == 0)
+            {
+                layers::internal::sigmoidInPlace<algorithmFPType, cpu>(2 * nOutputs, g);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    hn[j] = (algorithmFPType)0.0;
+                }
+                Math<algorithmFPType, cpu>::vTanh(nOutputs, gn, gn);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    hs[j] = ((algorithmFPType)1.0 - gz[j]) * gn[j];
+                }
+            }
+            else
+            {
+                const algorithmFPType *hp = hProj + s * nGateOutputs;
+                const algorithmFPType *hPrev = hs - nOutputs;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < 2 * nOutputs; j++)
+                {
+                    g[j] += hp[j];
+                }
+                layers::internal::sigmoidInPlace<algorithmFPType, cpu>(2 * nOutputs, g);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    hn[j] = hp[2 * nOutputs + j];
+                    gn[j] += gr[j] * hn[j];
+                }
+                Math<algorithmFPType, cpu>::vTanh(nOutputs, gn, gn);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    hs[j] = ((algorithmFPType)1.0 - gz[j]) * gn[j] + gz[j] * hPrev[j];
+                }
+            }
+        } );
+    }
+
+    if (isTraining)
+    {
+        WriteOnlySubtensor<algorithmFPType, cpu> hiddenBlock(*hiddenStatesTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(hiddenBlock);
+        algorithmFPType *hiddenStates = hiddenBlock.get();
+        const size_t nStates = nRows * nOutputs;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nStates; i++)
+        {
+            hiddenStates[i] = h[i];
+        }
+    }
+    return Status();
+}
+
+} // internal
+} // forward
+} // gru
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -66,6 +66,9 @@ Parameter::Parameter() : predictionStage(false), propagateGradient(true),
     allowInplaceComputation(true)
 {}
 
+/** Default constructor */
+QuantizationParameter::QuantizationParameter() : dataScale(1.0) {}
+
 }// namespace interface1
 }// namespace layers
 }// namespace neural_networks
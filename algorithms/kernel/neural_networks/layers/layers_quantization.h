@@ -0,0 +1,192 @@
+/* file: layers_quantization.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common int8 functions used by the quantized forward layers.
+//--
+*/
+
+#ifndef __LAYERS_QUANTIZATION_H__
+#define __LAYERS_QUANTIZATION_H__
+
+#include "service_defines.h"
+
+#if defined (__INTEL_COMPILER)
+  #include <immintrin.h>
+#endif
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace internal
+{
+
+/* Number of rows of the second int8 matrix kept in cache while the rows of the first matrix are streamed */
+const size_t int8GemmBlockSize = 16;
+
+/* Converts floating-point values into the symmetric int8 range [-127, 127] */
+template<typename algorithmFPType, CpuType cpu>
+inline void quantizeToInt8(const algorithmFPType *src, size_t n, algorithmFPType scale, DAAL_INT8 *dst)
+{
+    const algorithmFPType maxValue = (algorithmFPType)127.0;
+    const algorithmFPType half     = (algorithmFPType)0.5;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        algorithmFPType value = src[i] * scale;
+        value = (value >  maxValue ?  maxValue : value);
+        value = (value < -maxValue ? -maxValue : value);
+        dst[i] = (DAAL_INT8)(int)(value < 0 ? value - half : value + half);
+    }
+}
+
+/* Dot product of two int8 vectors accumulated in int32 */
+template<CpuType cpu>
+inline int dotInt8(const DAAL_INT8 *a, const DAAL_INT8 *b, size_t n)
+{
+    int sum = 0;
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += (int)a[i] * (int)b[i];
+    }
+    return sum;
+}
+
+#if defined (__INTEL_COMPILER)
+
+/*
+ * The int8 values are sign-extended to int16 and multiplied with pmaddwd, which adds the adjacent int32 products.
+ * Unlike pmaddubsw, the pair sums cannot saturate, so the data does not need to be shifted to the unsigned range
+ */
+#if ( __CPUID__(DAAL_CPU) == __avx2__ )
+
+template<>
+inline int dotInt8<avx2>(const DAAL_INT8 *a, const DAAL_INT8 *b, size_t n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m256i a16 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a + i)));
+        const __m256i b16 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + i)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a16, b16));
+    }
+    __m128i acc128 = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    acc128 = _mm_hadd_epi32(acc128, acc128);
+    acc128 = _mm_hadd_epi32(acc128, acc128);
+
+    int sum = _mm_cvtsi128_si32(acc128);
+    for (; i < n; i++)
+    {
+        sum += (int)a[i] * (int)b[i];
+    }
+    return sum;
+}
+
+#endif
+
+#if ( __CPUID__(DAAL_CPU) == __avx512__ )
+
+template<>
+inline int dotInt8<avx512>(const DAAL_INT8 *a, const DAAL_INT8 *b, size_t n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m512i a16 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(a + i)));
+        const __m512i b16 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(b + i)));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(a16, b16));
+    }
+
+    int sum = _mm512_reduce_add_epi32(acc);
+    for (; i < n; i++)
+    {
+        sum += (int)a[i] * (int)b[i];
+    }
+    return sum;
+}
+
+#endif
+
+#endif
+
+/*
+ * Product of the int8 matrices a (m x k) and b (n x k), both stored by rows, with int32 accumulation
+ * and requantization fused into the store:
+ *     c[i * cRowStride + j * cColStride] = scale[j] * (a_i, b_j) + shift[j]
+ */
+template<typename algorithmFPType, CpuType cpu>
+void gemmInt8(size_t m, size_t n, size_t k, const DAAL_INT8 *a, const DAAL_INT8 *b,
+              const algorithmFPType *scale, const algorithmFPType *shift,
+              algorithmFPType *c, size_t cRowStride, size_t cColStride)
+{
+    for (size_t jBlock = 0; jBlock < n; jBlock += int8GemmBlockSize)
+    {
+        const size_t jEnd = (jBlock + int8GemmBlockSize < n ? jBlock + int8GemmBlockSize : n);
+        for (size_t i = 0; i < m; i++)
+        {
+            const DAAL_INT8 *aRow = a + i * k;
+            algorithmFPType *cRow = c + i * cRowStride;
+            for (size_t j = jBlock; j < jEnd; j++)
+            {
+                const int acc = dotInt8<cpu>(aRow, b + j * k, k);
+                cRow[j * cColStride] = scale[j] * (algorithmFPType)acc + shift[j];
+            }
+        }
+    }
+}
+
+} // namespace internal
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
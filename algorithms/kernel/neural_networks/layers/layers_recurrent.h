@@ -0,0 +1,179 @@
+/* file: layers_recurrent.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions used by the recurrent layers.
+//--
+*/
+
+#ifndef __LAYERS_RECURRENT_H__
+#define __LAYERS_RECURRENT_H__
+
+#include "service_defines.h"
+#include "service_blas.h"
+#include "service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace internal
+{
+
+/*
+ * Computes C = alpha * op(A) * op(B) + beta * C for the matrices stored in row-major order,
+ * where C is of size m x n and op(A) is of size m x k.
+ * The leading dimensions allow processing of one time step of the nSamples x nTimeSteps x nFeatures tensors in place
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void rowMajorGemm(bool transA, bool transB, size_t m, size_t n, size_t k, algorithmFPType alpha,
+                         const algorithmFPType *a, size_t lda, const algorithmFPType *b, size_t ldb,
+                         algorithmFPType beta, algorithmFPType *c, size_t ldc)
+{
+    typedef typename daal::internal::Blas<algorithmFPType, cpu>::SizeType BlasSize;
+
+    /* Row-major C is column-major C', so C' = op(B)' * op(A)' is computed instead */
+    char transa = (transB ? 't' : 'n');
+    char transb = (transA ? 't' : 'n');
+    BlasSize _m = n;
+    BlasSize _n = m;
+    BlasSize _k = k;
+    BlasSize _lda = ldb;
+    BlasSize _ldb = lda;
+    BlasSize _ldc = ldc;
+
+    daal::internal::Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &_m, &_n, &_k, &alpha, b, &_lda, a, &_ldb, &beta, c, &_ldc);
+}
+
+/* Computes the logistic function in place as 0.5 * (1 + tanh(0.5 * x)) */
+template<typename algorithmFPType, CpuType cpu>
+inline void sigmoidInPlace(size_t n, algorithmFPType *x)
+{
+    const algorithmFPType half = (algorithmFPType)0.5;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        x[i] *= half;
+    }
+    daal::internal::Math<algorithmFPType, cpu>::vTanh(n, x, x);
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        x[i] = half + half * x[i];
+    }
+}
+
+/* Fills each of nRows rows of the matrix with the same vector of size n */
+template<typename algorithmFPType, CpuType cpu>
+inline void broadcastRows(size_t nRows, size_t n, const algorithmFPType *row, algorithmFPType *x)
+{
+    for (size_t i = 0; i < nRows; i++)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < n; j++)
+        {
+            x[i * n + j] = row[j];
+        }
+    }
+}
+
+/* Computes the column sums of the nRows x n matrix multiplied by the scale */
+template<typename algorithmFPType, CpuType cpu>
+inline void sumRows(size_t nRows, size_t n, const algorithmFPType *x, algorithmFPType scale, algorithmFPType *sum)
+{
+    for (size_t j = 0; j < n; j++)
+    {
+        sum[j] = (algorithmFPType)0.0;
+    }
+    for (size_t i = 0; i < nRows; i++)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < n; j++)
+        {
+            sum[j] += x[i * n + j];
+        }
+    }
+    for (size_t j = 0; j < n; j++)
+    {
+        sum[j] *= scale;
+    }
+}
+
+/*
+ * Copies the hidden states of the nSamples x nTimeSteps x nOutputs tensor shifted by one time step,
+ * so that the row of time step t contains the state of time step t - 1 and the rows of the first time step are zero
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void shiftTimeSteps(size_t nSamples, size_t nTimeSteps, size_t nOutputs, const algorithmFPType *h, algorithmFPType *hPrev)
+{
+    for (size_t s = 0; s < nSamples; s++)
+    {
+        const algorithmFPType *src = h + s * nTimeSteps * nOutputs;
+        algorithmFPType *dst = hPrev + s * nTimeSteps * nOutputs;
+        for (size_t j = 0; j < nOutputs; j++)
+        {
+            dst[j] = (algorithmFPType)0.0;
+        }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < (nTimeSteps - 1) * nOutputs; j++)
+        {
+            dst[nOutputs + j] = src[j];
+        }
+    }
+}
+
+} // internal
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
@@ -45,6 +45,11 @@
 //--
 */
 
+#include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "locallyconnected2d_layer_patches.h"
+
 using namespace daal::internal;
 using namespace daal::services;
 
@@ -68,6 +73,9 @@ services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute
                                                         Tensor &auxWeightsTensor, Tensor &wDerTensor, Tensor &bDerTensor,
                                                         const locallyconnected2d::Parameter &parameter)
 {
+    typedef typename Blas<algorithmFPType, cpu>::SizeType BlasSize;
+    typedef locallyconnected2d::internal::PatchBuffers<algorithmFPType, cpu> PatchBuffers;
+
     Status s;
 
     const services::Collection<size_t> &inGradDims   = inGradTensor.getDimensions();
@@ -76,9 +84,6 @@ services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute
     size_t nAuxWeightsRows = auxWeightsTensor.getDimensions()[0];
     size_t nBDerRows       = bDerTensor.getDimensions()[0];
 
-    DAAL_INT l3 = inGradDims[2];
-    DAAL_INT l4 = inGradDims[3];
-
     size_t firstIdx  = parameter.indices.dims[0];
     size_t secondIdx = parameter.indices.dims[1];
     size_t groupDim  = parameter.groupDimension;
@@ -86,183 +91,212 @@ services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute
 
     const size_t dimsArray[4] = { batchDim, groupDim, firstIdx, secondIdx };
 
-    size_t n1  = auxDataDims[batchDim];
-    DAAL_INT n2 = (DAAL_INT)auxDataDims[groupDim];
-    DAAL_INT n3 = (DAAL_INT)auxDataDims[firstIdx];
-    DAAL_INT n4 = (DAAL_INT)auxDataDims[secondIdx];
-
-    DAAL_INT s3       = (DAAL_INT)parameter.strides.size[0];
-    DAAL_INT s4       = (DAAL_INT)parameter.strides.size[1];
-    DAAL_INT p3       = (DAAL_INT)parameter.paddings.size[0];
-    DAAL_INT p4       = (DAAL_INT)parameter.paddings.size[1];
-    DAAL_INT nKernels = (DAAL_INT)parameter.nKernels;
-    DAAL_INT nGroups  = (DAAL_INT)parameter.nGroups;
-    DAAL_INT m2       = n2 / nGroups;
-    DAAL_INT nk       = nKernels / nGroups;
-    DAAL_INT m3       = (DAAL_INT)parameter.kernelSizes.size[0];
-    DAAL_INT m4       = (DAAL_INT)parameter.kernelSizes.size[1];
+    size_t n1 = auxDataDims[batchDim];
+    if(n1 == 0) { return s; }
+
+    const locallyconnected2d::internal::PatchLayout layout(parameter, (DAAL_INT)auxDataDims[groupDim], (DAAL_INT)auxDataDims[firstIdx],
+                                                          (DAAL_INT)auxDataDims[secondIdx], (DAAL_INT)inGradDims[2], (DAAL_INT)inGradDims[3]);
 
     TensorOffsetLayout inputLayout = auxDataTensor.createDefaultSubtensorLayout();
     DAAL_CHECK_STATUS(s, inputLayout.shuffleDimensions(services::Collection<size_t>( 4, dimsArray)));
 
-    ReadSubtensor<algorithmFPType, cpu, Tensor> auxWeightsBlock;
-    algorithmFPType *auxWeightsArray;
+    ReadSubtensor<algorithmFPType, cpu, Tensor> inGradBlock(const_cast<Tensor &>(inGradTensor), 0, 0, 0, n1);
+    DAAL_CHECK_BLOCK_STATUS(inGradBlock);
+    const algorithmFPType *inGradArray = inGradBlock.get();
 
-    WriteSubtensor<algorithmFPType, cpu, Tensor> gradientBlock;
-    algorithmFPType *gradientArray;
-    ReadSubtensor<algorithmFPType, cpu, Tensor> inGradBlock;
-    ReadSubtensor<algorithmFPType, cpu, Tensor> auxDataBlock;
+    ReadSubtensor<algorithmFPType, cpu, Tensor> auxDataBlock(auxDataTensor, 0, 0, 0, n1, inputLayout);
+    DAAL_CHECK_BLOCK_STATUS(auxDataBlock);
+    const algorithmFPType *auxDataArray = auxDataBlock.get();
 
-    WriteSubtensor<algorithmFPType, cpu, Tensor> wDerBlock(wDerTensor, 0, 0, 0, nAuxWeightsRows);
+    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> wDerBlock(wDerTensor, 0, 0, 0, nAuxWeightsRows);
     DAAL_CHECK_BLOCK_STATUS(wDerBlock);
     algorithmFPType *wDerArray = wDerBlock.get();
 
-    WriteSubtensor<algorithmFPType, cpu, Tensor> bDerBlock(bDerTensor, 0, 0, 0, nBDerRows);
+    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> bDerBlock(bDerTensor, 0, 0, 0, nBDerRows);
     DAAL_CHECK_BLOCK_STATUS(bDerBlock);
     algorithmFPType *bDerArray = bDerBlock.get();
 
-    const algorithmFPType zero = 0.0;
-    const algorithmFPType one = 1.0;
-
-    for(size_t i = 0; i < bDerTensor.getSize(); i++)
+    ReadSubtensor<algorithmFPType, cpu, Tensor> auxWeightsBlock;
+    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> gradientBlock;
+    const algorithmFPType *auxWeightsArray = nullptr;
+    algorithmFPType *gradientArray = nullptr;
+    if (parameter.propagateGradient)
     {
-        bDerArray[i] = zero;
-    }
+        auxWeightsBlock.set(auxWeightsTensor, 0, 0, 0, nAuxWeightsRows);
+        DAAL_CHECK_BLOCK_STATUS(auxWeightsBlock);
+        auxWeightsArray = auxWeightsBlock.get();
 
-    for(size_t i = 0; i < wDerTensor.getSize(); i++)
-    {
-        wDerArray[i] = zero;
+        gradientBlock.set(gradientTensor, 0, 0, 0, n1);
+        DAAL_CHECK_BLOCK_STATUS(gradientBlock);
+        gradientArray = gradientBlock.get();
     }
 
-    DAAL_INT gradientIndex   = 0;
-    DAAL_INT inGradIndex     = 0;
-    DAAL_INT weightsIndex    = 0;
-    DAAL_INT biasIndex       = 0;
-    DAAL_INT auxDataIndex    = 0;
-    DAAL_INT index           = 0;
-    DAAL_INT wDerIndex       = 0;
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType divider = one / (algorithmFPType)n1;
 
-    algorithmFPType divider = one / (algorithmFPType)n1;
-    DAAL_INT offsetBefore = nKernels * l3 * l4;
-    DAAL_INT d = 0;
-    DAAL_INT e = 0;
+    const size_t nPositions = (size_t)layout.nPositions;
+    const size_t patchSize  = (size_t)layout.patchSize;
+    const size_t nk         = (size_t)layout.nk;
+    const size_t blockSize  = (n1 < locallyconnected2d::internal::batchBlockSize ? n1 : locallyconnected2d::internal::batchBlockSize);
 
-    if (parameter.propagateGradient)
+    daal::tls<PatchBuffers *> tlsData([ & ]()
     {
-        auxWeightsBlock.set(auxWeightsTensor, 0, 0, 0, nAuxWeightsRows);
-        DAAL_CHECK_BLOCK_STATUS(auxWeightsBlock);
-        auxWeightsArray = const_cast<algorithmFPType *>(auxWeightsBlock.get());
-    }
+        return new PatchBuffers(blockSize * patchSize, blockSize * nk);
+    });
+
+    SafeStatus safeStat;
+
     /*
-       gradientArray[t] [q * n2 / nGroups + c] [i] [j]
-       inGradArray  [t] [q * nKernels / nGroups + r] [a] [b]
-       auxWeightsArray  [q * nKernels / nGroups + r] [a] [b] [c] [i - a * s3 + p3] [j - b * s4 + p4]
+       auxDataArray [t] [c + q * m2] [i * s3 - p3 + u] [j * s4 - p4 + v]
+       inGradArray  [t] [r + q * nk] [i] [j]
+       wDerArray        [r + q * nk] [i] [j] [c] [u] [v]
+       bDerArray        [r + q * nk] [i] [j]
+
+       Weights derivatives of the output location (i, j) and group q are accumulated over the blocks of samples as
+       the product of the transposed patches matrix (patchSize x samples) and the input gradient values (samples x nk).
+       Every task computes all derivatives of one output location.
     */
-    for(size_t t = 0; t < n1; t++)
+    daal::threader_for(nPositions, nPositions, [ & ](size_t position)
     {
-
-        inGradBlock.set(const_cast<Tensor &>(inGradTensor), 1, &t, 0, (size_t)nKernels);
-        DAAL_CHECK_BLOCK_STATUS(inGradBlock);
-        const algorithmFPType *inGradArray = inGradBlock.get();
-
-        auxDataBlock.set(auxDataTensor, 1, &t, 0, (size_t)n2, inputLayout);
-        DAAL_CHECK_BLOCK_STATUS(auxDataBlock);
-        const algorithmFPType *auxDataArray = auxDataBlock.get();
-
-        if (parameter.propagateGradient)
+        PatchBuffers *buffers = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(buffers && buffers->ok());
+        algorithmFPType *patches  = buffers->patches.get();
+        algorithmFPType *inGrad   = buffers->products.get();
+
+        const DAAL_INT i = (DAAL_INT)position / layout.l4;
+        const DAAL_INT j = (DAAL_INT)position % layout.l4;
+
+        char transa           = 'n';
+        char transb           = 't';
+        BlasSize m            = layout.patchSize;
+        BlasSize n            = layout.nk;
+        BlasSize lda          = layout.patchSize;
+        BlasSize ldb          = layout.nk;
+        BlasSize ldc          = layout.nPositions * layout.patchSize;
+        algorithmFPType alpha = divider;
+        algorithmFPType beta  = one;
+
+        for(DAAL_INT q = 0; q < layout.nGroups; q++)
         {
-            gradientBlock.set(gradientTensor, 1, &t, 0, (size_t)n2);
-            DAAL_CHECK_BLOCK_STATUS(gradientBlock);
-            gradientArray = gradientBlock.get();
+            algorithmFPType *wDer = wDerArray + (q * nk * nPositions + position) * patchSize;
+            algorithmFPType *bDer = bDerArray + q * nk * nPositions + position;
+            for(size_t r = 0; r < nk; r++)
+            {
+                bDer[r * nPositions] = zero;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t v = 0; v < patchSize; v++)
+                {
+                    wDer[r * nPositions * patchSize + v] = zero;
+                }
+            }
 
-            for(DAAL_INT q = 0; q < nGroups; q++)
+            for(size_t first = 0; first < n1; first += blockSize)
             {
-                for(DAAL_INT c = 0; c < m2; c++)
+                BlasSize k = (first + blockSize < n1 ? blockSize : n1 - first);
+
+                layout.gather<algorithmFPType, cpu>(auxDataArray + first * layout.sampleSize, k, q, i, j, patches);
+
+                for(DAAL_INT t = 0; t < k; t++)
                 {
-                    for(DAAL_INT i = 0; i < n3; i++)
+                    const algorithmFPType *sampleInGrad = inGradArray + (first + t) * layout.nKernels * nPositions + q * nk * nPositions + position;
+                    for(size_t r = 0; r < nk; r++)
                     {
-                        for(DAAL_INT j = 0; j < n4; j++)
-                        {
-                            gradientIndex = j + (i + (c + q * m2) * n3) * n4;
-                            gradientArray[gradientIndex] = zero;
-
-                            for(DAAL_INT r = 0; r < nk; r++)
-                            {
-                                for(DAAL_INT a = _floor(i - m3 + p3, s3) + 1; a <= (i + p3) / s3; a++)
-                                {
-                                    if(a >= 0 && a < l3)
-                                    {
-                                        for(DAAL_INT b = _floor(j - m4 + p4, s4) + 1; b <= (j + p4) / s4; b++)
-                                        {
-                                            if(b >= 0 && b < l4)
-                                            {
-                                                inGradIndex  = b + (a + (r + q * nk) * l3) * l4;
-                                                weightsIndex = j - b * s4 + p4 + (i - a * s3 + p3 + (c + (b + (a + (r + q * nk) * l3) * l4) * m2) * m3) * m4;
-                                                /* calculate gradient */
-                                                gradientArray[gradientIndex] += inGradArray[inGradIndex] *  auxWeightsArray[weightsIndex];
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        inGrad[t * nk + r] = sampleInGrad[r * nPositions];
+                        /* calculate biases derivatives */
+                        bDer[r * nPositions] += divider * inGrad[t * nk + r];
                     }
                 }
+
+                /* calculate weights derivatives */
+                Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha, patches, &lda, inGrad, &ldb, &beta, wDer, &ldc);
             }
         }
+    } );
 
-        for(DAAL_INT q = 0; q < nGroups; q++)
+    if (parameter.propagateGradient && safeStat)
+    {
+        /*
+           gradientArray[t] [q * n2 / nGroups + c] [i * s3 - p3 + a] [j * s4 - p4 + b]
+           inGradArray  [t] [q * nKernels / nGroups + r] [i] [j]
+           auxWeightsArray  [q * nKernels / nGroups + r] [i] [j] [c] [a] [b]
+
+           Gradient patches of the output location (i, j) are the product of the input gradient values (samples x nk)
+           and the weights of the location (nk x patchSize), they are added to the gradient as the patches of the location.
+           Patches of neighbouring locations overlap, so every task computes all gradient values of one block of samples and one group.
+        */
+        const size_t nThreads  = daal::threader_get_threads_number();
+        size_t gradBlockSize   = (nThreads > 1 ? n1 / nThreads : n1);
+        if(gradBlockSize > blockSize) { gradBlockSize = blockSize; }
+        if(gradBlockSize == 0) { gradBlockSize = 1; }
+        const size_t nGradBlocks = n1 / gradBlockSize + !!(n1 % gradBlockSize);
+        const size_t nTasks      = nGradBlocks * layout.nGroups;
+        const size_t groupSize   = (size_t)(layout.m2 * layout.n3 * layout.n4);
+
+        daal::threader_for(nTasks, nTasks, [ & ](size_t task)
         {
-            /*
-               auxDataArray [t] [c + q * m2] [i * s3 - p3 + u] [j * s4 - p4 + v]
-               inGradArray  [t] [r + q * nk] [i] [j]
-               wDerArray        [r + q * nk] [i] [j] [c] [u] [v]
-               bDerArray        [r + q * nk] [i] [j]
-            */
-            for(DAAL_INT r = 0; r < nk; r++)
+            PatchBuffers *buffers = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(buffers && buffers->ok());
+            algorithmFPType *patches  = buffers->patches.get();
+            algorithmFPType *inGrad   = buffers->products.get();
+
+            const DAAL_INT q    = (DAAL_INT)(task % layout.nGroups);
+            const size_t first  = (task / layout.nGroups) * gradBlockSize;
+
+            char transa           = 'n';
+            char transb           = 'n';
+            BlasSize m            = layout.patchSize;
+            BlasSize n            = (first + gradBlockSize < n1 ? gradBlockSize : n1 - first);
+            BlasSize k            = layout.nk;
+            BlasSize lda          = layout.nPositions * layout.patchSize;
+            BlasSize ldb          = layout.nk;
+            BlasSize ldc          = layout.patchSize;
+            algorithmFPType alpha = one;
+            algorithmFPType beta  = zero;
+
+            for(DAAL_INT t = 0; t < n; t++)
+            {
+                algorithmFPType *gradient = gradientArray + (first + t) * layout.sampleSize + q * groupSize;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t v = 0; v < groupSize; v++)
+                {
+                    gradient[v] = zero;
+                }
+            }
+
+            for(size_t position = 0; position < nPositions; position++)
             {
-                for(DAAL_INT i = 0; i < l3; i++)
+                const DAAL_INT i = (DAAL_INT)position / layout.l4;
+                const DAAL_INT j = (DAAL_INT)position % layout.l4;
+
+                for(DAAL_INT t = 0; t < n; t++)
                 {
-                    for(DAAL_INT j = 0; j < l4; j++)
+                    const algorithmFPType *sampleInGrad = inGradArray + (first + t) * layout.nKernels * nPositions + q * nk * nPositions + position;
+                    for(size_t r = 0; r < nk; r++)
                     {
-                        index   = j + (i + (r + q * nk) * l3) * l4;
-                        /* calculate biases derivatives */
-                        bDerArray[index] += divider * inGradArray[index];
-
-                        for(DAAL_INT c = 0; c < m2; c++)
-                        {
-                            for(DAAL_INT u = 0; u < m3; u++)
-                            {
-                                for(DAAL_INT v = 0; v < m4; v++)
-                                {
-                                    wDerIndex = v + (u + (c + (j + (i + (r + q * nk) * l3) * l4) * m2) * m3) * m4;
-                                    d = i * s3 - p3 + u;
-                                    e = j * s4 - p4 + v;
-
-                                    if(e >= 0 && d >= 0 && e < n4 && d < n3)
-                                    {
-                                        auxDataIndex = e + (d + (c + q * m2) * n3) * n4 ;
-                                        /* calculate weights derivatives */
-                                        wDerArray[wDerIndex] += divider * inGradArray[index] * auxDataArray[auxDataIndex];
-                                    }
-                                }
-                            }
-                        }
+                        inGrad[t * nk + r] = sampleInGrad[r * nPositions];
                     }
                 }
+
+                /* calculate gradient */
+                Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha,
+                                                   auxWeightsArray + (q * nk * nPositions + position) * patchSize, &lda,
+                                                   inGrad, &ldb, &beta, patches, &ldc);
+
+                layout.scatter<algorithmFPType, cpu>(patches, n, q, i, j, gradientArray + first * layout.sampleSize);
             }
-        }
+        } );
     }
-    return s;
-}
 
-template<typename algorithmFPType, Method method, CpuType cpu>
-DAAL_INT LocallyConnected2dKernel<algorithmFPType, method, cpu>::_floor(DAAL_INT numerator, DAAL_INT denominator)
-{
-    double result = (double)numerator / (double)denominator;
-    DAAL_INT _result = (DAAL_INT)result;
+    tlsData.reduce([ & ](PatchBuffers *buffers)
+    {
+        delete buffers;
+    });
+    DAAL_CHECK_SAFE_STATUS();
 
-    return (result < (double)_result) ? (_result - 1) : _result;
+    return s;
 }
 
 } // internal
@@ -83,7 +83,6 @@ public:
     services::Status compute(const Tensor &inGradTensor, Tensor &gradientTensor, Tensor &auxDataTensor,
                                                         Tensor &auxWeightsTensor, Tensor &wDerTensor, Tensor &bDerTensor,
                                                         const locallyconnected2d::Parameter &parameter);
-    DAAL_INT _floor(DAAL_INT numerator, DAAL_INT denominator);
 };
 
 } // internal
@@ -46,6 +46,9 @@
 */
 
 #include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "locallyconnected2d_layer_patches.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -69,6 +72,8 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, const Tensor &weightsTensor, const Tensor &biasesTensor,
                                 Tensor &valueTensor, const locallyconnected2d::Parameter &parameter)
 {
+    typedef typename Blas<algorithmFPType, cpu>::SizeType BlasSize;
+
     Status s;
 
     const services::Collection<size_t> &inputDims = inputTensor.getDimensions();
@@ -77,37 +82,29 @@ services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute
     size_t nWeightsRows = weightsTensor.getDimensions()[0];
     size_t nBiasesRows  = biasesTensor.getDimensions()[0];
 
-    DAAL_INT m3       = (DAAL_INT)parameter.kernelSizes.size[0];
-    DAAL_INT m4       = (DAAL_INT)parameter.kernelSizes.size[1];
-    DAAL_INT s3       = (DAAL_INT)parameter.strides.size[0];
-    DAAL_INT s4       = (DAAL_INT)parameter.strides.size[1];
-    DAAL_INT p3       = (DAAL_INT)parameter.paddings.size[0];
-    DAAL_INT p4       = (DAAL_INT)parameter.paddings.size[1];
-    DAAL_INT nKernels = (DAAL_INT)parameter.nKernels;
-    DAAL_INT nGroups  = (DAAL_INT)parameter.nGroups;
-
     size_t firstIdx  = parameter.indices.dims[0];
     size_t secondIdx = parameter.indices.dims[1];
     size_t groupDim  = parameter.groupDimension;
     size_t batchDim  = 6 - groupDim - firstIdx - secondIdx;
 
-    size_t n1  = inputDims[batchDim];
-    DAAL_INT n2 = (DAAL_INT)inputDims[groupDim];
-    DAAL_INT n3 = (DAAL_INT)inputDims[firstIdx];
-    DAAL_INT n4 = (DAAL_INT)inputDims[secondIdx];
+    size_t n1 = inputDims[batchDim];
+    if(n1 == 0) { return s; }
 
-    DAAL_INT l3 = (DAAL_INT)valueDims[2];
-    DAAL_INT l4 = (DAAL_INT)valueDims[3];
-    DAAL_INT m2 = n2 / nGroups;
-    DAAL_INT nk = nKernels / nGroups;
+    const locallyconnected2d::internal::PatchLayout layout(parameter, (DAAL_INT)inputDims[groupDim], (DAAL_INT)inputDims[firstIdx],
+                                                          (DAAL_INT)inputDims[secondIdx], (DAAL_INT)valueDims[2], (DAAL_INT)valueDims[3]);
 
     const size_t dimsArray[4] = { batchDim, groupDim, firstIdx, secondIdx };
 
     TensorOffsetLayout inputLayout = inputTensor.createDefaultSubtensorLayout();
     DAAL_CHECK_STATUS(s, inputLayout.shuffleDimensions(services::Collection<size_t>( 4, dimsArray)));
 
-    ReadSubtensor<algorithmFPType, cpu, Tensor> inputBlock;
-    WriteSubtensor<algorithmFPType, cpu, Tensor> resultBlock;
+    ReadSubtensor<algorithmFPType, cpu, Tensor> inputBlock(const_cast<Tensor &>(inputTensor), 0, 0, 0, n1, inputLayout);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+    const algorithmFPType *inputArray = inputBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> resultBlock(valueTensor, 0, 0, 0, n1);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+    algorithmFPType *resultArray = resultBlock.get();
 
     ReadSubtensor<algorithmFPType, cpu, Tensor> weightsBlock(const_cast<Tensor &>(weightsTensor), 0, 0, 0, nWeightsRows);
     DAAL_CHECK_BLOCK_STATUS(weightsBlock);
@@ -117,66 +114,74 @@ services::Status LocallyConnected2dKernel<algorithmFPType, method, cpu>::compute
     DAAL_CHECK_BLOCK_STATUS(biasesBlock);
     const algorithmFPType *biasesArray = biasesBlock.get();
 
-    const algorithmFPType zero = 0.0;
+    /*   inputArray  [t] [q * n2 / nGroups + c] [i * s3 - p3 + a] [j * s4 - p4 + b]
+         resultArray [t] [q * nKernels / nGroups + r] [i] [j]
+         weightsArray    [q * nKernels / nGroups + r] [i] [j] [c] [a] [b]
+         biasesArray     [q * nKernels / nGroups + r] [i] [j]
 
-    DAAL_INT resultIndex  = 0;
-    DAAL_INT weightsIndex = 0;
-    DAAL_INT inputIndex   = 0;
-    DAAL_INT biasesIndex  = 0;
-    DAAL_INT d = 0;
-    DAAL_INT e = 0;
-
-  /*   inputArray  [t] [q * n2 / nGroups + c] [i * s3 - p3 + a] [j * s4 - p4 + b]
-       resultArray [t] [q * nKernels / nGroups + r] [i] [j]
-       weightsArray    [q * nKernels / nGroups + r] [i] [j] [c] [a] [b]
-       biasesArray     [q * nKernels / nGroups + r] [i] [j]
+         For every output location (i, j) and group q the values of the block of samples are computed as
+         the product of the patches matrix (samples x patchSize) and the transposed weights of the location (patchSize x nk)
     */
-    for(size_t t = 0; t < n1; t++)
-    {
-        inputBlock.set(const_cast<Tensor &>(inputTensor), 1, &t, 0, (size_t)n2, inputLayout);
-        DAAL_CHECK_BLOCK_STATUS(inputBlock);
-        const algorithmFPType *inputArray = inputBlock.get();
+    const size_t nPositions = (size_t)layout.nPositions;
+    const size_t blockSize  = (n1 < locallyconnected2d::internal::batchBlockSize ? n1 : locallyconnected2d::internal::batchBlockSize);
+    const size_t nBlocks    = n1 / blockSize + !!(n1 % blockSize);
+    const size_t nTasks     = nPositions * nBlocks;
 
-        resultBlock.set(valueTensor, 1, &t, 0, (size_t)nKernels);
-        DAAL_CHECK_BLOCK_STATUS(resultBlock);
-        algorithmFPType *resultArray = resultBlock.get();
+    daal::tls<locallyconnected2d::internal::PatchBuffers<algorithmFPType, cpu> *> tlsData([ & ]()
+    {
+        return new locallyconnected2d::internal::PatchBuffers<algorithmFPType, cpu>(blockSize * layout.patchSize, blockSize * layout.nk);
+    });
 
-        for(DAAL_INT q = 0; q < nGroups; q++)
+    SafeStatus safeStat;
+    daal::threader_for(nTasks, nTasks, [ & ](size_t task)
+    {
+        locallyconnected2d::internal::PatchBuffers<algorithmFPType, cpu> *buffers = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(buffers && buffers->ok());
+        algorithmFPType *patches  = buffers->patches.get();
+        algorithmFPType *products = buffers->products.get();
+
+        const size_t position = task % nPositions;
+        const size_t first    = (task / nPositions) * blockSize;
+        const DAAL_INT i = (DAAL_INT)position / layout.l4;
+        const DAAL_INT j = (DAAL_INT)position % layout.l4;
+
+        char transa           = 't';
+        char transb           = 'n';
+        BlasSize m            = layout.nk;
+        BlasSize n            = (first + blockSize < n1 ? blockSize : n1 - first);
+        BlasSize k            = layout.patchSize;
+        BlasSize lda          = layout.nPositions * layout.patchSize;
+        BlasSize ldb          = layout.patchSize;
+        BlasSize ldc          = layout.nk;
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 0.0;
+
+        for(DAAL_INT q = 0; q < layout.nGroups; q++)
         {
-            for(DAAL_INT r = 0; r < nk; r++)
+            layout.gather<algorithmFPType, cpu>(inputArray + first * layout.sampleSize, n, q, i, j, patches);
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha,
+                                               weightsArray + (q * layout.nk * nPositions + position) * layout.patchSize, &lda,
+                                               patches, &ldb, &beta, products, &ldc);
+
+            for(DAAL_INT t = 0; t < n; t++)
             {
-                for(DAAL_INT i = 0; i < l3; i++)
+                algorithmFPType *result = resultArray + (first + t) * layout.nKernels * nPositions + q * layout.nk * nPositions + position;
+                const algorithmFPType *biases = biasesArray + q * layout.nk * nPositions + position;
+                for(DAAL_INT r = 0; r < layout.nk; r++)
                 {
-                    for(DAAL_INT j = 0; j < l4; j++)
-                    {
-                        resultIndex = j + (i + (q * nk + r) * l3) * l4;
-                        biasesIndex = j + (i + (q * nk + r) * l3) * l4;
-                        resultArray[resultIndex] = biasesArray[biasesIndex];
-
-                        for(DAAL_INT c = 0; c < m2 ; c++)
-                        {
-                            for(DAAL_INT a = 0; a < m3; a++)
-                            {
-                                for(DAAL_INT b = 0; b < m4; b++)
-                                {
-                                    weightsIndex = b + (a + (c + (j + (i + (q * nk + r) * l3) * l4) * m2) * m3) * m4;
-
-                                    d = b + j * s4 - p4;
-                                    e = a + i * s3 - p3;
-
-                                    if(  d >= 0 && d < n4  &&  e >= 0 && e < n3 )
-                                    {
-                                        inputIndex = d + (e + (q * m2 + c) * n3) * n4;
-                                        resultArray[resultIndex] += weightsArray[weightsIndex] * inputArray[inputIndex];
-                                    }
-                                }
-                            }
-                        }
-                    }
+                    result[r * nPositions] = products[t * layout.nk + r] + biases[r * nPositions];
                 }
             }
         }
-    }
+    } );
+
+    tlsData.reduce([ & ](locallyconnected2d::internal::PatchBuffers<algorithmFPType, cpu> *buffers)
+    {
+        delete buffers;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
     return s;
 }
 
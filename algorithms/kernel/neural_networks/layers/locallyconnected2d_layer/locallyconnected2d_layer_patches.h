@@ -0,0 +1,213 @@
+/* file: locallyconnected2d_layer_patches.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common classes for 2D locally connected layers
+//--
+*/
+
+#ifndef __LOCALLYCONNECTED2D_LAYER_PATCHES_H__
+#define __LOCALLYCONNECTED2D_LAYER_PATCHES_H__
+
+#include "neural_networks/layers/locallyconnected2d/locallyconnected2d_layer_types.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace locallyconnected2d
+{
+namespace internal
+{
+
+/* Number of samples processed by one call of the matrix multiplication */
+const size_t batchBlockSize = 64;
+
+/*
+ * Geometry of the locally connected layer viewed as a set of small matrix multiplications, one per output location.
+ * The patch of the output location (i, j) for the group q holds the input values
+ *     input [t] [q * m2 + c] [i * s3 - p3 + a] [j * s4 - p4 + b]
+ * at the position (c * m3 + a) * m4 + b, values outside of the input are zeros.
+ * The weights of the output location are the rows of the matrix
+ *     weights [q * nk + r] [i] [j] [c] [a] [b]
+ * that are nPositions * patchSize elements apart.
+ */
+struct PatchLayout
+{
+    PatchLayout(const locallyconnected2d::Parameter &parameter, DAAL_INT inputChannels, DAAL_INT inputFirstSize, DAAL_INT inputSecondSize,
+                DAAL_INT outputFirstSize, DAAL_INT outputSecondSize) :
+        n2(inputChannels), n3(inputFirstSize), n4(inputSecondSize), l3(outputFirstSize), l4(outputSecondSize),
+        m3((DAAL_INT)parameter.kernelSizes.size[0]), m4((DAAL_INT)parameter.kernelSizes.size[1]),
+        s3((DAAL_INT)parameter.strides.size[0]),     s4((DAAL_INT)parameter.strides.size[1]),
+        p3((DAAL_INT)parameter.paddings.size[0]),    p4((DAAL_INT)parameter.paddings.size[1]),
+        nGroups((DAAL_INT)parameter.nGroups), nKernels((DAAL_INT)parameter.nKernels)
+    {
+        m2 = n2 / nGroups;
+        nk = nKernels / nGroups;
+        patchSize  = m2 * m3 * m4;
+        nPositions = l3 * l4;
+        sampleSize = n2 * n3 * n4;
+    }
+
+    /* Copies the patches of the output location (i, j) of nSamples consecutive samples into nSamples x patchSize matrix */
+    template<typename algorithmFPType, CpuType cpu>
+    void gather(const algorithmFPType *input, size_t nSamples, DAAL_INT q, DAAL_INT i, DAAL_INT j, algorithmFPType *patches) const
+    {
+        const algorithmFPType zero = 0.0;
+        DAAL_INT aBegin, aEnd, bBegin, bEnd;
+        getKernelRange(i, j, aBegin, aEnd, bBegin, bEnd);
+
+        for(size_t t = 0; t < nSamples; t++)
+        {
+            for(DAAL_INT c = 0; c < m2; c++)
+            {
+                const algorithmFPType *channel = input + t * sampleSize + (q * m2 + c) * n3 * n4;
+                algorithmFPType *patch = patches + t * patchSize + c * m3 * m4;
+                for(DAAL_INT a = 0; a < m3; a++)
+                {
+                    algorithmFPType *patchRow = patch + a * m4;
+                    if(a < aBegin || a >= aEnd)
+                    {
+                        for(DAAL_INT b = 0; b < m4; b++) { patchRow[b] = zero; }
+                        continue;
+                    }
+
+                    const algorithmFPType *inputRow = channel + (i * s3 - p3 + a) * n4 + (j * s4 - p4 + bBegin);
+                    for(DAAL_INT b = 0; b < bBegin; b++) { patchRow[b] = zero; }
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for(DAAL_INT b = bBegin; b < bEnd; b++)
+                    {
+                        patchRow[b] = inputRow[b - bBegin];
+                    }
+                    for(DAAL_INT b = bEnd; b < m4; b++) { patchRow[b] = zero; }
+                }
+            }
+        }
+    }
+
+    /* Adds nSamples x patchSize matrix of the patch values of the output location (i, j) to the values of nSamples consecutive samples */
+    template<typename algorithmFPType, CpuType cpu>
+    void scatter(const algorithmFPType *patches, size_t nSamples, DAAL_INT q, DAAL_INT i, DAAL_INT j, algorithmFPType *output) const
+    {
+        DAAL_INT aBegin, aEnd, bBegin, bEnd;
+        getKernelRange(i, j, aBegin, aEnd, bBegin, bEnd);
+
+        for(size_t t = 0; t < nSamples; t++)
+        {
+            for(DAAL_INT c = 0; c < m2; c++)
+            {
+                algorithmFPType *channel = output + t * sampleSize + (q * m2 + c) * n3 * n4;
+                const algorithmFPType *patch = patches + t * patchSize + c * m3 * m4;
+                for(DAAL_INT a = aBegin; a < aEnd; a++)
+                {
+                    const algorithmFPType *patchRow = patch + a * m4;
+                    algorithmFPType *outputRow = channel + (i * s3 - p3 + a) * n4 + (j * s4 - p4 + bBegin);
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for(DAAL_INT b = bBegin; b < bEnd; b++)
+                    {
+                        outputRow[b - bBegin] += patchRow[b];
+                    }
+                }
+            }
+        }
+    }
+
+    DAAL_INT n2, n3, n4;
+    DAAL_INT l3, l4;
+    DAAL_INT m2, m3, m4;
+    DAAL_INT s3, s4;
+    DAAL_INT p3, p4;
+    DAAL_INT nGroups;
+    DAAL_INT nKernels;
+    DAAL_INT nk;
+    DAAL_INT patchSize;
+    DAAL_INT nPositions;
+    DAAL_INT sampleSize;
+
+private:
+    /* Computes the range of kernel indices that fall inside the input for the output location (i, j) */
+    void getKernelRange(DAAL_INT i, DAAL_INT j, DAAL_INT &aBegin, DAAL_INT &aEnd, DAAL_INT &bBegin, DAAL_INT &bEnd) const
+    {
+        aBegin = clip(p3 - i * s3, m3);
+        aEnd   = clip(n3 + p3 - i * s3, m3);
+        bBegin = clip(p4 - j * s4, m4);
+        bEnd   = clip(n4 + p4 - j * s4, m4);
+        if(aEnd < aBegin) { aEnd = aBegin; }
+        if(bEnd < bBegin) { bEnd = bBegin; }
+    }
+
+    static DAAL_INT clip(DAAL_INT value, DAAL_INT upper)
+    {
+        return (value < 0 ? 0 : (value > upper ? upper : value));
+    }
+};
+
+/* Thread local buffers for the patches of the block of samples and for the products of the patches and the weights */
+template<typename algorithmFPType, CpuType cpu>
+struct PatchBuffers
+{
+    DAAL_NEW_DELETE();
+
+    PatchBuffers(size_t nPatchValues, size_t nProducts) : patches(nPatchValues), products(nProducts) {}
+
+    bool ok() const { return patches.get() && products.get(); }
+
+    daal::internal::TArrayScalable<algorithmFPType, cpu> patches;
+    daal::internal::TArrayScalable<algorithmFPType, cpu> products;
+};
+
+} // internal
+} // locallyconnected2d
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
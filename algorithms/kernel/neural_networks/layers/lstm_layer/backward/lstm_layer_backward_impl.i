@@ -0,0 +1,244 @@
+/* file: lstm_layer_backward_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LSTM algorithm
+//--
+*/
+
+#ifndef __LSTM_LAYER_BACKWARD_IMPL_I__
+#define __LSTM_LAYER_BACKWARD_IMPL_I__
+
+#include "threading.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_tensor.h"
+#include "service_numeric_table.h"
+#include "layers_recurrent.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace lstm
+{
+namespace backward
+{
+namespace internal
+{
+
+/*
+ * Gradients with respect to the gates of all time steps are computed in reverse time order with one GEMM per time step.
+ * Derivatives of the weights and the gradient with respect to the input data are then computed
+ * for the whole sequence with one GEMM each
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status LSTMKernel<algorithmFPType, method, cpu>::compute(const Tensor &inGradTensor, const Tensor &xTensor, const Tensor &wTensor,
+                                                         const Tensor &gatesTensor, const Tensor &cellStatesTensor,
+                                                         const Tensor &hiddenStatesTensor, Tensor &wDerTensor, Tensor &bDerTensor,
+                                                         Tensor *resultTensor, const lstm::Parameter &parameter)
+{
+    const services::Collection<size_t> &xDims = xTensor.getDimensions();
+    const size_t nSamples   = xDims[0];
+    const size_t nTimeSteps = xDims[1];
+    const size_t nFeatures  = xDims[2];
+    const size_t nOutputs   = parameter.nOutputs;
+    const size_t nGateOutputs = 4 * nOutputs;
+    const size_t nRows = nSamples * nTimeSteps;
+    const size_t gatesStride  = nTimeSteps * nGateOutputs;
+    const size_t statesStride = nTimeSteps * nOutputs;
+    const algorithmFPType invBatchSize = (algorithmFPType)1.0 / nSamples;
+
+    ReadSubtensor<algorithmFPType, cpu> inGradBlock(const_cast<Tensor &>(inGradTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(inGradBlock);
+    const algorithmFPType *inGrad = inGradBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> xBlock(const_cast<Tensor &>(xTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType *x = xBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor), 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    const algorithmFPType *wx = wBlock.get();
+    const algorithmFPType *wh = wx + nFeatures * nGateOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> gatesBlock(const_cast<Tensor &>(gatesTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(gatesBlock);
+    const algorithmFPType *gates = gatesBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> cellBlock(const_cast<Tensor &>(cellStatesTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(cellBlock);
+    const algorithmFPType *cells = cellBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> hiddenBlock(const_cast<Tensor &>(hiddenStatesTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(hiddenBlock);
+    const algorithmFPType *hiddenStates = hiddenBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> wDerBlock(wDerTensor, 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wDerBlock);
+    algorithmFPType *wxDer = wDerBlock.get();
+    algorithmFPType *whDer = wxDer + nFeatures * nGateOutputs;
+
+    WriteOnlySubtensor<algorithmFPType, cpu> bDerBlock(bDerTensor, 0, 0, 0, nGateOutputs);
+    DAAL_CHECK_BLOCK_STATUS(bDerBlock);
+    algorithmFPType *bDer = bDerBlock.get();
+
+    /* Gradients with respect to the gate pre-activations of all time steps, stored in the layout of the gates */
+    TArrayScalable<algorithmFPType, cpu> gatesGradBuffer(nRows * nGateOutputs);
+    DAAL_CHECK_MALLOC(gatesGradBuffer.get());
+    algorithmFPType *gatesGrad = gatesGradBuffer.get();
+
+    /* Gradients with respect to the hidden and the cell states propagated from the next time step */
+    TArrayScalable<algorithmFPType, cpu> hGradBuffer(nSamples * nOutputs);
+    TArrayScalable<algorithmFPType, cpu> cGradBuffer(nSamples * nOutputs);
+    TArrayScalable<algorithmFPType, cpu> tanhBuffer(nSamples * nOutputs);
+    DAAL_CHECK_MALLOC(hGradBuffer.get() && cGradBuffer.get() && tanhBuffer.get());
+    algorithmFPType *hGrad = hGradBuffer.get();
+    algorithmFPType *cGrad = cGradBuffer.get();
+    algorithmFPType *tanhC = tanhBuffer.get();
+
+    for (size_t i = 0; i < nSamples * nOutputs; i++)
+    {
+        hGrad[i] = (algorithmFPType)0.0;
+        cGrad[i] = (algorithmFPType)0.0;
+    }
+
+    for (size_t tt = nTimeSteps; tt > 0; tt--)
+    {
+        const size_t t = tt - 1;
+
+        daal::threader_for(nSamples, nSamples, [ & ](size_t s)
+        {
+            const algorithmFPType *g  = gates + s * gatesStride + t * nGateOutputs;
+            const algorithmFPType *gi = g;
+            const algorithmFPType *gf = g + nOutputs;
+            const algorithmFPType *go = g + 2 * nOutputs;
+            const algorithmFPType *gc = g + 3 * nOutputs;
+
+            algorithmFPType *dg  = gatesGrad + s * gatesStride + t * nGateOutputs;
+            algorithmFPType *dgi = dg;
+            algorithmFPType *dgf = dg + nOutputs;
+            algorithmFPType *dgo = dg + 2 * nOutputs;
+            algorithmFPType *dgc = dg + 3 * nOutputs;
+
+            const algorithmFPType *c  = cells + s * statesStride + t * nOutputs;
+            const algorithmFPType *dv = inGrad + s * statesStride + t * nOutputs;
+            algorithmFPType *dh = hGrad + s * nOutputs;
+            algorithmFPType *dc = cGrad + s * nOutputs;
+            algorithmFPType *tc = tanhC + s * nOutputs;
+
+            Math<algorithmFPType, cpu>::vTanh(nOutputs, c, tc);
+
+            /* Cell state before the first time step is zero */
+            const algorithmFPType cPrevScale = (t > 0 ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+            const algorithmFPType *cPrev = (t > 0 ? c - nOutputs : c);
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nOutputs; j++)
+            {
+                const algorithmFPType dhj = dv[j] + dh[j];
+                const algorithmFPType dcj = dc[j] + dhj * go[j] * ((algorithmFPType)1.0 - tc[j] * tc[j]);
+                dgo[j] = dhj * tc[j] * go[j] * ((algorithmFPType)1.0 - go[j]);
+                dgi[j] = dcj * gc[j] * gi[j] * ((algorithmFPType)1.0 - gi[j]);
+                dgf[j] = dcj * cPrevScale * cPrev[j] * gf[j] * ((algorithmFPType)1.0 - gf[j]);
+                dgc[j] = dcj * gi[j] * ((algorithmFPType)1.0 - gc[j] * gc[j]);
+                dc[j]  = dcj * gf[j];
+            }
+        } );
+
+        /* Gradient with respect to the previous hidden state of the whole batch: dh_{t-1} = dGates_t * Wh' */
+        if (t > 0)
+        {
+            layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, true, nSamples, nOutputs, nGateOutputs, (algorithmFPType)1.0,
+                                                                  gatesGrad + t * nGateOutputs, gatesStride, wh, nGateOutputs,
+                                                                  (algorithmFPType)0.0, hGrad, nOutputs);
+        }
+    }
+
+    /* Derivatives of the input weights: dWx = x' * dGates / nSamples */
+    layers::internal::rowMajorGemm<algorithmFPType, cpu>(true, false, nFeatures, nGateOutputs, nRows, invBatchSize,
+                                                          x, nFeatures, gatesGrad, nGateOutputs, (algorithmFPType)0.0, wxDer, nGateOutputs);
+
+    /* Derivatives of the recurrent weights: dWh = h_{t-1}' * dGates_t / nSamples summed over time steps */
+    {
+        TArrayScalable<algorithmFPType, cpu> hPrevBuffer(nRows * nOutputs);
+        DAAL_CHECK_MALLOC(hPrevBuffer.get());
+        algorithmFPType *hPrev = hPrevBuffer.get();
+
+        layers::internal::shiftTimeSteps<algorithmFPType, cpu>(nSamples, nTimeSteps, nOutputs, hiddenStates, hPrev);
+        layers::internal::rowMajorGemm<algorithmFPType, cpu>(true, false, nOutputs, nGateOutputs, nRows, invBatchSize,
+                                                              hPrev, nOutputs, gatesGrad, nGateOutputs, (algorithmFPType)0.0, whDer, nGateOutputs);
+    }
+
+    layers::internal::sumRows<algorithmFPType, cpu>(nRows, nGateOutputs, gatesGrad, invBatchSize, bDer);
+
+    /* Gradient with respect to the input data: dx = dGates * Wx' */
+    if (parameter.propagateGradient)
+    {
+        WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(resultBlock);
+        algorithmFPType *result = resultBlock.get();
+
+        layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, true, nRows, nFeatures, nGateOutputs, (algorithmFPType)1.0,
+                                                              gatesGrad, nGateOutputs, wx, nGateOutputs, (algorithmFPType)0.0, result, nFeatures);
+    }
+    return Status();
+}
+
+} // internal
+} // backward
+} // lstm
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
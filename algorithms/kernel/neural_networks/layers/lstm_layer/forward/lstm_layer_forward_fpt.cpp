@@ -0,0 +1,153 @@
+/* file: lstm_layer_forward_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of lstm calculation algorithm and types methods.
+//--
+*/
+
+#include "lstm_layer_forward_types.h"
+#include "lstm_layer_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace lstm
+{
+namespace forward
+{
+namespace interface1
+{
+/**
+* Allocates memory to store the result of forward  LSTM layer
+ * \param[in] parameter %Parameter of forward LSTM layer
+ * \param[in] method    Computation method for the layer
+*/
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Input::allocate(const daal::algorithms::Parameter *parameter, const int method)
+{
+    using daal::services::SharedPtr;
+    using daal::data_management::Tensor;
+    using daal::data_management::HomogenTensor;
+
+    const Parameter *param =  static_cast<const Parameter *>(parameter);
+
+    services::Status s;
+
+    if( !get(layers::forward::weights) )
+    {
+        DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::weights, getWeightsSizes(param));
+    }
+
+    if( !get(layers::forward::biases) )
+    {
+        DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::biases, getBiasesSizes(param));
+    }
+    return s;
+}
+/**
+ * Allocates memory to store the result of forward  LSTM layer
+ * \param[in] input     %Input object for the algorithm
+ * \param[in] parameter %Parameter of forward LSTM layer
+ * \param[in] method    Computation method for the layer
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *in = static_cast<const Input * >(input);
+    services::Status s;
+    if (!get(layers::forward::value))
+    {
+        const services::Collection<size_t> &valueDims = getValueSize(in->get(layers::forward::data)->getDimensions(), parameter, method);
+        DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::value, valueDims);
+    }
+
+    const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
+    if(!par->predictionStage)
+    {
+        if (!get(layers::forward::resultForBackward))
+        {
+            set(layers::forward::resultForBackward, LayerDataPtr(new LayerData()));
+        }
+        DAAL_CHECK_STATUS(s, setResultForBackward(input));
+
+        /* Per time step states are stored in the layout of the value: nSamples x nTimeSteps x nOutputs */
+        const Parameter *param = static_cast<const Parameter * >(parameter);
+        const services::Collection<size_t> &dataDims = in->get(layers::forward::data)->getDimensions();
+        services::Collection<size_t> statesDims;
+        statesDims.push_back(dataDims[0]);
+        statesDims.push_back(dataDims[1]);
+        statesDims.push_back(param->nOutputs);
+        services::Collection<size_t> gatesDims = statesDims;
+        gatesDims[2] = 4 * param->nOutputs;
+
+        if (!get(auxGates))
+        {
+            DAAL_ALLOCATE_TENSOR_AND_SET(s, auxGates, gatesDims);
+        }
+        if (!get(auxCellStates))
+        {
+            DAAL_ALLOCATE_TENSOR_AND_SET(s, auxCellStates, statesDims);
+        }
+        if (!get(auxHiddenStates))
+        {
+            DAAL_ALLOCATE_TENSOR_AND_SET(s, auxHiddenStates, statesDims);
+        }
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Input::allocate<DAAL_FPTYPE>(const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+}// namespace interface1
+}// namespace forward
+}// namespace lstm
+}// namespace layers
+}// namespace neural_networks
+}// namespace algorithms
+}// namespace daal
@@ -0,0 +1,227 @@
+/* file: lstm_layer_forward_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LSTM algorithm
+//--
+*/
+
+#ifndef __LSTM_LAYER_FORWARD_IMPL_I__
+#define __LSTM_LAYER_FORWARD_IMPL_I__
+
+#include "threading.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_tensor.h"
+#include "service_numeric_table.h"
+#include "layers_recurrent.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace lstm
+{
+namespace forward
+{
+namespace internal
+{
+
+/*
+ * Gates of each sample and time step are stored contiguously in the order: input, forget, output, cell candidate.
+ * The input projections of all time steps are computed with one GEMM before the recurrence,
+ * after that each time step requires one GEMM with the recurrent weights for the whole batch
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status LSTMKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, const Tensor &wTensor, const Tensor &bTensor, Tensor &resultTensor,
+                                                         Tensor *gatesTensor, Tensor *cellStatesTensor, Tensor *hiddenStatesTensor,
+                                                         const lstm::Parameter &parameter)
+{
+    const services::Collection<size_t> &xDims = inputTensor.getDimensions();
+    const size_t nSamples   = xDims[0];
+    const size_t nTimeSteps = xDims[1];
+    const size_t nFeatures  = xDims[2];
+    const size_t nOutputs   = parameter.nOutputs;
+    const size_t nGateOutputs = 4 * nOutputs;
+    const size_t nRows = nSamples * nTimeSteps;
+    const bool isTraining = (gatesTensor && cellStatesTensor && hiddenStatesTensor);
+
+    ReadSubtensor<algorithmFPType, cpu> xBlock(const_cast<Tensor &>(inputTensor), 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType *x = xBlock.get();
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(const_cast<Tensor &>(wTensor), 0, 0, 0, nFeatures + nOutputs);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+    const algorithmFPType *wx = wBlock.get();
+    const algorithmFPType *wh = wx + nFeatures * nGateOutputs;
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(const_cast<Tensor &>(bTensor), 0, 0, 0, nGateOutputs);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+    const algorithmFPType *b = bBlock.get();
+
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nSamples);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+    algorithmFPType *h = resultBlock.get();
+
+    /* At the prediction stage the gates of all time steps and the cell state of the current time step are kept in scratch buffers */
+    TArrayScalable<algorithmFPType, cpu> gatesBuffer;
+    TArrayScalable<algorithmFPType, cpu> cellBuffer;
+    WriteOnlySubtensor<algorithmFPType, cpu> gatesBlock;
+    WriteOnlySubtensor<algorithmFPType, cpu> cellBlock;
+    algorithmFPType *gates = nullptr;
+    algorithmFPType *cells = nullptr;
+    if (isTraining)
+    {
+        gatesBlock.set(*gatesTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(gatesBlock);
+        gates = gatesBlock.get();
+
+        cellBlock.set(*cellStatesTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(cellBlock);
+        cells = cellBlock.get();
+    }
+    else
+    {
+        gatesBuffer.reset(nRows * nGateOutputs);
+        DAAL_CHECK_MALLOC(gatesBuffer.get());
+        gates = gatesBuffer.get();
+
+        cellBuffer.reset(nSamples * nOutputs);
+        DAAL_CHECK_MALLOC(cellBuffer.get());
+        cells = cellBuffer.get();
+    }
+
+    /* Input projections of all time steps: gates = x * Wx + b */
+    layers::internal::broadcastRows<algorithmFPType, cpu>(nRows, nGateOutputs, b, gates);
+    layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, false, nRows, nGateOutputs, nFeatures, (algorithmFPType)1.0,
+                                                          x, nFeatures, wx, nGateOutputs, (algorithmFPType)1.0, gates, nGateOutputs);
+
+    const size_t gatesStride  = nTimeSteps * nGateOutputs;
+    const size_t statesStride = nTimeSteps * nOutputs;
+
+    for (size_t t = 0; t < nTimeSteps; t++)
+    {
+        /* Recurrent projections of the whole batch: gates_t += h_{t-1} * Wh */
+        if (t > 0)
+        {
+            layers::internal::rowMajorGemm<algorithmFPType, cpu>(false, false, nSamples, nGateOutputs, nOutputs, (algorithmFPType)1.0,
+                                                                  h + (t - 1) * nOutputs, statesStride, wh, nGateOutputs,
+                                                                  (algorithmFPType)1.0, gates + t * nGateOutputs, gatesStride);
+        }
+
+        daal::threader_for(nSamples, nSamples, [ & ](size_t s)
+        {
+            algorithmFPType *g = gates + s * gatesStride + t * nGateOutputs;
+            algorithmFPType *gi = g;
+            algorithmFPType *gf = g + nOutputs;
+            algorithmFPType *go = g + 2 * nOutputs;
+            algorithmFPType *gc = g + 3 * nOutputs;
+
+            layers::internal::sigmoidInPlace<algorithmFPType, cpu>(3 * nOutputs, g);
+            Math<algorithmFPType, cpu>::vTanh(nOutputs, gc, gc);
+
+            algorithmFPType *c = (isTraining ? cells + s * statesStride + t * nOutputs : cells + s * nOutputs);
+            if (t == 0)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    c[j] = gi[j] * gc[j];
+                }
+            }
+            else
+            {
+                /* At the prediction stage the cell state is updated in place */
+                const algorithmFPType *cPrev = (isTraining ? c - nOutputs : c);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nOutputs; j++)
+                {
+                    c[j] = gf[j] * cPrev[j] + gi[j] * gc[j];
+                }
+            }
+
+            algorithmFPType *hs = h + s * statesStride + t * nOutputs;
+            Math<algorithmFPType, cpu>::vTanh(nOutputs, c, hs);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nOutputs; j++)
+            {
+                hs[j] *= go[j];
+            }
+        } );
+    }
+
+    if (isTraining)
+    {
+        WriteOnlySubtensor<algorithmFPType, cpu> hiddenBlock(*hiddenStatesTensor, 0, 0, 0, nSamples);
+        DAAL_CHECK_BLOCK_STATUS(hiddenBlock);
+        algorithmFPType *hiddenStates = hiddenBlock.get();
+        const size_t nStates = nRows * nOutputs;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nStates; i++)
+        {
+            hiddenStates[i] = h[i];
+        }
+    }
+    return Status();
+}
+
+} // internal
+} // forward
+} // lstm
+} // layers
+} // neural_networks
+} // algorithms
+} // daal
+
+#endif
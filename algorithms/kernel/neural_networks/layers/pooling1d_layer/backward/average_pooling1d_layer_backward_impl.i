@@ -51,6 +51,7 @@
 #include "service_memory.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 
 #include "pooling1d_layer_impl.i"
 
@@ -88,7 +89,6 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     algorithmFPType *grad = gradBlock.get();
 
     const algorithmFPType zero = 0.0;
-    daal::services::internal::service_memset<algorithmFPType, cpu>(grad, zero, gradBlock.getSize());
 
     pooling1d::internal::Parameter par(parameter.index .size[0], parameter.padding   .size[0],
                                        parameter.stride.size[0], parameter.kernelSize.size[0],
@@ -96,8 +96,16 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
 
     const algorithmFPType one = 1.0;
     const algorithmFPType gradMultiplier = one / (algorithmFPType)(par.kernelSize);
-    for (DAAL_INT i = 0; i < par.offsetBefore; i++)
+    daal::threader_for(par.offsetBefore, par.offsetBefore, [ & ](DAAL_INT i)
     {
+        algorithmFPType *gradSlice = grad + par.offsetAfter * par.firstSize * i;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < par.offsetAfter * par.firstSize; j++)
+        {
+            gradSlice[j] = zero;
+        }
+
         /*
          * Loop by the first kernel dimension
          * f - index of the left upper corner of the kernel
@@ -105,30 +113,28 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
          */
         for (DAAL_INT f = -par.padding, fo = 0; fo < par.firstOutSize; f += par.stride, fo++)
         {
-            for (DAAL_INT j = 0; j < par.offsetAfter; j++)
-            {
-                /*
-                 * Input value index
-                 */
-                const DAAL_INT inputIndex = j + par.offsetAfter * (fo + par.firstOutSize * i);
-                const algorithmFPType inputValue = gradMultiplier * inputGrad[inputIndex];
+            /*
+             * Input gradient values of all the indices after the pooled dimension
+             */
+            const algorithmFPType *inputRow = inputGrad + par.offsetAfter * (fo + par.firstOutSize * i);
 
-                /*
-                 * Loops over the kernel
-                 */
-                for (DAAL_INT fi = f; fi < f + par.kernelSize; fi++)
+            /*
+             * Loop over the part of the kernel inside the gradient
+             */
+            const DAAL_INT fBegin = (f < 0 ? 0 : f);
+            const DAAL_INT fEnd   = (f + par.kernelSize < par.firstSize ? f + par.kernelSize : par.firstSize);
+            for (DAAL_INT fi = fBegin; fi < fEnd; fi++)
+            {
+                algorithmFPType *gradRow = gradSlice + par.offsetAfter * fi;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (DAAL_INT j = 0; j < par.offsetAfter; j++)
                 {
-                    const DAAL_INT gradIndex = j + par.offsetAfter * (fi + par.firstSize * i);
-                    const bool paddingFlag = (fi < 0) || (fi >= par.firstSize);
-
-                    if (!paddingFlag)
-                    {
-                        grad[gradIndex] += inputValue;
-                    }
+                    gradRow[j] += gradMultiplier * inputRow[j];
                 }
             }
         }
-    }
+    } );
     return Status();
 }
 } // namespace internal
@@ -51,6 +51,7 @@
 #include "service_memory.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 #include "service_numeric_table.h"
 
 #include "pooling1d_layer_impl.i"
@@ -95,15 +96,20 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     DAAL_CHECK_BLOCK_STATUS(gradSubtensor);
     algorithmFPType *grad = gradSubtensor.get();
 
-    const size_t gradSize = gradTensor.getSize();
-    daal::services::internal::service_memset<algorithmFPType, cpu>(grad, zero, gradSize);
-
     pooling1d::internal::Parameter par(parameter.index .size[0], parameter.padding   .size[0],
                                        parameter.stride.size[0], parameter.kernelSize.size[0],
                                        gradTensor, gradDims, inputDims);
 
-    for (DAAL_INT i = 0; i < par.offsetBefore; i++)
+    daal::threader_for(par.offsetBefore, par.offsetBefore, [ & ](DAAL_INT i)
     {
+        algorithmFPType *gradSlice = grad + par.offsetAfter * par.firstSize * i;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < par.offsetAfter * par.firstSize; j++)
+        {
+            gradSlice[j] = zero;
+        }
+
         /*
          * Loop by the first kernel dimension
          * f - index of the left upper corner of the kernel
@@ -121,12 +127,11 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
                 const bool paddingFlag = (fi < 0) || (fi >= par.firstSize);
                 if (!paddingFlag && selectedPos[inputIndex] >= 0)
                 {
-                    DAAL_INT gradIndex = j + par.offsetAfter * (fi + par.firstSize * i);
-                    grad[gradIndex] += inputGrad[inputIndex];
+                    gradSlice[j + par.offsetAfter * fi] += inputGrad[inputIndex];
                 }
             }
         }
-    }
+    } );
     return Status();
 }
 
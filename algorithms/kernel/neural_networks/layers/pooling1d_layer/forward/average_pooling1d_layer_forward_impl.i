@@ -52,6 +52,7 @@
 #include "service_data_utils.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 
 #include "pooling1d_layer_impl.i"
 
@@ -95,7 +96,7 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
                                        dataTensor, dims, valueDims);
 
     const algorithmFPType divisor = 1.0 / (algorithmFPType)(par.kernelSize);
-    for (DAAL_INT i = 0; i < par.offsetBefore; i++)
+    daal::threader_for(par.offsetBefore, par.offsetBefore, [ & ](DAAL_INT i)
     {
         /*
          * Loop by the first kernel dimension
@@ -104,29 +105,39 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
          */
         for (DAAL_INT f = -par.padding, fo = 0; fo < par.firstOutSize; f += par.stride, fo++)
         {
+            /*
+             * Resulting values of all the indices after the pooled dimension
+             */
+            algorithmFPType *valueRow = value + par.offsetAfter * (fo + par.firstOutSize * i);
             for (DAAL_INT j = 0; j < par.offsetAfter; j++)
             {
-                /*
-                 * Resulting value index
-                 */
-                const DAAL_INT valueIndex = j + par.offsetAfter * (fo + par.firstOutSize * i);
-
-                algorithmFPType average = zero;
-                /*
-                 * Loop over the kernel
-                 */
-                for (DAAL_INT fi = f; fi < f + par.kernelSize; fi++)
-                {
-                    DAAL_INT dataIndex = j + par.offsetAfter * (fi + par.firstSize * i);
-                    bool paddingFlag = (fi < 0) || (fi >= par.firstSize);
-                    algorithmFPType dataValue = (paddingFlag ? zero : data[dataIndex]);
+                valueRow[j] = zero;
+            }
 
-                    average += dataValue;
+            /*
+             * Loop over the part of the kernel inside the data, padding values are zeros
+             */
+            const DAAL_INT fBegin = (f < 0 ? 0 : f);
+            const DAAL_INT fEnd   = (f + par.kernelSize < par.firstSize ? f + par.kernelSize : par.firstSize);
+            for (DAAL_INT fi = fBegin; fi < fEnd; fi++)
+            {
+                const algorithmFPType *dataRow = data + par.offsetAfter * (fi + par.firstSize * i);
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (DAAL_INT j = 0; j < par.offsetAfter; j++)
+                {
+                    valueRow[j] += dataRow[j];
                 }
-                value[valueIndex] = average * divisor;
+            }
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < par.offsetAfter; j++)
+            {
+                valueRow[j] *= divisor;
             }
         }
-    }
+    } );
     return Status();
 }
 
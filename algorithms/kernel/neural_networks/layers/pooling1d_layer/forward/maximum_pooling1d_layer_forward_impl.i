@@ -52,6 +52,7 @@
 #include "service_data_utils.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 #include "service_numeric_table.h"
 
 #include "pooling1d_layer_impl.i"
@@ -97,15 +98,14 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
         selectedPosSubtensor.set(*selectedPosTensor, 0, 0, 0, valueDims[0]);
         DAAL_CHECK_BLOCK_STATUS(selectedPosSubtensor);
         selectedPos = selectedPosSubtensor.get();
-        const size_t selectedPosSize = selectedPosTensor->getSize();
-        daal::services::internal::service_memset<int, cpu>(selectedPos, 0, selectedPosSize);
     }
 
     pooling1d::internal::Parameter par(parameter.index .size[0], parameter.padding   .size[0],
                                        parameter.stride.size[0], parameter.kernelSize.size[0],
                                        dataTensor, dims, valueDims);
 
-    for (DAAL_INT i = 0; i < par.offsetBefore; i++)
+    const algorithmFPType minValue = -(data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get());
+    daal::threader_for(par.offsetBefore, par.offsetBefore, [ & ](DAAL_INT i)
     {
         /*
          * Loop by the first kernel dimension
@@ -114,39 +114,64 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
          */
         for (DAAL_INT f = -par.padding, fo = 0; fo < par.firstOutSize; f += par.stride, fo++)
         {
+            /*
+             * Resulting values and their positions for all the indices after the pooled dimension
+             */
+            const DAAL_INT valueOffset = par.offsetAfter * (fo + par.firstOutSize * i);
+            algorithmFPType *valueRow = value + valueOffset;
+            int *selectedPosRow = (selectedPos ? selectedPos + valueOffset : nullptr);
             for (DAAL_INT j = 0; j < par.offsetAfter; j++)
             {
-                /*
-                 * Resulting value index
-                 */
-                const DAAL_INT valueIndex = j + par.offsetAfter * (fo + par.firstOutSize * i);
-
-                algorithmFPType max = -(data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get());
-                DAAL_INT maxIdx = -1;
-
-                /*
-                 * Loop over the kernel
-                 */
-                for (DAAL_INT fi = f; fi < f + par.kernelSize; fi++)
+                valueRow[j] = minValue;
+            }
+            if (selectedPosRow)
+            {
+                for (DAAL_INT j = 0; j < par.offsetAfter; j++)
                 {
-                    const DAAL_INT dataIndex = j + par.offsetAfter * (fi + par.firstSize * i);
-                    const bool paddingFlag = (fi < 0) || (fi >= par.firstSize);
-                    const algorithmFPType dataValue = (paddingFlag ? zero : data[dataIndex]);
+                    selectedPosRow[j] = -1;
+                }
+            }
 
-                    if (dataValue > max)
+            /*
+             * Loop over the kernel
+             */
+            for (DAAL_INT fi = f; fi < f + par.kernelSize; fi++)
+            {
+                const bool paddingFlag = (fi < 0) || (fi >= par.firstSize);
+                const algorithmFPType *dataRow = (paddingFlag ? nullptr : data + par.offsetAfter * (fi + par.firstSize * i));
+                const int pos = (int)(fi - f);
+
+                if (selectedPosRow)
+                {
+                    for (DAAL_INT j = 0; j < par.offsetAfter; j++)
                     {
-                        max = dataValue;
-                        maxIdx = fi - f;
+                        const algorithmFPType dataValue = (paddingFlag ? zero : dataRow[j]);
+                        if (dataValue > valueRow[j])
+                        {
+                            valueRow[j] = dataValue;
+                            selectedPosRow[j] = pos;
+                        }
                     }
                 }
-                value[valueIndex] = max;
-                if(selectedPos)
+                else if (paddingFlag)
                 {
-                    selectedPos[valueIndex] = maxIdx;
+                    for (DAAL_INT j = 0; j < par.offsetAfter; j++)
+                    {
+                        valueRow[j] = (zero > valueRow[j] ? zero : valueRow[j]);
+                    }
+                }
+                else
+                {
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (DAAL_INT j = 0; j < par.offsetAfter; j++)
+                    {
+                        valueRow[j] = (dataRow[j] > valueRow[j] ? dataRow[j] : valueRow[j]);
+                    }
                 }
             }
         }
-    }
+    } );
     return Status();
 }
 
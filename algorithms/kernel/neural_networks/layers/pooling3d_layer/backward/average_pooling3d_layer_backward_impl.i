@@ -52,6 +52,7 @@
 #include "service_memory.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 
 #include "pooling3d_layer_impl.i"
 
@@ -88,7 +89,6 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     algorithmFPType *grad = gradBlock.get();
 
     const algorithmFPType zero = 0.0;
-    daal::services::internal::service_memset<algorithmFPType, cpu>(grad, zero, gradBlock.getSize());
 
     pooling3d::internal::Parameter<cpu> par(parameter.indices.size, parameter.paddings   .size,
                                             parameter.strides.size, parameter.kernelSizes.size,
@@ -102,20 +102,35 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     }
     gradMultiplier = 1.0 / gradMultiplier;
 
-    DAAL_INT ii[nKernelDims + 1];    // index of the input data
-    DAAL_INT ik[nKernelDims];        // index of the kernel
-    DAAL_INT iv[nKernelDims];        // index of the value
-    DAAL_INT inputOffset[nKernelDims + 1];
-    DAAL_INT gradOffset[nKernelDims + 1];
+    /* Each value of the first offset owns a contiguous slice of the gradient */
+    const size_t gradSliceSize = gradTensor.getSize() / par.offset[0];
 
-    for (ii[0] = 0; ii[0] < par.offset[0]; ii[0]++)
+    daal::threader_for(par.offset[0], par.offset[0], [ & ](DAAL_INT i)
     {
+        DAAL_INT ii[nKernelDims + 1];    // index of the input data
+        DAAL_INT ik[nKernelDims];        // index of the kernel
+        DAAL_INT iv[nKernelDims];        // index of the value
+        DAAL_INT inputOffset[nKernelDims + 1];
+        DAAL_INT gradOffset[nKernelDims + 1];
+
+        algorithmFPType *gradSlice = grad + i * gradSliceSize;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < gradSliceSize; j++)
+        {
+            gradSlice[j] = zero;
+        }
+
+        ii[0] = i;
         inputOffset[0] = 0;
         gradOffset[0]  = 0;
 
+        /*
+         * Process the dimensions of input tensor recursively
+         */
         recurrentCompute(0, ii, ik, iv, par.padding, par.stride, par.kernelSize, par.dataSize, par.valueSize,
-            par.offset, gradOffset, inputOffset, inputGrad, grad, gradMultiplier);
-    }
+                         par.offset, gradOffset, inputOffset, inputGrad, grad, gradMultiplier);
+    } );
     return Status();
 }
 
@@ -151,32 +166,34 @@ void PoolingKernel<algorithmFPType, method, cpu>::recurrentCompute(size_t d,
         DAAL_INT inputIndex = ii[3] + inputOffset[3];
         algorithmFPType inputValue = gradMultiplier * inputGrad[inputIndex];
 
+        /*
+         * Range of the kernel inside the gradient
+         */
+        DAAL_INT iwkBegin[nKernelDims];
+        DAAL_INT iwkEnd[nKernelDims];
+        for (size_t i = 0; i < nKernelDims; i++)
+        {
+            iwkBegin[i] = (ik[i] < 0 ? -ik[i] : 0);
+            iwkEnd[i]   = (ik[i] + kernelSize[i] < gradSize[i] ? kernelSize[i] : gradSize[i] - ik[i]);
+        }
+
         DAAL_INT iwk[nKernelDims];              // index of the gradient within kernel
-        DAAL_INT iwkShifted[nKernelDims];
         DAAL_INT gradKernelOffset[nKernelDims];
-        bool paddingFlags[nKernelDims];
         /*
          * Loops over the kernel
          */
-        for (iwk[0] = 0, iwkShifted[0] = ik[0]; iwk[0] < kernelSize[0]; iwk[0]++, iwkShifted[0]++)
+        for (iwk[0] = iwkBegin[0]; iwk[0] < iwkEnd[0]; iwk[0]++)
         {
-            paddingFlags[0] = (iwkShifted[0] < 0) || (iwkShifted[0] >= gradSize[0]);
             gradKernelOffset[0] = offset[1] * iwk[0];
-            for (iwk[1] = 0, iwkShifted[1] = ik[1]; iwk[1] < kernelSize[1]; iwk[1]++, iwkShifted[1]++)
+            for (iwk[1] = iwkBegin[1]; iwk[1] < iwkEnd[1]; iwk[1]++)
             {
-                paddingFlags[1] = (iwkShifted[1] < 0) || (iwkShifted[1] >= gradSize[1]);
                 gradKernelOffset[1] = offset[2] * (iwk[1] + gradSize[1] * gradKernelOffset[0]);
-                for (iwk[2] = 0, iwkShifted[2] = ik[2]; iwk[2] < kernelSize[2]; iwk[2]++, iwkShifted[2]++)
+                algorithmFPType *gradRow = grad + ii[3] + gradOffset[3] + offset[3] * gradSize[2] * gradKernelOffset[1];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (iwk[2] = iwkBegin[2]; iwk[2] < iwkEnd[2]; iwk[2]++)
                 {
-                    paddingFlags[2] = (iwkShifted[2] < 0) || (iwkShifted[2] >= gradSize[2]);
-                    gradKernelOffset[2] = offset[3] * (iwk[2] + gradSize[2] * gradKernelOffset[1]);
-                    DAAL_INT gradIndex = ii[3] + gradOffset[3] + gradKernelOffset[2];
-                    bool paddingFlag = paddingFlags[0] || paddingFlags[1] || paddingFlags[2];
-
-                    if (!paddingFlag)
-                    {
-                        grad[gradIndex] += inputValue;
-                    }
+                    gradRow[offset[3] * iwk[2]] += inputValue;
                 }
             }
         }
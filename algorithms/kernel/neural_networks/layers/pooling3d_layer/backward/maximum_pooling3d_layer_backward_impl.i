@@ -52,6 +52,7 @@
 #include "service_memory.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 #include "service_numeric_table.h"
 
 #include "pooling3d_layer_impl.i"
@@ -96,27 +97,39 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     DAAL_CHECK_BLOCK_STATUS(gradSubtensor);
     algorithmFPType *grad = gradSubtensor.get();
 
-    const size_t gradientSize = gradTensor.getSize();
-    daal::services::internal::service_memset<algorithmFPType, cpu>(grad, zero, gradientSize);
-
     pooling3d::internal::Parameter<cpu> par(parameter.indices.size, parameter.paddings   .size,
                                             parameter.strides.size, parameter.kernelSizes.size,
                                             gradTensor, gradDims, inputDims);
 
-    DAAL_INT ii[nKernelDims + 1];    // index of the input data
-    DAAL_INT ik[nKernelDims];        // index of the kernel
-    DAAL_INT iv[nKernelDims];        // index of the value
-    DAAL_INT inputOffset[nKernelDims + 1];
-    DAAL_INT gradOffset[nKernelDims + 1];
+    /* Each value of the first offset owns a contiguous slice of the gradient */
+    const size_t gradSliceSize = gradTensor.getSize() / par.offset[0];
 
-    for (ii[0] = 0; ii[0] < par.offset[0]; ii[0]++)
+    daal::threader_for(par.offset[0], par.offset[0], [ & ](DAAL_INT i)
     {
+        DAAL_INT ii[nKernelDims + 1];    // index of the input data
+        DAAL_INT ik[nKernelDims];        // index of the kernel
+        DAAL_INT iv[nKernelDims];        // index of the value
+        DAAL_INT inputOffset[nKernelDims + 1];
+        DAAL_INT gradOffset[nKernelDims + 1];
+
+        algorithmFPType *gradSlice = grad + i * gradSliceSize;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < gradSliceSize; j++)
+        {
+            gradSlice[j] = zero;
+        }
+
+        ii[0] = i;
         inputOffset[0] = 0;
         gradOffset[0]  = 0;
 
+        /*
+         * Process the dimensions of input tensor recursively
+         */
         recurrentCompute(0, ii, ik, iv, par.padding, par.stride, par.kernelSize, par.dataSize, par.valueSize,
-            par.offset, gradOffset, inputOffset, inputGrad, grad, selectedPos);
-    }
+                         par.offset, gradOffset, inputOffset, inputGrad, grad, selectedPos);
+    } );
     return Status();
 }
 
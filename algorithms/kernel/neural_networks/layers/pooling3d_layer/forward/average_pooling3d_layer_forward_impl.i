@@ -53,6 +53,7 @@
 #include "service_data_utils.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 
 #include "pooling3d_layer_impl.i"
 
@@ -99,22 +100,24 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     }
     divisor = 1.0 / divisor;
 
-    DAAL_INT ii[nKernelDims + 1];    // index of the input data
-    DAAL_INT ik[nKernelDims];        // index of the kernel
-    DAAL_INT iv[nKernelDims];        // index of the value
-    DAAL_INT valueOffset[nKernelDims + 1];
-    DAAL_INT dataOffset[nKernelDims + 1];
-
-    for (ii[0] = 0; ii[0] < par.offset[0]; ii[0]++)
+    daal::threader_for(par.offset[0], par.offset[0], [ & ](DAAL_INT i)
     {
+        DAAL_INT ii[nKernelDims + 1];    // index of the input data
+        DAAL_INT ik[nKernelDims];        // index of the kernel
+        DAAL_INT iv[nKernelDims];        // index of the value
+        DAAL_INT valueOffset[nKernelDims + 1];
+        DAAL_INT dataOffset[nKernelDims + 1];
+
+        ii[0] = i;
         valueOffset[0] = 0;
         dataOffset[0]  = 0;
+
         /*
          * Process the dimensions of input tensor recursively
          */
         recurrentCompute(0, ii, ik, iv, par.padding, par.stride, par.kernelSize, par.dataSize, par.valueSize,
-            par.offset, dataOffset, valueOffset, data, value, divisor);
-    }
+                         par.offset, dataOffset, valueOffset, data, value, divisor);
+    } );
     return Status();
 }
 
@@ -153,31 +156,33 @@ void PoolingKernel<algorithmFPType, method, cpu>::recurrentCompute(size_t d,
 
         algorithmFPType average = zero;
 
+        /*
+         * Range of the kernel inside the data, padding values are zeros and do not contribute to the sum
+         */
+        DAAL_INT iwkBegin[nKernelDims];
+        DAAL_INT iwkEnd[nKernelDims];
+        for (size_t i = 0; i < nKernelDims; i++)
+        {
+            iwkBegin[i] = (ik[i] < 0 ? -ik[i] : 0);
+            iwkEnd[i]   = (ik[i] + kernelSize[i] < dataSize[i] ? kernelSize[i] : dataSize[i] - ik[i]);
+        }
+
         DAAL_INT iwk[nKernelDims];              // index of the value within kernel
-        DAAL_INT iwkShifted[nKernelDims];
         DAAL_INT dataKernelOffset[nKernelDims];
-        bool paddingFlags[nKernelDims];
         /*
          * Loops over the kernel
          */
-        for (iwk[0] = 0, iwkShifted[0] = ik[0]; iwk[0] < kernelSize[0]; iwk[0]++, iwkShifted[0]++)
+        for (iwk[0] = iwkBegin[0]; iwk[0] < iwkEnd[0]; iwk[0]++)
         {
-            paddingFlags[0] = (iwkShifted[0] < 0) || (iwkShifted[0] >= (DAAL_INT)dataSize[0]);
             dataKernelOffset[0] = offset[1] * iwk[0];
-            for (iwk[1] = 0, iwkShifted[1] = ik[1]; iwk[1] < kernelSize[1]; iwk[1]++, iwkShifted[1]++)
+            for (iwk[1] = iwkBegin[1]; iwk[1] < iwkEnd[1]; iwk[1]++)
             {
-                paddingFlags[1] = (iwkShifted[1] < 0) || (iwkShifted[1] >= (DAAL_INT)dataSize[1]);
                 dataKernelOffset[1] = offset[2] * (iwk[1] + dataSize[1] * dataKernelOffset[0]);
-                for (iwk[2] = 0, iwkShifted[2] = ik[2]; iwk[2] < kernelSize[2]; iwk[2]++, iwkShifted[2]++)
+                const algorithmFPType *dataRow = data + ii[3] + dataOffset[3] + offset[3] * dataSize[2] * dataKernelOffset[1];
+              PRAGMA_VECTOR_ALWAYS
+                for (iwk[2] = iwkBegin[2]; iwk[2] < iwkEnd[2]; iwk[2]++)
                 {
-                    paddingFlags[2] = (iwkShifted[2] < 0) || (iwkShifted[2] >= (DAAL_INT)dataSize[2]);
-                    dataKernelOffset[2] = offset[3] * (iwk[2] + dataSize[2] * dataKernelOffset[1]);
-                    DAAL_INT dataIndex = ii[3] + dataOffset[3] + dataKernelOffset[2];
-
-                    bool paddingFlag = paddingFlags[0] || paddingFlags[1] || paddingFlags[2];
-                    algorithmFPType dataValue = (paddingFlag ? zero : data[dataIndex]);
-
-                    average += dataValue;
+                    average += dataRow[offset[3] * iwk[2]];
                 }
             }
         }
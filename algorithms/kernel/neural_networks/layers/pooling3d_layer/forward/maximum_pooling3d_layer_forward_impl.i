@@ -52,6 +52,7 @@
 #include "service_data_utils.h"
 #include "service_blas.h"
 #include "service_tensor.h"
+#include "threading.h"
 #include "service_numeric_table.h"
 
 #include "pooling3d_layer_impl.i"
@@ -95,29 +96,32 @@ services::Status PoolingKernel<algorithmFPType, method, cpu>::compute(const Tens
     if(parameter.predictionStage == false)
     {
         selectedPosSubtensor.set(*selectedPosTensor, 0, 0, 0, valueDims[0]);
+        DAAL_CHECK_BLOCK_STATUS(selectedPosSubtensor);
         selectedPos = selectedPosSubtensor.get();
-        size_t selectedPosSize = selectedPosTensor->getSize();
-        daal::services::internal::service_memset<int, cpu>(selectedPos, 0, selectedPosSize);
     }
 
     pooling3d::internal::Parameter<cpu> par(parameter.indices.size, parameter.paddings   .size,
                                             parameter.strides.size, parameter.kernelSizes.size,
                                             dataTensor, dims, valueDims);
 
-    DAAL_INT ii[nKernelDims + 1];    // index of the input data
-    DAAL_INT ik[nKernelDims];        // index of the kernel
-    DAAL_INT iv[nKernelDims];        // index of the value
-    DAAL_INT valueOffset[nKernelDims + 1];
-    DAAL_INT dataOffset[nKernelDims + 1];
-
-    for (ii[0] = 0; ii[0] < par.offset[0]; ii[0]++)
+    daal::threader_for(par.offset[0], par.offset[0], [ & ](DAAL_INT i)
     {
+        DAAL_INT ii[nKernelDims + 1];    // index of the input data
+        DAAL_INT ik[nKernelDims];        // index of the kernel
+        DAAL_INT iv[nKernelDims];        // index of the value
+        DAAL_INT valueOffset[nKernelDims + 1];
+        DAAL_INT dataOffset[nKernelDims + 1];
+
+        ii[0] = i;
         valueOffset[0] = 0;
         dataOffset[0]  = 0;
 
+        /*
+         * Process the dimensions of input tensor recursively
+         */
         recurrentCompute(0, ii, ik, iv, par.padding, par.stride, par.kernelSize, par.dataSize, par.valueSize,
                          par.offset, dataOffset, valueOffset, data, value, selectedPos);
-    }
+    } );
     return Status();
 }
 
@@ -49,6 +49,7 @@
 #include "service_dnn_internal.h"
 #include "service_tensor.h"
 #include "service_numeric_table.h"
+#include "threading.h"
 
 #include "transposed_conv2d_layer.h"
 #include "transposed_conv2d_layer_types.h"
@@ -123,25 +124,21 @@ services::Status TransposedConv2dKernel<algorithmFPType, method, cpu>::compute(c
         const size_t batchSize = inGradTensor.getDimensionSize(0);
         const size_t nKernels = parameter.nKernels;
         const size_t channelSize = inGradTensor.getDimensionSize(2) * inGradTensor.getDimensionSize(3);
-        for(size_t j = 0; j < nKernels; j++)
+        const algorithmFPType invBatchSize = 1.0 / batchSize;
+        daal::threader_for(nKernels, nKernels, [ & ](size_t j)
         {
-            bDerArray[j] = 0;
-        }
-        for(size_t i = 0; i < batchSize; i++)
-        {
-            for(size_t j = 0; j < nKernels; j++)
+            algorithmFPType sum = 0;
+            for(size_t i = 0; i < batchSize; i++)
             {
+                const algorithmFPType *inGradChannel = inGradArray + (i * nKernels + j) * channelSize;
+              PRAGMA_VECTOR_ALWAYS
                 for(size_t k = 0; k < channelSize; k++)
                 {
-                    bDerArray[j] += inGradArray[i * nKernels * channelSize + j * channelSize + k];
+                    sum += inGradChannel[k];
                 }
             }
-        }
-        algorithmFPType invBatchSize = 1.0 / batchSize;
-        for(size_t j = 0; j < nKernels; j++)
-        {
-            bDerArray[j] *= invBatchSize;
-        }
+            bDerArray[j] = sum * invBatchSize;
+        } );
     }
 
     if(parameter.propagateGradient) // compute gradient w.r.t. data
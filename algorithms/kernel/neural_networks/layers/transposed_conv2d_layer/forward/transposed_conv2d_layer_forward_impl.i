@@ -47,6 +47,7 @@
 
 #include "service_tensor.h"
 #include "service_numeric_table.h"
+#include "threading.h"
 #include "convolution2d_layer_backward.h"
 #include "convolution2d_layer_backward_kernel.h"
 
@@ -106,16 +107,17 @@ services::Status TransposedConv2dKernel<algorithmFPType, method, cpu>::compute(c
     const size_t batchSize = resultTensor.getDimensionSize(0);
     const size_t nKernels = resultTensor.getDimensionSize(1);
     const size_t channelSize = resultTensor.getDimensionSize(2) * resultTensor.getDimensionSize(3);
-    for(size_t i = 0; i < batchSize; i++)
+    daal::threader_for(batchSize * nKernels, batchSize * nKernels, [ & ](size_t ij)
     {
-        for(size_t j = 0; j < nKernels; j++)
+        const algorithmFPType bias = bArray[ij % nKernels];
+        algorithmFPType *resultChannel = resultArray + ij * channelSize;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t k = 0; k < channelSize; k++)
         {
-            for(size_t k = 0; k < channelSize; k++)
-            {
-                resultArray[i * nKernels * channelSize + j * channelSize + k] += bArray[j];
-            }
+            resultChannel[k] += bias;
         }
-    }
+    } );
     return s;
 }
 
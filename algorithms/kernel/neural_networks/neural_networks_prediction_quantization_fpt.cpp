@@ -0,0 +1,264 @@
+/* file: neural_networks_prediction_quantization_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the int8 quantization of the neural network model for the prediction stage
+//--
+*/
+
+#include "neural_networks_prediction_quantization.h"
+#include "neural_networks_prediction.h"
+#include "neural_networks/layers/fullyconnected/fullyconnected_layer_types.h"
+#include "neural_networks/layers/convolution2d/convolution2d_layer_types.h"
+#include "homogen_tensor.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+/* Returns the int8 parameters and the number of output channels of the layers that support the int8 computations */
+static layers::QuantizationParameter *getQuantizationParameter(layers::Parameter *parameter, size_t &nChannels)
+{
+    layers::fullyconnected::Parameter *fullyconnectedParameter = dynamic_cast<layers::fullyconnected::Parameter *>(parameter);
+    if (fullyconnectedParameter)
+    {
+        nChannels = fullyconnectedParameter->nOutputs;
+        return &fullyconnectedParameter->quantization;
+    }
+    layers::convolution2d::Parameter *convolutionParameter = dynamic_cast<layers::convolution2d::Parameter *>(parameter);
+    if (convolutionParameter)
+    {
+        nChannels = convolutionParameter->nKernels;
+        return &convolutionParameter->quantization;
+    }
+    return NULL;
+}
+
+/* Computes the largest absolute value in each of nChannels equal consecutive parts of the tensor */
+template<typename algorithmFPType>
+services::Status computeMaxAbs(Tensor &tensor, size_t nChannels, algorithmFPType *maxAbs)
+{
+    services::Status s;
+    SubtensorDescriptor<algorithmFPType> block;
+    DAAL_CHECK_STATUS(s, tensor.getSubtensor(0, 0, 0, tensor.getDimensionSize(0), readOnly, block));
+    const algorithmFPType *array = block.getPtr();
+
+    const size_t channelSize = tensor.getSize() / nChannels;
+    for (size_t c = 0; c < nChannels; c++)
+    {
+        algorithmFPType value = 0;
+        for (size_t j = c * channelSize; j < (c + 1) * channelSize; j++)
+        {
+            const algorithmFPType absValue = (array[j] < 0 ? -array[j] : array[j]);
+            value = (absValue > value ? absValue : value);
+        }
+        maxAbs[c] = value;
+    }
+    return tensor.releaseSubtensor(block);
+}
+
+/* Returns the scale that maps [-maxAbs, maxAbs] onto the int8 range [-127, 127] */
+template<typename algorithmFPType>
+algorithmFPType computeScale(algorithmFPType maxAbs)
+{
+    return (maxAbs > 0 ? (algorithmFPType)127.0 / maxAbs : (algorithmFPType)1.0);
+}
+
+/* Quantizes the weights of the layer with a separate scale for each output channel */
+template<typename algorithmFPType>
+services::Status quantizeWeights(Tensor &weights, size_t nChannels, layers::QuantizationParameter &quantization)
+{
+    services::Status s;
+    DAAL_CHECK(nChannels && weights.getSize() % nChannels == 0, services::ErrorIncorrectSizeOfDimensionInTensor);
+
+    services::SharedPtr<HomogenTensor<DAAL_INT8> > weightsInt8 = HomogenTensor<DAAL_INT8>::create(weights.getDimensions(), Tensor::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    services::SharedPtr<HomogenTensor<algorithmFPType> > weightsScales =
+        HomogenTensor<algorithmFPType>::create(services::Collection<size_t>(1, &nChannels), Tensor::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    algorithmFPType *scales = weightsScales->getArray();
+    DAAL_CHECK_STATUS(s, computeMaxAbs<algorithmFPType>(weights, nChannels, scales));
+    for (size_t c = 0; c < nChannels; c++)
+    {
+        scales[c] = computeScale<algorithmFPType>(scales[c]);
+    }
+
+    SubtensorDescriptor<algorithmFPType> block;
+    DAAL_CHECK_STATUS(s, weights.getSubtensor(0, 0, 0, weights.getDimensionSize(0), readOnly, block));
+    const algorithmFPType *array = block.getPtr();
+    DAAL_INT8 *arrayInt8 = weightsInt8->getArray();
+
+    const size_t channelSize = weights.getSize() / nChannels;
+    for (size_t c = 0; c < nChannels; c++)
+    {
+        for (size_t j = c * channelSize; j < (c + 1) * channelSize; j++)
+        {
+            algorithmFPType value = array[j] * scales[c];
+            value = (value >  127 ?  127 : value);
+            value = (value < -127 ? -127 : value);
+            arrayInt8[j] = (DAAL_INT8)(int)(value < 0 ? value - 0.5 : value + 0.5);
+        }
+    }
+    DAAL_CHECK_STATUS(s, weights.releaseSubtensor(block));
+
+    quantization.weights = weightsInt8;
+    quantization.weightsScales = weightsScales;
+    return s;
+}
+
+/* Returns a copy of the floating-point tensor that does not share memory with the source */
+template<typename algorithmFPType>
+TensorPtr copyTensor(Tensor &src, services::Status &s)
+{
+    services::SharedPtr<HomogenTensor<algorithmFPType> > dst = HomogenTensor<algorithmFPType>::create(src.getDimensions(), Tensor::doAllocate, &s);
+    if (!s) { return TensorPtr(); }
+
+    SubtensorDescriptor<algorithmFPType> block;
+    s |= src.getSubtensor(0, 0, 0, src.getDimensionSize(0), readOnly, block);
+    if (!s) { return TensorPtr(); }
+    const algorithmFPType *srcArray = block.getPtr();
+    algorithmFPType *dstArray = dst->getArray();
+    const size_t size = src.getSize();
+    for (size_t i = 0; i < size; i++)
+    {
+        dstArray[i] = srcArray[i];
+    }
+    s |= src.releaseSubtensor(block);
+    return dst;
+}
+
+} // namespace internal
+
+namespace interface1
+{
+
+template<typename algorithmFPType>
+DAAL_EXPORT ModelPtr quantize(const ModelPtr &model, const data_management::TensorPtr &calibrationData, services::Status *stat)
+{
+    using namespace internal;
+    services::Status defaultStatus;
+    services::Status &s = (stat ? *stat : defaultStatus);
+    if (!model) { s.add(services::ErrorNullModel); return ModelPtr(); }
+    if (!calibrationData) { s.add(services::ErrorNullTensor); return ModelPtr(); }
+
+    ForwardLayersPtr forwardLayers = model->getLayers();
+    if (!(forwardLayers && forwardLayers->size() > 0)) { s.add(services::ErrorNullModel); return ModelPtr(); }
+    const size_t nLayers = forwardLayers->size();
+
+    /* Calibration observes the floating-point results of the layers of the source model */
+    Batch<algorithmFPType> net;
+    net.parameter.batchSize = calibrationData->getDimensionSize(0);
+    net.input.set(prediction::model, model);
+    net.input.set(prediction::data, calibrationData);
+    s |= net.computeNoThrow();
+    if (!s) { return ModelPtr(); }
+
+    /* The quantized model gets its own copies of the layers. The converted layers keep only the int8 weights,
+       the other weights and biases are copied out of the storage of the source model */
+    ForwardLayersPtr quantizedLayers(new ForwardLayers(nLayers));
+    if (!quantizedLayers) { s.add(services::ErrorMemoryAllocationFailed); return ModelPtr(); }
+    size_t nChannels = 0;
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        layers::forward::LayerIfacePtr layer = forwardLayers->get(i);
+        layers::forward::LayerIfacePtr quantizedLayer = layer->clone();
+        if (!quantizedLayer) { s.add(services::ErrorMemoryAllocationFailed); return ModelPtr(); }
+        (*quantizedLayers)[i] = quantizedLayer;
+
+        layers::forward::Input *layerInput = layer->getLayerInput();
+        layers::forward::Input *quantizedInput = quantizedLayer->getLayerInput();
+        TensorPtr layerWeights = layerInput->get(layers::forward::weights);
+        TensorPtr layerBiases  = layerInput->get(layers::forward::biases);
+
+        layers::QuantizationParameter *quantization = getQuantizationParameter(quantizedLayer->getLayerParameter(), nChannels);
+        if (quantization)
+        {
+            /* The input of the first layer refers to the calibration data only while the prediction runs */
+            TensorPtr layerData = (i == 0 ? calibrationData : layerInput->get(layers::forward::data));
+            if (!(layerData && layerWeights)) { s.add(services::ErrorNullTensor); return ModelPtr(); }
+
+            algorithmFPType dataMaxAbs = 0;
+            s |= computeMaxAbs<algorithmFPType>(*layerData, 1, &dataMaxAbs);
+            if (!s) { return ModelPtr(); }
+
+            layers::QuantizationParameter layerQuantization;
+            s |= quantizeWeights<algorithmFPType>(*layerWeights, nChannels, layerQuantization);
+            if (!s) { return ModelPtr(); }
+            layerQuantization.dataScale = computeScale<algorithmFPType>(dataMaxAbs);
+
+            *quantization = layerQuantization;
+            quantizedInput->set(layers::forward::weights, TensorPtr());
+        }
+        else
+        {
+            quantizedInput->set(layers::forward::weights, (layerWeights ? copyTensor<algorithmFPType>(*layerWeights, s) : TensorPtr()));
+        }
+        quantizedInput->set(layers::forward::biases, (layerBiases ? copyTensor<algorithmFPType>(*layerBiases, s) : TensorPtr()));
+        if (!s) { return ModelPtr(); }
+
+        quantizedLayer->getLayerParameter()->weightsAndBiasesInitialized = true;
+    }
+
+    services::SharedPtr<services::Collection<layers::NextLayers> > nextLayers(
+        new services::Collection<layers::NextLayers>(*model->getNextLayers()));
+    if (!nextLayers) { s.add(services::ErrorMemoryAllocationFailed); return ModelPtr(); }
+
+    return Model::create<algorithmFPType>(quantizedLayers, nextLayers, false, &s);
+}
+
+template DAAL_EXPORT ModelPtr quantize<DAAL_FPTYPE>(const ModelPtr &model, const data_management::TensorPtr &calibrationData,
+                                                    services::Status *stat);
+
+} // namespace interface1
+} // namespace prediction
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
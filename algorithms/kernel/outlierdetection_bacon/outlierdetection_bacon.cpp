@@ -80,6 +80,7 @@ services::Status Parameter::check() const
 
 Input::Input() : daal::algorithms::Input(1) {}
 Input::Input(const Input& other) : daal::algorithms::Input(other){}
+Input::Input(size_t nElements) : daal::algorithms::Input(nElements) {}
 
 /**
  * Returns input object for the multivariate outlier detection algorithm
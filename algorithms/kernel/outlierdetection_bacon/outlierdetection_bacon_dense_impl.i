@@ -52,7 +52,8 @@
 #include "outlier_detection_bacon_types.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_sort.h"
+#include "outlierdetection_bacon_impl.i"
 
 namespace daal
 {
@@ -70,43 +71,143 @@ using namespace daal::services;
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &resultTable, const Parameter &par)
 {
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
-
-    switch (par.initMethod)
-    {
-    case baconMedian:
-    default:
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK(nVectors > nFeatures, ErrorIncorrectNumberOfObservations);
+
+    const size_t nCandidates = (super::initSubsetFactor * nFeatures < nVectors ? super::initSubsetFactor * nFeatures : nVectors);
+
+    TArray<algorithmFPType, cpu> locationArray(nFeatures);
+    TArray<algorithmFPType, cpu> scatterArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> invScatterArray(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> candidatesArray(nCandidates);
+    BasicSubsetStatistics<algorithmFPType, cpu> stats(nFeatures);
+    DAAL_CHECK(locationArray.get() && scatterArray.get() && invScatterArray.get() && candidatesArray.get() && stats.isValid(),
+               ErrorMemoryAllocationFailed);
+
+    algorithmFPType *location   = locationArray.get();
+    algorithmFPType *scatter    = scatterArray.get();
+    algorithmFPType *invScatter = invScatterArray.get();
+    algorithmFPType *candidates = candidatesArray.get();
+
+    /* Compute distances to the initial location: the mean of the data set with Mahalanobis distance
+       or the coordinate-wise median with Euclidean distance. The distances are stored in the result table */
+    Status s;
+    if(par.initMethod == baconMahalanobis)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        {
+            ReadRows<algorithmFPType, cpu> firstRow(dataTable, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(firstRow);
+            for(size_t j = 0; j < nFeatures; j++)
+                location[j] = firstRow.get()[j];
+        }
+        DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, nullptr, location, nullptr, super::selectAll, 0, 0, nullptr, stats));
+        DAAL_CHECK_STATUS(s, super::computeInverseScatter(nFeatures, stats.nObservations, stats.crossProduct.get(), scatter, invScatter));
+        for(size_t j = 0; j < nFeatures; j++)
+            location[j] = stats.mean[j];
     }
-    case baconMahalanobis:
+    else
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
-    }
+        DAAL_CHECK_STATUS(s, computeMedian(dataTable, resultTable, location));
     }
-    baconParams[1] = (algorithmFPType)(par.alpha);
-    baconParams[2] = (algorithmFPType)(par.toleranceToConverge);
 
-    size_t nFeatures = dataTable.getNumberOfColumns();
-    size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, &resultTable, location,
+        (par.initMethod == baconMahalanobis ? invScatter : nullptr), super::selectByComputedDistance, -1,
+        nCandidates, candidates, stats));
+
+    /* The initial basic subset consists of nCandidates observations closest to the initial location */
+    algorithmFPType threshold = candidates[0];
+    DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, &resultTable, location, nullptr, super::selectByStoredDistance,
+                                                        threshold, 0, nullptr, stats));
+
+    for(size_t iter = 0; iter < maxIterations; iter++)
+    {
+        const size_t subsetSize = stats.nObservations;
+        DAAL_CHECK_STATUS(s, super::computeInverseScatter(nFeatures, subsetSize, stats.crossProduct.get(), scatter, invScatter));
+        for(size_t j = 0; j < nFeatures; j++)
+            location[j] = stats.mean[j];
+
+        threshold = super::computeThreshold(nVectors, nFeatures, subsetSize, par.alpha);
 
-    ReadRows<algorithmFPType, cpu> dataBlock(dataTable, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(dataBlock)
+        /* Compute Mahalanobis distances to the basic subset and the statistics of the next basic subset in one pass */
+        DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, &resultTable, location, invScatter, super::selectByComputedDistance,
+                                                            threshold, 0, nullptr, stats));
 
-    WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock)
+        if(super::isConverged(stats.nObservations, subsetSize, par.toleranceToConverge))
+            break;
+    }
+
+    return computeWeights(resultTable, threshold);
+}
 
-    const algorithmFPType *data = dataBlock.get();
-    algorithmFPType *weight = resultBlock.get();
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeMedian(NumericTable &dataTable, NumericTable &weightsTable,
+                                                                                     algorithmFPType *median)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t blockSize = super::blockSize;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
 
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+    WriteOnlyRows<algorithmFPType, cpu> bufferRows(weightsTable, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(bufferRows);
+    algorithmFPType *buffer = bufferRows.get();
 
+    const size_t half = nVectors / 2;
+    for(size_t j = 0; j < nFeatures; j++)
+    {
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+            ReadColumns<algorithmFPType, cpu> column(dataTable, j, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(column);
+            daal_memcpy_s(buffer + startRow, nRows * sizeof(algorithmFPType), column.get(), nRows * sizeof(algorithmFPType));
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        daal::algorithms::internal::nthElement<cpu>(buffer, buffer + half, buffer + nVectors);
+        median[j] = buffer[half];
+        if(!(nVectors % 2))
+        {
+            algorithmFPType lower = buffer[0];
+            for(size_t i = 1; i < half; i++)
+                lower = (buffer[i] > lower ? buffer[i] : lower);
+            median[j] = (median[j] + lower) * 0.5;
+        }
+    }
     return Status();
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeWeights(NumericTable &weightsTable, algorithmFPType threshold)
+{
+    const size_t nVectors  = weightsTable.getNumberOfRows();
+    const size_t blockSize = super::blockSize;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        WriteRows<algorithmFPType, cpu> weightRows(weightsTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(weightRows);
+        algorithmFPType *weight = weightRows.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nRows; i++)
+        {
+            weight[i] = (weight[i] <= threshold ? 1.0 : 0.0);
+        }
+    });
+    return safeStat.detach();
+}
+
 } // namespace internal
 
 } // namespace bacon_outlier_detection
@@ -0,0 +1,293 @@
+/* file: outlierdetection_bacon_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the BACON outlier detection in the distributed processing mode
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_DISTR_IMPL_I__
+#define __OUTLIERDETECTION_BACON_DISTR_IMPL_I__
+
+#include "numeric_table.h"
+#include "outlier_detection_bacon_types.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "outlierdetection_bacon_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::data_management;
+using namespace daal::services;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionDistributedStep1Kernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable,
+    NumericTable *locationTable, NumericTable *scatterTable, NumericTable *thresholdTable,
+    NumericTable **partialResult, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    TArray<algorithmFPType, cpu> locationArray(nFeatures);
+    BasicSubsetStatistics<algorithmFPType, cpu> stats(nFeatures);
+    DAAL_CHECK(locationArray.get() && stats.isValid(), ErrorMemoryAllocationFailed);
+    algorithmFPType *location = locationArray.get();
+
+    Status s;
+    if(!locationTable)
+    {
+        /* First iteration: all observations form the basic subset */
+        ReadRows<algorithmFPType, cpu> firstRow(dataTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(firstRow);
+        for(size_t j = 0; j < nFeatures; j++)
+            location[j] = firstRow.get()[j];
+
+        DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, nullptr, location, nullptr, super::selectAll, 0, 0, nullptr, stats));
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> locationRows(*locationTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(locationRows);
+        ReadRows<algorithmFPType, cpu> scatterRows(*scatterTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(scatterRows);
+        ReadRows<algorithmFPType, cpu> thresholdRows(*thresholdTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(thresholdRows);
+
+        for(size_t j = 0; j < nFeatures; j++)
+            location[j] = locationRows.get()[j];
+
+        TArray<algorithmFPType, cpu> invScatterArray(nFeatures * nFeatures);
+        DAAL_CHECK_MALLOC(invScatterArray.get());
+        algorithmFPType *invScatter = invScatterArray.get();
+        const algorithmFPType *scatter = scatterRows.get();
+        for(size_t j = 0; j < nFeatures * nFeatures; j++)
+            invScatter[j] = scatter[j];
+
+        DAAL_INT dim = (DAAL_INT)nFeatures;
+        char uplo = 'U';
+        DAAL_INT info;
+        Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, invScatter, &dim, &info);
+        DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+        Lapack<algorithmFPType, cpu>::xpotri(&uplo, &dim, invScatter, &dim, &info);
+        DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+
+        DAAL_CHECK_STATUS(s, super::computeSubsetStatistics(dataTable, nullptr, location, invScatter, super::selectByComputedDistance,
+                                                            thresholdRows.get()[0], 0, nullptr, stats));
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> nObservationsRows(*partialResult[0], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsRows);
+    WriteOnlyRows<algorithmFPType, cpu> nSubsetRows(*partialResult[1], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nSubsetRows);
+    WriteOnlyRows<algorithmFPType, cpu> sumRows(*partialResult[2], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumRows);
+    WriteOnlyRows<algorithmFPType, cpu> crossProductRows(*partialResult[3], 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(crossProductRows);
+
+    nObservationsRows.get()[0] = (algorithmFPType)nVectors;
+    nSubsetRows.get()[0]       = (algorithmFPType)stats.nObservations;
+
+    algorithmFPType *sum = sumRows.get();
+    for(size_t j = 0; j < nFeatures; j++)
+        sum[j] = stats.mean[j] * (algorithmFPType)stats.nObservations;
+
+    algorithmFPType *crossProduct = crossProductRows.get();
+    for(size_t j = 0; j < nFeatures * nFeatures; j++)
+        crossProduct[j] = stats.crossProduct[j];
+
+    return Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(size_t nPartialResults,
+    NumericTable **partialResults, NumericTable **partialResult, const Parameter &par)
+{
+    const size_t nFeatures = partialResult[2]->getNumberOfColumns();
+
+    WriteOnlyRows<algorithmFPType, cpu> nObservationsRows(*partialResult[0], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsRows);
+    WriteOnlyRows<algorithmFPType, cpu> nSubsetRows(*partialResult[1], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nSubsetRows);
+    WriteOnlyRows<algorithmFPType, cpu> sumRows(*partialResult[2], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumRows);
+    WriteOnlyRows<algorithmFPType, cpu> crossProductRows(*partialResult[3], 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(crossProductRows);
+
+    TArray<algorithmFPType, cpu> meanArray(nFeatures);
+    DAAL_CHECK_MALLOC(meanArray.get());
+    algorithmFPType *mean = meanArray.get();
+    algorithmFPType *crossProduct = crossProductRows.get();
+    for(size_t j = 0; j < nFeatures; j++)
+        mean[j] = 0;
+    for(size_t j = 0; j < nFeatures * nFeatures; j++)
+        crossProduct[j] = 0;
+
+    /* Merge means and centered cross-products of the basic subsets of local nodes */
+    algorithmFPType nObservations = 0;
+    algorithmFPType nSubset = 0;
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        ReadRows<algorithmFPType, cpu> inNObservationsRows(*partialResults[4 * i + 0], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(inNObservationsRows);
+        ReadRows<algorithmFPType, cpu> inNSubsetRows(*partialResults[4 * i + 1], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(inNSubsetRows);
+        nObservations += inNObservationsRows.get()[0];
+
+        const algorithmFPType nLocal = inNSubsetRows.get()[0];
+        if(nLocal <= 0)
+            continue;
+
+        ReadRows<algorithmFPType, cpu> inSumRows(*partialResults[4 * i + 2], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(inSumRows);
+        ReadRows<algorithmFPType, cpu> inCrossProductRows(*partialResults[4 * i + 3], 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(inCrossProductRows);
+        const algorithmFPType *inSum = inSumRows.get();
+        const algorithmFPType *inCrossProduct = inCrossProductRows.get();
+
+        const algorithmFPType nTotal = nSubset + nLocal;
+        const algorithmFPType coeff = nSubset * nLocal / nTotal;
+        const algorithmFPType invNLocal = 1.0 / nLocal;
+        for(size_t k = 0; k < nFeatures; k++)
+        {
+            const algorithmFPType deltaK = inSum[k] * invNLocal - mean[k];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType deltaJ = inSum[j] * invNLocal - mean[j];
+                crossProduct[k * nFeatures + j] += inCrossProduct[k * nFeatures + j] + coeff * deltaK * deltaJ;
+            }
+        }
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] += (inSum[j] * invNLocal - mean[j]) * nLocal / nTotal;
+        }
+        nSubset = nTotal;
+    }
+
+    nObservationsRows.get()[0] = nObservations;
+    nSubsetRows.get()[0]       = nSubset;
+    algorithmFPType *sum = sumRows.get();
+    for(size_t j = 0; j < nFeatures; j++)
+        sum[j] = mean[j] * nSubset;
+
+    return Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionDistributedStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable **partialResult,
+    NumericTable **result, const Parameter &par)
+{
+    const size_t nFeatures = partialResult[2]->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> nObservationsRows(*partialResult[0], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsRows);
+    ReadRows<algorithmFPType, cpu> nSubsetRows(*partialResult[1], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nSubsetRows);
+    ReadRows<algorithmFPType, cpu> sumRows(*partialResult[2], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumRows);
+    ReadRows<algorithmFPType, cpu> crossProductRows(*partialResult[3], 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(crossProductRows);
+
+    WriteOnlyRows<algorithmFPType, cpu> locationRows(*result[0], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(locationRows);
+    WriteOnlyRows<algorithmFPType, cpu> scatterRows(*result[1], 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(scatterRows);
+    WriteOnlyRows<algorithmFPType, cpu> thresholdRows(*result[2], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(thresholdRows);
+    WriteRows<algorithmFPType, cpu> subsetSizeRows(*result[3], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(subsetSizeRows);
+    WriteOnlyRows<algorithmFPType, cpu> convergedRows(*result[4], 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(convergedRows);
+
+    const size_t nVectors   = (size_t)nObservationsRows.get()[0];
+    const size_t subsetSize = (size_t)nSubsetRows.get()[0];
+    DAAL_CHECK(nVectors > nFeatures, ErrorIncorrectNumberOfObservations);
+
+    TArray<algorithmFPType, cpu> invScatterArray(nFeatures * nFeatures);
+    DAAL_CHECK_MALLOC(invScatterArray.get());
+
+    /* Check that the scatter matrix of the basic subset is positive definite before it is sent to local nodes */
+    Status s;
+    DAAL_CHECK_STATUS(s, super::computeInverseScatter(nFeatures, subsetSize, crossProductRows.get(), scatterRows.get(), invScatterArray.get()));
+
+    const algorithmFPType *sum = sumRows.get();
+    algorithmFPType *location = locationRows.get();
+    const algorithmFPType invN = 1.0 / (algorithmFPType)subsetSize;
+    for(size_t j = 0; j < nFeatures; j++)
+        location[j] = sum[j] * invN;
+
+    /* The size of the basic subset is zero before the first iteration */
+    const size_t prevSubsetSize = (size_t)subsetSizeRows.get()[0];
+    if(!prevSubsetSize)
+    {
+        /* The initial basic subset consists of about a half of observations closest to the mean of the data set */
+        thresholdRows.get()[0] = Math<algorithmFPType, cpu>::sSqrt(super::chiSquaredQuantile(nFeatures, 0.5));
+        convergedRows.get()[0] = 0;
+    }
+    else
+    {
+        thresholdRows.get()[0] = super::computeThreshold(nVectors, nFeatures, subsetSize, par.alpha);
+        convergedRows.get()[0] = (super::isConverged(subsetSize, prevSubsetSize, par.toleranceToConverge) ? 1 : 0);
+    }
+    subsetSizeRows.get()[0] = (algorithmFPType)subsetSize;
+
+    return Status();
+}
+
+} // namespace internal
+
+} // namespace bacon_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
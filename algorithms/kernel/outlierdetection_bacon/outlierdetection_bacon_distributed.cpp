@@ -0,0 +1,310 @@
+/* file: outlierdetection_bacon_distributed.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the BACON outlier detection classes
+//  for the distributed processing mode
+//--
+*/
+
+#include "outlier_detection_bacon_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_OUTLIER_DETECTION_BACON_PARTIAL_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedResult, SERIALIZATION_OUTLIER_DETECTION_BACON_DISTRIBUTED_RESULT_ID);
+
+DistributedInput<step1Local>::DistributedInput() : Input(lastLocalInputId + 1) {}
+DistributedInput<step1Local>::DistributedInput(const DistributedInput<step1Local>& other) : Input(other) {}
+
+/**
+ * Returns input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr DistributedInput<step1Local>::get(LocalInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void DistributedInput<step1Local>::set(LocalInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks input objects for the BACON outlier detection algorithm in the first step of the distributed processing mode
+ * \param[in] par     Algorithm parameters
+ * \param[in] method  Computation method for the algorithm
+ */
+services::Status DistributedInput<step1Local>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr()));
+
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    NumericTablePtr locationTable  = get(inputLocation);
+    NumericTablePtr scatterTable   = get(inputScatter);
+    NumericTablePtr thresholdTable = get(inputThreshold);
+
+    if(!locationTable && !scatterTable && !thresholdTable)
+        return s;
+    DAAL_CHECK(locationTable && scatterTable && thresholdTable, ErrorIncorrectOptionalInput);
+
+    const int unexpectedLayouts = (int)packed_mask;
+    DAAL_CHECK_STATUS(s, checkNumericTable(locationTable.get(), locationStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(scatterTable.get(), scatterStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(thresholdTable.get(), thresholdStr(), unexpectedLayouts, 0, 1, 1));
+    return s;
+}
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns partial result of the BACON outlier detection algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets partial result of the BACON outlier detection algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features in the input data set
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    NumericTablePtr sumTable = get(partialSum);
+    return (sumTable ? sumTable->getNumberOfColumns() : 0);
+}
+
+/**
+ * Checks partial results of the BACON outlier detection algorithm
+ * \param[in] input   Pointer to %Input objects of the algorithm
+ * \param[in] par     Pointer to the parameters of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const DistributedInput<step1Local> *algInput = dynamic_cast<const DistributedInput<step1Local> *>(input);
+    if(algInput)
+    {
+        const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        const int unexpectedLayouts = (int)packed_mask;
+        services::Status s;
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSum).get(), partialSumStr(), unexpectedLayouts, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCrossProduct).get(), partialCrossProductStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    }
+    return check(par, method);
+}
+
+/**
+ * Checks partial results of the BACON outlier detection algorithm
+ * \param[in] par     Pointer to the parameters of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nBasicSubsetObservations).get(), nBasicSubsetObservationsStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSum).get(), partialSumStr(), unexpectedLayouts, 0, 0, 1));
+
+    const size_t nFeatures = get(partialSum)->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCrossProduct).get(), partialCrossProductStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    return s;
+}
+
+DistributedInput<step2Master>::DistributedInput() : daal::algorithms::Input(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master>& other) : daal::algorithms::Input(other) {}
+
+/**
+ * Returns input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(ptr));
+}
+
+/**
+ * Adds partial result computed on a local node to the input of the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ * \param[in] id             Identifier of the %input object
+ * \param[in] partialResult  Partial result computed on a local node
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(partialResult);
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features in the input data set
+ */
+size_t DistributedInput<step2Master>::getNumberOfFeatures() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if(!collection || collection->size() == 0)
+        return 0;
+    PartialResultPtr pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[0]);
+    return (pres ? pres->getNumberOfFeatures() : 0);
+}
+
+/**
+ * Checks input objects for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ * \param[in] par     Algorithm parameters
+ * \param[in] method  Computation method for the algorithm
+ */
+services::Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    const size_t nFeatures = getNumberOfFeatures();
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[i]);
+        DAAL_CHECK(pres, ErrorIncorrectElementInPartialResultCollection);
+
+        DAAL_CHECK_STATUS(s, pres->check(par, method));
+        DAAL_CHECK_STATUS(s, checkNumericTable(pres->get(partialSum).get(), partialSumStr(), unexpectedLayouts, 0, nFeatures, 1));
+    }
+    return s;
+}
+
+DistributedResult::DistributedResult() : daal::algorithms::Result(lastDistributedResultId + 1) {}
+
+/**
+ * Returns result of the BACON outlier detection algorithm
+ * \param[in] id   Identifier of the result
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr DistributedResult::get(DistributedResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the BACON outlier detection algorithm
+ * \param[in] id    Identifier of the result
+ * \param[in] ptr   Pointer to the result
+ */
+void DistributedResult::set(DistributedResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the result object of the BACON outlier detection algorithm
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] par           Pointer to the parameters of the algorithm
+ * \param[in] method        Computation method
+ */
+services::Status DistributedResult::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    const size_t nFeatures = pres->getNumberOfFeatures();
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(location).get(), locationStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(scatter).get(), scatterStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(threshold).get(), thresholdStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(basicSubsetSize).get(), basicSubsetSizeStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(converged).get(), convergedStr(), unexpectedLayouts, 0, 1, 1));
+    return s;
+}
+
+} // namespace interface1
+} // namespace bacon_outlier_detection
+} // namespace algorithms
+} // namespace daal
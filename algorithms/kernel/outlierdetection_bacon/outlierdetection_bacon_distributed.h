@@ -0,0 +1,112 @@
+/* file: outlierdetection_bacon_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the BACON outlier detection partial and distributed results
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_DISTRIBUTED_H__
+#define __OUTLIERDETECTION_BACON_DISTRIBUTED_H__
+
+#include "outlier_detection_bacon_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory to store partial results of the BACON outlier detection algorithm
+ * \tparam algorithmFPType  Data type to use for storing results, double or float
+ * \param[in] input         Pointer to %Input objects of the algorithm
+ * \param[in] parameter     Pointer to the parameters of the algorithm
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const DistributedInput<step1Local> *localInput = dynamic_cast<const DistributedInput<step1Local> *>(input);
+    const size_t nFeatures = localInput ? localInput->get(data)->getNumberOfColumns() :
+                             static_cast<const DistributedInput<step2Master> *>(input)->getNumberOfFeatures();
+
+    services::Status s;
+    set(nObservations,            HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+    set(nBasicSubsetObservations, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+    set(partialSum,               HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialCrossProduct,      HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store the results of the BACON outlier detection algorithm in the distributed processing mode
+ * \tparam algorithmFPType  Data type to use for storing results, double or float
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] parameter     Pointer to the parameters of the algorithm
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status DistributedResult::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const size_t nFeatures = static_cast<const PartialResult *>(partialResult)->getNumberOfFeatures();
+
+    services::Status s;
+    set(location,        HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(scatter,         HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+    set(threshold,       HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+    set(basicSubsetSize, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, (algorithmFPType)0, &s));
+    set(converged,       HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, (algorithmFPType)0, &s));
+    return s;
+}
+
+} // namespace interface1
+} // namespace bacon_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,189 @@
+/* file: outlierdetection_bacon_distributed_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the BACON outlier detection algorithm container
+//  for the distributed processing mode.
+//--
+*/
+
+#include "outlier_detection_bacon_distributed.h"
+#include "outlierdetection_bacon_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace interface1
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionDistributedStep1Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step1Local> *input = static_cast<DistributedInput<step1Local> *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable &data = *(input->get(InputId::data));
+    NumericTable *location  = input->get(inputLocation).get();
+    NumericTable *scatter   = input->get(inputScatter).get();
+    NumericTable *threshold = input->get(inputThreshold).get();
+
+    NumericTable *r[lastPartialResultId + 1] =
+    {
+        pres->get(nObservations).get(),
+        pres->get(nBasicSubsetObservations).get(),
+        pres->get(partialSum).get(),
+        pres->get(partialCrossProduct).get()
+    };
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionDistributedStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       data, location, scatter, threshold, r, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionDistributedStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    data_management::DataCollection *collection = input->get(partialResults).get();
+    const size_t nPartialResults = collection->size();
+
+    const size_t nTables = lastPartialResultId + 1;
+    TArray<NumericTable *, cpu> aPtr(nPartialResults * nTables);
+    NumericTable **a = aPtr.get();
+    DAAL_CHECK_MALLOC(a);
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        PartialResult *inPres = static_cast<PartialResult *>((*collection)[i].get());
+        a[i * nTables + 0] = inPres->get(nObservations).get();
+        a[i * nTables + 1] = inPres->get(nBasicSubsetObservations).get();
+        a[i * nTables + 2] = inPres->get(partialSum).get();
+        a[i * nTables + 3] = inPres->get(partialCrossProduct).get();
+    }
+
+    NumericTable *r[nTables] =
+    {
+        pres->get(nObservations).get(),
+        pres->get(nBasicSubsetObservations).get(),
+        pres->get(partialSum).get(),
+        pres->get(partialCrossProduct).get()
+    };
+
+    daal::services::Environment::env &env = *_env;
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::OutlierDetectionDistributedStep2Kernel,
+                                                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, nPartialResults, a, r, *par);
+    collection->clear();
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *pres = static_cast<PartialResult *>(_pres);
+    DistributedResult *result = static_cast<DistributedResult *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *a[lastPartialResultId + 1] =
+    {
+        pres->get(nObservations).get(),
+        pres->get(nBasicSubsetObservations).get(),
+        pres->get(partialSum).get(),
+        pres->get(partialCrossProduct).get()
+    };
+
+    NumericTable *r[lastDistributedResultId + 1] =
+    {
+        result->get(location).get(),
+        result->get(scatter).get(),
+        result->get(threshold).get(),
+        result->get(basicSubsetSize).get(),
+        result->get(converged).get()
+    };
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       a, r, *par);
+}
+
+} // namespace interface1
+
+} // namespace bacon_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,414 @@
+/* file: outlierdetection_bacon_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the BACON outlier detection algorithm
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_BACON_IMPL_I__
+#define __OUTLIERDETECTION_BACON_IMPL_I__
+
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_heap.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "outlierdetection_bacon_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bacon_outlier_detection
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+/* Thread-local accumulator of the statistics of the basic subset.
+   Observations are shifted by the location to avoid the loss of precision on large data sets */
+template <typename algorithmFPType, CpuType cpu>
+struct BaconTlsData
+{
+    DAAL_NEW_DELETE();
+    size_t nObservations;
+    algorithmFPType *sum;           /* Sum of the shifted observations */
+    algorithmFPType *crossProduct;  /* Cross-product of the shifted observations, upper triangle in column-major order */
+    algorithmFPType *centered;      /* Shifted observations of the current block */
+    algorithmFPType *product;       /* Shifted observations of the current block multiplied by the inverse scatter matrix */
+    algorithmFPType *distance;      /* Distances of the observations of the current block */
+    algorithmFPType *candidates;    /* Max-heap of the smallest distances */
+    size_t nCandidates;
+
+    BaconTlsData(size_t nFeatures, size_t blockSize, size_t maxCandidates) :
+        nObservations(0), sum(nullptr), crossProduct(nullptr), centered(nullptr), product(nullptr), distance(nullptr),
+        candidates(nullptr), nCandidates(0)
+    {
+        sum          = service_scalable_calloc<algorithmFPType, cpu>(nFeatures);
+        crossProduct = service_scalable_calloc<algorithmFPType, cpu>(nFeatures * nFeatures);
+        centered     = service_scalable_malloc<algorithmFPType, cpu>(nFeatures * blockSize);
+        product      = service_scalable_malloc<algorithmFPType, cpu>(nFeatures * blockSize);
+        distance     = service_scalable_malloc<algorithmFPType, cpu>(blockSize);
+        if(maxCandidates)
+            candidates = service_scalable_malloc<algorithmFPType, cpu>(maxCandidates);
+    }
+
+    bool isValid(size_t maxCandidates) const
+    {
+        return sum && crossProduct && centered && product && distance && (candidates || !maxCandidates);
+    }
+
+    ~BaconTlsData()
+    {
+        service_scalable_free<algorithmFPType, cpu>(sum);
+        service_scalable_free<algorithmFPType, cpu>(crossProduct);
+        service_scalable_free<algorithmFPType, cpu>(centered);
+        service_scalable_free<algorithmFPType, cpu>(product);
+        service_scalable_free<algorithmFPType, cpu>(distance);
+        if(candidates)
+            service_scalable_free<algorithmFPType, cpu>(candidates);
+    }
+};
+
+/* Adds the value to the max-heap of at most maxCandidates smallest values */
+template <typename algorithmFPType, CpuType cpu>
+DAAL_FORCEINLINE void pushCandidate(algorithmFPType value, algorithmFPType *candidates, size_t &nCandidates, size_t maxCandidates)
+{
+    if(nCandidates < maxCandidates)
+    {
+        candidates[nCandidates++] = value;
+        daal::algorithms::internal::pushMaxHeap<cpu>(candidates, candidates + nCandidates);
+    }
+    else if(value < candidates[0])
+    {
+        daal::algorithms::internal::popMaxHeap<cpu>(candidates, candidates + nCandidates);
+        candidates[nCandidates - 1] = value;
+        daal::algorithms::internal::pushMaxHeap<cpu>(candidates, candidates + nCandidates);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status OutlierDetectionKernelBase<algorithmFPType, cpu>::computeSubsetStatistics(
+    NumericTable &dataTable, NumericTable *distanceTable,
+    const algorithmFPType *location, const algorithmFPType *invScatter,
+    SubsetSelection selection, algorithmFPType threshold,
+    size_t nCandidates, algorithmFPType *candidates,
+    BasicSubsetStatistics<algorithmFPType, cpu> &stats)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::tls<BaconTlsData<algorithmFPType, cpu> *> tlsData([=, &safeStat]()
+    {
+        auto ptr = new BaconTlsData<algorithmFPType, cpu>(nFeatures, blockSize, nCandidates);
+        if(!ptr || !ptr->isValid(nCandidates))
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        BaconTlsData<algorithmFPType, cpu> *local = tlsData.local();
+        if(!local)
+            return;
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType *data = dataRows.get();
+
+        algorithmFPType *centered = local->centered;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                centered[i * nFeatures + j] = data[i * nFeatures + j] - location[j];
+            }
+        }
+
+        const algorithmFPType *distance = nullptr;
+        ReadRows<algorithmFPType, cpu> storedDistanceRows;
+        if(selection == selectByStoredDistance)
+        {
+            distance = storedDistanceRows.set(distanceTable, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(storedDistanceRows);
+        }
+        else if(selection == selectByComputedDistance)
+        {
+            algorithmFPType *d = local->distance;
+            if(invScatter)
+            {
+                DAAL_INT dim = (DAAL_INT)nFeatures;
+                DAAL_INT n   = (DAAL_INT)nRows;
+                char side = 'L';
+                char uplo = 'U';
+                algorithmFPType one  = 1.0;
+                algorithmFPType zero = 0.0;
+                Blas<algorithmFPType, cpu>::xxsymm(&side, &uplo, &dim, &n, &one, const_cast<algorithmFPType *>(invScatter), &dim,
+                                                   centered, &dim, &zero, local->product, &dim);
+                const algorithmFPType *product = local->product;
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    algorithmFPType sum = 0.0;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for(size_t j = 0; j < nFeatures; j++)
+                    {
+                        sum += centered[i * nFeatures + j] * product[i * nFeatures + j];
+                    }
+                    d[i] = (sum > 0 ? sum : 0);
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    algorithmFPType sum = 0.0;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for(size_t j = 0; j < nFeatures; j++)
+                    {
+                        sum += centered[i * nFeatures + j] * centered[i * nFeatures + j];
+                    }
+                    d[i] = sum;
+                }
+            }
+            Math<algorithmFPType, cpu>::vSqrt(nRows, d, d);
+
+            if(distanceTable)
+            {
+                WriteOnlyRows<algorithmFPType, cpu> distanceRows(distanceTable, startRow, nRows);
+                DAAL_CHECK_BLOCK_STATUS_THR(distanceRows);
+                daal_memcpy_s(distanceRows.get(), nRows * sizeof(algorithmFPType), d, nRows * sizeof(algorithmFPType));
+            }
+            if(nCandidates)
+            {
+                for(size_t i = 0; i < nRows; i++)
+                {
+                    pushCandidate<algorithmFPType, cpu>(d[i], local->candidates, local->nCandidates, nCandidates);
+                }
+            }
+            distance = d;
+        }
+
+        /* Move the observations of the basic subset to the beginning of the block */
+        size_t nSelected = nRows;
+        if(selection != selectAll)
+        {
+            nSelected = 0;
+            for(size_t i = 0; i < nRows; i++)
+            {
+                if(distance[i] <= threshold)
+                {
+                    if(nSelected != i)
+                    {
+                        for(size_t j = 0; j < nFeatures; j++)
+                        {
+                            centered[nSelected * nFeatures + j] = centered[i * nFeatures + j];
+                        }
+                    }
+                    nSelected++;
+                }
+            }
+        }
+        if(!nSelected)
+            return;
+
+        local->nObservations += nSelected;
+        algorithmFPType *sum = local->sum;
+        for(size_t i = 0; i < nSelected; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                sum[j] += centered[i * nFeatures + j];
+            }
+        }
+
+        DAAL_INT dim = (DAAL_INT)nFeatures;
+        DAAL_INT n   = (DAAL_INT)nSelected;
+        char uplo  = 'U';
+        char trans = 'N';
+        algorithmFPType one = 1.0;
+        Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &n, &one, centered, &dim, &one, local->crossProduct, &dim);
+    });
+
+    algorithmFPType *shiftedSum = stats.mean.get();
+    algorithmFPType *crossProduct = stats.crossProduct.get();
+    for(size_t j = 0; j < nFeatures; j++)
+        shiftedSum[j] = 0;
+    for(size_t j = 0; j < nFeatures * nFeatures; j++)
+        crossProduct[j] = 0;
+    stats.nObservations = 0;
+    size_t nCandidatesTotal = 0;
+
+    tlsData.reduce([&](BaconTlsData<algorithmFPType, cpu> *local)
+    {
+        if(!local)
+            return;
+        stats.nObservations += local->nObservations;
+        for(size_t j = 0; j < nFeatures; j++)
+            shiftedSum[j] += local->sum[j];
+        for(size_t j = 0; j < nFeatures * nFeatures; j++)
+            crossProduct[j] += local->crossProduct[j];
+        for(size_t i = 0; i < local->nCandidates; i++)
+            pushCandidate<algorithmFPType, cpu>(local->candidates[i], candidates, nCandidatesTotal, nCandidates);
+        delete local;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Symmetrize the cross-product and move it and the sum from the location to the mean of the basic subset */
+    for(size_t i = 0; i < nFeatures; i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            crossProduct[j * nFeatures + i] = crossProduct[i * nFeatures + j];
+        }
+    }
+    if(stats.nObservations)
+    {
+        const algorithmFPType invN = 1.0 / (algorithmFPType)stats.nObservations;
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                crossProduct[i * nFeatures + j] -= shiftedSum[i] * shiftedSum[j] * invN;
+            }
+        }
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            shiftedSum[j] = location[j] + shiftedSum[j] * invN;
+        }
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status OutlierDetectionKernelBase<algorithmFPType, cpu>::computeInverseScatter(size_t nFeatures, size_t nObservations,
+    const algorithmFPType *crossProduct, algorithmFPType *scatter, algorithmFPType *invScatter)
+{
+    DAAL_CHECK(nObservations > nFeatures, ErrorOutlierDetectionInternal);
+
+    const algorithmFPType invN1 = 1.0 / (algorithmFPType)(nObservations - 1);
+    for(size_t j = 0; j < nFeatures * nFeatures; j++)
+    {
+        scatter[j]    = crossProduct[j] * invN1;
+        invScatter[j] = scatter[j];
+    }
+
+    DAAL_INT dim = (DAAL_INT)nFeatures;
+    char uplo = 'U';
+    DAAL_INT info;
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, invScatter, &dim, &info);
+    DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+
+    Lapack<algorithmFPType, cpu>::xpotri(&uplo, &dim, invScatter, &dim, &info);
+    DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType OutlierDetectionKernelBase<algorithmFPType, cpu>::chiSquaredQuantile(size_t nFeatures, algorithmFPType probability)
+{
+    /* Wilson-Hilferty approximation */
+    const algorithmFPType z = Math<algorithmFPType, cpu>::sCdfNormInv(probability);
+    const algorithmFPType a = 2.0 / (9.0 * (algorithmFPType)nFeatures);
+    const algorithmFPType t = 1.0 - a + z * Math<algorithmFPType, cpu>::sSqrt(a);
+    return (t > 0 ? (algorithmFPType)nFeatures * t * t * t : 0);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType OutlierDetectionKernelBase<algorithmFPType, cpu>::computeThreshold(size_t nVectors, size_t nFeatures,
+    size_t subsetSize, double alpha)
+{
+    const algorithmFPType n = (algorithmFPType)nVectors;
+    const algorithmFPType p = (algorithmFPType)nFeatures;
+    const algorithmFPType r = (algorithmFPType)subsetSize;
+    const algorithmFPType h = (algorithmFPType)((nVectors + nFeatures + 1) / 2);
+
+    /* Correction factor c_npr = c_np + c_hr */
+    const algorithmFPType chr = (r < h ? (h - r) / (h + r) : 0);
+    algorithmFPType cnp = 1.0 + (p + 1.0) / (n - p);
+    if(n > 3.0 * p + 1.0)
+    {
+        cnp += 2.0 / (n - 1.0 - 3.0 * p);
+    }
+    return (cnp + chr) * Math<algorithmFPType, cpu>::sSqrt(chiSquaredQuantile(nFeatures, 1.0 - alpha));
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool OutlierDetectionKernelBase<algorithmFPType, cpu>::isConverged(size_t subsetSize, size_t prevSubsetSize, double toleranceToConverge)
+{
+    const size_t diff = (subsetSize > prevSubsetSize ? subsetSize - prevSubsetSize : prevSubsetSize - subsetSize);
+    return (diff == 0) || ((double)diff < toleranceToConverge * (double)prevSubsetSize);
+}
+
+} // namespace internal
+
+} // namespace bacon_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
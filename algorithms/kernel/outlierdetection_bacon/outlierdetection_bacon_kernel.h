@@ -49,6 +49,7 @@
 #define __OUTLIERDETECTION_BACON_KERNEL_H__
 
 #include "outlier_detection_bacon.h"
+#include "outlier_detection_bacon_distributed.h"
 #include "kernel.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
@@ -65,10 +66,94 @@ namespace bacon_outlier_detection
 namespace internal
 {
 
+/**
+ *  \brief Statistics of the basic subset: number of observations, mean and cross-product centered at the mean
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct BasicSubsetStatistics
+{
+    BasicSubsetStatistics(size_t nFeatures) : nObservations(0), mean(nFeatures), crossProduct(nFeatures * nFeatures) {}
+
+    bool isValid() const { return mean.get() && crossProduct.get(); }
+
+    size_t nObservations;
+    TArray<algorithmFPType, cpu> mean;
+    TArray<algorithmFPType, cpu> crossProduct;
+};
+
+/**
+ *  \brief Building blocks of the BACON algorithm shared by the batch and distributed processing modes
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct OutlierDetectionKernelBase : public Kernel
+{
+    static const size_t blockSize = 512;        /* Number of observations processed by a thread at once */
+    static const size_t initSubsetFactor = 4;   /* Size of the initial basic subset is initSubsetFactor * nFeatures */
+
+    /* Defines which observations of the data set form the basic subset */
+    enum SubsetSelection
+    {
+        selectAll,                  /* All observations */
+        selectByComputedDistance,   /* Observations with the distance to the location not greater than the threshold */
+        selectByStoredDistance      /* Observations with the distance read from the distance table not greater than the threshold */
+    };
+
+    /** \brief Computes statistics of the basic subset in a single threaded pass over the data set.
+     *         If invScatter is not set, Euclidean distance is used instead of Mahalanobis one.
+     *         Computed distances are written into the distance table if it is set.
+     *         The nCandidates smallest distances are collected into the candidates array if nCandidates > 0 */
+    services::Status computeSubsetStatistics(NumericTable &dataTable, NumericTable *distanceTable,
+                                             const algorithmFPType *location, const algorithmFPType *invScatter,
+                                             SubsetSelection selection, algorithmFPType threshold,
+                                             size_t nCandidates, algorithmFPType *candidates,
+                                             BasicSubsetStatistics<algorithmFPType, cpu> &stats);
+
+    /** \brief Computes the inverse of the scatter matrix of the basic subset */
+    services::Status computeInverseScatter(size_t nFeatures, size_t nObservations, const algorithmFPType *crossProduct,
+                                           algorithmFPType *scatter, algorithmFPType *invScatter);
+
+    /** \brief Computes the distance threshold that defines the next basic subset */
+    algorithmFPType computeThreshold(size_t nVectors, size_t nFeatures, size_t subsetSize, double alpha);
+
+    /** \brief Computes the quantile of the chi-squared distribution with nFeatures degrees of freedom */
+    algorithmFPType chiSquaredQuantile(size_t nFeatures, algorithmFPType probability);
+
+    bool isConverged(size_t subsetSize, size_t prevSubsetSize, double toleranceToConverge);
+};
+
 template <typename algorithmFPType, Method method, CpuType cpu>
-struct OutlierDetectionKernel : public Kernel
+struct OutlierDetectionKernel : public OutlierDetectionKernelBase<algorithmFPType, cpu>
 {
+    typedef OutlierDetectionKernelBase<algorithmFPType, cpu> super;
+    static const size_t maxIterations = 100;    /* Upper bound on the number of iterations */
+
     services::Status compute(NumericTable &data, NumericTable &weights, const Parameter &par);
+
+protected:
+    /** \brief Computes the coordinate-wise median using the weights table as a buffer */
+    services::Status computeMedian(NumericTable &dataTable, NumericTable &weightsTable, algorithmFPType *median);
+
+    /** \brief Converts distances stored in the weights table into the weights of observations */
+    services::Status computeWeights(NumericTable &weightsTable, algorithmFPType threshold);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionDistributedStep1Kernel : public OutlierDetectionKernelBase<algorithmFPType, cpu>
+{
+    typedef OutlierDetectionKernelBase<algorithmFPType, cpu> super;
+
+    services::Status compute(NumericTable &data, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+                             NumericTable **partialResult, const Parameter &par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionDistributedStep2Kernel : public OutlierDetectionKernelBase<algorithmFPType, cpu>
+{
+    typedef OutlierDetectionKernelBase<algorithmFPType, cpu> super;
+
+    services::Status compute(size_t nPartialResults, NumericTable **partialResults, NumericTable **partialResult, const Parameter &par);
+
+    services::Status finalizeCompute(NumericTable **partialResult, NumericTable **result, const Parameter &par);
 };
 
 } // namespace internal
@@ -50,10 +50,13 @@
 
 #include "numeric_table.h"
 #include "outlier_detection_multivariate_types.h"
+#include "service_memory.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
 #include "service_blas.h"
 #include "service_lapack.h"
+#include "service_error_handling.h"
+#include "threading.h"
 #include "outlierdetection_multivariate_kernel.h"
 
 namespace daal
@@ -102,8 +105,8 @@ mahalanobisDistance(const size_t nFeatures,
         }
     }
 
-    Blas<algorithmFPType, cpu>::xsymm(&side, &uplo, &dim, &n, &one, invScatter, &dim, dataCen, &dim, &zero,
-                                      dataCenInvScatter, &dim);
+    Blas<algorithmFPType, cpu>::xxsymm(&side, &uplo, &dim, &n, &one, const_cast<algorithmFPType *>(invScatter), &dim, dataCen, &dim, &zero,
+                                       dataCenInvScatter, &dim);
 
     dataCenPtr = dataCen;
     algorithmFPType *dataCenInvScatterPtr = dataCenInvScatter;
@@ -127,15 +130,14 @@ computeInternal(const size_t nFeatures,
                 NumericTable &resultTable,
                 const algorithmFPType *locationArray,
                 const algorithmFPType *scatterArray,
-                const algorithmFPType thresholdValue,
-                algorithmFPType *buffer)
+                const algorithmFPType thresholdValue)
 {
-    ReadRows<algorithmFPType, cpu> dataBlock(dataTable);
-    WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable);
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    const algorithmFPType zero = (algorithmFPType)0.0;
 
-    algorithmFPType one  = (algorithmFPType)1.0;
-    algorithmFPType zero = (algorithmFPType)0.0;
-    algorithmFPType *invScatter = buffer;
+    TArray<algorithmFPType, cpu> invScatterPtr(nFeatures * nFeatures);
+    algorithmFPType *invScatter = invScatterPtr.get();
+    DAAL_CHECK(invScatter, ErrorMemoryAllocationFailed)
 
     for (size_t i = 0; i < nFeatures * nFeatures; i++)
     {
@@ -158,40 +160,60 @@ computeInternal(const size_t nFeatures,
         nBlocks++;
     }
 
+    /* Each thread owns a buffer for centered observations of one block and their product with the inverse scatter */
+    SafeStatus safeStat;
+    daal::tls<algorithmFPType *> tlsBuffer([=, &safeStat]()
+    {
+        algorithmFPType *ptr = (algorithmFPType *)daal::services::internal::service_scalable_malloc<algorithmFPType, cpu>(2 * nFeatures * blockSize);
+        if (!ptr)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        }
+        return ptr;
+    });
+
     /* Process input data table in blocks */
-    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
     {
+        algorithmFPType *buffer = tlsBuffer.local();
+        if (!buffer)
+        {
+            return;
+        }
+
         size_t startRow = iBlock * blockSize;
         size_t nRowsInBlock = blockSize;
         if (startRow + nRowsInBlock > nVectors)
         {
             nRowsInBlock = nVectors - startRow;
         }
-        DAAL_INT n = (DAAL_INT)nRowsInBlock;
 
-        const algorithmFPType *data = dataBlock.next(startRow, nRowsInBlock);
-        DAAL_CHECK_BLOCK_STATUS(dataBlock)
+        ReadRows<algorithmFPType, cpu> dataBlock(dataTable, startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType *data = dataBlock.get();
 
-        algorithmFPType *weight = resultBlock.next(startRow, nRowsInBlock);
-        DAAL_CHECK_BLOCK_STATUS(resultBlock)
+        WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(resultBlock);
+        algorithmFPType *weight = resultBlock.get();
 
         /* Calculate mahalanobis distances for a block of observations */
-        mahalanobisDistance(nFeatures, nRowsInBlock, data, locationArray, invScatter, weight,
-                            buffer + nFeatures * nFeatures);
+        mahalanobisDistance(nFeatures, nRowsInBlock, data, locationArray, invScatter, weight, buffer);
 
         for (size_t i = 0; i < nRowsInBlock; i++)
         {
-            if (Math<algorithmFPType, cpu>::sSqrt(weight[i]) > thresholdValue)
-            {
-                weight[i] = zero;
-            }
-            else
-            {
-                weight[i] = one;
-            }
+            weight[i] = (Math<algorithmFPType, cpu>::sSqrt(weight[i]) > thresholdValue) ? zero : one;
         }
-    }
-    return Status();
+    });
+
+    tlsBuffer.reduce([](algorithmFPType *ptr)
+    {
+        if (ptr)
+        {
+            daal::services::internal::service_scalable_free<algorithmFPType, cpu>(ptr);
+        }
+    });
+
+    return safeStat.detach();
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -219,17 +241,11 @@ compute(NumericTable &dataTable,
         defaultInitialization(locationArray, scatterArray, thresholdArray, nFeatures);
     }
 
-    /* Allocate memory for storing intermediate results */
-    size_t bufferSize = nFeatures * nFeatures + 2 * nFeatures * nVectors;
-    TArray<algorithmFPType, cpu> bufferPtr(bufferSize);
-    DAAL_CHECK(bufferPtr.get(), ErrorMemoryAllocationFailed)
-
-        /* Calculate results */
+    /* Calculate results */
     return computeInternal(nFeatures, nVectors, dataTable, resultTable,
                            locationArray,
                            scatterArray,
-                           thresholdArray[0],
-                           bufferPtr.get());
+                           thresholdArray[0]);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
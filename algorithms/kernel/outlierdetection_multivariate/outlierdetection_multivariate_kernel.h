@@ -86,15 +86,15 @@ struct OutlierDetectionKernel : public Kernel
                                       const size_t nFeatures);
 
     /** \brief Detect outliers in the data from input micro-table
-               and store resulting weights into output micro-table */
+               and store resulting weights into output micro-table.
+               Blocks of observations are processed in parallel */
     inline Status computeInternal(const size_t nFeatures,
                                   const size_t nVectors,
                                   NumericTable &dataTable,
                                   NumericTable &resultTable,
                                   const algorithmFPType *location,
                                   const algorithmFPType *scatter,
-                                  const algorithmFPType threshold,
-                                  algorithmFPType *buffer);
+                                  const algorithmFPType threshold);
 
     Status compute(NumericTable &dataTable,
                    NumericTable *locationTable,
@@ -0,0 +1,516 @@
+/* file: pca_dense_randomized_base.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA randomized.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BASE_H__
+#define __PCA_DENSE_RANDOMIZED_BASE_H__
+
+#include "pca_types.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_math.h"
+#include "service_rng.h"
+#include "service_data_utils.h"
+#include "pca_dense_base.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ *  Common part of the PCA randomized kernels.
+ *  Matrices of size nFeatures x sketchSize are stored in column-major order, i.e. the same memory
+ *  as the homogen numeric table with sketchSize rows and nFeatures columns
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedBase : public PCADenseBase<algorithmFPType, cpu>
+{
+public:
+    explicit PCARandomizedBase() {};
+
+protected:
+    static const size_t blockSize = 4096;
+
+    services::Status generateTestMatrix(size_t nFeatures, size_t sketchSize, size_t seed, algorithmFPType *omega) const;
+
+    services::Status processBlocks(data_management::NumericTable& data, const algorithmFPType *omega, size_t sketchSize,
+        algorithmFPType *nObservations, algorithmFPType *sum, algorithmFPType *sumSquares, algorithmFPType *crossProduct) const;
+
+    void computeStatistics(size_t nFeatures, algorithmFPType nObservations, const algorithmFPType *sum, const algorithmFPType *sumSquares,
+        algorithmFPType *means, algorithmFPType *variances, algorithmFPType *invStd) const;
+
+    void covarianceFromCrossProduct(size_t nFeatures, size_t sketchSize, algorithmFPType nObservations, const algorithmFPType *sum,
+        const algorithmFPType *omega, algorithmFPType *crossProduct) const;
+
+    services::Status orthonormalize(size_t nRows, size_t nCols, algorithmFPType *a) const;
+
+    services::Status symmetricEigen(size_t n, algorithmFPType *a, algorithmFPType *w) const;
+
+    services::Status finalizeSketch(PartialResult<randomizedDense> &partialResult, const RandomizedParameter &parameter,
+        data_management::NumericTable& eigenvalues, data_management::NumericTable& eigenvectors,
+        data_management::NumericTable *means, data_management::NumericTable *variances) const;
+
+    services::Status storeResults(size_t nFeatures, size_t sketchSize, const algorithmFPType *values, const algorithmFPType *vectors,
+        bool ascending, bool isDeterministic, data_management::NumericTable& eigenvalues, data_management::NumericTable& eigenvectors) const;
+
+    services::Status storeStatistics(size_t nFeatures, const algorithmFPType *means, const algorithmFPType *variances,
+        data_management::NumericTable *meansTable, data_management::NumericTable *variancesTable) const;
+
+    static void symmetrize(size_t n, algorithmFPType *a);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::generateTestMatrix(size_t nFeatures, size_t sketchSize, size_t seed,
+    algorithmFPType *omega) const
+{
+    daal::internal::BaseRNGs<cpu> brng(seed);
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    const algorithmFPType sigma = algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(algorithmFPType(nFeatures));
+    DAAL_CHECK(!rng.gaussian(nFeatures * sketchSize, omega, brng, algorithmFPType(0.0), sigma), services::ErrorIncorrectErrorcodeFromGenerator);
+    return services::Status();
+}
+
+/**
+ *  Accumulates the statistics (if sum is not null) and the cross-product X^T * X * omega
+ *  (if omega is not null) of the data set block by block
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::processBlocks(data_management::NumericTable& data, const algorithmFPType *omega,
+    size_t sketchSize, algorithmFPType *nObservations, algorithmFPType *sum, algorithmFPType *sumSquares, algorithmFPType *crossProduct) const
+{
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t nRows = data.getNumberOfRows();
+    const size_t nBlocks = nRows / blockSize + !!(nRows % blockSize);
+
+    TArray<algorithmFPType, cpu> productArray(omega ? blockSize * sketchSize : 0);
+    DAAL_CHECK_MALLOC(!omega || productArray.get());
+    algorithmFPType *product = productArray.get();
+
+    ReadRows<algorithmFPType, cpu> dataBlock(data, 0, 0);
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nBlockRows = (iBlock == nBlocks - 1) ? nRows - startRow : blockSize;
+        const algorithmFPType *x = dataBlock.next(startRow, nBlockRows);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock);
+
+        if (sum)
+        {
+            for (size_t i = 0; i < nBlockRows; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    const algorithmFPType value = x[i * nFeatures + j];
+                    sum[j] += value;
+                    sumSquares[j] += value * value;
+                }
+            }
+            *nObservations += nBlockRows;
+        }
+
+        if (omega)
+        {
+            /* product = X_b * omega, crossProduct += X_b^T * product */
+            const char transa = 'T';
+            const char notrans = 'N';
+            const algorithmFPType one = 1.0;
+            const algorithmFPType zero = 0.0;
+            const DAAL_INT m = (DAAL_INT)nBlockRows;
+            const DAAL_INT p = (DAAL_INT)nFeatures;
+            const DAAL_INT l = (DAAL_INT)sketchSize;
+
+            Blas<algorithmFPType, cpu>::xgemm(&transa, &notrans, &m, &l, &p, &one, x, &p, omega, &p, &zero, product, &m);
+            Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &m, &one, x, &p, product, &m, &one, crossProduct, &p);
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::computeStatistics(size_t nFeatures, algorithmFPType nObservations,
+    const algorithmFPType *sum, const algorithmFPType *sumSquares, algorithmFPType *means, algorithmFPType *variances, algorithmFPType *invStd) const
+{
+    const algorithmFPType invN = (nObservations > 0 ? algorithmFPType(1.0) / nObservations : algorithmFPType(0.0));
+    const algorithmFPType invN1 = (nObservations > 1 ? algorithmFPType(1.0) / (nObservations - 1) : algorithmFPType(0.0));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        means[j] = sum[j] * invN;
+        variances[j] = (sumSquares[j] - sum[j] * means[j]) * invN1;
+        if (variances[j] < 0)
+        {
+            variances[j] = 0;
+        }
+        invStd[j] = (variances[j] > 0 ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(variances[j]) : algorithmFPType(0.0));
+    }
+}
+
+/** Converts X^T * X * omega into covariance * omega: (crossProduct - sum * (sum^T * omega) / n) / (n - 1) */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::covarianceFromCrossProduct(size_t nFeatures, size_t sketchSize,
+    algorithmFPType nObservations, const algorithmFPType *sum, const algorithmFPType *omega, algorithmFPType *crossProduct) const
+{
+    const algorithmFPType invN = (nObservations > 0 ? algorithmFPType(1.0) / nObservations : algorithmFPType(0.0));
+    const algorithmFPType invN1 = (nObservations > 1 ? algorithmFPType(1.0) / (nObservations - 1) : algorithmFPType(0.0));
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        const algorithmFPType *omegaCol = omega + c * nFeatures;
+        algorithmFPType *col = crossProduct + c * nFeatures;
+
+        algorithmFPType dot = 0;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dot += sum[j] * omegaCol[j];
+        }
+        dot *= invN;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            col[j] = (col[j] - sum[j] * dot) * invN1;
+        }
+    }
+}
+
+/** Replaces the columns of the column-major nRows x nCols matrix with an orthonormal basis of their span */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::orthonormalize(size_t nRows, size_t nCols, algorithmFPType *a) const
+{
+    const DAAL_INT m = (DAAL_INT)nRows;
+    const DAAL_INT n = (DAAL_INT)nCols;
+    DAAL_INT info = 0;
+
+    TArray<algorithmFPType, cpu> tauArray(nCols);
+    DAAL_CHECK_MALLOC(tauArray.get());
+    algorithmFPType *tau = tauArray.get();
+
+    algorithmFPType workQuery[2];
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, a, m, tau, workQuery, -1, &info);
+    DAAL_INT lworkQr = (DAAL_INT)workQuery[0];
+    Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, a, m, tau, workQuery, -1, &info);
+    DAAL_INT lwork = (DAAL_INT)workQuery[0];
+    if (lworkQr > lwork) { lwork = lworkQr; }
+    if (lwork < n) { lwork = n; }
+
+    TArray<algorithmFPType, cpu> workArray(lwork);
+    DAAL_CHECK_MALLOC(workArray.get());
+
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, a, m, tau, workArray.get(), lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+    Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, a, m, tau, workArray.get(), lwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+    return services::Status();
+}
+
+/** Computes eigenvalues in ascending order and eigenvectors in place of the symmetric n x n matrix */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::symmetricEigen(size_t n, algorithmFPType *a, algorithmFPType *w) const
+{
+    char jobz  = 'V';
+    char uplo  = 'U';
+
+    DAAL_INT size = (DAAL_INT)n;
+    DAAL_INT lwork = 2 * size * size + 6 * size + 1;
+    DAAL_INT liwork = 5 * size + 3;
+    DAAL_INT info;
+
+    TArray<algorithmFPType, cpu> work(lwork);
+    TArray<DAAL_INT, cpu> iwork(liwork);
+    DAAL_CHECK_MALLOC(work.get() && iwork.get());
+
+    Lapack<algorithmFPType, cpu>::xsyevd(&jobz, &uplo, &size, a, &size, w, work.get(), &lwork, iwork.get(), &liwork, &info);
+    DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::symmetrize(size_t n, algorithmFPType *a)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            const algorithmFPType value = (a[i * n + j] + a[j * n + i]) * algorithmFPType(0.5);
+            a[i * n + j] = value;
+            a[j * n + i] = value;
+        }
+    }
+}
+
+/**
+ *  Computes the leading eigenpairs of the correlation matrix from the single-pass sketch
+ *  Y = covariance * omega with the stabilized Nystrom approximation
+ *  C ~ Y (omega^T Y)^-1 Y^T, where covariance is scaled to the correlation
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::finalizeSketch(PartialResult<randomizedDense> &partialResult,
+    const RandomizedParameter &parameter, data_management::NumericTable& eigenvalues, data_management::NumericTable& eigenvectors,
+    data_management::NumericTable *meansTable, data_management::NumericTable *variancesTable) const
+{
+    NumericTable &sketchTable = *partialResult.get(sketchRandomized);
+    const size_t nFeatures = sketchTable.getNumberOfColumns();
+    const size_t sketchSize = sketchTable.getNumberOfRows();
+    const size_t matrixSize = nFeatures * sketchSize;
+
+    ReadRows<algorithmFPType, cpu> nObservationsBlock(*partialResult.get(nObservationsRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    ReadRows<algorithmFPType, cpu> sumBlock(*partialResult.get(sumRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    ReadRows<algorithmFPType, cpu> sumSquaresBlock(*partialResult.get(sumSquaresRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock);
+    ReadRows<algorithmFPType, cpu> sketchBlock(sketchTable, 0, sketchSize);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+
+    const algorithmFPType nObservations = nObservationsBlock.get()[0];
+    const algorithmFPType *sum = sumBlock.get();
+
+    TArray<algorithmFPType, cpu> statisticsArray(3 * nFeatures);
+    TArray<algorithmFPType, cpu> omegaArray(matrixSize);
+    TArray<algorithmFPType, cpu> yArray(matrixSize);
+    TArray<algorithmFPType, cpu> fArray(matrixSize);
+    TArray<algorithmFPType, cpu> squareArray(3 * sketchSize * sketchSize + 2 * sketchSize);
+    DAAL_CHECK_MALLOC(statisticsArray.get() && omegaArray.get() && yArray.get() && fArray.get() && squareArray.get());
+
+    algorithmFPType *means = statisticsArray.get();
+    algorithmFPType *variances = means + nFeatures;
+    algorithmFPType *invStd = variances + nFeatures;
+    algorithmFPType *omega = omegaArray.get();
+    algorithmFPType *y = yArray.get();
+    algorithmFPType *f = fArray.get();
+    algorithmFPType *b = squareArray.get();
+    algorithmFPType *bInvSqrt = b + sketchSize * sketchSize;
+    algorithmFPType *ur = bInvSqrt + sketchSize * sketchSize;
+    algorithmFPType *w = ur + sketchSize * sketchSize;
+    algorithmFPType *sigma = w + sketchSize;
+
+    computeStatistics(nFeatures, nObservations, sum, sumSquaresBlock.get(), means, variances, invStd);
+
+    services::Status s = generateTestMatrix(nFeatures, sketchSize, parameter.seed, omega);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const algorithmFPType *sketch = sketchBlock.get();
+    for (size_t i = 0; i < matrixSize; i++)
+    {
+        y[i] = sketch[i];
+    }
+    covarianceFromCrossProduct(nFeatures, sketchSize, nObservations, sum, omega, y);
+
+    /* y = D^-1/2 * covariance * omega = C * omega', where omega' = D^1/2 * omega */
+    algorithmFPType norm = 0;
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const size_t id = c * nFeatures + j;
+            y[id] *= invStd[j];
+            omega[id] = (invStd[j] > 0 ? omega[id] / invStd[j] : algorithmFPType(0.0));
+            norm += y[id] * y[id];
+        }
+    }
+
+    /* Shift keeps omega'^T * y positive definite */
+    const algorithmFPType eps = daal::data_feature_utils::internal::EpsilonVal<algorithmFPType, cpu>::get();
+    const algorithmFPType shift = eps * daal::internal::Math<algorithmFPType, cpu>::sSqrt(norm * algorithmFPType(nFeatures));
+    for (size_t i = 0; i < matrixSize; i++)
+    {
+        y[i] += shift * omega[i];
+    }
+
+    const char trans = 'T';
+    const char notrans = 'N';
+    const algorithmFPType one = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT l = (DAAL_INT)sketchSize;
+
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &l, &l, &p, &one, omega, &p, y, &p, &zero, b, &l);
+    symmetrize(sketchSize, b);
+    DAAL_CHECK_STATUS(s, symmetricEigen(sketchSize, b, w));
+
+    /* bInvSqrt = B^-1/2 restricted to the numerically nonzero part of the spectrum */
+    const algorithmFPType threshold = eps * w[sketchSize - 1] * algorithmFPType(sketchSize);
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        const algorithmFPType scale = (w[c] > threshold ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(w[c]) : algorithmFPType(0.0));
+        for (size_t j = 0; j < sketchSize; j++)
+        {
+            ur[c * sketchSize + j] = b[c * sketchSize + j] * scale;
+        }
+    }
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &l, &l, &l, &one, ur, &l, b, &l, &zero, bInvSqrt, &l);
+
+    /* f = y * B^-1/2, so that f * f^T approximates the correlation matrix */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &l, &one, y, &p, bInvSqrt, &l, &zero, f, &p);
+
+    /* Thin SVD of f: f = Q * R, R = Ur * S * Vr^T */
+    {
+        DAAL_INT info = 0;
+        TArray<algorithmFPType, cpu> tauArray(sketchSize);
+        DAAL_CHECK_MALLOC(tauArray.get());
+
+        algorithmFPType workQuery[2];
+        Lapack<algorithmFPType, cpu>::xgeqrf(p, l, f, p, tauArray.get(), workQuery, -1, &info);
+        DAAL_INT lwork = (DAAL_INT)workQuery[0];
+        if (lwork < l) { lwork = l; }
+        TArray<algorithmFPType, cpu> workArray(lwork);
+        DAAL_CHECK_MALLOC(workArray.get());
+        Lapack<algorithmFPType, cpu>::xgeqrf(p, l, f, p, tauArray.get(), workArray.get(), lwork, &info);
+        DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+
+        for (size_t c = 0; c < sketchSize; c++)
+        {
+            for (size_t j = 0; j < sketchSize; j++)
+            {
+                b[c * sketchSize + j] = (j <= c ? f[c * nFeatures + j] : algorithmFPType(0.0));
+            }
+        }
+
+        Lapack<algorithmFPType, cpu>::xorgqr(p, l, l, f, p, tauArray.get(), workQuery, -1, &info);
+        DAAL_INT lworkQ = (DAAL_INT)workQuery[0];
+        if (lworkQ < l) { lworkQ = l; }
+        TArray<algorithmFPType, cpu> qWorkArray(lworkQ);
+        DAAL_CHECK_MALLOC(qWorkArray.get());
+        Lapack<algorithmFPType, cpu>::xorgqr(p, l, l, f, p, tauArray.get(), qWorkArray.get(), lworkQ, &info);
+        DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+
+        Lapack<algorithmFPType, cpu>::xgesvd('A', 'N', l, l, b, l, sigma, ur, l, bInvSqrt, 1, workQuery, -1, &info);
+        lwork = (DAAL_INT)workQuery[0];
+        if (lwork < 5 * l) { lwork = 5 * l; }
+        TArray<algorithmFPType, cpu> svdWorkArray(lwork);
+        DAAL_CHECK_MALLOC(svdWorkArray.get());
+        Lapack<algorithmFPType, cpu>::xgesvd('A', 'N', l, l, b, l, sigma, ur, l, bInvSqrt, 1, svdWorkArray.get(), lwork, &info);
+        DAAL_CHECK(info == 0, services::ErrorPCAFailedToComputeRandomizedEigenvalues);
+    }
+
+    /* Eigenvectors y = Q * Ur, eigenvalues sigma^2 - shift */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &l, &one, f, &p, ur, &l, &zero, y, &p);
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        const algorithmFPType value = sigma[c] * sigma[c] - shift;
+        sigma[c] = (value > 0 ? value : algorithmFPType(0.0));
+    }
+
+    DAAL_CHECK_STATUS(s, storeResults(nFeatures, sketchSize, sigma, y, false, parameter.isDeterministic, eigenvalues, eigenvectors));
+    return storeStatistics(nFeatures, means, variances, meansTable, variancesTable);
+}
+
+/** Writes the leading eigenpairs into the result; the vectors are stored as columns of the nFeatures x sketchSize matrix */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::storeResults(size_t nFeatures, size_t sketchSize,
+    const algorithmFPType *values, const algorithmFPType *vectors, bool ascending, bool isDeterministic,
+    data_management::NumericTable& eigenvalues, data_management::NumericTable& eigenvectors) const
+{
+    const size_t nComponents = eigenvalues.getNumberOfColumns();
+    {
+        WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+        algorithmFPType *eigenvaluesArray = eigenvaluesBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+        algorithmFPType *eigenvectorsArray = eigenvectorsBlock.get();
+
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            const size_t id = (ascending ? sketchSize - 1 - i : i);
+            eigenvaluesArray[i] = (values[id] > 0 ? values[id] : algorithmFPType(0.0));
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                eigenvectorsArray[i * nFeatures + j] = vectors[id * nFeatures + j];
+            }
+        }
+    }
+
+    if (isDeterministic)
+    {
+        return this->signFlipEigenvectors(eigenvectors);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedBase<algorithmFPType, cpu>::storeStatistics(size_t nFeatures, const algorithmFPType *means,
+    const algorithmFPType *variances, data_management::NumericTable *meansTable, data_management::NumericTable *variancesTable) const
+{
+    if (meansTable)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> meansBlock(*meansTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meansBlock);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            meansBlock.get()[j] = means[j];
+        }
+    }
+    if (variancesTable)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> variancesBlock(*variancesTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(variancesBlock);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            variancesBlock.get()[j] = variances[j];
+        }
+    }
+    return services::Status();
+}
+
+template <ComputeMode mode, typename algorithmFPType, CpuType cpu>
+class PCARandomizedKernel : public PCARandomizedBase<algorithmFPType, cpu> {};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,99 @@
+/* file: pca_dense_randomized_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_CONTAINER_H__
+#define __PCA_DENSE_RANDOMIZED_BATCH_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_batch.h"
+#include "pca_dense_randomized_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface2
+{
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCARandomizedKernel, batch, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, randomizedDense, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    BatchParameter<algorithmFPType, randomizedDense> *parameter = static_cast<BatchParameter<algorithmFPType, randomizedDense> *>(_par);
+
+    data_management::NumericTablePtr data = input->get(pca::data);
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+    data_management::NumericTablePtr means        = result->get(pca::means);
+    data_management::NumericTablePtr variances    = result->get(pca::variances);
+
+    services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedKernel, __DAAL_KERNEL_ARGUMENTS(batch, algorithmFPType), compute,
+                       *data, parameter, *eigenvalues, *eigenvectors, means.get(), variances.get());
+}
+
+} // namespace interface2
+}
+}
+} // namespace daal
+#endif
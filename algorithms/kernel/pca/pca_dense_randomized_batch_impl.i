@@ -0,0 +1,178 @@
+/* file: pca_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ *  Randomized subspace iteration on the correlation matrix C:
+ *  Q = orth(omega), Q = orth(C * Q) nPowerIterations times, then the eigenpairs of Q^T * C * Q.
+ *  Every product with C is one pass over the data set
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<batch, algorithmFPType, cpu>::compute(
+    data_management::NumericTable& data,
+    const RandomizedParameter *parameter,
+    data_management::NumericTable& eigenvalues,
+    data_management::NumericTable& eigenvectors,
+    data_management::NumericTable *means,
+    data_management::NumericTable *variances)
+{
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t sketchSize = parameter->getSketchSize(nFeatures);
+    const size_t matrixSize = nFeatures * sketchSize;
+
+    TArray<algorithmFPType, cpu> statisticsArray(5 * nFeatures);
+    TArray<algorithmFPType, cpu> matricesArray(3 * matrixSize);
+    TArray<algorithmFPType, cpu> squareArray(sketchSize * sketchSize + sketchSize);
+    DAAL_CHECK_MALLOC(statisticsArray.get() && matricesArray.get() && squareArray.get());
+
+    algorithmFPType *sum = statisticsArray.get();
+    algorithmFPType *sumSquares = sum + nFeatures;
+    algorithmFPType *meansArray = sumSquares + nFeatures;
+    algorithmFPType *variancesArray = meansArray + nFeatures;
+    algorithmFPType *invStd = variancesArray + nFeatures;
+    algorithmFPType *q = matricesArray.get();
+    algorithmFPType *y = q + matrixSize;
+    algorithmFPType *scaled = y + matrixSize;
+    algorithmFPType *t = squareArray.get();
+    algorithmFPType *w = t + sketchSize * sketchSize;
+
+    for (size_t j = 0; j < 2 * nFeatures; j++)
+    {
+        sum[j] = 0;
+    }
+    algorithmFPType nObservations = 0;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->processBlocks(data, 0, 0, &nObservations, sum, sumSquares, 0));
+    this->computeStatistics(nFeatures, nObservations, sum, sumSquares, meansArray, variancesArray, invStd);
+
+    DAAL_CHECK_STATUS(s, this->generateTestMatrix(nFeatures, sketchSize, parameter->seed, q));
+    DAAL_CHECK_STATUS(s, this->orthonormalize(nFeatures, sketchSize, q));
+
+    for (size_t it = 0; it < parameter->nPowerIterations; it++)
+    {
+        DAAL_CHECK_STATUS(s, multiplyByCorrelation(data, sketchSize, nObservations, sum, invStd, q, scaled, y));
+        algorithmFPType *tmp = q;
+        q = y;
+        y = tmp;
+        DAAL_CHECK_STATUS(s, this->orthonormalize(nFeatures, sketchSize, q));
+    }
+    DAAL_CHECK_STATUS(s, multiplyByCorrelation(data, sketchSize, nObservations, sum, invStd, q, scaled, y));
+
+    /* t = Q^T * C * Q, its eigenvectors rotate Q into the eigenvectors of C */
+    const char trans = 'T';
+    const char notrans = 'N';
+    const algorithmFPType one = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT l = (DAAL_INT)sketchSize;
+
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &l, &l, &p, &one, q, &p, y, &p, &zero, t, &l);
+    this->symmetrize(sketchSize, t);
+    DAAL_CHECK_STATUS(s, this->symmetricEigen(sketchSize, t, w));
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &l, &one, q, &p, t, &l, &zero, y, &p);
+
+    DAAL_CHECK_STATUS(s, this->storeResults(nFeatures, sketchSize, w, y, true, parameter->isDeterministic, eigenvalues, eigenvectors));
+    return this->storeStatistics(nFeatures, meansArray, variancesArray, means, variances);
+}
+
+/** product = C * v = D^-1/2 * covariance * D^-1/2 * v */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<batch, algorithmFPType, cpu>::multiplyByCorrelation(
+    data_management::NumericTable& data, size_t sketchSize, algorithmFPType nObservations,
+    const algorithmFPType *sum, const algorithmFPType *invStd, const algorithmFPType *v, algorithmFPType *scaled, algorithmFPType *product)
+{
+    const size_t nFeatures = data.getNumberOfColumns();
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            scaled[c * nFeatures + j] = v[c * nFeatures + j] * invStd[j];
+            product[c * nFeatures + j] = 0;
+        }
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->processBlocks(data, scaled, sketchSize, 0, 0, 0, product));
+    this->covarianceFromCrossProduct(nFeatures, sketchSize, nObservations, sum, scaled, product);
+
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            product[c * nFeatures + j] *= invStd[j];
+        }
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
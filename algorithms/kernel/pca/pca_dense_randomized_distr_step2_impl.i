@@ -0,0 +1,128 @@
+/* file: pca_dense_randomized_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_distr_step2_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/** Partial results of the randomized method are additive, so merging is an element-wise sum */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<distributed, algorithmFPType, cpu>::compute(
+    DistributedInput<randomizedDense> *input,
+    PartialResult<randomizedDense> *partialResult,
+    const RandomizedParameter *parameter)
+{
+    data_management::DataCollectionPtr collection = input->get(partialResults);
+    const size_t nBlocks = collection->size();
+
+    services::Status s;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        services::SharedPtr<PartialResult<randomizedDense> > localPartialResult = input->getPartialResult(i);
+        DAAL_CHECK_STATUS(s, addTable(*localPartialResult->get(nObservationsRandomized), *partialResult->get(nObservationsRandomized)));
+        DAAL_CHECK_STATUS(s, addTable(*localPartialResult->get(sumRandomized), *partialResult->get(sumRandomized)));
+        DAAL_CHECK_STATUS(s, addTable(*localPartialResult->get(sumSquaresRandomized), *partialResult->get(sumSquaresRandomized)));
+        DAAL_CHECK_STATUS(s, addTable(*localPartialResult->get(sketchRandomized), *partialResult->get(sketchRandomized)));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<distributed, algorithmFPType, cpu>::finalize(
+    PartialResult<randomizedDense> *partialResult,
+    const RandomizedParameter *parameter,
+    data_management::NumericTable& eigenvalues,
+    data_management::NumericTable& eigenvectors,
+    data_management::NumericTable *means,
+    data_management::NumericTable *variances)
+{
+    return this->finalizeSketch(*partialResult, *parameter, eigenvalues, eigenvectors, means, variances);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<distributed, algorithmFPType, cpu>::addTable(
+    data_management::NumericTable& source, data_management::NumericTable& dest)
+{
+    const size_t nRows = dest.getNumberOfRows();
+    const size_t nElements = nRows * dest.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> sourceBlock(source, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(sourceBlock);
+    const algorithmFPType *sourceArray = sourceBlock.get();
+
+    WriteRows<algorithmFPType, cpu> destBlock(dest, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(destBlock);
+    algorithmFPType *destArray = destBlock.get();
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nElements; i++)
+    {
+        destArray[i] += sourceArray[i];
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
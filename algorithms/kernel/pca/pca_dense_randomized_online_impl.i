@@ -0,0 +1,110 @@
+/* file: pca_dense_randomized_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_online_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<online, algorithmFPType, cpu>::compute(
+    data_management::NumericTable& data,
+    PartialResult<randomizedDense> *partialResult,
+    const RandomizedParameter *parameter)
+{
+    data_management::NumericTable &sketchTable = *partialResult->get(sketchRandomized);
+    const size_t nFeatures = sketchTable.getNumberOfColumns();
+    const size_t sketchSize = sketchTable.getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(*partialResult->get(nObservationsRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    WriteRows<algorithmFPType, cpu> sumBlock(*partialResult->get(sumRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    WriteRows<algorithmFPType, cpu> sumSquaresBlock(*partialResult->get(sumSquaresRandomized), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock);
+    WriteRows<algorithmFPType, cpu> sketchBlock(sketchTable, 0, sketchSize);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+
+    /* The test matrix is regenerated from the seed on every call so that all blocks and nodes share it */
+    TArray<algorithmFPType, cpu> omega(nFeatures * sketchSize);
+    DAAL_CHECK_MALLOC(omega.get());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->generateTestMatrix(nFeatures, sketchSize, parameter->seed, omega.get()));
+    return this->processBlocks(data, omega.get(), sketchSize, nObservationsBlock.get(), sumBlock.get(), sumSquaresBlock.get(), sketchBlock.get());
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedKernel<online, algorithmFPType, cpu>::finalize(
+    PartialResult<randomizedDense> *partialResult,
+    const RandomizedParameter *parameter,
+    data_management::NumericTable& eigenvalues,
+    data_management::NumericTable& eigenvectors,
+    data_management::NumericTable *means,
+    data_management::NumericTable *variances)
+{
+    return this->finalizeSketch(*partialResult, *parameter, eigenvalues, eigenvectors, means, variances);
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
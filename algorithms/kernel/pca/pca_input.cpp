@@ -118,7 +118,14 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfInputNumericTables);
     NumericTablePtr dataTable = get(data);
     Status s;
-    if(_isCorrelation)
+    if(method == randomizedDense)
+    {
+        DAAL_CHECK(!_isCorrelation, ErrorInputCorrelationNotSupportedInRandomizedMethod);
+        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+        const BaseBatchParameter *parameter = static_cast<const BaseBatchParameter *>(par);
+        DAAL_CHECK_EX(parameter->nComponents <= dataTable->getNumberOfColumns(), ErrorIncorrectParameter, ParameterName, nComponentsStr());
+    }
+    else if(_isCorrelation)
     {
         int unexpectedLayouts = (int)NumericTableIface::upperPackedTriangularMatrix | (int)NumericTableIface::lowerPackedTriangularMatrix;
         DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), correlationStr(), unexpectedLayouts));
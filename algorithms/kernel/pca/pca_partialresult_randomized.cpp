@@ -0,0 +1,131 @@
+/* file: pca_partialresult_randomized.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS3(PartialResult,randomizedDense,SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_ID);
+
+PartialResult<randomizedDense>::PartialResult() : PartialResultBase(lastPartialRandomizedResultId + 1) {};
+
+/**
+ * Gets partial results of the PCA randomized algorithm
+ * \param[in] id    Identifier of the input object
+ * \return          Input object that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult<randomizedDense>::get(PartialRandomizedResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+size_t PartialResult<randomizedDense>::getNFeatures() const { return get(sumRandomized)->getNumberOfColumns(); }
+
+/**
+ * Sets partial result of the PCA randomized algorithm
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Pointer to the object
+ */
+void PartialResult<randomizedDense>::set(const PartialRandomizedResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+* Checks partial results of the PCA randomized algorithm
+* \param[in] input      %Input object of the algorithm
+* \param[in] parameter  Algorithm %parameter
+* \param[in] method     Computation method
+*/
+Status PartialResult<randomizedDense>::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const InputIface *in = static_cast<const InputIface *>(input);
+    DAAL_CHECK(!in->isCorrelation(), ErrorInputCorrelationNotSupportedInRandomizedMethod);
+    return checkImpl(in->getNFeatures(), parameter);
+}
+
+/**
+* Checks partial results of the PCA randomized algorithm
+* \param[in] par        Algorithm %parameter
+* \param[in] method     Computation method
+*/
+Status PartialResult<randomizedDense>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    return checkImpl(0, par);
+}
+
+Status PartialResult<randomizedDense>::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
+    int csrLayout = (int)NumericTableIface::csrArray;
+    int packedLayouts = packed_mask;
+    NumericTablePtr sumRandomized = get(pca::sumRandomized);
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(pca::nObservationsRandomized).get(), nObservationsRandomizedStr(), csrLayout, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(sumRandomized.get(), sumRandomizedStr(), packedLayouts, 0, nFeatures, 1));
+    nFeatures = sumRandomized->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(pca::sumSquaresRandomized).get(), sumSquaresRandomizedStr(), packedLayouts, 0, nFeatures, 1));
+
+    const RandomizedParameter *parameter = static_cast<const RandomizedParameter *>(par);
+    const size_t sketchSize = parameter->getSketchSize(nFeatures);
+    return checkNumericTable(get(pca::sketchRandomized).get(), sketchRandomizedStr(), packedLayouts, 0, nFeatures, sketchSize);
+}
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
@@ -68,7 +68,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const auto* par = static_cast<const BaseBatchParameter*>(parameter);
     DAAL_CHECK(par, services::ErrorNullPtr);
 
-    size_t nComponents = par->nComponents;
+    /* Only the randomized method computes a truncated number of components */
+    size_t nComponents = (method == randomizedDense ? par->nComponents : 0);
     DAAL_UINT64 resultsToCompute = par->resultsToCompute;
 
     auto impl = ResultImpl::cast(getStorage());
@@ -89,7 +90,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     const auto* par = static_cast<const BaseBatchParameter*>(parameter);
     DAAL_CHECK(par, services::ErrorNullPtr);
 
-    size_t nComponents = par->nComponents;
+    /* Only the randomized method computes a truncated number of components */
+    size_t nComponents = (method == randomizedDense ? par->nComponents : 0);
     DAAL_UINT64 resultsToCompute = par->resultsToCompute;
 
     auto impl = ResultImpl::cast(getStorage());
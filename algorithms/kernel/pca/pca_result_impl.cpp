@@ -46,6 +46,7 @@
 */
 
 #include "pca_result_impl.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -63,16 +64,30 @@ namespace interface2
 /**
 * Checks the results of the PCA algorithm implementation
 * \param[in] nFeatures      Number of features
+* \param[in] nComponents    Number of components
 * \param[in] nTables        Number of tables
 *
 * \return Status
 */
 services::Status ResultImpl::check(size_t nFeatures, size_t nComponents, size_t nTables) const
 {
-    Status status = interface1::ResultImpl::check(nFeatures, nTables);
-    DAAL_CHECK_STATUS_VAR(status);
-    // TODO:
-    return status;
+    DAAL_CHECK(size() == nTables, ErrorIncorrectNumberOfOutputNumericTables);
+    const int packedLayouts = packed_mask;
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(NumericTable::cast(get(eigenvalues)).get(), eigenvaluesStr(), packedLayouts, 0, 0, 1));
+
+    auto pEigenvalues = NumericTable::cast(get(eigenvalues));
+    auto pEigenvectors = NumericTable::cast(get(eigenvectors));
+    DAAL_CHECK(pEigenvectors, ErrorNullNumericTable);
+
+    /* Eigenvalues are computed either for all features or for the requested number of components */
+    const size_t nEigenvalues = pEigenvalues->getNumberOfColumns();
+    if (nFeatures)
+    {
+        DAAL_CHECK_EX(nEigenvalues == nFeatures || (nComponents > 0 && nEigenvalues == nComponents),
+            ErrorIncorrectNumberOfColumns, ArgumentName, eigenvaluesStr());
+    }
+    return checkNumericTable(pEigenvectors.get(), eigenvectorsStr(), packedLayouts, 0, nFeatures, nEigenvalues);
 }
 
 } // namespace interface2
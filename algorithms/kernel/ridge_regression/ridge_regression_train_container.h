@@ -99,7 +99,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
             compute, *(input->get(data)), *(input->get(dependentVariables)), *(m->getXTXTable()),       \
-            *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag, *(par->ridgeParameters));
+            *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag, *(par->ridgeParameters),          \
+            input->get(weights).get());
 }
 
 /**
@@ -134,7 +135,7 @@ services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
 
     __DAAL_CALL_KERNEL(env, internal::OnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),   \
             compute, *(input->get(data)), *(input->get(dependentVariables)), *(m->getXTXTable()),       \
-            *(m->getXTYTable()), par->interceptFlag);
+            *(m->getXTYTable()), par->interceptFlag, input->get(weights).get());
 }
 
 /**
@@ -69,9 +69,10 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
                                                                          NumericTable &xty,
                                                                          NumericTable &beta,
                                                                          bool interceptFlag,
-                                                                         const NumericTable &ridge) const
+                                                                         const NumericTable &ridge,
+                                                                         const NumericTable *w) const
 {
-    Status st = UpdateKernelType::compute(x, y, xtx, xty, true, interceptFlag);
+    Status st = UpdateKernelType::compute(x, y, xtx, xty, true, interceptFlag, w);
     if (st)
         st = FinalizeKernelType::compute(xtx, xty, xtx, xty, beta, interceptFlag,
                                          KernelHelper<algorithmFPType, cpu>(ridge));
@@ -81,9 +82,9 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(
     const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-    bool interceptFlag) const
+    bool interceptFlag, const NumericTable *w) const
 {
-    return UpdateKernelType::compute(x, y, xtx, xty, false, interceptFlag);
+    return UpdateKernelType::compute(x, y, xtx, xty, false, interceptFlag, w);
 }
 
 template <typename algorithmFPType, CpuType cpu>
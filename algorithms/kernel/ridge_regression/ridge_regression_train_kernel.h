@@ -90,7 +90,7 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx,
                    NumericTable &xty, NumericTable &beta, bool interceptFlag,
-                   const NumericTable &ridge) const;
+                   const NumericTable &ridge, const NumericTable *w) const;
 };
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
@@ -104,7 +104,7 @@ class OnlineKernel<algorithmFPType, training::normEqDense, cpu> : public daal::a
     typedef linear_model::normal_equations::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-                   bool interceptFlag) const;
+                   bool interceptFlag, const NumericTable *w) const;
 
     Status finalizeCompute(const NumericTable &xtx, const NumericTable &xty, NumericTable &xtxFinal, NumericTable &xtyFinal,
                            NumericTable &beta, bool interceptFlag, const NumericTable &ridge) const;
@@ -1068,6 +1068,32 @@ DAAL_FORCEINLINE void introSort(RandomAccessIterator first, RandomAccessIterator
     internalIntroSort<cpu>(first, last, last - first);
 }
 
+/* Partially reorders [first, last) so that *nth is the element that would be there if the range were sorted,
+   elements before nth are not greater than it and elements after nth are not less than it */
+template <CpuType cpu, typename RandomAccessIterator>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+    while (DAAL_INSERTION_SORT_MAX_SIZE_IN_INTROSORT < last - first)
+    {
+        RandomAccessIterator partFirst, partLast;
+        partition3<cpu>(first, last, partFirst, partLast);
+
+        if (nth < partFirst)
+        {
+            last = partFirst;
+        }
+        else if (partLast <= nth)
+        {
+            first = partLast;
+        }
+        else
+        {
+            return;
+        }
+    }
+    introSort<cpu>(first, last);
+}
+
 template <CpuType cpu, typename ForwardIterator>
 ForwardIterator isSortedUntil(ForwardIterator first, ForwardIterator last)
 {
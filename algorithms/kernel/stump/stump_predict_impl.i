@@ -52,6 +52,8 @@
 #include "numeric_table.h"
 #include "daal_defines.h"
 #include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -77,21 +79,33 @@ services::Status StumpPredictKernel<method, algorithmFPtype, cpu>::compute(const
     const algorithmFPtype leftValue  = model->getLeftSubsetAverage<algorithmFPtype>();
     const algorithmFPtype rightValue = model->getRightSubsetAverage<algorithmFPtype>();
 
-    services::Status s;
+    const size_t splitFeature = model->getSplitFeature();
+    const size_t blockSize = 4096;
+    const size_t nBlocks = nVectors / blockSize + !!(nVectors % blockSize);
 
-    WriteOnlyColumns<algorithmFPtype, cpu> rBD(*rTable, 0, 0, nVectors);
-    DAAL_CHECK_STATUS(s, rBD.status());
-    algorithmFPtype* r = rBD.get();
+    /* Process blocks of observations in parallel */
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
 
-    ReadColumns<algorithmFPtype, cpu> xBD(*const_cast<NumericTable *>(xTable), model->getSplitFeature(), 0, nVectors);
-    DAAL_CHECK_STATUS(s, xBD.status());
-    const algorithmFPtype* x = xBD.get();
+        WriteOnlyColumns<algorithmFPtype, cpu> rBD(*rTable, 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBD);
+        algorithmFPtype* r = rBD.get();
 
-    for (size_t i = 0; i < nVectors; i++)
-    {
-        r[i] = ((x[i] < splitPoint) ? leftValue : rightValue);
-    }
-    return s;
+        ReadColumns<algorithmFPtype, cpu> xBD(*const_cast<NumericTable *>(xTable), splitFeature, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPtype* x = xBD.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; i++)
+        {
+            r[i] = ((x[i] < splitPoint) ? leftValue : rightValue);
+        }
+    });
+    return safeStat.detach();
 }
 
 } // namespace daal::algorithms::stump::prediction::internal
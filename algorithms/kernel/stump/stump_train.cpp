@@ -69,6 +69,49 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_STUMP_TRAINING_RESULT_ID);
+
+Input::Input() : classifier::training::Input(lastInputId + 1) {}
+
+/**
+ * Returns the input object of the decision stump training algorithm
+ * \param[in] id   Identifier of the input object, \ref InputId
+ * \return         Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(stump::training::InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the decision stump training algorithm
+ * \param[in] id    Identifier of the input object, \ref InputId
+ * \param[in] value Pointer to the input object
+ */
+void Input::set(stump::training::InputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the input object
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(parameter, method));
+
+    NumericTablePtr sortedIndicesTable = get(sortedIndices);
+    if(sortedIndicesTable)
+    {
+        const NumericTablePtr dataTable = get(classifier::training::data);
+        DAAL_CHECK_STATUS(s, checkNumericTable(sortedIndicesTable.get(), sortedIndicesStr(), 0, 0,
+                                               dataTable->getNumberOfRows(), dataTable->getNumberOfColumns()));
+    }
+    return s;
+}
+
 Result::Result() {}
 
 /**
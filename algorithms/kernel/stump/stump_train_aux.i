@@ -77,6 +77,7 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t
     const NumericTable *xTable = a[0];
     const NumericTable *yTable = a[1];
     const NumericTable *wTable = (n >= 3 ? a[2] : 0);
+    const NumericTable *sortedIndicesTable = (n >= 4 ? a[3] : 0);
 
     const size_t nFeatures = xTable->getNumberOfColumns();
     const size_t nVectors  = xTable->getNumberOfRows();
@@ -107,8 +108,8 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t
     {
         ReadColumns<algorithmFPtype, cpu> y(const_cast<NumericTable *>(yTable), 0, 0, nVectors);
         DAAL_CHECK_STATUS(s, y.status());
-        doStumpRegression(nVectors, nFeatures, xTable, (wTable ? wBlock.get() : wArray.get()), y.get(),
-            splitFeature, splitPoint, leftValue, rightValue);
+        DAAL_CHECK_STATUS(s, doStumpRegression(nVectors, nFeatures, xTable, (wTable ? wBlock.get() : wArray.get()), y.get(),
+            sortedIndicesTable, splitFeature, splitPoint, leftValue, rightValue));
     }
 
     r->setSplitFeature(splitFeature);
@@ -76,13 +76,14 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    stump::training::Input *input = static_cast<stump::training::Input *>(_in);
     stump::training::Result *result = static_cast<stump::training::Result *>(_res);
     size_t n = input->size();
-    NumericTable *a[3];
+    NumericTable *a[4];
     a[0] = static_cast<NumericTable *>(input->get(classifier::training::data).get());
     a[1] = static_cast<NumericTable *>(input->get(classifier::training::labels).get());
     a[2] = static_cast<NumericTable *>(input->get(classifier::training::weights).get());
+    a[3] = static_cast<NumericTable *>(input->get(stump::training::sortedIndices).get());
     stump::Model *r = static_cast<stump::Model *>(result->get(classifier::training::model).get());
 
     daal::services::Environment::env &env = *_env;
@@ -56,6 +56,7 @@
 #include "stump_train_kernel.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "stump_train_sorted_indices.i"
 
 namespace daal
 {
@@ -70,149 +71,24 @@ namespace internal
 using namespace daal::internal;
 
 /**
- *  \brief Quick sort function that sorts array x and rearranges arrays w,z
- *         accordingly
- *
- *  \param n[in] Length of input arrays
- *  \param x     Array that is used as "key" when sorted
- *  \param w     Array that is used as "value" when sorted
- *  \param z     Array that is used as "value" when sorted
- */
-template <Method method, typename algorithmFPtype, CpuType cpu>
-void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w,
-                                                                 algorithmFPtype *z )
-{
-    int i, ir, j, k, jstack = -1, l = 0;
-    algorithmFPtype a, b, c, tmp;
-    const int M = 7, NSTACK = 128;
-    algorithmFPtype istack[NSTACK];
-
-    ir = n - 1;
-
-    for(;;)
-    {
-        if(ir - l < M)
-        {
-            for(j = l + 1; j <= ir; j++)
-            {
-                a = x[j];
-                b = w[j];
-                c = z[j];
-
-                for(i = j - 1; i >= l; i--)
-                {
-                    if(x[i] <= a) { break; }
-                    x[i + 1] = x[i];
-                    w[i + 1] = w[i];
-                    z[i + 1] = z[i];
-                }
-
-                x[i + 1] = a;
-                w[i + 1] = b;
-                z[i + 1] = c;
-            }
-
-            if(jstack < 0) { break; }
-
-            ir = istack[jstack--];
-            l = istack[jstack--];
-        }
-        else
-        {
-            k = (l + ir) >> 1;
-            daal::services::internal::swap<cpu, algorithmFPtype>(x[k], x[l + 1]);
-            daal::services::internal::swap<cpu, algorithmFPtype>(w[k], w[l + 1]);
-            daal::services::internal::swap<cpu, algorithmFPtype>(z[k], z[l + 1]);
-            if(x[l] > x[ir])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l], x[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l], w[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l], z[ir]);
-            }
-            if(x[l + 1] > x[ir])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l + 1], x[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l + 1], w[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l + 1], z[ir]);
-            }
-            if(x[l] > x[l + 1])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l], x[l + 1]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l], w[l + 1]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l], z[l + 1]);
-            }
-            i = l + 1;
-            j = ir;
-            a = x[l + 1];
-            b = w[l + 1];
-            c = z[l + 1];
-            for(;;)
-            {
-                while(x[++i] < a);
-                while(x[--j] > a);
-                if(j < i) { break; }
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[i], x[j]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[i], w[j]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[i], z[j]);
-            }
-            x[l + 1] = x[j];
-            w[l + 1] = w[j];
-            z[l + 1] = z[j];
-
-            x[j] = a;
-            w[j] = b;
-            z[j] = c;
-            jstack += 2;
-
-            if(ir - i + 1 >= j - l)
-            {
-                istack[jstack  ] = ir ;
-                istack[jstack - 1] = i  ;
-                ir = j - 1;
-            }
-            else
-            {
-                istack[jstack  ] = j - 1;
-                istack[jstack - 1] = l  ;
-                l = i;
-            }
-        }
-    }
-
-    return;
-}
-
-/**
- *  \brief Fit the function f[j] by a weighted least-squares
- *  regression of x to z with weigths w.
- *  Process ordered or numerical feature
- *
- *  \param n[in]        Number of observations
- *  \param x[in]        Input data feature of size n
- *  \param w[in]        Array of weights of size n
- *  \param z[in]        Array of weights of responses of size n
- *  \param sumW[in]     Total sum of weights
- *  \param sumM[in]     Total sum of weighted responses
- *  \param sumS[in]     Total sum of weighted squares of responses
- *  \param minS[out]       Value of goal function obtained for the best split
- *  \param splitPoint[out] Resulting split point
- *  \param lMean[out]      "left" average of weighted responses
- *                            for resulting split
- *  \param rMean[out]      "right" average of weighted responses
- *                            for resulting split
+ *  \brief Find the best split of the ordered feature x by scanning the observations
+ *         in the order given by sortedIndices, which must be the ascending order of x
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
-services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size_t nVectors,
-    const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z,
-                                                                            algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+template <typename IndexType>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::findOrderedSplit(size_t nVectors,
+    const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z, const IndexType *sortedIndices,
+    algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
     algorithmFPtype &minS, algorithmFPtype& splitPoint,
     algorithmFPtype& lMean, algorithmFPtype& rMean)
 {
     const algorithmFPtype THR = 1e-10;
     const algorithmFPtype C05 = (algorithmFPtype)0.5;
-    splitPoint = 0.0;
-    lMean = 0.0;
-    rMean = 0.0;
+
+    algorithmFPtype bestS = minS;
+    algorithmFPtype bestT = 0.0;
+    algorithmFPtype bestLMean = 0.0;
+    algorithmFPtype bestRMean = 0.0;
 
     algorithmFPtype lw, rw;  /* sums of weights in the left and right regions */
     algorithmFPtype lm, rm;  /* weighted means of the responses z of the left and right
@@ -223,22 +99,6 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegression
     algorithmFPtype lc, rc;  /* goal functions of the left and right regions
                       (see (9.13) in [2]) */
 
-    /* Allocate memory for storing intermediate data */
-    TArray<algorithmFPtype, cpu> aXX(nVectors);
-    TArray<algorithmFPtype, cpu> aWW(nVectors);
-    TArray<algorithmFPtype, cpu> aZZ(nVectors);
-    algorithmFPtype *xx = aXX.get();
-    algorithmFPtype *ww = aWW.get();
-    algorithmFPtype *zz = aZZ.get();
-
-    DAAL_CHECK(xx && ww && zz, services::ErrorMemoryAllocationFailed);
-
-    daal::services::daal_memcpy_s(ww, nVectors * sizeof(algorithmFPtype), w, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(zz, nVectors * sizeof(algorithmFPtype), z, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
-
-    StumpQSort(nVectors, xx, ww, zz);
-
     lw = 0.0;
     lM = 0.0;
     ls = 0.0;
@@ -246,28 +106,30 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegression
     rM = sumM;
     rs = sumS;
 
+    if (nVectors == 0) { return; }
+
     /* Seek split point s. */
-    for (size_t k = 0; k < nVectors - 1; k++)
+    size_t iCur = sortedIndices[0];
+    for (size_t k = 0; k + 1 < nVectors; k++)
     {
+        const size_t iNext = sortedIndices[k + 1];
+        const algorithmFPtype xCur  = x[iCur];
+        const algorithmFPtype xNext = x[iNext];
+
         /* Move points one-by-one from the right regoin into the left
            and choose the optimal split */
-        algorithmFPtype wz = ww[k] * zz[k];
-        algorithmFPtype wzz = wz * zz[k];
+        algorithmFPtype wz = w[iCur] * z[iCur];
+        algorithmFPtype wzz = wz * z[iCur];
 
-        lw += ww[k];
+        lw += w[iCur];
         lM += wz;
         ls += wzz;
-        rw -= ww[k];
+        rw -= w[iCur];
         rM -= wz;
         rs -= wzz;
+        iCur = iNext;
 
-        if (xx[k] == xx[k + 1]) { continue; }
-
-        /* Current split point */
-        algorithmFPtype curT = C05 * (xx[k] + xx[k + 1]);
-
-        /* Calculate weight; weighted mean and weighted sum of squares
-           over points left to curT */
+        if (xCur == xNext) { continue; }
 
         /* Calculate goal function (lc = Sum (ww[j]*(zz[j] - lm)*(zz[j] - lm))
            for the left region
@@ -282,9 +144,6 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegression
             lc = ls - lM * lm;
         }
 
-        /* Calculate weight; weighted mean and weighted sum of squares
-           over points right to curT */
-
         /* Calculate goal function (rc = Sum (ww[j]*(zz[j] - rm)*(zz[j] - rm))
            for the right region
            (See left right of (9.13) in [2]) */
@@ -300,22 +159,74 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegression
         /* Calculate goal function for the current split (See (9.13) in [2]) */
         sum = lc + rc;
 
-        if ( sum < minS )
+        if ( sum < bestS )
         {
             /* remember the minimal split point and weighted means */
-            minS = sum;
-            splitPoint  = curT;
-            lMean = lm;
-            rMean = rm;
+            bestS = sum;
+            bestT = C05 * (xCur + xNext);
+            bestLMean = lm;
+            bestRMean = rm;
         }
     }
-    return services::Status();
+
+    minS  = bestS;
+    splitPoint = bestT;
+    lMean = bestLMean;
+    rMean = bestRMean;
+}
+
+/**
+ *  \brief Find the split point of the ordered or numerical feature x that minimizes
+ *  the weighted sum of squared deviations of the responses z from the means
+ *  of the left and right regions
+ *
+ *  \param n[in]        Number of observations
+ *  \param x[in]        Input data feature of size n
+ *  \param w[in]        Array of weights of size n
+ *  \param z[in]        Array of responses of size n
+ *  \param sortedIndices[in]    Indices of observations in the ascending order of x,
+ *                               or NULL to sort them in the call
+ *  \param sumW[in]     Total sum of weights
+ *  \param sumM[in]     Total sum of weighted responses
+ *  \param sumS[in]     Total sum of weighted squares of responses
+ *  \param minS[out]       Value of goal function obtained for the best split
+ *  \param splitPoint[out] Resulting split point
+ *  \param lMean[out]      "left" average of weighted responses
+ *                            for resulting split
+ *  \param rMean[out]      "right" average of weighted responses
+ *                            for resulting split
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size_t nVectors,
+    const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z, const int *sortedIndices,
+    algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+    algorithmFPtype &minS, algorithmFPtype& splitPoint,
+    algorithmFPtype& lMean, algorithmFPtype& rMean)
+{
+    splitPoint = 0.0;
+    lMean = 0.0;
+    rMean = 0.0;
+
+    if (sortedIndices)
+    {
+        findOrderedSplit<int>(nVectors, x, w, z, sortedIndices, sumW, sumM, sumS, minS, splitPoint, lMean, rMean);
+        return services::Status();
+    }
+
+    /* Here if the indices are not presorted: sort this feature only */
+    TArray<size_t, cpu> aIdx(nVectors);
+    size_t *idx = aIdx.get();
+    DAAL_CHECK(idx, services::ErrorMemoryAllocationFailed);
+    services::Status s = sortIndices<algorithmFPtype, size_t, cpu>(nVectors, x, idx);
+    DAAL_CHECK_STATUS_VAR(s);
+    findOrderedSplit<size_t>(nVectors, x, w, z, idx, sumW, sumM, sumS, minS, splitPoint, lMean, rMean);
+    return s;
 }
 
 /**
- *  \brief Fit the function f[m*nk+j] by a weighted least-squares
- *  regression of z to x with weigths w.
- *  Process categorical feature
+ *  \brief Find the category of the categorical feature x that, separated from the other
+ *  categories, minimizes the weighted sum of squared deviations of the responses z
+ *  from the means of the two regions
  *
  *  \param n[in]              Number of observations
  *  \param nCategories[in]    Number of categories in input feature x
@@ -486,7 +397,7 @@ struct group_res
 template <Method method, typename algorithmFPtype, CpuType cpu>
 services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n, size_t dim, const NumericTable *x,
                                                                        const algorithmFPtype *w,
-                                                                       const algorithmFPtype *z,
+                                                                       const algorithmFPtype *z, const NumericTable *sortedIndices,
                                                                        size_t& splitFeature, algorithmFPtype& splitPoint,
                                                                        algorithmFPtype& leftValue, algorithmFPtype& rightValue)
 {
@@ -530,9 +441,13 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegressi
         {
             /* Here if feature k is not categorical */
             ReadColumns<algorithmFPtype, cpu> block(*const_cast<NumericTable*>(x), k, (size_t)0, n);
+            ReadRows<int, cpu> indicesBlock(const_cast<NumericTable*>(sortedIndices), k, 1);
             s = block.status();
             if(s)
-                s = stumpRegressionOrdered(n, block.get(), w, z, sumW, sumM, sumS, localMinS, localSplitPoint, localLMean, localRMean);
+                s = indicesBlock.status();
+            if(s)
+                s = stumpRegressionOrdered(n, block.get(), w, z, indicesBlock.get(),
+                                           sumW, sumM, sumS, localMinS, localSplitPoint, localLMean, localRMean);
         }
         if(!s)
         {
@@ -52,6 +52,7 @@
 #include "stump_model.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "service_numeric_table.h"
 
 using namespace daal::data_management;
 
@@ -73,14 +74,18 @@ public:
     services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
 
 private:
-    void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
-
     services::Status stumpRegressionOrdered(size_t nVectors,
-                                const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z,
+                                const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z, const int *sortedIndices,
                                 algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
                                 algorithmFPtype &minS, algorithmFPtype& splitPoint,
                                 algorithmFPtype& lMean, algorithmFPtype& rMean);
 
+    template <typename IndexType>
+    void findOrderedSplit(size_t nVectors, const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z,
+                          const IndexType *sortedIndices, algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                          algorithmFPtype &minS, algorithmFPtype& splitPoint,
+                          algorithmFPtype& lMean, algorithmFPtype& rMean);
+
     services::Status stumpRegressionCategorical(size_t n, size_t nCategories,
                                     const int *x, const algorithmFPtype *w, const algorithmFPtype *z,
                                     algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
@@ -91,7 +96,7 @@ private:
                      algorithmFPtype& sumS);
 
     services::Status doStumpRegression(size_t n, size_t dim, const NumericTable *x, const algorithmFPtype *w,
-        const algorithmFPtype *z, size_t& splitFeature, algorithmFPtype& splitPoint,
+        const algorithmFPtype *z, const NumericTable *sortedIndices, size_t& splitFeature, algorithmFPtype& splitPoint,
         algorithmFPtype& leftValue, algorithmFPtype& rightValue);
 };
 
@@ -0,0 +1,184 @@
+/* file: stump_train_sorted_indices.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Indices of observations sorted by the features, shared by the decision stumps
+//  trained on the same data set.
+//--
+*/
+
+#ifndef __STUMP_TRAIN_SORTED_INDICES_I__
+#define __STUMP_TRAIN_SORTED_INDICES_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_error_handling.h"
+#include "service_sort.h"
+#include "stump_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+
+/**
+ *  \brief Sort indices of observations by the values of the feature x
+ *
+ *  \param n[in]              Number of observations
+ *  \param x[in]              Input data feature of size n
+ *  \param sortedIndices[out] Indices of observations in the ascending order of x
+ */
+template <typename algorithmFPtype, typename IndexType, CpuType cpu>
+services::Status sortIndices(size_t n, const algorithmFPtype *x, IndexType *sortedIndices)
+{
+    TArray<algorithmFPtype, cpu> aXX(n);
+    algorithmFPtype *xx = aXX.get();
+    DAAL_CHECK(xx, services::ErrorMemoryAllocationFailed);
+
+    daal::services::daal_memcpy_s(xx, n * sizeof(algorithmFPtype), x, n * sizeof(algorithmFPtype));
+    for (size_t i = 0; i < n; i++)
+    {
+        sortedIndices[i] = (IndexType)i;
+    }
+    daal::algorithms::internal::qSort<algorithmFPtype, IndexType, cpu>(n, xx, sortedIndices);
+    return services::Status();
+}
+
+/**
+ *  \brief Compute the value of the stump::training::sortedIndices input for the data set x.
+ *         Row j of the result holds the indices of observations in the ascending order of feature j,
+ *         rows of categorical features are not used by the stump and hold the identity order.
+ *         The features are sorted in double precision, so that the order stays ascending
+ *         for the stumps that read the data in float or double.
+ *
+ *  \param x[in]               Training data set
+ *  \param sortedIndices[out]  Table of nFeatures x nVectors indices,
+ *                             left empty if the number of observations does not fit into int
+ */
+template <CpuType cpu>
+services::Status computeSortedIndices(const NumericTable &x, NumericTablePtr &sortedIndices)
+{
+    const size_t nFeatures = x.getNumberOfColumns();
+    const size_t nVectors  = x.getNumberOfRows();
+    if (nVectors > (size_t)daal::data_feature_utils::internal::MaxVal<int, cpu>::get())
+    {
+        return services::Status();
+    }
+
+    services::Status s;
+    services::SharedPtr<HomogenNumericTableCPU<int, cpu> > table = HomogenNumericTableCPU<int, cpu>::create(nVectors, nFeatures, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    int *indices = table->getArray();
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t k)
+    {
+        int *featureIndices = indices + k * nVectors;
+        if (x.getFeatureType(k) == data_management::data_feature_utils::DAAL_CATEGORICAL)
+        {
+            for (size_t i = 0; i < nVectors; i++)
+            {
+                featureIndices[i] = (int)i;
+            }
+            return;
+        }
+        ReadColumns<double, cpu> block(const_cast<NumericTable &>(x), k, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS_THR(block);
+        services::Status localStatus = sortIndices<double, int, cpu>(nVectors, block.get(), featureIndices);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    sortedIndices = table;
+    return s;
+}
+
+/**
+ *  \brief Return the input of the weak learner training algorithm as the decision stump training input,
+ *         or null if the weak learner is not a decision stump
+ */
+inline stump::training::Input *getStumpInput(classifier::training::Input *input)
+{
+    return dynamic_cast<stump::training::Input *>(input);
+}
+
+/**
+ *  \brief Share the indices of observations sorted by the features of x between
+ *         all models trained with the weak learner training algorithm, if it is a decision stump.
+ *         Boosting algorithms call it once per training, before the first weak learner is trained.
+ *
+ *  \param input[in,out]  %Input of the weak learner training algorithm
+ *  \param x[in]          Training data set
+ */
+template <CpuType cpu>
+services::Status setSortedIndices(classifier::training::Input *input, const NumericTable &x)
+{
+    stump::training::Input *stumpInput = getStumpInput(input);
+    if (!stumpInput)
+    {
+        return services::Status();
+    }
+    NumericTablePtr sortedIndices;
+    services::Status s = computeSortedIndices<cpu>(x, sortedIndices);
+    if (s)
+    {
+        stumpInput->set(stump::training::sortedIndices, sortedIndices);
+    }
+    return s;
+}
+
+} // namespace daal::algorithms::stump::training::internal
+}
+}
+}
+} // namespace daal
+
+#endif
@@ -71,6 +71,11 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *in = static_cast<const Input *>(input);
+    if(method == randomizedDense)
+    {
+        const RandomizedParameter *par = static_cast<const RandomizedParameter *>(parameter);
+        return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows(), par->nComponents);
+    }
     return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
 }
 
@@ -106,6 +111,27 @@ DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n)
     return st;
 }
 
+/**
+ * Allocates memory to store the truncated results of the SVD algorithm:
+ * k singular values, the n x k matrix of left singular vectors and k right singular vectors of size m
+ * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  m  Number of columns in the input data set
+ * \param[in]  n  Number of rows in the input data set
+ * \param[in]  k  Number of singular values and vectors to store
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n, size_t k)
+{
+    Status st;
+    set(singularValues, HomogenNumericTable<algorithmFPType>::create(k, 1, NumericTable::doAllocate, &st));
+    set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, k, NumericTable::doAllocate, &st));
+    if(n != 0)
+    {
+        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(k, n, NumericTable::doAllocate, &st));
+    }
+    return st;
+}
+
 }// namespace interface1
 }// namespace svd
 }// namespace algorithms
@@ -58,6 +58,7 @@ namespace interface1
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, daal::algorithms::Parameter *parameter, const int method);
 template DAAL_EXPORT services::Status Result::allocateImpl<DAAL_FPTYPE>(size_t m, size_t n);
+template DAAL_EXPORT services::Status Result::allocateImpl<DAAL_FPTYPE>(size_t m, size_t n, size_t k);
 
 }// namespace interface1
 }// namespace svd
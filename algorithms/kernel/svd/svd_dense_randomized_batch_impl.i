@@ -0,0 +1,243 @@
+/* file: svd_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "svd_dense_randomized_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+
+/**
+ *  Randomized SVD of the n x p data set X:
+ *  Q = orth(omega), Q = orth(X^T * X * Q) nPowerIterations + 1 times, so that Q spans the leading right singular subspace,
+ *  then the thin SVD of B = X * Q = Ub * S * Wr^T gives X ~ Ub * S * (Q * Wr)^T.
+ *  Every product with X^T * X and the product B = X * Q are one pass over the data set
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable *const *a,
+                                                                       const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    const RandomizedParameter *parameter = static_cast<const RandomizedParameter *>(par);
+    NumericTable &data = *const_cast<NumericTable *>(a[0]);
+
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t nVectors = data.getNumberOfRows();
+    const size_t nComponents = parameter->nComponents;
+    const size_t sketchSize = parameter->getSketchSize(nFeatures);
+    const size_t matrixSize = nFeatures * sketchSize;
+
+    TArray<algorithmFPType, cpu> matricesArray(2 * matrixSize);
+    TArray<algorithmFPType, cpu> bArray(nVectors * sketchSize);
+    TArray<algorithmFPType, cpu> squareArray(2 * sketchSize * sketchSize + sketchSize);
+    DAAL_CHECK_MALLOC(matricesArray.get() && bArray.get() && squareArray.get());
+
+    algorithmFPType *q = matricesArray.get();
+    algorithmFPType *y = q + matrixSize;
+    algorithmFPType *b = bArray.get();
+    algorithmFPType *ur = squareArray.get();
+    algorithmFPType *vrt = ur + sketchSize * sketchSize;
+    algorithmFPType *sigma = vrt + sketchSize * sketchSize;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, this->generateTestMatrix(nFeatures, sketchSize, parameter->seed, q));
+    DAAL_CHECK_STATUS(s, this->orthonormalize(nFeatures, sketchSize, q));
+
+    for (size_t it = 0; it <= parameter->nPowerIterations; it++)
+    {
+        for (size_t i = 0; i < matrixSize; i++)
+        {
+            y[i] = 0;
+        }
+        DAAL_CHECK_STATUS(s, this->processBlocks(data, q, sketchSize, 0, 0, 0, y));
+        algorithmFPType *tmp = q;
+        q = y;
+        y = tmp;
+        DAAL_CHECK_STATUS(s, this->orthonormalize(nFeatures, sketchSize, q));
+    }
+
+    DAAL_CHECK_STATUS(s, multiplyByData(data, sketchSize, q, b));
+    DAAL_CHECK_STATUS(s, decomposeProjection(nVectors, sketchSize, b, sigma, ur, vrt));
+
+    const char trans = 'T';
+    const char notrans = 'N';
+    const algorithmFPType one = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT n = (DAAL_INT)nVectors;
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT l = (DAAL_INT)sketchSize;
+    const DAAL_INT k = (DAAL_INT)nComponents;
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> singularValuesBlock(r[0], 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(singularValuesBlock);
+        algorithmFPType *singularValuesArray = singularValuesBlock.get();
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            singularValuesArray[i] = sigma[i];
+        }
+    }
+
+    const Parameter *svdPar = static_cast<const Parameter *>(par);
+    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        /* Rows of the n x k table are the rows of Ub * Ur(:, 1:k), i.e. the column-major k x n matrix Ur(:, 1:k)^T * Ub^T */
+        WriteOnlyRows<algorithmFPType, cpu> leftBlock(r[1], 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(leftBlock);
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &trans, &k, &n, &l, &one, ur, &l, b, &n, &zero, leftBlock.get(), &k);
+    }
+
+    if (svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        /* Rows of the k x p table are the right singular vectors, i.e. the column-major p x k matrix Q * Wr(:, 1:k) */
+        WriteOnlyRows<algorithmFPType, cpu> rightBlock(r[2], 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(rightBlock);
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &p, &k, &l, &one, q, &p, vrt, &l, &zero, rightBlock.get(), &p);
+    }
+    return s;
+}
+
+/** b = X * q, stored as the column-major nVectors x sketchSize matrix */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::multiplyByData(NumericTable& data, size_t sketchSize,
+                                                                              const algorithmFPType *q, algorithmFPType *b) const
+{
+    const size_t nFeatures = data.getNumberOfColumns();
+    const size_t nRows = data.getNumberOfRows();
+    const size_t blockSize = pca::internal::PCARandomizedBase<algorithmFPType, cpu>::blockSize;
+    const size_t nBlocks = nRows / blockSize + !!(nRows % blockSize);
+
+    const char trans = 'T';
+    const char notrans = 'N';
+    const algorithmFPType one = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT n = (DAAL_INT)nRows;
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT l = (DAAL_INT)sketchSize;
+
+    ReadRows<algorithmFPType, cpu> dataBlock(data, 0, 0);
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nBlockRows = (iBlock == nBlocks - 1) ? nRows - startRow : blockSize;
+        const algorithmFPType *x = dataBlock.next(startRow, nBlockRows);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock);
+
+        const DAAL_INT m = (DAAL_INT)nBlockRows;
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &m, &l, &p, &one, x, &p, q, &p, &zero, b + startRow, &n);
+    }
+    return Status();
+}
+
+/**
+ *  Thin SVD of the column-major nVectors x sketchSize matrix b = Qb * R, R = Ur * S * Wr^T.
+ *  On exit b holds Qb, sigma holds S in descending order, ur holds Ur and vrt holds Wr^T
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::decomposeProjection(size_t nVectors, size_t sketchSize, algorithmFPType *b,
+                                                                                   algorithmFPType *sigma, algorithmFPType *ur, algorithmFPType *vrt) const
+{
+    const DAAL_INT n = (DAAL_INT)nVectors;
+    const DAAL_INT l = (DAAL_INT)sketchSize;
+    DAAL_INT info = 0;
+
+    TArray<algorithmFPType, cpu> tauArray(sketchSize);
+    TArray<algorithmFPType, cpu> rArray(sketchSize * sketchSize);
+    DAAL_CHECK_MALLOC(tauArray.get() && rArray.get());
+    algorithmFPType *tau = tauArray.get();
+    algorithmFPType *rMatrix = rArray.get();
+
+    algorithmFPType workQuery[2];
+    Lapack<algorithmFPType, cpu>::xgeqrf(n, l, b, n, tau, workQuery, -1, &info);
+    DAAL_INT lwork = (DAAL_INT)workQuery[0];
+    Lapack<algorithmFPType, cpu>::xorgqr(n, l, l, b, n, tau, workQuery, -1, &info);
+    if ((DAAL_INT)workQuery[0] > lwork) { lwork = (DAAL_INT)workQuery[0]; }
+    Lapack<algorithmFPType, cpu>::xgesvd('A', 'A', l, l, rMatrix, l, sigma, ur, l, vrt, l, workQuery, -1, &info);
+    if ((DAAL_INT)workQuery[0] > lwork) { lwork = (DAAL_INT)workQuery[0]; }
+    if (lwork < 5 * l) { lwork = 5 * l; }
+
+    TArray<algorithmFPType, cpu> workArray(lwork);
+    DAAL_CHECK_MALLOC(workArray.get());
+    algorithmFPType *work = workArray.get();
+
+    Lapack<algorithmFPType, cpu>::xgeqrf(n, l, b, n, tau, work, lwork, &info);
+    DAAL_CHECK(info == 0, ErrorSvdIthParamIllegalValue);
+
+    for (size_t c = 0; c < sketchSize; c++)
+    {
+        for (size_t j = 0; j < sketchSize; j++)
+        {
+            rMatrix[c * sketchSize + j] = (j <= c ? b[c * nVectors + j] : algorithmFPType(0.0));
+        }
+    }
+
+    Lapack<algorithmFPType, cpu>::xorgqr(n, l, l, b, n, tau, work, lwork, &info);
+    DAAL_CHECK(info == 0, ErrorSvdIthParamIllegalValue);
+
+    Lapack<algorithmFPType, cpu>::xgesvd('A', 'A', l, l, rMatrix, l, sigma, ur, l, vrt, l, work, lwork, &info);
+    DAAL_CHECK(info >= 0, ErrorSvdIthParamIllegalValue);
+    DAAL_CHECK(info == 0, ErrorSvdXBDSQRDidNotConverge);
+    return Status();
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -130,6 +130,11 @@ Status Input::check(const daal::algorithms::Parameter *parameter, int method) co
     if(!s) { return s; }
 
     DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+    if(method == randomizedDense)
+    {
+        const RandomizedParameter *par = static_cast<const RandomizedParameter *>(parameter);
+        DAAL_CHECK_EX(par->nComponents <= dataTable->getNumberOfColumns(), ErrorIncorrectParameter, ParameterName, nComponentsStr());
+    }
     return Status();
 }
 
@@ -97,16 +97,17 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
     Parameter *svdPar   = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par  ));
     size_t nVectors = algInput->get(data)->getNumberOfRows();
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    size_t nComponents = (method == randomizedDense ? static_cast<RandomizedParameter *>(svdPar)->nComponents : nFeatures);
     int unexpectedLayouts = (int)packed_mask;
 
-    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nFeatures, 1);
+    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nComponents, 1);
     if(svdPar->rightSingularMatrix == requiredInPackedForm)
     {
-        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nComponents);
     }
     if(svdPar->leftSingularMatrix == requiredInPackedForm)
     {
-        s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+        s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nComponents, nVectors);
     }
     return s;
 }
@@ -50,6 +50,7 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_workspace.h"
 
 namespace daal
 {
@@ -100,7 +101,7 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
         const algorithmFPType *svCoeff = mtSVCoeff.get();
 
-        TArray<algorithmFPType, cpu> aBuf(nSV * nVectors);
+        TWorkspaceArray<algorithmFPType, cpu> aBuf(currentWorkspace(), nSV * nVectors);
         DAAL_CHECK(aBuf.get(), ErrorMemoryAllocationFailed);
         algorithmFPType *buf = aBuf.get();
 
@@ -69,6 +69,7 @@
 #include "service_numeric_table.h"
 #include "service_utils.h"
 #include "service_data_utils.h"
+#include "service_tracing.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -108,6 +109,7 @@ Status SVMTrainTask<algorithmFPType, cpu>::compute(const Parameter& svmPar)
     if(!s)
         return s;
 
+    DAAL_TRACE_SCOPE("svm.smo");
     size_t nActiveVectors(_nVectors);
     algorithmFPType curEps = MaxVal<algorithmFPType, cpu>::get();
     if(!svmPar.doShrinking)
@@ -0,0 +1,188 @@
+/* file: compression_framed_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of framed compression in the batch processing mode
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COMPRESSION_FRAMED_BATCH"></a>
+ * \example compression_framed_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+string datasetFileName  = "../data/batch/logitboost_train.csv";
+
+const size_t chunkSize = 16 * 1024;  /* Size of independently compressed chunks */
+
+DataBlock rawData;             /* Data to compress */
+DataBlock compressedData;      /* Result of compression */
+DataBlock deCompressedData;    /* Result of decompression */
+DataBlock rangeData;           /* Result of decompression of a range of bytes */
+size_t rangeOffset = 0;        /* Offset of the decompressed range in the raw data */
+
+void prepareMemory();
+void releaseMemory();
+void printCRC32();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Read data from a file and allocate memory */
+    prepareMemory();
+
+    /* Create a stream for framed compression with zlib, chunks are compressed in parallel */
+    FramedCompressionStream comprStream(zlib, level9, chunkSize);
+
+    /* Write raw data to the compression stream */
+    comprStream << rawData;
+
+    /* Get the size of the framed compressed data */
+    compressedData.setSize(comprStream.getCompressedDataSize());
+
+    /* Allocate memory to store the compressed data */
+    compressedData.setPtr(new byte[compressedData.getSize()]);
+
+    /* Store the compressed data */
+    comprStream.copyCompressedArray(compressedData);
+
+    /* Create a stream for decompression, compression method is read from the framed data */
+    FramedDecompressionStream deComprStream;
+
+    /* Write the compressed data to the decompression stream */
+    deComprStream << compressedData;
+
+    /* Get the size of the decompressed data */
+    deCompressedData.setSize(deComprStream.getDecompressedDataSize());
+
+    /* Allocate memory to store the decompressed data */
+    deCompressedData.setPtr(new byte[deCompressedData.getSize()]);
+
+    /* Decompress all chunks in parallel and store the decompressed data */
+    deComprStream.copyDecompressedArray(deCompressedData);
+
+    /* Decompress only the chunks that contain the last chunkSize bytes of the raw data */
+    rangeData.setSize(deCompressedData.getSize() < chunkSize ? deCompressedData.getSize() : chunkSize);
+    rangeData.setPtr(new byte[rangeData.getSize()]);
+    rangeOffset = deCompressedData.getSize() - rangeData.getSize();
+    deComprStream.copyDecompressedRange(rangeOffset, rangeData.getPtr(), rangeData.getSize());
+
+    /* Compute and print checksums for raw data and the decompressed data */
+    printCRC32();
+
+    releaseMemory();
+
+    return 0;
+}
+
+void prepareMemory()
+{
+    /* Allocate memory for raw data and read an input file */
+    byte *data;
+    rawData.setSize(readTextFile(datasetFileName, &data));
+    rawData.setPtr(data);
+}
+
+void printCRC32()
+{
+    unsigned int crcRawData = 0;
+    unsigned int crcDecompressedData = 0;
+    unsigned int crcRawRange = 0;
+    unsigned int crcDecompressedRange = 0;
+
+    /* Compute checksums for raw data and the decompressed data */
+    crcRawData = getCRC32(rawData.getPtr(), crcRawData, rawData.getSize());
+    crcDecompressedData = getCRC32(deCompressedData.getPtr(), crcDecompressedData, deCompressedData.getSize());
+    crcRawRange = getCRC32(rawData.getPtr() + rangeOffset, crcRawRange, rangeData.getSize());
+    crcDecompressedRange = getCRC32(rangeData.getPtr(), crcDecompressedRange, rangeData.getSize());
+
+    cout << endl << "Framed compression example program results:" << endl << endl;
+
+    cout << "Raw data checksum:    0x" << hex << crcRawData << endl;
+    cout << "Decompressed data checksum: 0x" << hex << crcDecompressedData << endl;
+    cout << "Decompressed range checksum: 0x" << hex << crcDecompressedRange << endl;
+
+    if (rawData.getSize() != deCompressedData.getSize())
+    {
+        cout << "ERROR: Decompressed data size mismatches with the raw data size" << endl;
+    }
+    else if (crcRawData != crcDecompressedData)
+    {
+        cout << "ERROR: Decompressed data CRC mismatches with the raw data CRC" << endl;
+    }
+    else if (crcRawRange != crcDecompressedRange)
+    {
+        cout << "ERROR: Decompressed range CRC mismatches with the raw data CRC" << endl;
+    }
+    else
+    {
+        cout << "OK: Decompressed data CRC matches with the raw data CRC" << endl;
+    }
+}
+
+void releaseMemory()
+{
+    if(compressedData.getPtr())
+    {
+        delete [] compressedData.getPtr();
+    }
+    if(deCompressedData.getPtr())
+    {
+        delete [] deCompressedData.getPtr();
+    }
+    if(rangeData.getPtr())
+    {
+        delete [] rangeData.getPtr();
+    }
+    if(rawData.getPtr())
+    {
+        delete [] rawData.getPtr();
+    }
+}
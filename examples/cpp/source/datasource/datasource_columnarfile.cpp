@@ -0,0 +1,114 @@
+/* file: datasource_columnarfile.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+
+/*
+!  Content:
+!    C++ example of writing and reading of the columnar table file
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_COLUMNARFILE"></a>
+ * \example datasource_columnarfile.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName  = "../data/batch/kmeans_dense.csv";
+string columnarFileName = "kmeans_dense.dcol";
+
+const size_t chunkRows = 1000;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> csvDataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                    DataSource::doDictionaryFromContext);
+    csvDataSource.loadDataBlock();
+
+    /* Write the data into the columnar table file, every chunk of columns is compressed with zlib */
+    {
+        ColumnarFileWriter writer(columnarFileName.c_str(), zlib, level9, chunkRows);
+        writer.write(*csvDataSource.getNumericTable());
+        services::Status s = writer.close();
+        if (!s)
+        {
+            cout << "Error: " << s.getDescription() << endl;
+            return -1;
+        }
+    }
+
+    /* Print the statistics of the first column stored for every chunk */
+    ColumnarFileDataSource<> dataSource(columnarFileName, DataSource::doAllocateNumericTable);
+    ColumnarFileReader &reader = dataSource.getReader();
+    cout << "Number of rows: " << reader.getNumberOfRows() << ", number of chunks: " << reader.getNumberOfChunks() << endl;
+    for (size_t i = 0; i < reader.getNumberOfChunks(); i++)
+    {
+        ColumnChunkStatistics statistics = reader.getChunkStatistics(i, 0);
+        cout << "Chunk " << i << ": rows " << reader.getChunkFirstRow(i) << " - "
+                  << reader.getChunkFirstRow(i) + reader.getChunkNumberOfRows(i) - 1
+                  << ", min " << statistics.minimum << ", max " << statistics.maximum << endl;
+    }
+
+    /* Create data source dictionary from the column descriptions stored in the file */
+    dataSource.createDictionaryFromContext();
+
+    /* Filter in 3 chosen columns, only the blocks of these columns are read and decompressed */
+    services::Collection<size_t> validList(3);
+    validList[0] = 1; validList[1] = 2; validList[2] = 5;
+    dataSource.getFeatureManager().addModifier( ColumnFilter().list(validList) );
+
+    /* Load 10 rows starting from the middle of the third chunk */
+    dataSource.seekRow(2 * chunkRows + chunkRows / 2);
+    dataSource.loadDataBlock(10);
+
+    /* Print result */
+    NumericTablePtr table = dataSource.getNumericTable();
+    printNumericTable(table, "Loaded data", 10);
+
+    return 0;
+}
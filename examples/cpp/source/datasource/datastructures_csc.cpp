@@ -0,0 +1,112 @@
+/* file: datastructures_csc.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Compressed sparse columns (CSC) data structures example.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_CSC">
+ * \example datastructures_csc.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+int main()
+{
+    std::cout << "Compressed sparse columns (CSC) numeric table example" << std::endl << std::endl;
+
+    const size_t nObservations  = 5;
+    const size_t nFeatures = 5;
+    const size_t firstReadRow = 1;
+    const size_t nRead = 3;
+    const size_t readFeature = 3;
+
+    /* Example of using CSC numeric table */
+    float  values[]     = {1, -2, -4, -1,  5,  8,  4,  2, -3,  6,  7,  4, -5};
+    size_t rowIndices[] = {1,  2,  4,  1,  2,  5,  3,  4,  1,  3,  4,  3,  5};
+    size_t colOffsets[] = {1,          4,          7,      9,         12,     14};
+
+    CSCNumericTablePtr dataTable = CSCNumericTable::create(values, rowIndices, colOffsets, nFeatures, nObservations);
+    checkPtr(dataTable.get());
+
+    /* Read values of a feature. The sparse structure is not converted */
+    BlockDescriptor<> block;
+    dataTable->getBlockOfColumnValues(readFeature, 0, nObservations, readOnly, block);
+    printArray<float>(block.getBlockPtr(), 1, block.getNumberOfRows(),
+                       "Print feature 3 from CSC data array as dense float array:");
+    dataTable->releaseBlockOfColumnValues(block);
+
+    /* Read block of rows in CSR format and write into it */
+    CSRBlockDescriptor<> csrBlock;
+    dataTable->getSparseBlock(firstReadRow, nRead, readWrite, csrBlock);
+    float *valuesBlock = csrBlock.getBlockValuesPtr();
+    size_t nValuesInBlock = csrBlock.getDataSize();
+    printArray<float>(valuesBlock, nValuesInBlock, 1,
+                      "Values in 3 rows from CSC data array:");
+    printArray<size_t>(csrBlock.getBlockColumnIndicesPtr(), nValuesInBlock, 1,
+                      "Columns indices in 3 rows from CSC data array:");
+    printArray<size_t>(csrBlock.getBlockRowIndicesPtr(), nRead + 1, 1,
+                      "Rows offsets in 3 rows from CSC data array:");
+    for (size_t i = 0; i < nValuesInBlock; i++)
+    {
+        valuesBlock[i] = -(1.0f + i);
+    }
+    dataTable->releaseSparseBlock(csrBlock);
+
+    /* Convert the table into CSR numeric table */
+    services::Status status;
+    CSRNumericTablePtr csrTable = CSRNumericTable::create<float>(dataTable, &status);
+    checkPtr(csrTable.get());
+
+    /* Read block of rows in dense format */
+    csrTable->getBlockOfRows(firstReadRow, nRead, readOnly, block);
+    std::cout << block.getNumberOfRows() << " rows are read" << std::endl << std::endl;
+    printArray<float>(block.getBlockPtr(), nFeatures, block.getNumberOfRows(),
+                       "Print 3 rows from converted CSR data array as dense float array:");
+    csrTable->releaseBlockOfRows(block);
+
+    return 0;
+}
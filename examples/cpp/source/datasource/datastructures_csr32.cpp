@@ -0,0 +1,109 @@
+/* file: datastructures_csr32.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Compressed sparse rows (CSR) data structures with 32-bit column indices example.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_CSR32">
+ * \example datastructures_csr32.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+int main()
+{
+    std::cout << "Compressed sparse rows (CSR) numeric table with 32-bit column indices example" << std::endl << std::endl;
+
+    const size_t nObservations  = 5;
+    const size_t nFeatures = 5;
+    const size_t firstReadRow = 1;
+    const size_t nRead = 3;
+
+    /* Example of using CSR numeric table with 32-bit column indices */
+    float        values[]     = {1, -1, -3, -2,  5,  4,  6,  4, -4,  2,  7,  8, -5};
+    unsigned int colIndices[] = {1,  2,  4,  1,  2,  3,  4,  5,  1,  3,  4,  2,  5};
+    size_t       rowOffsets[] = {1,          4,      6,          9,         12,     14};
+
+    CSR32NumericTablePtr dataTable = CSR32NumericTable::create(values, colIndices, rowOffsets, nFeatures, nObservations);
+    checkPtr(dataTable.get());
+
+    /* Read block of rows in CSR format with 32-bit column indices. Column indices are not copied */
+    CSRBlockDescriptor<float, unsigned int> csrBlock32;
+    dataTable->getSparseBlock(firstReadRow, nRead, readOnly, csrBlock32);
+    size_t nValuesInBlock = csrBlock32.getDataSize();
+    printArray<float>(csrBlock32.getBlockValuesPtr(), nValuesInBlock, 1,
+                      "Values in 3 rows from CSR data array:");
+    printArray<unsigned int>(csrBlock32.getBlockColumnIndicesPtr(), nValuesInBlock, 1,
+                      "32-bit columns indices in 3 rows from CSR data array:");
+    printArray<size_t>(csrBlock32.getBlockRowIndicesPtr(), nRead + 1, 1,
+                      "Rows offsets in 3 rows from CSR data array:");
+    dataTable->releaseSparseBlock(csrBlock32);
+
+    /* Read the same block of rows with column indices widened to size_t, as algorithms for CSR numeric tables do */
+    CSRBlockDescriptor<> csrBlock;
+    dataTable->getSparseBlock(firstReadRow, nRead, readOnly, csrBlock);
+    printArray<size_t>(csrBlock.getBlockColumnIndicesPtr(), csrBlock.getDataSize(), 1,
+                      "Columns indices in 3 rows from CSR data array:");
+    dataTable->releaseSparseBlock(csrBlock);
+
+    /* Convert the table into CSR numeric table with size_t column indices and back */
+    services::Status status;
+    CSRNumericTablePtr csrTable = CSRNumericTable::create<float>(dataTable, &status);
+    checkPtr(csrTable.get());
+    CSR32NumericTablePtr csr32Table = CSR32NumericTable::create<float>(csrTable, &status);
+    checkPtr(csr32Table.get());
+
+    /* Read block of rows in dense format */
+    BlockDescriptor<> block;
+    csr32Table->getBlockOfRows(firstReadRow, nRead, readOnly, block);
+    std::cout << block.getNumberOfRows() << " rows are read" << std::endl << std::endl;
+    printArray<float>(block.getBlockPtr(), nFeatures, block.getNumberOfRows(),
+                       "Print 3 rows from converted CSR data array as dense float array:");
+    csr32Table->releaseBlockOfRows(block);
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/* file: em_gmm_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_DISTRIBUTED"></a>
+ * \example em_gmm_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float  dataFPType;          /* Data floating-point type */
+
+/* Input data set parameters */
+const std::string datasetFileName = "../data/batch/em_gmm.csv" ;
+const size_t nComponents     = 2;
+const size_t nIterations     = 10;
+const size_t nBlocks         = 4;
+const size_t nVectorsInBlock = 25;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+            DataSource::doDictionaryFromContext);
+    dataSource.loadDataBlock();
+    NumericTablePtr fullData = dataSource.getNumericTable();
+
+    /* Compute initial values for the EM algorithm for the GMM */
+    em_gmm::init::Batch<> initAlgorithm(nComponents);
+    initAlgorithm.input.set(em_gmm::init::data, fullData);
+    initAlgorithm.compute();
+
+    em_gmm::Distributed<step2Master> masterAlgorithm(nComponents);
+    em_gmm::ResultPtr model;
+
+    for(size_t it = 0; it < nIterations; it++)
+    {
+        /* Each block of observations plays the role of a local node */
+        FileDataSource<CSVFeatureManager> blockSource(datasetFileName, DataSource::doAllocateNumericTable,
+                DataSource::doDictionaryFromContext);
+
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            blockSource.loadDataBlock(nVectorsInBlock);
+
+            /* Compute sufficient statistics of the block with respect to the current model */
+            em_gmm::Distributed<step1Local> localAlgorithm(nComponents);
+            localAlgorithm.input.set(em_gmm::data, blockSource.getNumericTable());
+            if(it == 0)
+            {
+                localAlgorithm.input.set(em_gmm::inputValues, initAlgorithm.getResult());
+            }
+            else
+            {
+                localAlgorithm.input.set(em_gmm::inputValues, model);
+            }
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(em_gmm::partialResults, localAlgorithm.getPartialResult());
+        }
+
+        /* Merge the statistics and compute the next values of the model parameters */
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+        model = masterAlgorithm.getResult();
+
+        /* Start the next iteration with an empty collection of partial results */
+        masterAlgorithm.input.set(em_gmm::partialResults, DataCollectionPtr(new DataCollection()));
+    }
+
+    printNumericTable(model->get(em_gmm::weights), "Weights");
+    printNumericTable(model->get(em_gmm::means), "Means");
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        printNumericTable(model->get(em_gmm::covariances, i), "Covariance");
+    }
+    printNumericTable(model->get(em_gmm::goalFunction), "Log-likelyhood of the data:");
+
+    /* Score the observations against the trained model */
+    em_gmm::prediction::Batch<> predictAlgorithm(nComponents);
+    predictAlgorithm.input.set(em_gmm::prediction::data, fullData);
+    predictAlgorithm.input.set(em_gmm::prediction::inputValues, model);
+    predictAlgorithm.compute();
+
+    em_gmm::prediction::ResultPtr prediction = predictAlgorithm.getResult();
+    printNumericTable(prediction->get(em_gmm::prediction::responsibilities), "First 10 responsibilities:", 10);
+    printNumericTable(prediction->get(em_gmm::prediction::logLikelihood), "First 10 log-likelyhood values:", 10);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/* file: log_reg_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of logistic regression in the batch processing mode.
+!
+!    The program trains the multinomial logistic regression model with L1 penalty
+!    on a training data set in compressed sparse rows (CSR) format and computes
+!    classification for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_CSR_BATCH"></a>
+ * \example log_reg_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::logistic_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName     = "../data/batch/naivebayes_train_csr.csv";
+string trainGroundTruthFileName = "../data/batch/naivebayes_train_labels.csv";
+
+string testDatasetFileName      = "../data/batch/naivebayes_test_csr.csv";
+string testGroundTruthFileName  = "../data/batch/naivebayes_test_labels.csv";
+
+const size_t nTrainObservations = 8000;
+const size_t nTestObservations  = 2000;
+
+/* Logistic regression training parameters */
+const double l1Penalty = 0.001;
+const size_t maxIterations = 200;
+
+const size_t nClasses = 20;  /* Number of classes */
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr& res);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the labels from a .csv file */
+    FileDataSource<CSVFeatureManager> trainGroundTruthSource(trainGroundTruthFileName,
+                                                             DataSource::doAllocateNumericTable,
+                                                             DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from input files */
+    CSRNumericTablePtr trainData(createSparseTable<float>(trainDatasetFileName));
+    trainGroundTruthSource.loadDataBlock(nTrainObservations);
+
+    /* Create an algorithm object to train the logistic regression model with the L-BFGS method */
+    training::Batch<float, training::lbfgs> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainGroundTruthSource.getNumericTable());
+
+    algorithm.parameter().l1Penalty = l1Penalty;
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the logistic regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    return trainingResult;
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    /* Retrieve the test data from a .csv file */
+    CSRNumericTablePtr testData(createSparseTable<float>(testDatasetFileName));
+
+    /* Create an algorithm object to predict classes with the logistic regression model */
+    prediction::Batch<float> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Predict classes with the logistic regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+
+    FileDataSource<CSVFeatureManager> testGroundTruth(testGroundTruthFileName,
+                                                      DataSource::doAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+    testGroundTruth.loadDataBlock(nTestObservations);
+
+    printNumericTables<int, int>(testGroundTruth.getNumericTable().get(),
+                                 predictionResult->get(classifier::prediction::prediction).get(),
+                                 "Ground truth", "Classification results",
+                                 "Logistic regression classification results (first 20 observations):", 20);
+}
@@ -0,0 +1,156 @@
+/* file: log_reg_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of logistic regression in the batch processing mode.
+!
+!    The program trains the multinomial logistic regression model on a training
+!    data set with the L-BFGS method and computes classes labels and their
+!    probabilities for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_DENSE_BATCH"></a>
+ * \example log_reg_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::logistic_regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_classification_train.csv";
+const string testDatasetFileName  = "../data/batch/df_classification_test.csv";
+const size_t nFeatures  = 3;  /* Number of features in training and testing data sets */
+
+/* Logistic regression training parameters */
+const double l2Penalty = 0.01;
+
+const size_t nClasses = 5;  /* Number of classes */
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr& res);
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the logistic regression model */
+    training::Batch<> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainDependentVariable);
+
+    algorithm.parameter().l2Penalty = l2Penalty;
+
+    /* Build the logistic regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    printNumericTable(trainingResult->get(classifier::training::model)->getBeta(), "Logistic regression model coefficients:");
+    return trainingResult;
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict classes with the logistic regression model */
+    prediction::Batch<> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+    algorithm.parameter().resultsToCompute = prediction::computeClassesLabels | prediction::computeClassesProbabilities;
+
+    /* Predict classes with the logistic regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(classifier::prediction::prediction),
+        "Logistic regression prediction results (first 10 rows):", 10);
+    printNumericTable(predictionResult->get(prediction::probabilities),
+        "Logistic regression prediction probabilities (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,111 @@
+/* file: descriptive_stats_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments, the variance-covariance matrix,
+!    quantiles and sorted observations in one data scan in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DESCRIPTIVE_STATISTICS_DENSE_BATCH">
+ * \example descriptive_stats_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+/* Quantile orders */
+const size_t nQuantileOrders = 3;
+double quantileOrders[nQuantileOrders] = { 0.25, 0.5, 0.75 };
+
+void printResults(const descriptive_statistics::ResultPtr &res);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute descriptive statistics using the default method */
+    descriptive_statistics::Batch<> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(descriptive_statistics::data, dataSource.getNumericTable());
+
+    /* Request all statistics. They are computed from one scan of the input data */
+    algorithm.parameter.statisticsToCompute = descriptive_statistics::allStatistics;
+    algorithm.parameter.quantileOrders = HomogenNumericTable<>::create(quantileOrders, nQuantileOrders, 1);
+
+    /* Compute the descriptive statistics */
+    algorithm.compute();
+
+    /* Print the results */
+    printResults(algorithm.getResult());
+
+    return 0;
+}
+
+void printResults(const descriptive_statistics::ResultPtr &res)
+{
+    low_order_moments::ResultPtr moments = res->get(descriptive_statistics::lowOrderMomentsResult);
+    printNumericTable(moments->get(low_order_moments::minimum),           "Minimum:");
+    printNumericTable(moments->get(low_order_moments::maximum),           "Maximum:");
+    printNumericTable(moments->get(low_order_moments::mean),              "Mean:");
+    printNumericTable(moments->get(low_order_moments::variance),          "Variance:");
+    printNumericTable(moments->get(low_order_moments::standardDeviation), "Standard deviation:");
+
+    printNumericTable(res->get(descriptive_statistics::covarianceResult)->get(covariance::covariance), "Covariance matrix:");
+    printNumericTable(res->get(descriptive_statistics::quantilesResult)->get(quantiles::quantiles), "Quantiles:");
+    printNumericTable(res->get(descriptive_statistics::sortingResult)->get(sorting::sortedData), "Sorted data (first 10 rows):", 10);
+}
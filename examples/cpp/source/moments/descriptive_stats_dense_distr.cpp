@@ -0,0 +1,149 @@
+/* file: descriptive_stats_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments and the variance-covariance
+!    matrix in one data scan in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DESCRIPTIVE_STATISTICS_DENSE_DISTRIBUTED">
+ * \example descriptive_stats_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const size_t nBlocks         = 4;
+
+const string datasetFileNames[] =
+{
+    "../data/distributed/covcormoments_dense_1.csv",
+    "../data/distributed/covcormoments_dense_2.csv",
+    "../data/distributed/covcormoments_dense_3.csv",
+    "../data/distributed/covcormoments_dense_4.csv"
+};
+
+descriptive_statistics::PartialResultPtr partialResult[nBlocks];
+descriptive_statistics::ResultPtr result;
+
+void computestep1Local(size_t i);
+void computeOnMasterNode();
+
+void printResults(const descriptive_statistics::ResultPtr &res);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    printResults(result);
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute descriptive statistics in the distributed processing mode using the default method */
+    descriptive_statistics::Distributed<step1Local> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(descriptive_statistics::data, dataSource.getNumericTable());
+
+    /* Compute the partial low order moments and covariance estimates on nodes */
+    algorithm.compute();
+
+    /* Get the computed partial estimates */
+    partialResult[block] = algorithm.getPartialResult();
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to compute descriptive statistics in the distributed processing mode using the default method */
+    descriptive_statistics::Distributed<step2Master> algorithm;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(descriptive_statistics::partialResults, partialResult[i]);
+    }
+
+    /* Merge the partial estimates computed on local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed statistics */
+    result = algorithm.getResult();
+}
+
+void printResults(const descriptive_statistics::ResultPtr &res)
+{
+    low_order_moments::ResultPtr moments = res->get(descriptive_statistics::lowOrderMomentsResult);
+    printNumericTable(moments->get(low_order_moments::minimum),           "Minimum:");
+    printNumericTable(moments->get(low_order_moments::maximum),           "Maximum:");
+    printNumericTable(moments->get(low_order_moments::mean),              "Mean:");
+    printNumericTable(moments->get(low_order_moments::variance),          "Variance:");
+
+    covariance::ResultPtr cov = res->get(descriptive_statistics::covarianceResult);
+    printNumericTable(cov->get(covariance::covariance), "Covariance matrix:");
+    printNumericTable(cov->get(covariance::mean),       "Mean vector:");
+}
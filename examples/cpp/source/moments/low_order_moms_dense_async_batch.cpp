@@ -0,0 +1,104 @@
+/* file: low_order_moms_dense_async_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+/*
+!  Content:
+!    C++ example of computing low order moments and the correlation matrix
+!    concurrently in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_ASYNC_BATCH">
+ * \example low_order_moms_dense_async_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create algorithms to compute low order moments and the correlation matrix */
+    low_order_moments::Batch<> momentsAlgorithm;
+    covariance::Batch<> correlationAlgorithm;
+    correlationAlgorithm.parameter.outputMatrixType = covariance::correlationMatrix;
+
+    /* Set input objects for the algorithms */
+    momentsAlgorithm.input.set(low_order_moments::data, dataSource.getNumericTable());
+    correlationAlgorithm.input.set(covariance::data, dataSource.getNumericTable());
+
+    /* Start both computations. They run concurrently and share the threads of the library */
+    ComputeFuture momentsFuture     = momentsAlgorithm.computeAsync();
+    ComputeFuture correlationFuture = correlationAlgorithm.computeAsync();
+
+    /* Wait for the computations to complete */
+    services::Status momentsStatus     = momentsFuture.wait();
+    services::Status correlationStatus = correlationFuture.wait();
+    if(!momentsStatus || !correlationStatus)
+    {
+        cout << "Error: " << (momentsStatus ? correlationStatus : momentsStatus).getDescription() << endl;
+        return -1;
+    }
+
+    /* Get the computed results */
+    low_order_moments::ResultPtr momentsResult = momentsAlgorithm.getResult();
+    covariance::ResultPtr correlationResult = correlationAlgorithm.getResult();
+
+    printNumericTable(momentsResult->get(low_order_moments::mean),              "Mean:");
+    printNumericTable(momentsResult->get(low_order_moments::standardDeviation), "Standard deviation:");
+    printNumericTable(correlationResult->get(covariance::correlation),          "Correlation matrix:");
+
+    return 0;
+}
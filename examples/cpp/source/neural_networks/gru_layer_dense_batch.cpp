@@ -0,0 +1,121 @@
+/* file: gru_layer_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of forward and backward GRU layer usage
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GRU_LAYER_BATCH"></a>
+ * \example gru_layer_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Input data set parameters */
+string datasetName = "../data/batch/layer.csv";
+
+int main()
+{
+    size_t nOutputs   = 5;
+    size_t nTimeSteps = 4;
+
+    /* Read datasetFileName from a file and create a tensor to store input data */
+    TensorPtr tensorData = readTensorFromCSV(datasetName);
+
+    /* Interpret each group of nTimeSteps consecutive rows as one sequence */
+    const Collection<size_t> &dataDims = tensorData->getDimensions();
+    Collection<size_t> sequenceDims;
+    sequenceDims.push_back(dataDims[0] / nTimeSteps);
+    sequenceDims.push_back(nTimeSteps);
+    sequenceDims.push_back(dataDims[1]);
+    HomogenTensor<> *dataArray = static_cast<HomogenTensor<> *>(tensorData.get());
+    TensorPtr sequenceData = TensorPtr(new HomogenTensor<>(sequenceDims, dataArray->getArray()));
+
+    /* Create an algorithm to compute forward GRU layer results using default method */
+    gru::forward::Batch<> gruLayerForward(nOutputs);
+
+    /* Set input objects for the forward GRU layer */
+    gruLayerForward.input.set(forward::data, sequenceData);
+
+    /* Compute forward GRU layer results */
+    gruLayerForward.compute();
+
+    /* Print the results of the forward GRU layer */
+    gru::forward::ResultPtr forwardResult = gruLayerForward.getResult();
+    printTensor(forwardResult->get(forward::value), "Forward GRU layer result (first 5 rows):", 5);
+    printTensor(forwardResult->get(gru::auxHiddenStates), "Forward GRU layer hidden states (first 5 rows):", 5);
+
+    /* Get the size of forward GRU layer output */
+    const Collection<size_t> &gDims = forwardResult->get(forward::value)->getDimensions();
+    TensorPtr tensorDataBack = TensorPtr(new HomogenTensor<>(gDims, Tensor::doAllocate, 0.01f));
+
+    /* Create an algorithm to compute backward GRU layer results using default method */
+    gru::backward::Batch<> gruLayerBackward(nOutputs);
+
+    /* Set input objects for the backward GRU layer */
+    gruLayerBackward.input.set(backward::inputGradient, tensorDataBack);
+    gruLayerBackward.input.set(backward::inputFromForward, forwardResult->get(forward::resultForBackward));
+
+    /* Compute backward GRU layer results */
+    gruLayerBackward.compute();
+
+    /* Print the results of the backward GRU layer */
+    backward::ResultPtr backwardResult = gruLayerBackward.getResult();
+    printTensor(backwardResult->get(backward::gradient),
+                "Backward GRU layer gradient result (first 5 rows):", 5);
+    printTensor(backwardResult->get(backward::weightDerivatives),
+                "Backward GRU layer weightDerivative result (first 5 rows):", 5);
+    printTensor(backwardResult->get(backward::biasDerivatives),
+                "Backward GRU layer biasDerivative result (first 5 rows):", 5);
+
+    return 0;
+}
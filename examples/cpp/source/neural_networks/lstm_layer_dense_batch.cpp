@@ -0,0 +1,121 @@
+/* file: lstm_layer_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of forward and backward LSTM layer usage
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LSTM_LAYER_BATCH"></a>
+ * \example lstm_layer_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Input data set parameters */
+string datasetName = "../data/batch/layer.csv";
+
+int main()
+{
+    size_t nOutputs   = 5;
+    size_t nTimeSteps = 4;
+
+    /* Read datasetFileName from a file and create a tensor to store input data */
+    TensorPtr tensorData = readTensorFromCSV(datasetName);
+
+    /* Interpret each group of nTimeSteps consecutive rows as one sequence */
+    const Collection<size_t> &dataDims = tensorData->getDimensions();
+    Collection<size_t> sequenceDims;
+    sequenceDims.push_back(dataDims[0] / nTimeSteps);
+    sequenceDims.push_back(nTimeSteps);
+    sequenceDims.push_back(dataDims[1]);
+    HomogenTensor<> *dataArray = static_cast<HomogenTensor<> *>(tensorData.get());
+    TensorPtr sequenceData = TensorPtr(new HomogenTensor<>(sequenceDims, dataArray->getArray()));
+
+    /* Create an algorithm to compute forward LSTM layer results using default method */
+    lstm::forward::Batch<> lstmLayerForward(nOutputs);
+
+    /* Set input objects for the forward LSTM layer */
+    lstmLayerForward.input.set(forward::data, sequenceData);
+
+    /* Compute forward LSTM layer results */
+    lstmLayerForward.compute();
+
+    /* Print the results of the forward LSTM layer */
+    lstm::forward::ResultPtr forwardResult = lstmLayerForward.getResult();
+    printTensor(forwardResult->get(forward::value), "Forward LSTM layer result (first 5 rows):", 5);
+    printTensor(forwardResult->get(lstm::auxHiddenStates), "Forward LSTM layer hidden states (first 5 rows):", 5);
+
+    /* Get the size of forward LSTM layer output */
+    const Collection<size_t> &gDims = forwardResult->get(forward::value)->getDimensions();
+    TensorPtr tensorDataBack = TensorPtr(new HomogenTensor<>(gDims, Tensor::doAllocate, 0.01f));
+
+    /* Create an algorithm to compute backward LSTM layer results using default method */
+    lstm::backward::Batch<> lstmLayerBackward(nOutputs);
+
+    /* Set input objects for the backward LSTM layer */
+    lstmLayerBackward.input.set(backward::inputGradient, tensorDataBack);
+    lstmLayerBackward.input.set(backward::inputFromForward, forwardResult->get(forward::resultForBackward));
+
+    /* Compute backward LSTM layer results */
+    lstmLayerBackward.compute();
+
+    /* Print the results of the backward LSTM layer */
+    backward::ResultPtr backwardResult = lstmLayerBackward.getResult();
+    printTensor(backwardResult->get(backward::gradient),
+                "Backward LSTM layer gradient result (first 5 rows):", 5);
+    printTensor(backwardResult->get(backward::weightDerivatives),
+                "Backward LSTM layer weightDerivative result (first 5 rows):", 5);
+    printTensor(backwardResult->get(backward::biasDerivatives),
+                "Backward LSTM layer biasDerivative result (first 5 rows):", 5);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/* file: out_detect_bacon_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multivariate outlier detection using the Bacon method
+!    in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-OUT_DETECT_BACON_DENSE_DISTRIBUTED"></a>
+ * \example out_detect_bacon_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace algorithms;
+
+typedef double algorithmFPType;     /* Algorithm floating-point type */
+
+/* Bacon algorithm parameters */
+const size_t nBlocks        = 4;
+const size_t maxIterations  = 20;
+
+const string dataFileNames[] =
+{
+    "../data/distributed/covcormoments_dense_1.csv", "../data/distributed/covcormoments_dense_2.csv",
+    "../data/distributed/covcormoments_dense_3.csv", "../data/distributed/covcormoments_dense_4.csv"
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &dataFileNames[0], &dataFileNames[1], &dataFileNames[2], &dataFileNames[3]);
+
+    NumericTablePtr data[nBlocks];
+    NumericTablePtr weights[nBlocks];
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+        FileDataSource<CSVFeatureManager> dataSource(dataFileNames[i], DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+        /* Retrieve the data from the input file */
+        dataSource.loadDataBlock();
+        data[i] = dataSource.getNumericTable();
+    }
+
+    /* The master algorithm keeps the basic subset size between iterations to detect convergence */
+    bacon_outlier_detection::Distributed<step2Master, algorithmFPType> masterAlgorithm;
+
+    NumericTablePtr location, scatter, threshold;
+
+    for (size_t it = 0; it < maxIterations; it++)
+    {
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            /* Compute the statistics of the local part of the basic subset */
+            bacon_outlier_detection::Distributed<step1Local, algorithmFPType> localAlgorithm;
+
+            localAlgorithm.input.set(bacon_outlier_detection::data, data[i]);
+            if (location)
+            {
+                localAlgorithm.input.set(bacon_outlier_detection::inputLocation,  location);
+                localAlgorithm.input.set(bacon_outlier_detection::inputScatter,   scatter);
+                localAlgorithm.input.set(bacon_outlier_detection::inputThreshold, threshold);
+            }
+
+            localAlgorithm.compute();
+
+            masterAlgorithm.input.add(bacon_outlier_detection::partialResults, localAlgorithm.getPartialResult());
+        }
+
+        /* Merge the partial results and compute the estimates for the next iteration */
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+
+        bacon_outlier_detection::DistributedResultPtr res = masterAlgorithm.getResult();
+        location  = res->get(bacon_outlier_detection::location);
+        scatter   = res->get(bacon_outlier_detection::scatter);
+        threshold = res->get(bacon_outlier_detection::threshold);
+
+        BlockDescriptor<int> block;
+        res->get(bacon_outlier_detection::converged)->getBlockOfRows(0, 1, readOnly, block);
+        const bool converged = (block.getBlockPtr()[0] != 0);
+        res->get(bacon_outlier_detection::converged)->releaseBlockOfRows(block);
+        if (converged)
+        {
+            break;
+        }
+    }
+
+    /* Mark the outliers on each node using the final estimates */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        multivariate_outlier_detection::Batch<algorithmFPType> algorithm;
+
+        algorithm.input.set(multivariate_outlier_detection::data,      data[i]);
+        algorithm.input.set(multivariate_outlier_detection::location,  location);
+        algorithm.input.set(multivariate_outlier_detection::scatter,   scatter);
+        algorithm.input.set(multivariate_outlier_detection::threshold, threshold);
+
+        algorithm.compute();
+
+        weights[i] = algorithm.getResult()->get(multivariate_outlier_detection::weights);
+    }
+
+    printNumericTable(masterAlgorithm.getResult()->get(bacon_outlier_detection::basicSubsetSize), "Basic subset size:");
+    printNumericTable(location, "Location:");
+    printNumericTable(threshold, "Threshold:");
+    printNumericTables(data[0].get(), weights[0].get(),
+                       "Input data", "Weights",
+                       "Outlier detection result on the 1st node (Bacon method)", 10);
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/* file: pca_rnd_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis (PCA) using the randomized
+!    method in the distributed processing mode
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_RND_DENSE_DISTRIBUTED"></a>
+ * \example pca_rnd_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+/* Input data set parameters */
+const size_t nBlocks         = 4;
+const size_t nVectorsInBlock = 250;
+
+/* PCA algorithm parameters */
+const size_t nComponents = 3;
+
+const string dataFileNames[] =
+{
+    "../data/distributed/pca_normalized_1.csv", "../data/distributed/pca_normalized_2.csv",
+    "../data/distributed/pca_normalized_3.csv", "../data/distributed/pca_normalized_4.csv"
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &dataFileNames[0], &dataFileNames[1], &dataFileNames[2], &dataFileNames[3]);
+
+    /* Create an algorithm for principal component analysis using the randomized method on the master node */
+    pca::Distributed<step2Master, algorithmFPType, pca::randomizedDense> masterAlgorithm;
+    masterAlgorithm.parameter.nComponents = nComponents;
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+        FileDataSource<CSVFeatureManager> dataSource(dataFileNames[i], DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+        /* Retrieve the input data */
+        dataSource.loadDataBlock(nVectorsInBlock);
+
+        /* Create an algorithm for principal component analysis using the randomized method on the local node.
+           The number of components and the seed must be the same on all nodes */
+        pca::Distributed<step1Local, algorithmFPType, pca::randomizedDense> localAlgorithm;
+        localAlgorithm.parameter.nComponents = nComponents;
+
+        /* Set the input data to the algorithm */
+        localAlgorithm.input.set(pca::data, dataSource.getNumericTable());
+
+        /* Sketch the local data in a single pass */
+        localAlgorithm.compute();
+
+        /* Set local partial results as input for the master-node algorithm */
+        masterAlgorithm.input.add(pca::partialResults, localAlgorithm.getPartialResult());
+    }
+
+    /* Merge and finalize PCA decomposition on the master node */
+    masterAlgorithm.compute();
+
+    masterAlgorithm.finalizeCompute();
+
+    /* Retrieve the algorithm results */
+    pca::ResultPtr result = masterAlgorithm.getResult();
+
+    /* Print the results */
+    printNumericTable(result->get(pca::eigenvalues), "Eigenvalues:");
+    printNumericTable(result->get(pca::eigenvectors), "Eigenvectors:");
+
+    return 0;
+}
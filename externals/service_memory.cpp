@@ -47,9 +47,11 @@
 
 #include "service_memory.h"
 #include "service_service.h"
+#include "service_tracing.h"
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
+    if(daal::internal::isTracingEnabled()) { daal::internal::traceAllocation(size); }
     return daal::internal::Service<>::serv_malloc(size, alignment);
 }
 
@@ -53,6 +53,7 @@
 #include "service_defines.h"
 #include "tbb/scalable_allocator.h"
 #include "threading.h"
+#include "service_tracing.h"
 
 namespace daal
 {
@@ -100,6 +101,7 @@ void service_free(T * ptr)
 template<typename T, CpuType cpu>
 T *service_scalable_calloc(size_t size, size_t alignment = 64)
 {
+    if(daal::internal::isTracingEnabled()) { daal::internal::traceAllocation(size * sizeof(T)); }
     T *ptr = (T *)scalable_aligned_malloc(size * sizeof(T), alignment );
     if( ptr == NULL ) { return NULL; }
 
@@ -117,6 +119,7 @@ T *service_scalable_calloc(size_t size, size_t alignment = 64)
 template<typename T, CpuType cpu>
 T *service_scalable_malloc(size_t size, size_t alignment = 64)
 {
+    if(daal::internal::isTracingEnabled()) { daal::internal::traceAllocation(size * sizeof(T)); }
     T *ptr = (T *)scalable_aligned_malloc(size * sizeof(T), alignment );
     if( ptr == NULL ) { return NULL; }
 
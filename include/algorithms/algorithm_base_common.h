@@ -52,6 +52,7 @@
 #include "services/daal_kernel_defines.h"
 #include "services/error_handling.h"
 #include "services/env_detect.h"
+#include "services/workspace.h"
 #include "algorithms/algorithm_types.h"
 
 namespace daal
@@ -137,6 +138,25 @@ public:
         return _enableChecks;
     }
 
+    /**
+     * Attaches the workspace the algorithm takes its scratch memory from.
+     * The memory is kept in the workspace between the calls of compute()
+     * \param[in] workspace  Workspace, or empty pointer to allocate the scratch memory on each call
+     */
+    void setWorkspace(const services::WorkspacePtr &workspace)
+    {
+        _workspace = workspace;
+    }
+
+    /**
+     * Returns the workspace attached to the algorithm
+     * \return Workspace attached to the algorithm
+     */
+    services::WorkspacePtr getWorkspace() const
+    {
+        return _workspace;
+    }
+
     /**
      * For backward compatibility. Returns error collection of the algorithm
      * \return Error collection of the algorithm
@@ -163,6 +183,7 @@ protected:
 
     daal::services::Environment::env    _env;
     services::Status _status;
+    services::WorkspacePtr _workspace;
 };
 
 /** @} */
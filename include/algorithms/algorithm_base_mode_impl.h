@@ -51,6 +51,7 @@
 #include "services/daal_defines.h"
 #include "algorithms/algorithm_base_common.h"
 #include "algorithms/algorithm_base_mode_batch.h"
+#include "algorithms/algorithm_future.h"
 
 namespace daal
 {
@@ -99,6 +100,16 @@ public:
         return services::throwIfPossible(this->_status);
     }
 
+    /**
+     * Starts the computation of the final results of the algorithm in the %batch mode,
+     * or partial results of the algorithm in %online and %distributed modes on the thread pool of the library
+     * and returns without waiting for it to complete. Computations started this way run concurrently
+     * and share the threads of the library. The algorithm, its input and results must not be accessed
+     * until the computation completes
+     * \return Handle of the computation that provides its status
+     */
+    ComputeFuture computeAsync();
+
     /**
      * Computes final results of the algorithm using partial results in %online and %distributed modes.
      */
@@ -272,6 +283,15 @@ public:
         return services::throwIfPossible(this->_status);
     }
 
+    /**
+     * Starts the computation of the final results of the algorithm in the %batch mode on the thread pool of the library
+     * and returns without waiting for it to complete. Computations started this way run concurrently
+     * and share the threads of the library. The algorithm, its input and results must not be accessed
+     * until the computation completes
+     * \return Handle of the computation that provides its status
+     */
+    ComputeFuture computeAsync();
+
     /**
      * Validates parameters of the compute method
      */
@@ -0,0 +1,133 @@
+/* file: algorithm_future.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the handle of an asynchronous computation.
+//--
+*/
+
+#ifndef __ALGORITHM_FUTURE_H__
+#define __ALGORITHM_FUTURE_H__
+
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace interface1
+{
+/**
+ * @addtogroup base_algorithms
+ * @{
+ */
+
+/**
+ *  <a name="DAAL-CLASS-ALGORITHMS__COMPUTEFUTUREIFACE"></a>
+ *  \brief Abstract interface class of the state of an asynchronous computation
+ */
+class ComputeFutureIface : public Base
+{
+public:
+    virtual ~ComputeFutureIface() {}
+
+    /**
+     * Waits for the computation to complete
+     * \return Status of the computation
+     */
+    virtual services::Status wait() = 0;
+
+    /**
+     * Returns true if the computation has completed
+     * \return Flag that indicates whether the computation has completed
+     */
+    virtual bool isReady() const = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-ALGORITHMS__COMPUTEFUTURE"></a>
+ *  \brief Handle of a computation submitted by the computeAsync() method of an algorithm.
+ *         Copies of the handle refer to the same computation. When the last copy is destroyed,
+ *         it waits for the computation to complete
+ */
+class ComputeFuture
+{
+public:
+    /** Constructs the handle of a completed computation with the given status */
+    ComputeFuture(const services::Status &status = services::Status()) : _status(status) {}
+
+    /** Constructs the handle of the computation with the given state */
+    ComputeFuture(const services::SharedPtr<ComputeFutureIface> &impl) : _impl(impl) {}
+
+    /**
+     * Waits for the computation to complete. Must not be called concurrently for the same computation
+     * \return Status of the computation
+     */
+    services::Status wait()
+    {
+        return (_impl ? _impl->wait() : _status);
+    }
+
+    /**
+     * Returns true if the computation has completed
+     * \return Flag that indicates whether the computation has completed
+     */
+    bool isReady() const
+    {
+        return (_impl ? _impl->isReady() : true);
+    }
+
+private:
+    services::SharedPtr<ComputeFutureIface> _impl;
+    services::Status _status;
+};
+/** @} */
+} // namespace interface1
+using interface1::ComputeFutureIface;
+using interface1::ComputeFuture;
+
+} // namespace algorithms
+} // namespace daal
+
+#endif
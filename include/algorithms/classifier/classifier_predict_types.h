@@ -193,6 +193,12 @@ public:
     DECLARE_SERIALIZABLE_CAST(Result);
     Result();
 
+    /**
+     * Constructs the result of the classification algorithm with the given number of results
+     * \param[in] n    Number of results of the classification algorithm
+     */
+    Result(const size_t n);
+
     /**
      * Returns the prediction result of the classification algorithm
      * \param[in] id   Identifier of the prediction result, \ref ResultId
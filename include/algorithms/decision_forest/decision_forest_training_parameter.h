@@ -148,8 +148,13 @@ public:
                                                  than the threshold then the node is not split anymore.*/
     VariableImportanceMode varImportance;   /*!< Variable importance computation mode */
     DAAL_UINT64 resultsToCompute;           /*!< 64 bit integer flag that indicates the results to compute */
-    bool memorySavingMode;                  /*!< If true then use memory saving (but slower) mode */
-    bool bootstrap;                         /*!< If true then training set for a tree is a bootstrap of the whole training set */
+    bool memorySavingMode;                  /*!< If true then use memory saving (but slower) mode.
+                                                 For input data in CSR format the index used otherwise keeps
+                                                 only nonzero values */
+    bool bootstrap;                         /*!< If true then training set for a tree is a bootstrap of the whole training set.
+                                                 Observation weights are supported only in this mode: they set the probabilities
+                                                 of drawing the observations into the bootstrap and are not used in the impurity
+                                                 (Gini or variance) of the splits */
 };
 /* [Parameter source code] */
 } // namespace interface1
@@ -114,7 +114,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      */
     Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses),
                                      pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(1),
-                                     splitCriterion(infoGain) {}
+                                     splitCriterion(infoGain), maxBins(256) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -125,6 +125,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     Pruning pruning;                    /*!< Pruning method for Decision tree */
     size_t maxTreeDepth;                /*!< Maximum tree depth. 0 means unlimited depth. */
     size_t minObservationsInLeafNodes;  /*!< Minimum number of observations in the leaf node. Can be any positive number. */
+    size_t maxBins;                     /*!< Maximum number of bins per feature used by the binnedDense training method, from 2 to 256 */
 };
 /* [Parameter source code] */
 
@@ -88,7 +88,8 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    binnedDense  = 1  /*!< Method that splits nodes on histograms of features quantized into at most Parameter::maxBins bins */
 };
 
 /**
@@ -101,7 +101,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  Main constructor
      */
     Parameter() : daal::algorithms::Parameter(),
-                  pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5)
+                  pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5), maxBins(256)
     {}
 
     /**
@@ -112,6 +112,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Pruning pruning;                    /*!< Pruning method for Decision tree */
     size_t maxTreeDepth;                /*!< Maximum tree depth. 0 means unlimited depth. */
     size_t minObservationsInLeafNodes;  /*!< Minimum number of observations in the leaf node. Can be any positive number. */
+    size_t maxBins;                     /*!< Maximum number of bins per feature used by the binnedDense training method, from 2 to 256 */
 };
 /* [Parameter source code] */
 
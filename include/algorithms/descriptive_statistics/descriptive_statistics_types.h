@@ -0,0 +1,526 @@
+/* file: descriptive_statistics_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the descriptive statistics algorithm that
+//  computes several statistical estimates in one pass over the data.
+//--
+*/
+
+#ifndef __DESCRIPTIVE_STATISTICS_TYPES_H__
+#define __DESCRIPTIVE_STATISTICS_TYPES_H__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "algorithms/moments/low_order_moments_types.h"
+#include "algorithms/covariance/covariance_types.h"
+#include "algorithms/quantiles/quantiles_types.h"
+#include "algorithms/sorting/sorting_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup descriptive_statistics Descriptive Statistics
+ * \copydoc daal::algorithms::descriptive_statistics
+ * @ingroup analysis
+ * @{
+ */
+/**
+ * \brief Contains classes for computing several descriptive statistics of a data set in one data scan
+ */
+namespace descriptive_statistics
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__METHOD"></a>
+ * Available methods for computing the descriptive statistics
+ */
+enum Method
+{
+    defaultDense = 0        /*!< Default: performance-oriented method. Works with all types of numeric tables except CSR */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__STATISTICSTOCOMPUTEID"></a>
+ * Available identifiers of the statistics computed by the descriptive statistics algorithm
+ */
+enum StatisticsToComputeId
+{
+    lowOrderMoments    = 0x00000001ULL, /*!< Low order moments computed by the low order %moments algorithm */
+    covarianceMatrix   = 0x00000002ULL, /*!< Variance-covariance or correlation matrix computed by the covariance algorithm */
+    quantileEstimates  = 0x00000004ULL, /*!< Quantiles computed by the quantiles algorithm. Batch processing mode only */
+    sortedObservations = 0x00000008ULL, /*!< Observations sorted by the sorting algorithm. Batch processing mode only */
+    allStatistics      = 0x0000000FULL  /*!< All of the above statistics */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__INPUTID"></a>
+ * Available identifiers of input objects for the descriptive statistics algorithm
+ */
+enum InputId
+{
+    data,                   /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__LOWORDERMOMENTSPARTIALRESULTID"></a>
+ * Available identifiers of the low order %moments partial result of the descriptive statistics algorithm
+ */
+enum LowOrderMomentsPartialResultId
+{
+    lowOrderMomentsPartialResult = 0    /*!< Partial result of the low order %moments algorithm */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__COVARIANCEPARTIALRESULTID"></a>
+ * Available identifiers of the covariance partial result of the descriptive statistics algorithm
+ */
+enum CovariancePartialResultId
+{
+    covariancePartialResult = 1,        /*!< Partial result of the covariance algorithm */
+    lastPartialResultId = covariancePartialResult
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__LOWORDERMOMENTSRESULTID"></a>
+ * Available identifiers of the low order %moments result of the descriptive statistics algorithm
+ */
+enum LowOrderMomentsResultId
+{
+    lowOrderMomentsResult = 0           /*!< Result of the low order %moments algorithm */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__COVARIANCERESULTID"></a>
+ * Available identifiers of the covariance result of the descriptive statistics algorithm
+ */
+enum CovarianceResultId
+{
+    covarianceResult = 1                /*!< Result of the covariance algorithm */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__QUANTILESRESULTID"></a>
+ * Available identifiers of the quantiles result of the descriptive statistics algorithm
+ */
+enum QuantilesResultId
+{
+    quantilesResult = 2                 /*!< Result of the quantiles algorithm */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__SORTINGRESULTID"></a>
+ * Available identifiers of the sorting result of the descriptive statistics algorithm
+ */
+enum SortingResultId
+{
+    sortingResult = 3,                  /*!< Result of the sorting algorithm */
+    lastResultId = sortingResult
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DESCRIPTIVE_STATISTICS__MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for the descriptive statistics algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults,     /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DESCRIPTIVE_STATISTICS__PARAMETER"></a>
+ * \brief Parameters of the descriptive statistics algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs parameters of the descriptive statistics algorithm
+     * \param[in] statisticsToCompute  64 bit integer flag that indicates the statistics to compute, \ref StatisticsToComputeId
+     */
+    Parameter(DAAL_UINT64 statisticsToCompute = lowOrderMoments | covarianceMatrix);
+
+    DAAL_UINT64 statisticsToCompute;                    /*!< 64 bit integer flag that indicates the statistics to compute */
+    covariance::OutputMatrixType outputMatrixType;      /*!< Type of the matrix computed for the covarianceMatrix statistic */
+    data_management::NumericTablePtr quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DESCRIPTIVE_STATISTICS__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface of the input objects for the descriptive statistics algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    InputIface(const InputIface& other) : daal::algorithms::Input(other){}
+    virtual services::Status getNumberOfColumns(size_t& nCols) const = 0;
+    virtual ~InputIface() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DESCRIPTIVE_STATISTICS__INPUT"></a>
+ * \brief %Input objects for the descriptive statistics algorithm
+ */
+class DAAL_EXPORT Input : public InputIface
+{
+public:
+    Input();
+    Input(const Input& other);
+
+    virtual ~Input() {};
+
+    /**
+     * Get number of columns in the input data set
+     * \param[out] nCols Number of columns in the input data set
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t& nCols) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the input object for the descriptive statistics algorithm
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets input object for the descriptive statistics algorithm
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DESCRIPTIVE_STATISTICS__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method
+ *        of the descriptive statistics algorithm in the online or distributed processing mode.
+ *        The partial results are the partial results of the low order %moments and covariance algorithms
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the descriptive statistics algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes memory to store partial results of the descriptive statistics algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Get number of columns in the partial result of the descriptive statistics algorithm
+     * \param[out] nCols Number of columns
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t& nCols) const;
+
+    /**
+     * Returns the partial result of the low order %moments algorithm
+     * \param[in] id   Identifier of the partial result, \ref LowOrderMomentsPartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    low_order_moments::PartialResultPtr get(LowOrderMomentsPartialResultId id) const;
+
+    /**
+     * Returns the partial result of the covariance algorithm
+     * \param[in] id   Identifier of the partial result, \ref CovariancePartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    covariance::PartialResultPtr get(CovariancePartialResultId id) const;
+
+    /**
+     * Sets the partial result of the low order %moments algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(LowOrderMomentsPartialResultId id, const low_order_moments::PartialResultPtr &ptr);
+
+    /**
+     * Sets the partial result of the covariance algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(CovariancePartialResultId id, const covariance::PartialResultPtr &ptr);
+
+    /**
+     * Checks correctness of the partial result
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of partial result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter *parameter) const;
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DESCRIPTIVE_STATISTICS__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the descriptive statistics
+ *        algorithm in the batch processing mode or finalizeCompute() method of the algorithm in the online or
+ *        distributed processing mode. Only the results of the requested statistics are allocated
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory for storing final results of the descriptive statistics algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Allocates memory for storing final results of the descriptive statistics algorithm
+     * \param[in] partialResult     Pointer to the structure with partial result objects
+     * \param[in] parameter         Pointer to the structure of algorithm parameters
+     * \param[in] method            Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the low order %moments algorithm
+     * \param[in] id   Identifier of the result, \ref LowOrderMomentsResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    low_order_moments::ResultPtr get(LowOrderMomentsResultId id) const;
+
+    /**
+     * Returns the result of the covariance algorithm
+     * \param[in] id   Identifier of the result, \ref CovarianceResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    covariance::ResultPtr get(CovarianceResultId id) const;
+
+    /**
+     * Returns the result of the quantiles algorithm
+     * \param[in] id   Identifier of the result, \ref QuantilesResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    quantiles::ResultPtr get(QuantilesResultId id) const;
+
+    /**
+     * Returns the result of the sorting algorithm
+     * \param[in] id   Identifier of the result, \ref SortingResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    sorting::ResultPtr get(SortingResultId id) const;
+
+    /**
+     * Sets the result of the low order %moments algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the result
+     */
+    void set(LowOrderMomentsResultId id, const low_order_moments::ResultPtr &value);
+
+    /**
+     * Sets the result of the covariance algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the result
+     */
+    void set(CovarianceResultId id, const covariance::ResultPtr &value);
+
+    /**
+     * Sets the result of the quantiles algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the result
+     */
+    void set(QuantilesResultId id, const quantiles::ResultPtr &value);
+
+    /**
+     * Sets the result of the sorting algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the result
+     */
+    void set(SortingResultId id, const sorting::ResultPtr &value);
+
+    /**
+     * Checks the correctness of result
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           %Parameter of the algorithm
+     * \param[in] method        Computation method
+     */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] par       Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, size_t nVectors, const daal::algorithms::Parameter *par) const;
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DESCRIPTIVE_STATISTICS__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the descriptive statistics algorithm in the distributed processing mode on the master node
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DAAL_EXPORT DistributedInput : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput& other);
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Get number of columns in the input data set
+     * \param[out] nCols Number of columns in the input data set
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t& nCols) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds partial result to the collection of input objects for the descriptive statistics algorithm
+     * in the distributed processing mode
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Sets input object for the descriptive statistics algorithm in the distributed processing mode
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks algorithm parameters on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::InputIface;
+using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::DistributedInput;
+
+} // namespace daal::algorithms::descriptive_statistics
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,216 @@
+/* file: euclidean_distance_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Euclidean distance algorithm interface.
+//--
+*/
+
+#ifndef __EUCDISTANCE_TYPES_H__
+#define __EUCDISTANCE_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/symmetric_matrix.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup euclidean_distance Euclidean Distance Matrix
+ * \copydoc daal::algorithms::euclidean_distance
+ * @ingroup analysis
+ * @{
+ */
+/**
+* \brief Contains classes for computing the Euclidean distance
+*/
+namespace euclidean_distance
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EUCLIDEAN_DISTANCE__METHOD"></a>
+ * Available methods for computing the Euclidean distance
+ */
+enum Method
+{
+    defaultDense = 0       /*!< Default: performance-oriented method. */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EUCLIDEAN_DISTANCE__INPUTID"></a>
+ * Available identifiers of input objects for the Euclidean distance algorithm
+ */
+enum InputId
+{
+    data,            /*!< %Input data table */
+    otherData,       /*!< Optional second input data table. If it is set, the distances between
+                          observations of data and observations of otherData are computed */
+    lastInputId = otherData
+};
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EUCLIDEAN_DISTANCE__RESULTID"></a>
+ * Available identifiers of results for the Euclidean distance algorithm
+ */
+enum ResultId
+{
+    euclideanDistance,        /*!< Table to store the result.*/
+    lastResultId = euclideanDistance
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__EUCLIDEAN_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the Euclidean distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter(bool squared = false);
+    bool squared;       /*!< Flag that specifies whether squared Euclidean distances are computed. Default is false */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EUCLIDEAN_DISTANCE__INPUT"></a>
+ * \brief %Input objects for the Euclidean distance algorithm
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    Input();
+    Input(const Input& other) : daal::algorithms::Input(other){}
+
+    virtual ~Input() {}
+
+    /**
+    * Returns the input object of the Euclidean distance algorithm
+    * \param[in] id    Identifier of the input object
+    * \return          %Input object that corresponds to the given identifier
+    */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+    * Sets the input object for the Euclidean distance algorithm
+    * \param[in] id    Identifier of the input object
+    * \param[in] ptr   Pointer to the object
+    */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+    * Checks the parameters of the Euclidean distance algorithm
+    * \param[in] par     %Parameter of the algorithm
+    * \param[in] method  computation method
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EUCLIDEAN_DISTANCE__RESULT"></a>
+ * \brief Results obtained with the compute() method of the Euclidean distance algorithm in the batch processing mode
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store results of the Euclidean distance algorithm.
+     * The result is a packed symmetric matrix if only data is set, and a homogen matrix
+     * of size nRows(data) x nRows(otherData) otherwise
+     * \param[in] input  Pointer to input structure
+     * \param[in] par    Pointer to parameter structure
+     * \param[in] method Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+    /**
+     * Returns the result of the Euclidean distance algorithm
+     * \param[in] id   Identifier of the result
+     * \return         %Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the Euclidean distance algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the result object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+    * Checks the result of the Euclidean distance algorithm
+    * \param[in] input   %Input of the algorithm
+    * \param[in] par     %Parameter of the algorithm
+    * \param[in] method  Computation method
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace euclidean_distance
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,411 @@
+/* file: em_gmm_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the EM for GMM algorithm in the distributed processing mode
+//--
+*/
+
+#ifndef __EM_GMM_DISTRIBUTED_H__
+#define __EM_GMM_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "em_gmm_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+
+namespace interface1
+{
+/**
+ * @defgroup em_gmm_distributed Distributed
+ * @ingroup em_gmm_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the EM for GMM algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods to compute the E-step of the EM for GMM algorithm on local nodes
+ *        in the first step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the EM for GMM algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes partial results of the EM for GMM algorithm in the first step of the distributed processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing, the first step of the distributed processing mode produces partial results only
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods to compute the M-step of the EM for GMM algorithm on the master node
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the EM for GMM algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges partial results computed on local nodes in the second step of the distributed processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes weights, means and covariances of the components from the merged partial results
+     * in the second step of the distributed processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED"></a>
+ * \brief Computes one iteration of the EM for GMM algorithm in the distributed processing mode.
+ *        Local nodes compute the E-step and sufficient statistics of their data in the first step.
+ *        The master node merges the statistics and computes the M-step in the second step.
+ *        The result of the second step is used as the input of the first step in the next iteration
+ * <!-- \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ *
+ * \par Enumerations
+ *      - \ref Method          Computation methods for EM for GMM
+ *      - \ref InputId         Identifiers of input objects for EM for GMM
+ *      - \ref MasterInputId   Identifiers of input objects for EM for GMM in the second step
+ *      - \ref PartialResultId Identifiers of partial results of EM for GMM
+ *      - \ref ResultId        Result identifiers for EM for GMM
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the E-step of the EM for GMM algorithm on local nodes in the first step of the distributed processing mode
+ * <!-- \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    /**
+     * Constructs the EM for GMM algorithm
+     * \param[in] nComponents   Number of components in the Gaussian mixture model
+     */
+    Distributed(const size_t nComponents);
+
+    /**
+     * Constructs the EM for GMM algorithm by copying input objects and parameters
+     * of another EM for GMM algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains partial results of the EM for GMM algorithm
+     * \return Structure that contains partial results of the EM for GMM algorithm
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Sets the memory for storing partial results of the EM for GMM algorithm
+     * \param[in] partialResult  Structure for storing partial results of the EM for GMM algorithm
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM algorithm with a copy of input objects
+     * of this EM for GMM algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResult());
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize();
+
+public:
+    Input input;           /*!< %Input data structure */
+    Parameter parameter;   /*!< %Parameter data structure */
+
+private:
+    PartialResultPtr _partialResult;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the M-step of the EM for GMM algorithm on the master node in the second step of the distributed processing mode
+ * <!-- \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    /**
+     * Constructs the EM for GMM algorithm
+     * \param[in] nComponents   Number of components in the Gaussian mixture model
+     */
+    Distributed(const size_t nComponents);
+
+    /**
+     * Constructs the EM for GMM algorithm by copying input objects and parameters
+     * of another EM for GMM algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains results of the EM for GMM algorithm
+     * \return Structure that contains results of the EM for GMM algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Sets the memory for storing results of the EM for GMM algorithm
+     * \param[in] result  Structure for storing results of the EM for GMM algorithm
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains merged partial results of the EM for GMM algorithm
+     * \return Structure that contains merged partial results of the EM for GMM algorithm
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Sets the memory for storing merged partial results of the EM for GMM algorithm
+     * \param[in] partialResult  Structure for storing merged partial results of the EM for GMM algorithm
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        DAAL_CHECK(_partialResult, services::ErrorNullPartialResult);
+        services::Status s;
+        DAAL_CHECK_STATUS(s, _partialResult->check(_par, method));
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        return _result->check(_partialResult.get(), _par, method);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM algorithm with a copy of input objects
+     * of this EM for GMM algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new Result());
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResult());
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize();
+
+public:
+    DistributedStep2MasterInput input; /*!< %Input data structure */
+    Parameter parameter;               /*!< %Parameter data structure */
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace em_gmm
+} // namespace algorithm
+} // namespace daal
+#endif
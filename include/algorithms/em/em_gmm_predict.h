@@ -0,0 +1,201 @@
+/* file: em_gmm_predict.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the EM for GMM prediction algorithm in the batch processing mode
+//--
+*/
+
+#ifndef __EM_GMM_PREDICT_H__
+#define __EM_GMM_PREDICT_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "em_gmm_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace prediction
+{
+
+namespace interface1
+{
+/**
+ * @defgroup em_gmm_prediction_batch Batch
+ * @ingroup em_gmm_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PREDICTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the EM for GMM prediction algorithm.
+ *        This class is associated with the Batch class and supports the method of scoring data in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM prediction algorithm, double or float
+ * \tparam method           EM for GMM prediction method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+     /**
+     * Constructs a container for the EM for GMM prediction algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the EM for GMM prediction algorithm in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PREDICTION__BATCH"></a>
+ * \brief Computes posterior probabilities of the components and log-likelyhood of the observations
+ *        for the Gaussian mixture model in the batch processing mode.
+ * <!-- \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM prediction algorithm, double or float
+ * \tparam method           EM for GMM prediction method
+ *
+ * \par Enumerations
+ *      - \ref Method   Computation methods for EM for GMM prediction
+ *      - \ref InputId  Identifiers of input objects for EM for GMM prediction
+ *      - \ref ResultId Result identifiers for EM for GMM prediction
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    /**
+     * Constructs the EM for GMM prediction algorithm
+     * \param[in] nComponents   Number of components in the Gaussian mixture model
+     */
+    Batch(const size_t nComponents);
+
+    /**
+     * Constructs the EM for GMM prediction algorithm by copying input objects and parameters
+     * of another EM for GMM prediction algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains results of the EM for GMM prediction algorithm
+     * \return Structure that contains results of the EM for GMM prediction algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Sets the memory for storing results of the EM for GMM prediction algorithm
+     * \param[in] result  Structure for storing results of the EM for GMM prediction algorithm
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM prediction algorithm with a copy of input objects
+     * of this EM for GMM prediction algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize();
+
+public:
+    Input input;           /*!< %Input data structure */
+    Parameter parameter;   /*!< %Parameter data structure */
+
+private:
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace prediction
+} // namespace em_gmm
+} // namespace algorithm
+} // namespace daal
+#endif
@@ -0,0 +1,293 @@
+/* file: em_gmm_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the EM for GMM prediction algorithm.
+//--
+*/
+
+#ifndef __EM_GMM_PREDICT_TYPES_H__
+#define __EM_GMM_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "em_gmm_covariance_storage_id.h"
+#include "em_gmm_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+/**
+ * @defgroup em_gmm_prediction Prediction
+ * \copydoc daal::algorithms::em_gmm::prediction
+ * @ingroup em_gmm
+ * @{
+ */
+/**
+ * \brief Contains classes for scoring new data against the Gaussian mixture model trained by the EM for GMM algorithm
+ */
+namespace prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PREDICTION__METHOD"></a>
+ * Available methods for the EM for GMM prediction algorithm
+ */
+enum Method
+{
+    defaultDense = 0       /*!< Default: performance-oriented method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PREDICTION__INPUTID"></a>
+ * Available identifiers of input objects of the EM for GMM prediction algorithm
+ */
+enum InputId
+{
+    data,                   /*!< %Input data table */
+    inputWeights,           /*!< Weights of the components */
+    inputMeans,             /*!< Means of the components */
+    lastInputId = inputMeans
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PREDICTION__INPUTCOVARIANCESID"></a>
+ * Available identifiers of input covariances of the EM for GMM prediction algorithm
+ */
+enum InputCovariancesId
+{
+    inputCovariances = lastInputId + 1,       /*!< %Collection of covariances of the components */
+    lastInputCovariancesId = inputCovariances
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PREDICTION__INPUTVALUESID"></a>
+ * Available identifiers of the trained model of the EM for GMM prediction algorithm
+ */
+enum InputValuesId
+{
+    inputValues = lastInputCovariancesId + 1,  /*!< Weights, means and covariances of the components */
+    lastInputValuesId = inputValues
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PREDICTION__RESULTID"></a>
+ * Available identifiers of results of the EM for GMM prediction algorithm
+ */
+enum ResultId
+{
+    responsibilities,       /*!< Table of posterior probabilities of the components for each observation */
+    logLikelihood,          /*!< Table of log-likelyhood values of the observations */
+    lastResultId = logLikelihood
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__EM_GMM__PREDICTION__PARAMETER"></a>
+ * \brief %Parameter for the EM for GMM prediction algorithm
+ *
+ * \snippet em/em_gmm_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameter of the EM for GMM prediction algorithm
+     * \param[in] nComponents              Number of components in the Gaussian mixture model
+     * \param[in] regularizationFactor     Factor for covariance regularization in case of ill-conditional data
+     * \param[in] covarianceStorage        Type of covariance in the Gaussian mixture model.
+     */
+    Parameter(const size_t nComponents,
+              const double regularizationFactor = 0.01,
+              const CovarianceStorageId covarianceStorage = full);
+
+    virtual ~Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual services::Status check() const;
+
+    size_t nComponents;                                     /*!< Number of components in the Gaussian mixture model */
+    double regularizationFactor;                            /*!< Factor for covariance regularization in case of ill-conditional data */
+    CovarianceStorageId covarianceStorage;                  /*!< Type of covariance in the Gaussian mixture model. */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PREDICTION__INPUT"></a>
+ * \brief %Input objects for the EM for GMM prediction algorithm
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other) : daal::algorithms::Input(other){}
+
+    virtual ~Input() {}
+
+    /**
+     * Sets one input object for the EM for GMM prediction algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the input covariance object for the EM for GMM prediction algorithm
+     * \param[in] id    Identifier of the input covariance collection object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputCovariancesId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Sets weights, means and covariances of the components for the EM for GMM prediction algorithm
+     * \param[in] id    Identifier of the input values object
+     * \param[in] ptr   Result of the EM for GMM algorithm
+     */
+    void set(InputValuesId id, const em_gmm::ResultPtr &ptr);
+
+    /**
+     * Returns the input numeric table for the EM for GMM prediction algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Returns the collection of input covariances for the EM for GMM prediction algorithm
+     * \param[in] id    Identifier of the collection of input covariances
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(InputCovariancesId id) const;
+
+    /**
+     * Returns a covariance with a given index from the collection of input covariances
+     * \param[in] id    Identifier of the collection of input covariances
+     * \param[in] index Index of the covariance to be returned
+     * \return          Pointer to the table with the input covariance
+     */
+    data_management::NumericTablePtr get(InputCovariancesId id, size_t index) const;
+
+    /**
+     * Checks the correctness of the input
+     * \param[in] par       Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access results obtained with the compute() method of the EM for GMM prediction algorithm
+ */
+class DAAL_EXPORT Result: public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    /** Default constructor */
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory for storing results of the EM for GMM prediction algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Sets the result of the EM for GMM prediction algorithm
+     * \param[in] id    %Result identifier
+     * \param[in] ptr   Pointer to the numeric table with the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns the result of the EM for GMM prediction algorithm
+     * \param[in] id   %Result identifier
+     * \return         %Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+    * Checks the result of the EM for GMM prediction algorithm
+    * \param[in] input   %Input of the algorithm
+    * \param[in] par     %Parameter of algorithm
+    * \param[in] method  Computation method
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace prediction
+} // namespace em_gmm
+} // namespace algorithm
+} // namespace daal
+#endif
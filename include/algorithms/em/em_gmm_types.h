@@ -134,6 +134,39 @@ enum ResultCovariancesId
     lastResultCovariancesId = covariances
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__MASTERINPUTID"></a>
+ * Available identifiers of input objects of the EM for GMM algorithm in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults,         /*!< %Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the EM for GMM algorithm in the distributed processing mode
+ */
+enum PartialResultId
+{
+    partialSumOfWeights,    /*!< Sums of responsibilities of the components over the observations */
+    partialMeans,           /*!< Means of the observations weighted by responsibilities of the components */
+    partialGoalFunction,    /*!< Table containing log-likelyhood value of the observations */
+    lastPartialResultId = partialGoalFunction
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTCROSSPRODUCTSID"></a>
+ * Available identifiers of partial cross-products of the EM for GMM algorithm in the distributed processing mode
+ */
+enum PartialResultCrossProductsId
+{
+    partialCrossProducts = lastPartialResultId + 1, /*!< %Collection of cross-products of the observations centered on partial means
+                                                         and weighted by responsibilities of the components */
+    lastPartialResultCrossProductsId = partialCrossProducts
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -182,18 +215,38 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 /* [Parameter source code] */
 
+class Result;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__INPUTIFACE"></a>
+ * \brief Interface for input objects of the EM for GMM algorithm in the batch and distributed processing modes
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    InputIface(const InputIface& other) : daal::algorithms::Input(other) {}
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of features in the input object
+     * \return Number of features in the input object
+     */
+    virtual size_t getNumberOfFeatures() const = 0;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__INPUT"></a>
  * \brief %Input objects for the EM for GMM algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     /** Default constructor */
     Input();
 
     /** Copy constructor */
-    Input(const Input& other) : daal::algorithms::Input(other){}
+    Input(const Input& other) : InputIface(other){}
 
     virtual ~Input() {}
 
@@ -218,6 +271,14 @@ public:
      */
     void set(InputValuesId id, const init::ResultPtr &ptr);
 
+    /**
+     * Sets input objects for the EM for GMM algorithm
+     * \param[in] id    Identifier of the input values object. Result of the EM for GMM algorithm
+     *                  in the batch or distributed processing mode can be used.
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputValuesId id, const services::SharedPtr<Result> &ptr);
+
     /**
      * Returns the input numeric table for the EM for GMM algorithm
      * \param[in] id    Identifier of the input numeric table
@@ -240,6 +301,11 @@ public:
      */
     data_management::NumericTablePtr get(InputCovariancesId id, size_t index) const;
 
+    /**
+     * Returns the number of features in the input data table
+     * \return Number of features in the input data table
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
 
     /**
      * Checks the correctness of the input result
@@ -271,6 +337,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory for storing results of the EM for GMM algorithm in the distributed processing mode
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the parameter structure
+     * \param[in] method        Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Sets the result of the EM for GMM algorithm
      * \param[in] id    %Result identifier
@@ -315,6 +390,14 @@ public:
     */
     services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+    * Checks the result parameter of the EM for GMM algorithm in the distributed processing mode
+    * \param[in] pres    Partial results of the algorithm
+    * \param[in] par     %Parameter of algorithm
+    * \param[in] method  Computation method
+    */
+    services::Status check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -322,14 +405,170 @@ protected:
     {
         return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    /** \private */
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const;
+
+    /** \private */
+    template <typename algorithmFPType>
+    services::Status allocateImpl(size_t nFeatures, const daal::algorithms::Parameter *parameter);
 };
 typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the EM for GMM algorithm
+ *        in the distributed processing mode. Partial results are sufficient statistics of one E-step over the local data:
+ *        sums of responsibilities, weighted means and weighted centered cross-products of the components
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    /** Default constructor */
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory for storing partial results of the EM for GMM algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Sets the partial result of the EM for GMM algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the numeric table with the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the collection of partial cross-products of the EM for GMM algorithm
+     * \param[in] id    Identifier of the collection of partial cross-products
+     * \param[in] ptr   Pointer to the collection of partial cross-products
+     */
+    void set(PartialResultCrossProductsId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the partial result of the EM for GMM algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Returns the collection of partial cross-products of the EM for GMM algorithm
+     * \param[in] id   Identifier of the collection of partial cross-products
+     * \return         Collection of partial cross-products that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(PartialResultCrossProductsId id) const;
+
+    /**
+     * Returns the partial cross-product with a given index from the collection of partial cross-products
+     * \param[in] id    Identifier of the collection of partial cross-products
+     * \param[in] index Index of the partial cross-product to be returned
+     * \return          Pointer to the table with the partial cross-product
+     */
+    data_management::NumericTablePtr get(PartialResultCrossProductsId id, size_t index) const;
+
+    /**
+     * Returns the number of features in the partial results
+     * \return Number of features in the partial results
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks partial results of the EM for GMM algorithm
+     * \param[in] input   %Input of the algorithm
+     * \param[in] par     %Parameter of algorithm
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of the EM for GMM algorithm
+     * \param[in] par     %Parameter of algorithm
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /** \private */
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects for the EM for GMM algorithm in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public InputIface
+{
+public:
+    /** Default constructor */
+    DistributedStep2MasterInput();
+
+    /** Copy constructor */
+    DistributedStep2MasterInput(const DistributedStep2MasterInput& other) : InputIface(other){}
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Sets an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds partial results computed on local nodes to the input of the EM for GMM algorithm
+     * in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] value Pointer to the partial result
+     */
+    void add(MasterInputId id, const PartialResultPtr &value);
+
+    /**
+     * Returns the number of features in the partial results computed on local nodes
+     * \return Number of features in the partial results
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks an input object for the EM for GMM algorithm in the second step of the distributed processing mode
+     * \param[in] par     %Parameter of algorithm
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::DistributedStep2MasterInput;
 
 } // namespace em_gmm
 } // namespace algorithm
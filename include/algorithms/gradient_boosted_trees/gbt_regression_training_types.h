@@ -107,7 +107,8 @@ enum InputId
 {
     data              = algorithms::regression::training::data,               /*!< %Input data table */
     dependentVariable = algorithms::regression::training::dependentVariables, /*!< %Values of the dependent variable for the input data */
-    lastInputId       = dependentVariable
+    weights           = algorithms::regression::training::lastInputId + 1,    /*!< Optional weights of the observations, numeric table of size n x 1 */
+    lastInputId       = weights
 };
 
 /**
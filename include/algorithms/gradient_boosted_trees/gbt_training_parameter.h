@@ -124,7 +124,9 @@ public:
                                                  Range : [0, p] where p is the total number of features.
                                                  Default is 0 (use all features) */
     size_t minObservationsInLeafNode;       /*!< Minimal number of observations in a leaf node. Default is 5. */
-    bool memorySavingMode;                  /*!< If true then use memory saving (but slower) mode. Default is false */
+    bool memorySavingMode;                  /*!< If true then use memory saving (but slower) mode. Default is false.
+                                                 For input data in CSR format the index used otherwise keeps
+                                                 only nonzero values */
     engines::EnginePtr engine;              /*!< Engine for the random numbers generator used by the algorithms */
     double approxSplitAccuracy;             /*!< Used with 'approximate' split finding method only.
                                                  O(1/approxSplitAccuracy) is an estimate for a number of bins
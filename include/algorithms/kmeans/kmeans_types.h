@@ -95,7 +95,8 @@ enum InputId
 {
     data,            /*!< %Input data table */
     inputCentroids,  /*!< Initial centroids for the algorithm */
-    lastInputId = inputCentroids
+    weights,         /*!< Optional weights of the observations, numeric table of size n x 1. Used in the batch processing mode */
+    lastInputId = weights
 };
 
 /**
@@ -78,7 +78,8 @@ enum InputId
 {
     data               = regression::training::data,               /*!< %Input data table */
     dependentVariables = regression::training::dependentVariables, /*!< Values of the dependent variable for the input data */
-    lastInputId = dependentVariables
+    weights            = regression::training::lastInputId + 1,    /*!< Optional weights of the observations, numeric table of size n x 1 */
+    lastInputId = weights
 };
 
 /**
@@ -125,6 +126,14 @@ public:
      * \param[in] value   Input numeric table
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks an input object for the linear model-based training
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -0,0 +1,94 @@
+/* file: linear_regression_elastic_net_model.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the linear regression model class for the elastic net method
+//--
+*/
+
+#ifndef __LINREG_ELASTIC_NET_MODEL_H__
+#define __LINREG_ELASTIC_NET_MODEL_H__
+
+#include "algorithms/linear_regression/linear_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+
+namespace interface1
+{
+/**
+ * @ingroup linear_regression
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__MODELELASTICNET"></a>
+ * \brief %Model trained with the linear regression algorithm using the elastic net method.
+ *        The model contains only the regression coefficients
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT ModelElasticNet : public Model
+{
+public:
+    DECLARE_MODEL(ModelElasticNet, linear_regression::Model);
+
+    virtual ~ModelElasticNet() {}
+};
+typedef services::SharedPtr<ModelElasticNet> ModelElasticNetPtr;
+typedef services::SharedPtr<const ModelElasticNet> ModelElasticNetConstPtr;
+/** @} */
+} // namespace interface1
+using interface1::ModelElasticNet;
+using interface1::ModelElasticNetPtr;
+using interface1::ModelElasticNetConstPtr;
+
+}
+}
+}
+#endif
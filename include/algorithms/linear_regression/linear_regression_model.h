@@ -79,8 +79,21 @@ namespace interface1
  * \snippet linear_regression/linear_regression_model.h Parameter source code
  */
 /* [Parameter source code] */
-struct Parameter : public linear_model::Parameter
+struct DAAL_EXPORT Parameter : public linear_model::Parameter
 {
+    Parameter();
+    Parameter(const Parameter &other);
+
+    double l1Penalty;           /*!< Coefficient of the L1 penalty term. Used by the elastic net method only */
+    double l2Penalty;           /*!< Coefficient of the L2 penalty term. Used by the elastic net method only */
+    size_t pathLength;          /*!< Number of values of the L1 penalty on the regularization path that ends at l1Penalty.
+                                     Used by the elastic net method only */
+    size_t maxIterations;       /*!< Maximal number of coordinate descent passes for each value on the path.
+                                     Used by the elastic net method only */
+    double accuracyThreshold;   /*!< Coordinate descent stops when the maximal change of a coefficient in a pass
+                                     is less than this threshold. Used by the elastic net method only */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [Parameter source code] */
 
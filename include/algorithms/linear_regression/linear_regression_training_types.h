@@ -81,7 +81,9 @@ enum Method
 {
     defaultDense = 0,   /*!< Default: Normal equations method */
     normEqDense = 0,    /*!< Normal equations method */
-    qrDense = 1         /*!< QR decomposition-based method */
+    qrDense = 1,        /*!< QR decomposition-based method */
+    elasticNetDense = 2 /*!< Elastic net (L1 and L2 penalized) method based on the coordinate descent.
+                             Available in the batch processing mode only */
 };
 
 /**
@@ -92,7 +94,8 @@ enum InputId
 {
     data               = linear_model::training::data,               /*!< %Input data table */
     dependentVariables = linear_model::training::dependentVariables, /*!< Values of the dependent variable for the input data */
-    lastInputId = dependentVariables
+    weights            = linear_model::training::weights,            /*!< Optional weights of the observations, numeric table of size n x 1 */
+    lastInputId = weights
 };
 
 /**
@@ -126,6 +129,18 @@ enum ResultId
     lastResultId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__RESULTNUMERICTABLEID"></a>
+ * \brief Available identifiers of the numeric table results of linear regression model-based training
+ */
+enum ResultNumericTableId
+{
+    nIterations = lastResultId + 1, /*!< Numeric table of size 1 x k with the numbers of coordinate descent iterations
+                                         performed for the final L1 penalty of each response. Computed by the elastic net method only.
+                                         A value equal to maxIterations means that the method has not converged */
+    lastResultNumericTableId = nIterations
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -400,6 +415,20 @@ public:
      */
     void set(ResultId id, const linear_regression::ModelPtr &value);
 
+    /**
+     * Returns the numeric table result of linear regression model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultNumericTableId id) const;
+
+    /**
+     * Sets the numeric table result of linear regression model-based training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultNumericTableId id, const data_management::NumericTablePtr &value);
+
     /**
      * Checks the result of linear regression model-based training
      * \param[in] input   %Input object for the algorithm
@@ -0,0 +1,135 @@
+/* file: logistic_regression_model.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the logistic regression model
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_MODEL_H__
+#define __LOGISTIC_REGRESSION_MODEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/classifier/classifier_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup logistic_regression Logistic Regression
+ * \copydoc daal::algorithms::logistic_regression
+ * @ingroup classification
+ */
+/**
+ * \brief Contains classes for the logistic regression algorithm
+ */
+namespace logistic_regression
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup logistic_regression
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__MODEL"></a>
+ * \brief %Model of the classifier trained by the logistic_regression::training::Batch algorithm.
+ *        For two classes the model contains one vector of coefficients,
+ *        for nClasses > 2 it contains one vector of coefficients per class (multinomial model).
+ *
+ * \par References
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public classifier::Model
+{
+public:
+    DECLARE_MODEL(Model, classifier::Model)
+
+    virtual ~Model() {}
+
+    /**
+     * Returns the number of regression coefficients in one vector of coefficients
+     * including the intercept term
+     * \return Number of regression coefficients
+     */
+    virtual size_t getNumberOfBetas() const = 0;
+
+    /**
+     * Returns true if the intercept term was computed for the model
+     * \return Flag of the intercept term
+     */
+    virtual bool getInterceptFlag() const = 0;
+
+    /**
+     * Returns the numeric table that contains regression coefficients.
+     * Each row of the table contains the intercept term followed by the coefficients of the features
+     * \return Table that contains regression coefficients
+     */
+    virtual data_management::NumericTablePtr getBeta() = 0;
+
+    /**
+     * Returns the numeric table that contains regression coefficients.
+     * Each row of the table contains the intercept term followed by the coefficients of the features
+     * \return Table that contains regression coefficients
+     */
+    virtual const data_management::NumericTablePtr getBeta() const = 0;
+
+protected:
+    Model() : classifier::Model() {}
+};
+/** @} */
+typedef services::SharedPtr<Model> ModelPtr;
+typedef services::SharedPtr<const Model> ModelConstPtr;
+} // namespace interface1
+using interface1::Model;
+using interface1::ModelPtr;
+using interface1::ModelConstPtr;
+
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,247 @@
+/* file: logistic_regression_predict.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for logistic regression model-based prediction
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_PREDICT_H__
+#define __LOGISTIC_REGRESSION_PREDICT_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/classifier/classifier_predict.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+#include "algorithms/logistic_regression/logistic_regression_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+/**
+ * \brief Contains classes for prediction based on models
+ */
+namespace prediction
+{
+/**
+ * @defgroup logistic_regression_prediction_batch Batch
+ * @ingroup logistic_regression_prediction
+ * @{
+ */
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the logistic regression algorithm.
+ *        This class is associated with daal::algorithms::logistic_regression::prediction::interface1::Batch class
+ *        and supports method to compute logistic regression prediction
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Logistic regression computation method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public PredictionContainerIface
+{
+public:
+    /**
+     * Constructs a container for logistic regression model-based prediction with a specified environment
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of logistic regression model-based prediction
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__BATCH"></a>
+ * \brief Predicts logistic regression results
+ * <!-- \n<a href="DAAL-REF-LOGISTIC_REGRESSION-ALGORITHM">Logistic regression algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the logistic regression algorithm, double or float
+ * \tparam method           Logistic regression computation method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method                                       Logistic regression prediction methods
+ *      - \ref classifier::prediction::NumericTableInputId  Identifiers of input Numeric Table objects
+ *                                                          for the logistic regression prediction algorithm
+ *      - \ref classifier::prediction::ModelInputId         Identifiers of input Model objects of the algorithm
+ *      - \ref classifier::prediction::ResultId             Identifiers of prediction results
+ *      - \ref ResultNumericTableId                         Identifiers of additional prediction results
+ *
+ * \par References
+ *      - \ref interface1::Model "Model" class
+ *      - \ref interface1::Input "Input" class
+ *      - \ref interface1::Result "Result" class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Batch : public classifier::prediction::Batch
+{
+public:
+    Input input;                /*!< %Input objects of the algorithm */
+
+    /**
+     * Constructs logistic regression prediction algorithm
+     * \param[in] nClasses  Number of classes
+     */
+    Batch(size_t nClasses)
+    {
+        _par = new Parameter(nClasses);
+        initialize();
+    };
+
+    /**
+     * Constructs a logistic regression prediction algorithm by copying input objects and parameters
+     * of another logistic regression prediction algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : classifier::prediction::Batch(other), input(other.input)
+    {
+        _par = new Parameter(other.parameter());
+        initialize();
+    }
+
+    /** Destructor */
+    ~Batch()
+    {
+        delete _par;
+    }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    Parameter& parameter() { return *static_cast<Parameter*>(_par); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    const Parameter& parameter() const { return *static_cast<const Parameter*>(_par); }
+
+    /**
+     * Gets input objects for the logistic regression prediction algorithm
+     * \return %Input objects for the logistic regression prediction algorithm
+     */
+    Input * getInput() DAAL_C11_OVERRIDE { return &input; }
+
+    /**
+     * Returns method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the logistic regression prediction algorithm
+     * \return Structure that contains the results of the logistic regression prediction algorithm
+     */
+    ResultPtr getResult()
+    {
+        return Result::cast(_result);
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the logistic regression prediction algorithm
+     * \param[in] result  Structure to store the results of the logistic regression prediction algorithm
+     * \return Status of computation
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated logistic regression prediction algorithm with a copy of input objects
+     * and parameters of this logistic regression prediction algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        ResultPtr res = getResult();
+        DAAL_CHECK(res, services::ErrorNullResult);
+        services::Status s = res->template allocate<algorithmFPType>(&input, _par, 0);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _in = &input;
+        _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _result.reset(new Result());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::logistic_regression::prediction
+}
+}
+} // namespace daal
+#endif
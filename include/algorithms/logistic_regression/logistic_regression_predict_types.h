@@ -0,0 +1,248 @@
+/* file: logistic_regression_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the classes used in the prediction stage
+//  of the logistic regression algorithm
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_PREDICT_TYPES_H__
+#define __LOGISTIC_REGRESSION_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+#include "algorithms/classifier/classifier_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+/**
+ * @defgroup logistic_regression_prediction Prediction
+ * \copydoc daal::algorithms::logistic_regression::prediction
+ * @ingroup logistic_regression
+ * @{
+ */
+/**
+ * \brief Contains classes for making prediction based on the logistic regression model */
+namespace prediction
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__METHOD"></a>
+ * Available methods for predictions based on the logistic regression model
+ */
+enum Method
+{
+    defaultDense = 0        /*!< Default method, supports dense and CSR input data */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__RESULTNUMERICTABLEID"></a>
+ * Available identifiers of the results of the logistic regression prediction algorithm
+ * in addition to classifier::prediction::ResultId
+ */
+enum ResultNumericTableId
+{
+    probabilities = classifier::prediction::lastResultId + 1,  /*!< Numeric table of size n x nClasses with probabilities of the classes */
+    logProbabilities,                                           /*!< Numeric table of size n x nClasses with logarithms of probabilities of the classes */
+    lastResultNumericTableId = logProbabilities
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results to compute
+ */
+enum ResultToComputeId
+{
+    computeClassesLabels           = 0x00000001ULL, /*!< Compute the labels of the classes */
+    computeClassesProbabilities    = 0x00000002ULL, /*!< Compute the probabilities of the classes */
+    computeClassesLogProbabilities = 0x00000004ULL  /*!< Compute the logarithms of probabilities of the classes */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the prediction algorithm
+ *
+ * \snippet logistic_regression/logistic_regression_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), resultsToCompute(computeClassesLabels) {}
+    Parameter(const Parameter& o) : daal::algorithms::classifier::Parameter(o), resultsToCompute(o.resultsToCompute) {}
+    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results to compute, \ref ResultToComputeId */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__INPUT"></a>
+ * \brief Input objects in the prediction stage of the logistic regression algorithm
+ */
+class DAAL_EXPORT Input : public classifier::prediction::Input
+{
+    typedef classifier::prediction::Input super;
+public:
+    Input() : super() {}
+    Input(const Input& other) : super(other) {}
+    virtual ~Input() {}
+
+    using super::get;
+    using super::set;
+
+    /**
+     * Returns the input Numeric Table object in the prediction stage of the classification algorithm
+     * \param[in] id    Identifier of the input NumericTable object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(classifier::prediction::NumericTableInputId id) const;
+
+    /**
+     * Returns the input Model object in the prediction stage of the logistic regression algorithm
+     * \param[in] id    Identifier of the input Model object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    logistic_regression::ModelPtr get(classifier::prediction::ModelInputId id) const;
+
+    /**
+     * Sets the input NumericTable object in the prediction stage of the classification algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(classifier::prediction::NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the input Model object in the prediction stage of the logistic regression algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(classifier::prediction::ModelInputId id, const logistic_regression::ModelPtr &ptr);
+
+    /**
+     * Checks the correctness of the input object
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access prediction results obtained with the compute() method
+ *        of the logistic regression prediction algorithm in the batch processing mode
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+    typedef classifier::prediction::Result super;
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    using super::get;
+    using super::set;
+
+    /**
+     * Returns the prediction result of the logistic regression algorithm
+     * \param[in] id   Identifier of the prediction result, \ref ResultNumericTableId
+     * \return         Prediction result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultNumericTableId id) const;
+
+    /**
+     * Sets the prediction result of the logistic regression algorithm
+     * \param[in] id    Identifier of the prediction result, \ref ResultNumericTableId
+     * \param[in] value Pointer to the prediction result
+     */
+    void set(ResultNumericTableId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory for storing prediction results of the logistic regression algorithm
+     * \tparam  algorithmFPType     Data type for storing prediction results
+     * \param[in] input     Pointer to the input objects of the classification algorithm
+     * \param[in] parameter Pointer to the parameters of the classification algorithm
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] input     Pointer to the the input object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                           int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+}
+/** @} */
+}
+}
+}
+#endif // __LOGISTIC_REGRESSION_PREDICT_TYPES_H__
@@ -0,0 +1,183 @@
+/* file: logistic_regression_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression training algorithm interface.
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAINING_TYPES_H__
+#define __LOGISTIC_REGRESSION_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/classifier/classifier_training_types.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+/**
+ * @defgroup logistic_regression_training Training
+ * \copydoc daal::algorithms::logistic_regression::training
+ * @ingroup logistic_regression
+ * @{
+ */
+/**
+ * \brief Contains classes for logistic regression models training
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__METHOD"></a>
+ * \brief Computation methods for logistic regression model-based training.
+ *        All methods support dense and CSR input data
+ */
+enum Method
+{
+    lbfgs        = 0,   /*!< Limited memory BFGS method. Orthant-wise variant (OWL-QN) is used when l1Penalty > 0 */
+    newtonCG     = 1,   /*!< Truncated Newton method with conjugate gradient iterations
+                             on Hessian-vector products. Supports l2Penalty only */
+    defaultDense = 0    /*!< Default training method */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__PARAMETER"></a>
+ * \brief Logistic regression algorithm parameters.
+ *        The algorithm minimizes the average cross-entropy loss plus
+ *        l1Penalty * ||w||_1 + l2Penalty * ||w||_2^2, where w does not include the intercept term
+ *
+ * \snippet logistic_regression/logistic_regression_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public classifier::Parameter
+{
+    /** Default constructor */
+    Parameter(size_t nClasses = 2) : classifier::Parameter(nClasses), interceptFlag(true),
+        l1Penalty(0.0), l2Penalty(0.0), maxIterations(100), accuracyThreshold(1.0e-6), nCorrectionPairs(10) {}
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    bool interceptFlag;         /*!< Flag that indicates whether the intercept term needs to be computed */
+    double l1Penalty;           /*!< L1 regularization coefficient. Used by the lbfgs method only */
+    double l2Penalty;           /*!< L2 regularization coefficient */
+    size_t maxIterations;       /*!< Maximal number of iterations of the optimization method */
+    double accuracyThreshold;   /*!< Training stops when the largest absolute value of the gradient is below this threshold */
+    size_t nCorrectionPairs;    /*!< Number of correction pairs kept by the lbfgs method */
+};
+/* [Parameter source code] */
+
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method
+ *        of model-based training
+ */
+class DAAL_EXPORT Result : public classifier::training::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+
+    Result();
+    virtual ~Result() {}
+
+    /**
+     * Returns the model trained with the logistic regression algorithm
+     * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
+     * \return          Model trained with the logistic regression algorithm
+     */
+    ModelPtr get(classifier::training::ResultId id) const;
+
+    /**
+    * Sets the result of model-based training
+    * \param[in] id      Identifier of the result
+    * \param[in] value   Result
+    */
+    void set(classifier::training::ResultId id, const ModelPtr &value);
+
+    /**
+     * Allocates memory to store final results of the logistic regression training algorithm
+     * \param[in] input         %Input of the logistic regression training algorithm
+     * \param[in] parameter     Parameters of the algorithm
+     * \param[in] method        Logistic regression computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+    * Checks the result of model-based training
+    * \param[in] input   %Input object for the algorithm
+    * \param[in] par     %Parameter of the algorithm
+    * \param[in] method  Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace daal::algorithms::logistic_regression::training
+/** @} */
+}
+}
+} // namespace daal
+#endif // __LOGISTIC_REGRESSION_TRAINING_TYPES_H__
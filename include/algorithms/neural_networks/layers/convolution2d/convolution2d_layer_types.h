@@ -173,6 +173,7 @@ public:
     Paddings paddings;       /*!< Data structure representing the number of data to be implicitly added to the subtensor */
     size_t nKernels;         /*!< Number of kernels applied to the input layer data */
     size_t nGroups;          /*!< Number of groups which the input data is split in groupDimension dimension */
+    QuantizationParameter quantization; /*!< Int8 weights used at the prediction stage, set by neural_networks::prediction::quantize() */
 };
 
 } // namespace interface1
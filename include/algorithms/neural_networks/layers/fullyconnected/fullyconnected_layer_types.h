@@ -105,7 +105,8 @@ public:
      */
     Parameter(size_t _nOutputs);
 
-    size_t nOutputs; /*!< A number of layer outputs. The parameter required to initialize the layer */
+    size_t nOutputs;                    /*!< A number of layer outputs. The parameter required to initialize the layer */
+    QuantizationParameter quantization; /*!< Int8 weights used at the prediction stage, set by neural_networks::prediction::quantize() */
 };
 
 } // namespace interface1
@@ -0,0 +1,267 @@
+/* file: gru_layer_forward.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the forward GRU layer
+//  in the batch processing mode
+//--
+*/
+
+#ifndef __GRU_LAYER_FORWARD_H__
+#define __GRU_LAYER_FORWARD_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/tensor.h"
+#include "services/daal_defines.h"
+#include "algorithms/neural_networks/layers/layer.h"
+#include "algorithms/neural_networks/layers/gru/gru_layer_types.h"
+#include "algorithms/neural_networks/layers/gru/gru_layer_forward_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace gru
+{
+namespace forward
+{
+namespace interface1
+{
+/**
+ * @defgroup gru_forward_batch Batch
+ * @ingroup gru_forward
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__GRU__FORWARD__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the forward GRU layer.
+ *        This class is associated with the daal::algorithms::neural_networks::layers::gru::forward::Batch class
+ *        and supports the method of forward GRU layer computation in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of forward GRU layer, double or float
+ * \tparam method           Computation method of the layer, \ref daal::algorithms::neural_networks::layers::gru::Method
+ * \tparam cpu              Version of the cpu-specific implementation of the layer, \ref daal::CpuType
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public layers::forward::LayerContainerIfaceImpl
+{
+public:
+    /**
+     * Constructs a container for the forward GRU layer with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the forward GRU layer in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    services::Status setupCompute() DAAL_C11_OVERRIDE;
+    virtual services::Status allocateInput() DAAL_C11_OVERRIDE
+    {
+        Input *input = static_cast<Input *>(_in);
+        return input->allocate<algorithmFPType>(_par, (int) method);
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__GRU__FORWARD__BATCH"></a>
+ * \brief Provides methods for forward GRU layer computations in the batch processing mode
+ * <!-- \n<a href="DAAL-REF-GRUFORWARD-ALGORITHM">Forward GRU layer description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of forward GRU layer, double or float
+ * \tparam method           Computation method of the layer, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method          Computation methods for the forward GRU layer
+ *      - \ref LayerDataId Identifiers of results of the forward GRU layer
+ *
+ * \par References
+ *      - backward::interface1::Batch class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Batch : public layers::forward::LayerIfaceImpl
+{
+public:
+    typedef layers::forward::LayerIfaceImpl super;
+    Parameter &parameter; /*!< \ref interface1::Parameter "Parameters" of the layer */
+    Input input;          /*!< %Input objects of the layer */
+
+    /**
+     * Constructs forward GRU layer
+     *  \param[in] nOutputs Size of the hidden state of the layer
+     */
+    Batch(const size_t nOutputs) : _defaultParameter(nOutputs), parameter(_defaultParameter)
+    {
+        initialize();
+    };
+
+    /**
+     * Constructs a forward GRU layer in the batch processing mode
+     * and initializes its parameter with the provided parameter
+     * \param[in] parameter Parameter to initialize the parameter of the layer
+     */
+    Batch(Parameter& parameter) : parameter(parameter), _defaultParameter(parameter)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a forward GRU layer by copying input objects and parameters of another forward GRU layer
+     * \param[in] other A layer to be used as the source to initialize the input objects
+     *                  and parameters of this layer
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : super(other),
+        _defaultParameter(other.parameter), parameter(_defaultParameter), input(other.input)
+    {
+        initialize();
+    }
+
+    /**
+     * Returns method of the layer
+     * \return Method of the layer
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the input objects of the forward GRU layer
+     * \return Structure that contains the input objects of the forward GRU layer
+     */
+    virtual Input *getLayerInput() DAAL_C11_OVERRIDE { return &input; }
+
+    /**
+     * Returns the structure that contains parameters of the forward GRU layer
+     * \return Structure that contains parameters of the forward GRU layer
+     */
+    virtual Parameter *getLayerParameter() DAAL_C11_OVERRIDE { return &parameter; };
+
+    /**
+     * Returns the structure that contains results of GRU layer
+     * \return Structure that contains results of GRU layer
+     */
+    layers::forward::ResultPtr getLayerResult() DAAL_C11_OVERRIDE
+    {
+        return getResult();
+    }
+
+    /**
+     * Returns the structure that contains results of GRU layer
+     * \return Structure that contains results of GRU layer
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of GRU layer
+     * \param[in] result  Structure to store results of GRU layer
+     *
+     * \return Status of computations
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated GRU layer
+     * with a copy of input objects and parameters of this GRU layer
+     * \return Pointer to the newly allocated layer
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+    /**
+     * Allocates memory to store the result of the forward GRU layer
+     *
+     * \return Status of computations
+     */
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = this->_result->template allocate<algorithmFPType>(&(this->input), &parameter, (int) method);
+        this->_res = this->_result.get();
+        return s;
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_LAYER_CONTAINER(BatchContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result.reset(new Result());
+    }
+
+private:
+    ResultPtr _result;
+    Parameter _defaultParameter;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+} // namespace forward
+} // namespace gru
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,243 @@
+/* file: gru_layer_forward_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of forward GRU layer.
+//--
+*/
+
+#ifndef __GRU_LAYER_FORWARD_TYPES_H__
+#define __GRU_LAYER_FORWARD_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/tensor.h"
+#include "data_management/data/homogen_tensor.h"
+#include "services/daal_defines.h"
+#include "algorithms/neural_networks/layers/layer_forward_types.h"
+#include "algorithms/neural_networks/layers/gru/gru_layer_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace gru
+{
+/**
+ * @defgroup gru_forward Forward GRU Layer
+ * \copydoc daal::algorithms::neural_networks::layers::gru::forward
+ * @ingroup gru
+ * @{
+ */
+/**
+ * \brief Contains classes for the forward GRU layer
+ */
+namespace forward
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__GRU__FORWARD__INPUT"></a>
+ * \brief %Input objects for the forward GRU layer
+ */
+class DAAL_EXPORT Input : public layers::forward::Input
+{
+public:
+    typedef layers::forward::Input super;
+    /**
+     * Default constructor
+     */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Sets an input object for the forward GRU layer
+     */
+    using layers::forward::Input::set;
+    /**
+     * Returns an input object for the forward GRU layer
+    */
+    using layers::forward::Input::get;
+
+    /**
+     * Allocates memory to store the result of forward  GRU layer
+     * \param[in] parameter %Parameter of forward GRU layer
+     * \param[in] method    Computation method for the layer
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns dimensions of weights tensor
+     * \return Dimensions of weights tensor
+     */
+    virtual const services::Collection<size_t> getWeightsSizes(const layers::Parameter *parameter) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns dimensions of biases tensor
+     * \return Dimensions of biases tensor
+     */
+    virtual const services::Collection<size_t> getBiasesSizes(const layers::Parameter *parameter) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks input object of the forward GRU layer
+     * \param[in] parameter %Parameter of layer
+     * \param[in] method    Computation method of the layer
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__GRU__FORWARD__RESULT"></a>
+ * \brief Results obtained with the compute() method of the forward GRU layer
+ *        in the batch processing mode
+ */
+class DAAL_EXPORT Result : public layers::forward::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    /**
+     * Default constructor
+     */
+    Result();
+
+    virtual ~Result() {}
+
+    /**
+     * Returns the result of the forward GRU layer
+     */
+    using layers::forward::Result::get;
+
+    /**
+     * Sets the result of the forward GRU layer
+     */
+    using layers::forward::Result::set;
+
+    /**
+     * Allocates memory to store the result of forward  GRU layer
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] parameter %Parameter of forward GRU layer
+     * \param[in] method    Computation method for the layer
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Sets the result that is used in backward GRU layer
+     * \param[in] input     Pointer to an object containing the input data
+     *
+     * \return Status of computations
+     */
+    virtual services::Status setResultForBackward(const daal::algorithms::Input *input) DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns dimensions of value tensor
+     * \return Dimensions of value tensor
+     */
+    virtual const services::Collection<size_t> getValueSize(const services::Collection<size_t> &inputSize,
+                                                            const daal::algorithms::Parameter *par, const int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the result of forward GRU layer
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(LayerDataId id) const;
+
+    /**
+     * Sets the result of forward GRU layer
+     * \param[in] id     Identifier of the result
+     * \param[in] value  Result
+     */
+    void set(LayerDataId id, const data_management::TensorPtr &value);
+
+    /**
+     * Checks the result of the forward GRU layer
+     * \param[in] input   %Input object of the layer
+     * \param[in] par     %Parameter of the layer
+     * \param[in] method  Computation method of the layer
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace forward
+/** @} */
+} // namespace gru
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -127,6 +127,27 @@ public:
     bool allowInplaceComputation;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__QUANTIZATIONPARAMETER"></a>
+ * \brief Int8 representation of the layer weights used at the prediction stage of the neural network
+ */
+class DAAL_EXPORT QuantizationParameter
+{
+public:
+    /** Default constructor */
+    QuantizationParameter();
+
+    /**
+     * Returns the flag specifying whether the forward stage of the layer uses the int8 weights
+     * \return True if the int8 weights are set, false otherwise
+     */
+    bool isEnabled() const { return weights.get() != NULL; }
+
+    data_management::TensorPtr weights;       /*!< Weights in the int8 range stored as a tensor of type DAAL_INT8 of the weights size */
+    data_management::TensorPtr weightsScales; /*!< One-dimensional tensor with the scale of each output channel of the weights */
+    double dataScale;                         /*!< Scale that maps the input data of the layer into the int8 range */
+};
+
 /**
  * \brief Contains extra input and output object of neural network layer
  */
@@ -290,6 +311,7 @@ using interface1::LayerData;
 using interface1::LayerDataPtr;
 using interface1::NextLayers;
 using interface1::Parameter;
+using interface1::QuantizationParameter;
 
 } // namespace layers
 /** @} */
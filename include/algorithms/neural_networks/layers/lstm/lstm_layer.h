@@ -0,0 +1,120 @@
+/* file: lstm_layer.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LSTM neural network layer.
+//--
+*/
+
+#ifndef __LSTM_LAYER_H__
+#define __LSTM_LAYER_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/tensor.h"
+#include "services/daal_defines.h"
+#include "algorithms/neural_networks/layers/layer.h"
+#include "algorithms/neural_networks/layers/lstm/lstm_layer_types.h"
+#include "algorithms/neural_networks/layers/lstm/lstm_layer_forward.h"
+#include "algorithms/neural_networks/layers/lstm/lstm_layer_backward.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+/**
+ * \brief Contains classes for neural network long short-term memory (LSTM) layer
+ */
+namespace lstm
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup lstm
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__LAYERS__LSTM__BATCH"></a>
+ * \brief Computes the result of the forward and backward LSTM layer of neural network in the batch processing mode
+ * <!-- \n<a href="DAAL-REF-LSTMFORWARD-ALGORITHM">Forward LSTM layer description and usage models</a> -->
+ * <!-- \n<a href="DAAL-REF-LSTMBACKWARD-ALGORITHM">Backward LSTM layer description and usage models</a> -->
+ *
+ * \tparam algorithmFPType Data type to use in intermediate computations for the LSTM layer, double or float
+ * \tparam method          %Batch LSTM layer computation method, \ref Method
+ *
+ * \par References
+ *      - \ref forward::interface1::Batch  "forward::Batch" class
+ *      - \ref backward::interface1::Batch "backward::Batch" class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Batch : public LayerIface
+{
+public:
+    Parameter parameter; /*!< Parameters of the layer */
+    /**
+     *  \param[in] nOutputs Size of the hidden state of the layer
+     */
+    Batch(size_t nOutputs): parameter(nOutputs)
+    {
+        forward::Batch<algorithmFPType, method> *forwardLayerObject = new forward::Batch<algorithmFPType, method>(parameter);
+        backward::Batch<algorithmFPType, method> *backwardLayerObject = new backward::Batch<algorithmFPType, method>(parameter);
+
+        LayerIface::forwardLayer = services::SharedPtr<forward::Batch<algorithmFPType, method> >(forwardLayerObject);
+        LayerIface::backwardLayer = services::SharedPtr<backward::Batch<algorithmFPType, method> >(backwardLayerObject);
+    };
+};
+/** @} */
+} // namespace interface1
+using interface1::Batch;
+
+} // namespace lstm
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+#endif
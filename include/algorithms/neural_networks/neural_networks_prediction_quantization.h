@@ -0,0 +1,97 @@
+/* file: neural_networks_prediction_quantization.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the int8 quantization of the neural network model for the prediction stage
+//--
+*/
+
+#ifndef __NEURAL_NETWORKS_PREDICTION_QUANTIZATION_H__
+#define __NEURAL_NETWORKS_PREDICTION_QUANTIZATION_H__
+
+#include "services/daal_defines.h"
+#include "data_management/data/tensor.h"
+#include "algorithms/neural_networks/neural_networks_prediction_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup neural_networks_prediction
+ * @{
+ */
+/**
+ * Creates the model with the fully-connected and two-dimensional convolution layers converted to the int8 computations.
+ * The source model runs the forward pass on the calibration data, the scale of the input data of each layer is
+ * calibrated on the observed values and the weights are quantized with a separate scale for each output channel.
+ * The forward stages of the converted layers multiply int8 data by int8 weights with int32 accumulation
+ * and requantize the products to the floating-point results. The converted layers of the new model store
+ * only the int8 weights; the source model is not modified
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the calibration, double or float
+ * \param[in]  model           Trained model for the prediction stage of the neural network
+ * \param[in]  calibrationData Tensor with samples representative of the data the model is applied to.
+ *                             The first dimension of the tensor is the number of samples
+ * \param[out] stat            Status of computations
+ * \return Quantized model for the prediction stage of the neural network
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT ModelPtr quantize(const ModelPtr &model, const data_management::TensorPtr &calibrationData,
+                              services::Status *stat = NULL);
+/** @} */
+} // namespace interface1
+using interface1::quantize;
+} // namespace prediction
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -50,6 +50,7 @@
 
 #include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -103,6 +104,60 @@ enum ResultId
     weights = 0 /*!< Outlier detection results */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__LOCALINPUTID"></a>
+ * Available identifiers of input objects for the BACON outlier detection algorithm
+ * in the first step of the distributed processing mode
+ */
+enum LocalInputId
+{
+    inputLocation  = 1,                  /*!< Location of the basic subset computed on the master node on the previous iteration */
+    inputScatter   = 2,                  /*!< Scatter matrix of the basic subset computed on the master node on the previous iteration */
+    inputThreshold = 3,                  /*!< Mahalanobis distance threshold that defines the basic subset */
+    lastLocalInputId = inputThreshold
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0,                  /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the BACON outlier detection algorithm
+ * in the distributed processing mode
+ */
+enum PartialResultId
+{
+    nObservations            = 0,        /*!< Total number of observations processed */
+    nBasicSubsetObservations = 1,        /*!< Number of observations in the basic subset */
+    partialSum               = 2,        /*!< Sum of the observations in the basic subset */
+    partialCrossProduct      = 3,        /*!< Cross-product of the observations in the basic subset centered at their mean */
+    lastPartialResultId = partialCrossProduct
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDRESULTID"></a>
+ * Available identifiers of the results of the BACON outlier detection algorithm
+ * in the second step of the distributed processing mode
+ */
+enum DistributedResultId
+{
+    location        = 0,                 /*!< Location (mean) of the basic subset */
+    scatter         = 1,                 /*!< Scatter (variance-covariance) matrix of the basic subset */
+    threshold       = 2,                 /*!< Mahalanobis distance threshold that defines the next basic subset */
+    basicSubsetSize = 3,                 /*!< Number of observations in the basic subset */
+    converged       = 4,                 /*!< Equals 1 if the size of the basic subset is changed by less than
+                                              the convergence threshold since the previous iteration, 0 otherwise */
+    lastDistributedResultId = converged
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -165,6 +220,9 @@ public:
      * \return Status of computations
     */
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    Input(size_t nElements);
 };
 
 /**
@@ -225,12 +283,251 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the BACON outlier detection algorithm in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for the BACON outlier detection algorithm in the first step of the distributed processing mode.
+ *        The location, scatter and threshold are computed on the master node on the previous iteration.
+ *        If they are not set, all observations of the local data set form the basic subset.
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput<step1Local>& other);
+
+    virtual ~DistributedInput() {}
+
+    using Input::get;
+    using Input::set;
+
+    /**
+     * Returns input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(LocalInputId id) const;
+
+    /**
+     * Sets input object for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(LocalInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks input objects for the BACON outlier detection algorithm in the first step of the distributed processing mode
+     * \param[in] par     Algorithm parameters
+     * \param[in] method  Computation method for the algorithm
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the BACON outlier detection algorithm
+ *        in the distributed processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the BACON outlier detection algorithm
+     * \tparam algorithmFPType  Data type to use for storing results, double or float
+     * \param[in] input         Pointer to %Input objects of the algorithm
+     * \param[in] parameter     Pointer to the parameters of the algorithm
+     * \param[in] method        Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns partial result of the BACON outlier detection algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets partial result of the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features in the input data set
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks partial results of the BACON outlier detection algorithm
+     * \param[in] input   Pointer to %Input objects of the algorithm
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of the BACON outlier detection algorithm
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for the BACON outlier detection algorithm in the second step of the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public daal::algorithms::Input
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput<step2Master>& other);
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Sets input object for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds partial result computed on a local node to the input of the BACON outlier detection algorithm
+     * in the second step of the distributed processing mode
+     * \param[in] id             Identifier of the %input object
+     * \param[in] partialResult  Partial result computed on a local node
+     */
+    void add(MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features in the input data set
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks input objects for the BACON outlier detection algorithm in the second step of the distributed processing mode
+     * \param[in] par     Algorithm parameters
+     * \param[in] method  Computation method for the algorithm
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__BACON_OUTLIER_DETECTION__DISTRIBUTEDRESULT"></a>
+ * \brief Results obtained with the finalizeCompute() method of the BACON outlier detection algorithm
+ *        in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedResult : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedResult);
+    DistributedResult();
+
+    virtual ~DistributedResult() {};
+
+    /**
+     * Allocates memory to store the results of the BACON outlier detection algorithm
+     * \tparam algorithmFPType  Data type to use for storing results, double or float
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] parameter     Pointer to the parameters of the algorithm
+     * \param[in] method        Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns result of the BACON outlier detection algorithm
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedResultId id) const;
+
+    /**
+     * Sets the result of the BACON outlier detection algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the result
+     */
+    void set(DistributedResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the result object of the BACON outlier detection algorithm
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] par           Pointer to the parameters of the algorithm
+     * \param[in] method        Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedResult> DistributedResultPtr;
+
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedInput;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::DistributedResult;
+using interface1::DistributedResultPtr;
 
 } // namespace bacon_outlier_detection
 } // namespace algorithm
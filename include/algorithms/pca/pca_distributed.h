@@ -164,6 +164,48 @@ public:
     services::Status finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_RANDOMIZEDDENSE_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm on the local node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, randomizedDense, cpu> : public OnlineContainer<algorithmFPType, randomizedDense, cpu>
+{
+public:
+    /** \brief Constructor */
+    DistributedContainer(daal::services::Environment::env *daalEnv) : OnlineContainer<algorithmFPType, randomizedDense, cpu>(daalEnv) {};
+    virtual ~DistributedContainer() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDDENSE_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm on the master node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu> : public AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes thel result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED"></a>
  * \brief Computes the result of the PCA algorithm
@@ -481,6 +523,135 @@ protected:
         _result.reset(new Result());
     }
 };
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+ * \brief Computes the result of the PCA randomized algorithm on the master node
+ * <!-- \n<a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, randomizedDense> : public Analysis<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, randomizedDense> &other) :
+        input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)randomizedDense; }
+
+    /**
+     * Registers user-allocated memory to store  partial results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial results of the PCA algorithm
+     */
+    services::Status setPartialResult(const services::SharedPtr<PartialResult<randomizedDense> >& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns structure that contains computed partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResult<randomizedDense> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    services::Status setResult(const ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedDense> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedDense> >(cloneImpl());
+    }
+
+    DistributedInput<randomizedDense> input; /*!< Input object */
+    DistributedParameter<step2Master, algorithmFPType, randomizedDense> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResult<randomizedDense> > _partialResult;
+    ResultPtr _result;
+
+    virtual Distributed<step2Master, algorithmFPType, randomizedDense> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, randomizedDense>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, randomizedDense);
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, randomizedDense);
+        _pres = _partialResult.get();
+        return s;
+    }
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, randomizedDense);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, randomizedDense)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResult<randomizedDense>());
+        _result.reset(new Result());
+    }
+};
 /** @} */
 } // namespace interface1
 using interface1::DistributedContainer;
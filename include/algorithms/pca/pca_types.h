@@ -80,7 +80,8 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense = 0, /*!< PCA Default method */
-    svdDense = 1 /*!< PCA SVD method */
+    svdDense = 1, /*!< PCA SVD method */
+    randomizedDense = 2 /*!< PCA randomized method that computes a truncated number of components */
 };
 
 /**
@@ -148,6 +149,19 @@ enum PartialSVDCollectionResultId
     lastPartialSVDCollectionResultId = distributedInputs
 };
 
+/**
+    * <a name="DAAL-ENUM-ALGORITHMS__PCA__PARTIALRANDOMIZEDRESULTID"></a>
+    * Available identifiers of partial results of the PCA randomized algorithm
+    */
+enum PartialRandomizedResultId
+{
+    nObservationsRandomized, /* Number of processed observations */
+    sumRandomized,           /* Feature sums of the processed data */
+    sumSquaresRandomized,    /* Feature sums of squares of the processed data */
+    sketchRandomized,        /* Cross-product of the processed data multiplied by the random test matrix */
+    lastPartialRandomizedResultId = sketchRandomized
+};
+
 /**
     * <a name="DAAL-ENUM-ALGORITHMS__PCA__RESULTID"></a>
     * Available identifiers of the results of the PCA algorithm
@@ -471,6 +485,84 @@ protected:
     }
 };
 
+/**
+    * <a name="DAAL-CLASS-PCA__PARTIALRESULT"></a>
+    * \brief Provides methods to access partial results obtained with the compute() method of the PCA randomized algorithm
+    *        in the online or distributed processing mode
+    */
+template<> class DAAL_EXPORT PartialResult<daal::algorithms::pca::randomizedDense> : public PartialResultBase
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult<daal::algorithms::pca::randomizedDense>);
+    PartialResult();
+
+    /**
+        * Gets partial results of the PCA randomized algorithm
+        * \param[in] id    Identifier of the input object
+        * \return          Input object that corresponds to the given identifier
+        */
+    data_management::NumericTablePtr get(PartialRandomizedResultId id) const;
+
+    virtual size_t getNFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+        * Sets partial result of the PCA randomized algorithm
+        * \param[in] id      Identifier of the result
+        * \param[in] value   Pointer to the object
+        */
+    void set(const PartialRandomizedResultId id, const data_management::NumericTablePtr &value);
+
+    virtual ~PartialResult() {};
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] input      %Input object of the algorithm
+    * \param[in] parameter  Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] par        Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+        * Allocates memory to store partial results of the PCA randomized algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of allocation
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+        * Initializes memory to store partial results of the PCA randomized algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of initialization
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+protected:
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEPARAMETER"></a>
     * \brief Class that specifies the common parameters of the PCA algorithm
@@ -671,6 +763,58 @@ public:
     size_t getNFeatures() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_INPUT"></a>
+    * \brief Input objects of the PCA randomized algorithm in the distributed processing mode
+    */
+template<> class DAAL_EXPORT DistributedInput<randomizedDense> : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput& other);
+
+    /**
+        * Sets input objects for the PCA on the second step in the distributed processing mode
+        * \param[in] id    Identifier of the input object
+        * \param[in] ptr   Input object that corresponds to the given identifier
+        */
+    void set(Step2MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+        * Gets input objects for the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id    Identifier of the input object
+        * \return          Input object that corresponds to the given identifier
+        */
+    data_management::DataCollectionPtr get(Step2MasterInputId id) const;
+
+    /**
+        * Adds input objects of the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id      Identifier of the input object
+        * \param[in] value   Pointer to the input object
+        */
+    void add(Step2MasterInputId id, const services::SharedPtr<PartialResult<randomizedDense> > &value);
+
+    /**
+        * Retrieves specific partial result from the input objects of the PCA algorithm on the second step in the distributed processing mode
+        * \param[in] id      Identifier of the partial result
+        */
+    services::SharedPtr<PartialResult<randomizedDense> > getPartialResult(size_t id) const;
+
+    /**
+    * Checks the input of the PCA algorithm
+    * \param[in] parameter Algorithm %parameter
+    * \param[in] method    Computation  method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+        * Returns the number of columns in the input data set
+        * \return Number of columns in the input data set
+        */
+    size_t getNFeatures() const DAAL_C11_OVERRIDE;
+};
+
 } // namespace interface1
 
 namespace interface2
@@ -746,6 +890,49 @@ public:
 };
 
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__RANDOMIZEDPARAMETER"></a>
+* \brief Class that specifies the parameters of the PCA randomized algorithm.
+*        The same parameters are used in the batch, online and distributed processing modes
+*/
+class DAAL_EXPORT RandomizedParameter : public BaseBatchParameter
+{
+public:
+    /**
+     * Constructs parameters of the PCA randomized algorithm
+     * \param[in] nComponents       Number of principal components to compute
+     * \param[in] oversampling      Number of additional random directions in the sketch of the correlation matrix
+     * \param[in] nPowerIterations  Number of power iterations in the batch processing mode
+     * \param[in] seed              Seed of the generator of the random test matrix
+     */
+    RandomizedParameter(size_t nComponents = 0, size_t oversampling = 10, size_t nPowerIterations = 2, size_t seed = 777);
+
+    size_t oversampling;        /*!< Number of additional random directions in the sketch of the correlation matrix */
+    size_t nPowerIterations;    /*!< Number of power iterations. Used in the batch processing mode only */
+    size_t seed;                /*!< Seed of the generator of the random test matrix.
+                                     Must be the same on all nodes in the distributed processing mode */
+
+    /**
+    * Returns the number of columns in the random test matrix
+    * \param[in] nFeatures Number of features in the input data set
+    * \return Number of columns in the random test matrix
+    */
+    size_t getSketchSize(size_t nFeatures) const;
+
+    /**
+    * Checks parameters of the PCA randomized algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA randomized algorithm in the batch computing mode
+*/
+template<typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense> : public RandomizedParameter {};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -844,6 +1031,24 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+} // namespace interface2
+
+namespace interface1
+{
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA randomized algorithm in the online computing mode
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, randomizedDense> : public interface2::RandomizedParameter {};
+
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER_STEP2MASTER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA randomized algorithm in the distributed computing mode
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT DistributedParameter<step2Master, algorithmFPType, randomizedDense> : public interface2::RandomizedParameter {};
+
     /** @} */
 } // namespace interface1
 using interface1::InputIface;
@@ -852,6 +1057,7 @@ using interface1::PartialResultBase;
 using interface1::PartialResult;
 using interface2::BatchParameter;
 using interface2::BaseBatchParameter;
+using interface2::RandomizedParameter;
 using interface1::OnlineParameter;
 using interface1::DistributedParameter;
 using interface1::DistributedInput;
@@ -91,7 +91,8 @@ enum InputId
 {
     data               = linear_model::training::data,               /*!< %Input data table */
     dependentVariables = linear_model::training::dependentVariables, /*!< Values of the dependent variable for the input data */
-    lastInputId = dependentVariables
+    weights            = linear_model::training::weights,            /*!< Optional weights of the observations, numeric table of size n x 1 */
+    lastInputId = weights
 };
 
 /**
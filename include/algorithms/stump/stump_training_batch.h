@@ -117,7 +117,7 @@ class DAAL_EXPORT Batch : public weak_learner::training::Batch
 {
 public:
     classifier::Parameter parameter;            /*!< \ref classifier::interface1::Parameter "Parameters" of the algorithm */
-    classifier::training::Input input;          /*!< %Input data structure */
+    Input input;                                /*!< %Input data structure */
 
     Batch()
     {
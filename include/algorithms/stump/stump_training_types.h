@@ -82,11 +82,59 @@ enum Method
     defaultDense = 0        /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__STUMP__TRAINING__INPUTID"></a>
+ * \brief Available identifiers of input objects for the decision stump training algorithm
+ */
+enum InputId
+{
+    sortedIndices = classifier::training::lastInputId + 1, /*!< Optional. Numeric table of size p x n, where row j holds the indices of
+                                                                the observations in the ascending order of feature j. The boosting
+                                                                algorithms compute it once per training and share it between all
+                                                                weak learners */
+    lastInputId = sortedIndices
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__STUMP__TRAINING__INPUT"></a>
+ * \brief %Input objects for the decision stump training algorithm
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    Input();
+    Input(const Input& other) : classifier::training::Input(other){}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns the input object of the decision stump training algorithm
+     * \param[in] id   Identifier of the input object, \ref InputId
+     * \return         Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(stump::training::InputId id) const;
+
+    /**
+     * Sets the input object of the decision stump training algorithm
+     * \param[in] id    Identifier of the input object, \ref InputId
+     * \param[in] value Pointer to the input object
+     */
+    void set(stump::training::InputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the input object
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__STUMP__TRAINING__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the decision stump training algorithm
@@ -142,6 +190,7 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 } // namespace interface1
+using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -108,8 +108,8 @@ template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defa
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
-    Input input;            /*!< %Input data structure */
-    Parameter parameter;    /*!< SVD parameters structure */
+    Input input;                        /*!< %Input data structure */
+    BatchParameter<method> parameter;   /*!< SVD parameters structure */
 
     Batch()
     {
@@ -172,7 +172,7 @@ protected:
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
         _result.reset(new Result());
-        services::Status s = _result->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _res = _result.get();
         return s;
     }
@@ -72,7 +72,8 @@ namespace svd
  */
 enum Method
 {
-    defaultDense    = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    randomizedDense = 1  /*!< Randomized method that computes the truncated decomposition for the leading singular values */
 };
 
 /**
@@ -199,6 +200,56 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
 };
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVD__RANDOMIZEDPARAMETER"></a>
+ * \brief Parameters for the randomized computation method of the SVD algorithm
+ */
+struct DAAL_EXPORT RandomizedParameter : public Parameter
+{
+    /**
+     *  Default constructor
+     *  \param[in] _nComponents       Number of leading singular values and vectors to compute
+     *  \param[in] _oversampling      Number of additional random directions in the sketch of the row space
+     *  \param[in] _nPowerIterations  Number of power iterations
+     *  \param[in] _seed              Seed of the generator of the random test matrix
+     */
+    RandomizedParameter(size_t _nComponents = 0, size_t _oversampling = 10, size_t _nPowerIterations = 2, size_t _seed = 777);
+
+    size_t nComponents;         /*!< Number of leading singular values and vectors to compute */
+    size_t oversampling;        /*!< Number of additional random directions in the sketch of the row space */
+    size_t nPowerIterations;    /*!< Number of power iterations */
+    size_t seed;                /*!< Seed of the generator of the random test matrix */
+
+    /**
+     * Returns the number of columns in the random test matrix
+     * \param[in] nFeatures Number of features in the input data set
+     * \return Number of columns in the random test matrix
+     */
+    size_t getSketchSize(size_t nFeatures) const;
+
+    /**
+     * Checks parameters of the randomized SVD algorithm
+     * \return Errors detected while checking
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVD__BATCHPARAMETER"></a>
+ * \brief Parameters of the SVD algorithm in the batch processing mode
+ *
+ * \tparam method  SVD computation method, \ref daal::algorithms::svd::Method
+ */
+template<Method method>
+struct BatchParameter : public Parameter {};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVD__BATCHPARAMETER_RANDOMIZEDDENSE"></a>
+ * \brief Parameters of the randomized SVD algorithm in the batch processing mode
+ */
+template<>
+struct BatchParameter<randomizedDense> : public RandomizedParameter {};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SVD__INPUT"></a>
  * \brief Input objects for the SVD algorithm in the batch processing and online processing modes, and the first step in the distributed
@@ -492,6 +543,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n);
 
+    /**
+     * Allocates memory to store the truncated results of the SVD algorithm
+     * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  m  Number of columns in the input data set
+     * \param[in]  n  Number of rows in the input data set
+     * \param[in]  k  Number of singular values and vectors to store
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n, size_t k);
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -677,6 +739,8 @@ typedef services::SharedPtr<DistributedPartialResultStep3> DistributedPartialRes
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::RandomizedParameter;
+using interface1::BatchParameter;
 using interface1::Input;
 using interface1::DistributedStep2Input;
 using interface1::DistributedStep3Input;
@@ -62,12 +62,17 @@
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
+#include "services/tracing.h"
+#include "services/workspace.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/framed_compression_stream.h"
 #include "data_management/compression/lzocompression.h"
 #include "data_management/compression/rlecompression.h"
 #include "data_management/compression/zlibcompression.h"
+#include "data_management/data_source/columnar_file.h"
+#include "data_management/data_source/columnar_file_data_source.h"
 #include "data_management/data_source/csv_feature_manager.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
@@ -75,6 +80,8 @@
 #include "data_management/data_source/string_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/csr32_numeric_table.h"
+#include "data_management/data/csc_numeric_table.h"
 #include "data_management/data/data_archive.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
@@ -115,6 +122,7 @@
 #include "algorithms/linear_regression/linear_regression_ne_model.h"
 #include "algorithms/linear_regression/linear_regression_predict.h"
 #include "algorithms/linear_regression/linear_regression_qr_model.h"
+#include "algorithms/linear_regression/linear_regression_elastic_net_model.h"
 #include "algorithms/linear_regression/linear_regression_training_distributed.h"
 #include "algorithms/linear_regression/linear_regression_training_batch.h"
 #include "algorithms/linear_regression/linear_regression_training_online.h"
@@ -175,12 +183,16 @@
 #include "algorithms/em/em_gmm_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm_init_types.h"
+#include "algorithms/em/em_gmm_distributed.h"
+#include "algorithms/em/em_gmm_predict.h"
+#include "algorithms/em/em_gmm_predict_types.h"
 #include "algorithms/outlier_detection/outlier_detection_multivariate_types.h"
 #include "algorithms/outlier_detection/outlier_detection_multivariate.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate_types.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon_types.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon.h"
+#include "algorithms/outlier_detection/outlier_detection_bacon_distributed.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_train.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_predict.h"
@@ -190,6 +202,10 @@
 #include "algorithms/moments/low_order_moments_online.h"
 #include "algorithms/moments/low_order_moments_distributed.h"
 #include "algorithms/moments/low_order_moments_types.h"
+#include "algorithms/descriptive_statistics/descriptive_statistics_batch.h"
+#include "algorithms/descriptive_statistics/descriptive_statistics_online.h"
+#include "algorithms/descriptive_statistics/descriptive_statistics_distributed.h"
+#include "algorithms/descriptive_statistics/descriptive_statistics_types.h"
 #include "algorithms/covariance/covariance_batch.h"
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
@@ -201,6 +217,8 @@
 #include "algorithms/distance/correlation_distance_types.h"
 #include "algorithms/distance/cosine_distance.h"
 #include "algorithms/distance/cosine_distance_types.h"
+#include "algorithms/distance/euclidean_distance.h"
+#include "algorithms/distance/euclidean_distance_types.h"
 #include "algorithms/boosting/adaboost_model.h"
 #include "algorithms/boosting/adaboost_predict.h"
 #include "algorithms/boosting/adaboost_training_batch.h"
@@ -243,6 +261,7 @@
 #include "algorithms/neural_networks/neural_networks_training_model.h"
 #include "algorithms/neural_networks/neural_networks_training_distributed.h"
 #include "algorithms/neural_networks/neural_networks_prediction_model.h"
+#include "algorithms/neural_networks/neural_networks_prediction_quantization.h"
 #include "algorithms/neural_networks/neural_networks_types.h"
 #include "algorithms/neural_networks/layers/layer.h"
 #include "algorithms/neural_networks/layers/layer_types.h"
@@ -284,6 +303,10 @@
 #include "algorithms/neural_networks/layers/eltwise_sum/eltwise_sum_layer_types.h"
 #include "algorithms/neural_networks/layers/fullyconnected/fullyconnected_layer.h"
 #include "algorithms/neural_networks/layers/fullyconnected/fullyconnected_layer_types.h"
+#include "algorithms/neural_networks/layers/lstm/lstm_layer.h"
+#include "algorithms/neural_networks/layers/lstm/lstm_layer_types.h"
+#include "algorithms/neural_networks/layers/gru/gru_layer.h"
+#include "algorithms/neural_networks/layers/gru/gru_layer_types.h"
 #include "algorithms/neural_networks/layers/convolution2d/convolution2d_layer.h"
 #include "algorithms/neural_networks/layers/convolution2d/convolution2d_layer_types.h"
 #include "algorithms/neural_networks/layers/transposed_conv2d/transposed_conv2d_layer.h"
@@ -387,6 +410,11 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+#include "algorithms/logistic_regression/logistic_regression_predict.h"
+#include "algorithms/logistic_regression/logistic_regression_predict_types.h"
+#include "algorithms/logistic_regression/logistic_regression_training_batch.h"
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
 #include "algorithms/regression/regression_training_batch.h"
 #include "algorithms/regression/regression_predict.h"
 #include "algorithms/linear_model/linear_model_training_batch.h"
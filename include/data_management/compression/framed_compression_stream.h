@@ -0,0 +1,241 @@
+/* file: framed_compression_stream.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the framed compression and decompression stream interface.
+//--
+*/
+
+#ifndef __FRAMED_COMPRESSION_STREAM_H__
+#define __FRAMED_COMPRESSION_STREAM_H__
+
+#include "services/base.h"
+#include "data_management/compression/compression.h"
+#include "data_management/data/data_block.h"
+#include "services/collection.h"
+
+namespace daal
+{
+namespace data_management
+{
+/**
+ * @ingroup data_compression
+ * @{
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__FRAMEDCOMPRESSIONSTREAM"></a>
+ * \brief %FramedCompressionStream class compresses input raw data into a framed stream.
+ *        Input data is split into chunks of a fixed size that are compressed independently and in parallel.
+ *        The framed stream starts with a header and an index of chunks followed by compressed chunks,
+ *        that allows the FramedDecompressionStream to decompress any range of bytes without decompressing the preceding data.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref FramedDecompressionStream class
+ */
+class DAAL_EXPORT FramedCompressionStream : public Base
+{
+public:
+    /**
+     * %FramedCompressionStream constructor
+     * \param method    Compression method used to compress chunks
+     * \param level     Optional parameter, compression level
+     * \param chunkSize Optional parameter, size of uncompressed chunks in bytes
+     */
+    FramedCompressionStream(CompressionMethod method, CompressionLevel level = defaultLevel, size_t chunkSize = 1024 * 1024 * 4);
+    virtual ~FramedCompressionStream();
+
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream.
+     * Data is compressed as soon as enough chunks are accumulated to load all threads
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+    /**
+     * Writes the next DataBlock to %FramedCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+    /**
+     * Compresses the remaining data and returns the size of the framed stream
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+    /**
+     * Copies the framed stream to an external array.
+     * The stream may be copied by parts with several calls, it is cleared when all its bytes are copied
+     * \param[out] outPtr Pointer to the array where the framed stream is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte *outPtr, size_t outSize);
+    /**
+     * Copies the framed stream to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where the framed stream is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock &outBlock)
+    {
+        return copyCompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    void *_impl;
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__FRAMEDDECOMPRESSIONSTREAM"></a>
+ * \brief %FramedDecompressionStream class decompresses the stream produced by FramedCompressionStream.
+ *        Chunks are decompressed in parallel, only the chunks overlapping the requested range of bytes are decompressed.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref FramedCompressionStream class
+ */
+class DAAL_EXPORT FramedDecompressionStream : public Base
+{
+public:
+    /**
+     * %FramedDecompressionStream constructor
+     */
+    FramedDecompressionStream();
+    virtual ~FramedDecompressionStream();
+    /**
+     * Writes the next part of the framed stream to %FramedDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock of the framed stream
+     */
+    virtual void push_back(DataBlock *inBlock);
+    /**
+     * Writes the next part of the framed stream to %FramedDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock of the framed stream
+     */
+    virtual void operator << (DataBlock *inBlock)
+    {
+        push_back(inBlock);
+    }
+    /**
+     * Writes the next part of the framed stream to %FramedDecompressionStream
+     * \param[in] inBlock  Next DataBlock of the framed stream
+     */
+    virtual void operator << (DataBlock inBlock)
+    {
+        push_back(&inBlock);
+    }
+    /**
+     * Returns the size of decompressed data stored in the framed stream.
+     * The size is read from the header, no data is decompressed
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+    /**
+     * Returns the number of independently compressed chunks in the framed stream
+     * \return Number of chunks
+     */
+    virtual size_t getNumberOfChunks();
+    /**
+     * Decompresses the next part of data to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte *outPtr, size_t outSize);
+    /**
+     * Decompresses the next part of data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock &outBlock)
+    {
+        return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize());
+    }
+    /**
+     * Decompresses the range of bytes of the original data to an external array.
+     * Only the chunks that overlap the range are decompressed
+     * \param[in]  offset  Offset of the first byte of the range in the original data
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes to decompress
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedRange(size_t offset, byte *outPtr, size_t outSize);
+
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    void *_impl;
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+} // namespace interface1
+using interface1::FramedCompressionStream;
+using interface1::FramedDecompressionStream;
+/** @} */
+
+} //namespace data_management
+} //namespace daal
+
+#endif // __FRAMED_COMPRESSION_STREAM_H__
@@ -463,16 +463,20 @@ private:
 
         char *ptr = (char *)(_ptr.get()) + _structSize * idx;
 
-        for( size_t j = 0 ; j < ncols ; j++ )
+        T* blockPtr = block.getBlockPtr();
+
+        /* Consecutive fields of the same type are converted record by record into the block in one pass */
+        for( size_t j0 = 0 ; j0 < ncols ; )
         {
-            NumericTableFeature &f = (*_ddict)[j];
+            data_feature_utils::IndexNumType indexType = (*_ddict)[j0].indexType;
 
-            char *location = ptr + _offsets[j];
+            size_t j1 = j0 + 1;
+            while( j1 < ncols && (*_ddict)[j1].indexType == indexType ) { j1++; }
 
-            T* blockPtr = block.getBlockPtr();
+            data_feature_utils::getVectorRecordUpCast(indexType, data_feature_utils::getInternalNumType<T>())
+            ( nrows, j1 - j0, ptr, _structSize, _offsets + j0, blockPtr + j0, ncols );
 
-            data_feature_utils::getVectorStrideUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
-            ( nrows, location, _structSize, blockPtr + j, sizeof(T)*ncols );
+            j0 = j1;
         }
         return services::Status();
     }
@@ -488,14 +492,17 @@ private:
 
             T* blockPtr = block.getBlockPtr();
 
-            for( size_t j = 0 ; j < ncols ; j++ )
+            for( size_t j0 = 0 ; j0 < ncols ; )
             {
-                NumericTableFeature &f = (*_ddict)[j];
+                data_feature_utils::IndexNumType indexType = (*_ddict)[j0].indexType;
+
+                size_t j1 = j0 + 1;
+                while( j1 < ncols && (*_ddict)[j1].indexType == indexType ) { j1++; }
 
-                char *location = ptr + _offsets[j];
+                data_feature_utils::getVectorRecordDownCast(indexType, data_feature_utils::getInternalNumType<T>())
+                ( block.getNumberOfRows(), j1 - j0, ptr, _structSize, _offsets + j0, blockPtr + j0, ncols );
 
-                data_feature_utils::getVectorStrideDownCast(f.indexType, data_feature_utils::getInternalNumType<T>())
-                ( block.getNumberOfRows(), blockPtr + j, sizeof(T)*ncols, location, _structSize );
+                j0 = j1;
             }
         }
         block.reset();
@@ -0,0 +1,704 @@
+/* file: csc_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a compressed sparse column (CSC) numeric table.
+//--
+*/
+
+#ifndef __CSC_NUMERIC_TABLE_H__
+#define __CSC_NUMERIC_TABLE_H__
+
+#include "services/base.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSCNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in the compressed sparse column (CSC) layout.
+ *         Row indices within each column must be sorted in ascending order.
+ *         Access to columns of the table does not require copying of the sparse structure.
+ *         The table also implements CSRNumericTableIface, so any algorithm that supports CSR numeric tables accepts it;
+ *         blocks of rows are converted into the CSR layout in that case.
+ */
+class DAAL_EXPORT CSCNumericTable : public NumericTable, public CSRNumericTableIface
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(CSCNumericTable)
+
+    /**
+     *  Constructor for an empty CSC numeric table
+     */
+    CSCNumericTable(): NumericTable(0, 0, DictionaryIface::equal), _indexing(oneBased)
+    {
+        _layout = csrArray;
+        this->_status |= setArrays<double>( services::SharedPtr<double>(), services::SharedPtr<size_t>(), services::SharedPtr<size_t>() );
+    }
+
+    /**
+     *  Constructs CSC numeric table with user-allocated memory
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSC layout. Let ptr_size denote the size of an array ptr
+     *  \param[in]    rowIndices  Array of row indices in the CSC layout. Values of indices are determined by the index base
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout. Size of the array is ncol+1. The first element is 0/1
+     *                            in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[in]    indexing    Indexing scheme used to access data in the CSC layout
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSC numeric table with user-allocated memory
+     *  \note Present version of Intel(R) Data Analytics Acceleration Library supports 1-based indexing only
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSCNumericTable> create(DataType *const ptr, size_t *rowIndices, size_t *colOffsets,
+                                                       size_t nColumns, size_t nRows, CSRIndexing indexing = oneBased,
+                                                       services::Status *stat = NULL)
+    {
+        return create<DataType>(services::SharedPtr<DataType>(ptr, services::EmptyDeleter()),
+                                services::SharedPtr<size_t>(rowIndices, services::EmptyDeleter()),
+                                services::SharedPtr<size_t>(colOffsets, services::EmptyDeleter()),
+                                nColumns, nRows, indexing, stat);
+    }
+
+    /**
+     *  Constructs CSC numeric table with user-allocated memory
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSC layout. Let ptr_size denote the size of an array ptr
+     *  \param[in]    rowIndices  Array of row indices in the CSC layout. Values of indices are determined by the index base
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout. Size of the array is ncol+1. The first element is 0/1
+     *                            in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[in]    indexing    Indexing scheme used to access data in the CSC layout
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSC numeric table with user-allocated memory
+     *  \note Present version of Intel(R) Data Analytics Acceleration Library supports 1-based indexing only
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSCNumericTable> create(const services::SharedPtr<DataType>& ptr,
+                                                       const services::SharedPtr<size_t>& rowIndices,
+                                                       const services::SharedPtr<size_t>& colOffsets,
+                                                       size_t nColumns, size_t nRows, CSRIndexing indexing = oneBased,
+                                                       services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_IMPL_EX(CSCNumericTable, ptr, rowIndices, colOffsets, nColumns, nRows, indexing);
+    }
+
+    /**
+     *  Constructs CSC numeric table that holds a copy of the data of a sparse numeric table,
+     *  for example, CSRNumericTable or CSR32NumericTable
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    source      Numeric table that implements CSRNumericTableIface
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return       CSC numeric table with 1-based indexing
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSCNumericTable> create(const NumericTablePtr &source, services::Status *stat = NULL)
+    {
+        services::Status defaultSt;
+        services::Status &st = (stat ? *stat : defaultSt);
+        services::SharedPtr<CSCNumericTable> result;
+
+        CSRNumericTableIface *csr = dynamic_cast<CSRNumericTableIface *>(source.get());
+        if (!csr)
+        {
+            st.add(services::ErrorIncorrectTypeOfInputNumericTable);
+            return result;
+        }
+
+        const size_t nRows = source->getNumberOfRows();
+        const size_t nCols = source->getNumberOfColumns();
+        CSRBlockDescriptor<DataType> block;
+        st |= csr->getSparseBlock(0, nRows, readOnly, block);
+        if (!st) { return result; }
+
+        const size_t nValues = block.getDataSize();
+        services::SharedPtr<DataType> values((DataType *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(DataType)), services::ServiceDeleter());
+        services::SharedPtr<size_t> rowIndices((size_t *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(size_t)), services::ServiceDeleter());
+        services::SharedPtr<size_t> colOffsets((size_t *)daal::services::daal_malloc((nCols + 1) * sizeof(size_t)), services::ServiceDeleter());
+        if (!values || !rowIndices || !colOffsets)
+        {
+            csr->releaseSparseBlock(block);
+            st.add(services::ErrorMemoryAllocationFailed);
+            return result;
+        }
+
+        const DataType *srcValues = block.getBlockValuesPtr();
+        const size_t *srcCols     = block.getBlockColumnIndicesPtr();
+        const size_t *srcRows     = block.getBlockRowIndicesPtr();
+        size_t *offsets = colOffsets.get();
+
+        /* Count the number of non-zero values in each column */
+        for (size_t j = 0; j < nCols + 1; j++) { offsets[j] = 0; }
+        for (size_t k = 0; k < nValues; k++) { offsets[srcCols[k]]++; }
+        offsets[0] = 1;
+        for (size_t j = 0; j < nCols; j++) { offsets[j + 1] += offsets[j]; }
+
+        /* Rows are visited in ascending order, so row indices within each column come out sorted.
+           offsets[j] is used as a cursor of column j and is restored afterwards */
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t k = srcRows[i] - srcRows[0]; k < srcRows[i + 1] - srcRows[0]; k++)
+            {
+                const size_t pos = offsets[srcCols[k] - 1] - 1;
+                values.get()[pos]     = srcValues[k];
+                rowIndices.get()[pos] = i + 1;
+                offsets[srcCols[k] - 1]++;
+            }
+        }
+        for (size_t j = nCols; j > 0; j--) { offsets[j] = offsets[j - 1]; }
+        offsets[0] = 1;
+
+        st |= csr->releaseSparseBlock(block);
+        if (!st) { return result; }
+
+        return create<DataType>(values, rowIndices, colOffsets, nCols, nRows, oneBased, &st);
+    }
+
+    virtual ~CSCNumericTable()
+    {
+        freeDataMemoryImpl();
+    }
+
+    virtual services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
+    {
+        return setNumberOfRowsImpl(nrows);
+    }
+
+    /**
+     *  Returns pointers to a data set stored in the CSC layout
+     *  \param[out]    ptr         Array of values in the CSC layout
+     *  \param[out]    rowIndices  Array of row indices in the CSC layout
+     *  \param[out]    colOffsets  Array of column offsets in the CSC layout
+     */
+    template<typename DataType>
+    services::Status getArrays(DataType **ptr, size_t **rowIndices, size_t **colOffsets) const
+    {
+        if (ptr) { *ptr = (DataType*)_ptr.get(); }
+        if (rowIndices) { *rowIndices = _rowIndices.get(); }
+        if (colOffsets) { *colOffsets = _colOffsets.get(); }
+        return services::Status();
+    }
+
+    /**
+     *  Sets a pointer to a CSC data set
+     *  \param[in]    ptr         Array of values in the CSC layout
+     *  \param[in]    rowIndices  Array of row indices in the CSC layout
+     *  \param[in]    colOffsets  Array of column offsets in the CSC layout
+     *  \param[in]    indexing    The indexing scheme for access to data in the CSC layout
+     */
+    template<typename DataType>
+    services::Status setArrays(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& rowIndices,
+                               const services::SharedPtr<size_t>& colOffsets, CSRIndexing indexing = oneBased)
+    {
+        freeDataMemoryImpl();
+
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
+        _rowIndices = rowIndices;
+        _colOffsets = colOffsets;
+        _indexing = indexing;
+
+        if( ptr && rowIndices && colOffsets ) { _memStatus  = userAllocated; }
+        return services::Status();
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<int>(block);
+    }
+
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseSparseBlock(CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<double>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<float>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<int>(block);
+    }
+
+    /**
+     *  Allocates memory for a data set
+     *  \param[in]    dataSize     Number of non-zero values
+     *  \param[in]    type         Memory type
+     */
+    services::Status allocateDataMemory(size_t dataSize, daal::MemType type = daal::dram)
+    {
+        freeDataMemoryImpl();
+
+        size_t ncol = getNumberOfColumns();
+
+        if( ncol == 0 )
+            return services::Status(services::ErrorIncorrectNumberOfFeatures);
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        _ptr        = services::SharedPtr<byte>  (   (byte*)daal::services::daal_malloc( dataSize   * f.typeSize     ), services::ServiceDeleter());
+        _rowIndices = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( dataSize   * sizeof(size_t) ), services::ServiceDeleter());
+        _colOffsets = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( (ncol + 1) * sizeof(size_t) ), services::ServiceDeleter());
+
+        _memStatus = internallyAllocated;
+
+        if( !_ptr || !_rowIndices || !_colOffsets )
+        {
+            freeDataMemoryImpl();
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        _colOffsets.get()[0] = ((_indexing == oneBased) ? 1 : 0);
+        return services::Status();
+    }
+
+    /**
+     * Returns the indexing scheme for access to data in the CSC layout
+     * \return  CSC layout indexing
+     */
+    CSRIndexing getCSCIndexing() const
+    {
+        return _indexing;
+    }
+
+    /**
+     * \copydoc NumericTableIface::check
+     */
+    virtual services::Status check(const char *description, bool checkDataAllocation = true) const DAAL_C11_OVERRIDE
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, data_management::NumericTable::check(description, checkDataAllocation));
+
+        if( _indexing != oneBased )
+        {
+            return services::Status(services::Error::create(services::ErrorUnsupportedCSRIndexing, services::ArgumentName, description));
+        }
+
+        return services::Status();
+    }
+
+    size_t getDataSize() DAAL_C11_OVERRIDE
+    {
+        size_t ncol = getNumberOfColumns();
+        if( ncol > 0 && _colOffsets )
+        {
+            return _colOffsets.get()[ncol] - _colOffsets.get()[0];
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+protected:
+    NumericTableFeature _defaultFeature;
+    CSRIndexing _indexing;
+
+    services::SharedPtr<byte> _ptr;
+    services::SharedPtr<size_t> _rowIndices;
+    services::SharedPtr<size_t> _colOffsets;
+
+    template<typename DataType>
+    CSCNumericTable(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<size_t>& rowIndices, const services::SharedPtr<size_t>& colOffsets,
+                    size_t nColumns, size_t nRows, CSRIndexing indexing,
+                    services::Status &st):
+        NumericTable(nColumns, nRows, DictionaryIface::equal, st), _indexing(indexing)
+    {
+        _layout = csrArray;
+        st |= setArrays<DataType>(ptr, rowIndices, colOffsets, indexing);
+
+        _defaultFeature.setType<DataType>();
+        st |= _ddict->setAllFeatures( _defaultFeature );
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _ptr = services::SharedPtr<byte>();
+        _rowIndices = services::SharedPtr<size_t>();
+        _colOffsets = services::SharedPtr<size_t>();
+
+        _memStatus  = notAllocated;
+    }
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        size_t dataSize = 0;
+        if( !onDeserialize )
+        {
+            dataSize = getDataSize();
+        }
+        arch->set( dataSize );
+
+        if( onDeserialize )
+        {
+            allocateDataMemory( dataSize );
+        }
+
+        size_t nfeat = getNumberOfColumns();
+
+        if( nfeat > 0 )
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+
+            arch->set( (char *)_ptr.get(), dataSize * f.typeSize );
+            arch->set( _rowIndices.get(), dataSize );
+            arch->set( _colOffsets.get(), nfeat + 1  );
+        }
+
+        return services::Status();
+    }
+
+    /**
+     *  Returns the position of the first value of the column with the row index not less than rowIdx
+     *  \param[in] col     Index of the column
+     *  \param[in] rowIdx  0-based index of the row
+     */
+    size_t lowerBound(size_t col, size_t rowIdx) const
+    {
+        const size_t *rowIndices = _rowIndices.get();
+        size_t first = _colOffsets.get()[col] - 1;
+        size_t last  = _colOffsets.get()[col + 1] - 1;
+        while (first < last)
+        {
+            const size_t middle = first + (last - first) / 2;
+            if (rowIndices[middle] - 1 < rowIdx) { first = middle + 1; }
+            else { last = middle; }
+        }
+        return first;
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        NumericTableFeature &f = (*_ddict)[0];
+        data_feature_utils::vectorConvertFuncType upCast =
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>());
+
+        T *buffer = block.getBlockPtr();
+        const size_t *rowIndices = _rowIndices.get();
+        const size_t *colOffsets = _colOffsets.get();
+
+        for( size_t i = 0; i < ncols * nrows; i++ ) { buffer[i] = (T)0; }
+
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            const size_t end = colOffsets[j + 1] - 1;
+            for( size_t k = lowerBound(j, idx); k < end && rowIndices[k] - 1 < idx + nrows; k++ )
+            {
+                upCast( 1, _ptr.get() + k * f.typeSize, buffer + (rowIndices[k] - 1 - idx) * ncols + j );
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock( BlockDescriptor<T> &block )
+    {
+        if (!(block.getRWFlag() & (int)writeOnly))
+            block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        NumericTableFeature &f = (*_ddict)[0];
+        data_feature_utils::vectorConvertFuncType upCast =
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>());
+
+        T *bufferPtr = block.getBlockPtr();
+        const size_t *rowIndices = _rowIndices.get();
+        const size_t end = _colOffsets.get()[feat_idx + 1] - 1;
+
+        for( size_t i = 0; i < nrows; i++ ) { bufferPtr[i] = (T)0; }
+
+        for( size_t k = lowerBound(feat_idx, idx); k < end && rowIndices[k] - 1 < idx + nrows; k++ )
+        {
+            upCast( 1, _ptr.get() + k * f.typeSize, bufferPtr + rowIndices[k] - 1 - idx );
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTFeature( BlockDescriptor<T> &block )
+    {
+        if(block.getRWFlag() & (int)writeOnly)
+            return services::Status();
+        block.reset();
+        return services::Status();
+    }
+
+    /**
+     *  Copies values of the rows [idx, idx + nrows) between the table and the block in the CSR layout.
+     *  Columns are visited in ascending order, so column indices within each row of the block are sorted
+     *  \param[in]     rowCursor   Positions of the first value of each row in the block; advanced by the method
+     *  \param[in]     toBlock     Copy direction
+     */
+    template <typename T>
+    void copySparseRows(size_t idx, size_t nrows, T *values, size_t *colIndices, size_t *rowCursor, bool toBlock)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t *rowIndices = _rowIndices.get();
+        const size_t *colOffsets = _colOffsets.get();
+
+        NumericTableFeature &f = (*_ddict)[0];
+        data_feature_utils::vectorConvertFuncType convert = toBlock ?
+            data_feature_utils::getVectorUpCast  (f.indexType, data_feature_utils::getInternalNumType<T>()) :
+            data_feature_utils::getVectorDownCast(f.indexType, data_feature_utils::getInternalNumType<T>());
+
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            const size_t end = colOffsets[j + 1] - 1;
+            for( size_t k = lowerBound(j, idx); k < end && rowIndices[k] - 1 < idx + nrows; k++ )
+            {
+                const size_t pos = rowCursor[rowIndices[k] - 1 - idx]++;
+                if( toBlock )
+                {
+                    convert( 1, _ptr.get() + k * f.typeSize, values + pos );
+                    colIndices[pos] = j + 1;
+                }
+                else
+                {
+                    convert( 1, values + pos, _ptr.get() + k * f.typeSize );
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    services::Status getSparseTBlock( size_t idx, size_t nrows, int rwFlag, CSRBlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( ncols, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeValuesBuffer( 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeRowsBuffer(nrows) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        size_t *rowOffsets = block.getBlockRowIndicesPtr();
+
+        /* Count the number of non-zero values in each row of the block */
+        const size_t *rowIndices = _rowIndices.get();
+        const size_t *colOffsets = _colOffsets.get();
+        for( size_t i = 0; i < nrows + 1; i++ ) { rowOffsets[i] = 0; }
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            const size_t end = colOffsets[j + 1] - 1;
+            for( size_t k = lowerBound(j, idx); k < end && rowIndices[k] - 1 < idx + nrows; k++ )
+            {
+                rowOffsets[rowIndices[k] - idx]++;
+            }
+        }
+        rowOffsets[0] = 1;
+        for( size_t i = 0; i < nrows; i++ ) { rowOffsets[i + 1] += rowOffsets[i]; }
+
+        const size_t nValues = rowOffsets[nrows] - 1;
+        if( !block.resizeValuesBuffer(nValues) || !block.resizeColumnIndicesBuffer(nValues) )
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        services::SharedPtr<size_t> rowCursor((size_t *)daal::services::daal_malloc(nrows * sizeof(size_t)), services::ServiceDeleter());
+        if( !rowCursor ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+        for( size_t i = 0; i < nrows; i++ ) { rowCursor.get()[i] = rowOffsets[i] - 1; }
+
+        copySparseRows<T>(idx, nrows, block.getBlockValuesPtr(), block.getBlockColumnIndicesPtr(), rowCursor.get(), true);
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseSparseTBlock(CSRBlockDescriptor<T> &block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t nrows = block.getNumberOfRows();
+            const size_t idx   = block.getRowsOffset();
+            const size_t *rowOffsets = block.getBlockRowIndicesPtr();
+
+            services::SharedPtr<size_t> rowCursor((size_t *)daal::services::daal_malloc(nrows * sizeof(size_t)), services::ServiceDeleter());
+            if( !rowCursor ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+            for( size_t i = 0; i < nrows; i++ ) { rowCursor.get()[i] = rowOffsets[i] - 1; }
+
+            copySparseRows<T>(idx, nrows, block.getBlockValuesPtr(), block.getBlockColumnIndicesPtr(), rowCursor.get(), false);
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    virtual services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        _ddict->setNumberOfFeatures( ncol );
+        _ddict->setAllFeatures( _defaultFeature );
+        return services::Status();
+    }
+};
+typedef services::SharedPtr<CSCNumericTable> CSCNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::CSCNumericTable;
+using interface1::CSCNumericTablePtr;
+
+}
+} // namespace daal
+#endif
@@ -0,0 +1,817 @@
+/* file: csr32_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a compressed sparse row (CSR) numeric table with 32-bit column indices.
+//--
+*/
+
+#ifndef __CSR32_NUMERIC_TABLE_H__
+#define __CSR32_NUMERIC_TABLE_H__
+
+#include "services/base.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSR32NUMERICTABLEIFACE"></a>
+ *  \brief Abstract class that defines the interface of CSR numeric tables that provide access
+ *         to column indices stored as 32-bit integers
+ */
+class CSR32NumericTableIface
+{
+public:
+    virtual ~CSR32NumericTableIface() {}
+
+    /**
+     *  Gets a block of feature vectors in the CSR layout with 32-bit column indices.
+     *
+     *  \param[in] vector_idx       Index of the first row to include into the block.
+     *  \param[in] vector_num       Number of rows in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature vectors.
+     *  \param[out] block           The block of feature values.
+     *
+     *  \return Status of computations
+     */
+    virtual services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double, unsigned int> &block) = 0;
+
+    /**
+     *  Gets a block of feature vectors in the CSR layout with 32-bit column indices.
+     *
+     *  \param[in] vector_idx       Index of the first row to include into the block.
+     *  \param[in] vector_num       Number of rows in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature vectors.
+     *  \param[out] block           The block of feature values.
+     *
+     *  \return Status of computations
+     */
+    virtual services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float, unsigned int> &block) = 0;
+
+    /**
+     *  Gets a block of feature vectors in the CSR layout with 32-bit column indices.
+     *
+     *  \param[in] vector_idx       Index of the first row to include into the block.
+     *  \param[in] vector_num       Number of rows in the block.
+     *  \param[in] rwflag           Flag specifying read/write access to the block of feature vectors.
+     *  \param[out] block           The block of feature values.
+     *
+     *  \return Status of computations
+     */
+    virtual services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int, unsigned int> &block) = 0;
+
+    /**
+     *  Releases a block of feature vectors in the CSR layout with 32-bit column indices.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseBlock(CSRBlockDescriptor<double, unsigned int> &block) = 0;
+
+    /**
+     *  Releases a block of feature vectors in the CSR layout with 32-bit column indices.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseBlock(CSRBlockDescriptor<float, unsigned int> &block) = 0;
+
+    /**
+     *  Releases a block of feature vectors in the CSR layout with 32-bit column indices.
+     *  \param[in] block           The block of feature values.
+     */
+    virtual services::Status releaseSparseBlock(CSRBlockDescriptor<int, unsigned int> &block) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSR32NUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in the CSR layout with 32-bit column indices.
+ *         Row offsets are stored as size_t, so the number of non-zero values is not limited by 32 bits.
+ *         The table also implements CSRNumericTableIface, so any algorithm that supports CSR numeric tables accepts it;
+ *         column indices are widened to size_t in that case.
+ *
+ *         The 32-bit column indices are used directly by the linear and RBF kernel functions and by the training of
+ *         the multinomial naive Bayes classifier, CSR methods. All other algorithms, including the CSR methods of
+ *         K-Means, covariance, naive Bayes prediction and implicit ALS, read the table with widened indices
+ *         and are not faster with CSR32NumericTable than with CSRNumericTable.
+ */
+class DAAL_EXPORT CSR32NumericTable : public NumericTable, public CSRNumericTableIface, public CSR32NumericTableIface
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(CSR32NumericTable)
+
+    /**
+     *  Constructor for an empty CSR numeric table with 32-bit column indices
+     */
+    CSR32NumericTable(): NumericTable(0, 0, DictionaryIface::equal), _indexing(oneBased)
+    {
+        _layout = csrArray;
+        this->_status |= setArrays<double>( services::SharedPtr<double>(), services::SharedPtr<unsigned int>(), services::SharedPtr<size_t>() );
+    }
+
+    /**
+     *  Constructs CSR numeric table with 32-bit column indices and user-allocated memory
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSR layout. Let ptr_size denote the size of an array ptr
+     *  \param[in]    colIndices  Array of 32-bit column indices in the CSR layout. Values of indices are determined by the index base
+     *  \param[in]    rowOffsets  Array of row indices in the CSR layout. Size of the array is nrow+1. The first element is 0/1
+     *                            in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[in]    indexing    Indexing scheme used to access data in the CSR layout
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSR numeric table with user-allocated memory
+     *  \note Present version of Intel(R) Data Analytics Acceleration Library supports 1-based indexing only
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSR32NumericTable> create(DataType *const ptr, unsigned int *colIndices, size_t *rowOffsets,
+                                                         size_t nColumns, size_t nRows, CSRIndexing indexing = oneBased,
+                                                         services::Status *stat = NULL)
+    {
+        return create<DataType>(services::SharedPtr<DataType>(ptr, services::EmptyDeleter()),
+                                services::SharedPtr<unsigned int>(colIndices, services::EmptyDeleter()),
+                                services::SharedPtr<size_t>(rowOffsets, services::EmptyDeleter()),
+                                nColumns, nRows, indexing, stat);
+    }
+
+    /**
+     *  Constructs CSR numeric table with 32-bit column indices and user-allocated memory
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    ptr         Array of values in the CSR layout. Let ptr_size denote the size of an array ptr
+     *  \param[in]    colIndices  Array of 32-bit column indices in the CSR layout. Values of indices are determined by the index base
+     *  \param[in]    rowOffsets  Array of row indices in the CSR layout. Size of the array is nrow+1. The first element is 0/1
+     *                            in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     *  \param[in]    nColumns    Number of columns in the corresponding dense table
+     *  \param[in]    nRows       Number of rows in the corresponding dense table
+     *  \param[in]    indexing    Indexing scheme used to access data in the CSR layout
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return CSR numeric table with user-allocated memory
+     *  \note Present version of Intel(R) Data Analytics Acceleration Library supports 1-based indexing only
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSR32NumericTable> create(const services::SharedPtr<DataType>& ptr,
+                                                         const services::SharedPtr<unsigned int>& colIndices,
+                                                         const services::SharedPtr<size_t>& rowOffsets,
+                                                         size_t nColumns, size_t nRows, CSRIndexing indexing = oneBased,
+                                                         services::Status *stat = NULL)
+    {
+        if (nColumns > (size_t)maxColumnIndex)
+        {
+            if (stat) { stat->add(services::ErrorIncorrectNumberOfColumns); }
+            return services::SharedPtr<CSR32NumericTable>();
+        }
+        DAAL_DEFAULT_CREATE_IMPL_EX(CSR32NumericTable, ptr, colIndices, rowOffsets, nColumns, nRows, indexing);
+    }
+
+    /**
+     *  Constructs CSR numeric table with 32-bit column indices that holds a copy of the data of another sparse numeric table,
+     *  for example, CSRNumericTable or CSCNumericTable
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    source      Numeric table that implements CSRNumericTableIface
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return       CSR numeric table with 32-bit column indices and 1-based indexing
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSR32NumericTable> create(const NumericTablePtr &source, services::Status *stat = NULL)
+    {
+        services::Status defaultSt;
+        services::Status &st = (stat ? *stat : defaultSt);
+        services::SharedPtr<CSR32NumericTable> result;
+
+        CSRNumericTableIface *csr = dynamic_cast<CSRNumericTableIface *>(source.get());
+        if (!csr)
+        {
+            st.add(services::ErrorIncorrectTypeOfInputNumericTable);
+            return result;
+        }
+        if (source->getNumberOfColumns() > (size_t)maxColumnIndex)
+        {
+            st.add(services::ErrorIncorrectNumberOfColumns);
+            return result;
+        }
+
+        const size_t nRows = source->getNumberOfRows();
+        CSRBlockDescriptor<DataType> block;
+        st |= csr->getSparseBlock(0, nRows, readOnly, block);
+        if (!st) { return result; }
+
+        const size_t nValues = block.getDataSize();
+        services::SharedPtr<DataType> values((DataType *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(DataType)), services::ServiceDeleter());
+        services::SharedPtr<unsigned int> colIndices((unsigned int *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(unsigned int)), services::ServiceDeleter());
+        services::SharedPtr<size_t> rowOffsets((size_t *)daal::services::daal_malloc((nRows + 1) * sizeof(size_t)), services::ServiceDeleter());
+        if (!values || !colIndices || !rowOffsets)
+        {
+            csr->releaseSparseBlock(block);
+            st.add(services::ErrorMemoryAllocationFailed);
+            return result;
+        }
+
+        const DataType *srcValues = block.getBlockValuesPtr();
+        const size_t *srcCols     = block.getBlockColumnIndicesPtr();
+        const size_t *srcRows     = block.getBlockRowIndicesPtr();
+        for (size_t i = 0; i < nValues; i++)
+        {
+            values.get()[i]     = srcValues[i];
+            colIndices.get()[i] = (unsigned int)srcCols[i];
+        }
+        for (size_t i = 0; i < nRows + 1; i++)
+        {
+            rowOffsets.get()[i] = srcRows[i] - srcRows[0] + 1;
+        }
+        st |= csr->releaseSparseBlock(block);
+        if (!st) { return result; }
+
+        return create<DataType>(values, colIndices, rowOffsets, source->getNumberOfColumns(), nRows, oneBased, &st);
+    }
+
+    virtual ~CSR32NumericTable()
+    {
+        freeDataMemoryImpl();
+    }
+
+    virtual services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
+    {
+        return setNumberOfRowsImpl(nrows);
+    }
+
+    /**
+     *  Returns pointers to a data set stored in the CSR layout
+     *  \param[out]    ptr         Array of values in the CSR layout
+     *  \param[out]    colIndices  Array of 32-bit column indices in the CSR layout
+     *  \param[out]    rowOffsets  Array of row indices in the CSR layout
+     */
+    template<typename DataType>
+    services::Status getArrays(DataType **ptr, unsigned int **colIndices, size_t **rowOffsets) const
+    {
+        if (ptr) { *ptr = (DataType*)_ptr.get(); }
+        if (colIndices) { *colIndices = _colIndices.get(); }
+        if (rowOffsets) { *rowOffsets = _rowOffsets.get(); }
+        return services::Status();
+    }
+
+    /**
+     *  Sets a pointer to a CSR data set
+     *  \param[in]    ptr         Array of values in the CSR layout
+     *  \param[in]    colIndices  Array of 32-bit column indices in the CSR layout
+     *  \param[in]    rowOffsets  Array of row indices in the CSR layout
+     *  \param[in]    indexing    The indexing scheme for access to data in the CSR layout
+     */
+    template<typename DataType>
+    services::Status setArrays(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<unsigned int>& colIndices,
+                               const services::SharedPtr<size_t>& rowOffsets, CSRIndexing indexing = oneBased)
+    {
+        freeDataMemoryImpl();
+
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
+        _colIndices = colIndices;
+        _rowOffsets = rowOffsets;
+        _indexing = indexing;
+
+        if( ptr && colIndices && rowOffsets ) { _memStatus  = userAllocated; }
+        return services::Status();
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+         return releaseTFeature<int>(block);
+    }
+
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<double, size_t>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<float, size_t>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<int, size_t>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseSparseBlock(CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<double, size_t>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<float, size_t>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<int, size_t>(block);
+    }
+
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<double, unsigned int>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<float, unsigned int>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return getSparseTBlock<int, unsigned int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseSparseBlock(CSRBlockDescriptor<double, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<double, unsigned int>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<float, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<float, unsigned int>(block);
+    }
+    services::Status releaseSparseBlock(CSRBlockDescriptor<int, unsigned int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseSparseTBlock<int, unsigned int>(block);
+    }
+
+    /**
+     *  Allocates memory for a data set
+     *  \param[in]    dataSize     Number of non-zero values
+     *  \param[in]    type         Memory type
+     */
+    services::Status allocateDataMemory(size_t dataSize, daal::MemType type = daal::dram)
+    {
+        freeDataMemoryImpl();
+
+        size_t nrow = getNumberOfRows();
+
+        if( nrow == 0 )
+            return services::Status(services::ErrorIncorrectNumberOfObservations);
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        _ptr        = services::SharedPtr<byte>        (          (byte*)daal::services::daal_malloc( dataSize   * f.typeSize           ), services::ServiceDeleter());
+        _colIndices = services::SharedPtr<unsigned int>((unsigned int *)daal::services::daal_malloc( dataSize   * sizeof(unsigned int) ), services::ServiceDeleter());
+        _rowOffsets = services::SharedPtr<size_t>      (      (size_t *)daal::services::daal_malloc( (nrow + 1) * sizeof(size_t)       ), services::ServiceDeleter());
+
+        _memStatus = internallyAllocated;
+
+        if( !_ptr || !_colIndices || !_rowOffsets )
+        {
+            freeDataMemoryImpl();
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        _rowOffsets.get()[0] = ((_indexing == oneBased) ? 1 : 0);
+        return services::Status();
+    }
+
+    /**
+     * Returns the indexing scheme for access to data in the CSR layout
+     * \return  CSR layout indexing
+     */
+    CSRIndexing getCSRIndexing() const
+    {
+        return _indexing;
+    }
+
+    /**
+     * \copydoc NumericTableIface::check
+     */
+    virtual services::Status check(const char *description, bool checkDataAllocation = true) const DAAL_C11_OVERRIDE
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, data_management::NumericTable::check(description, checkDataAllocation));
+
+        if( _indexing != oneBased )
+        {
+            return services::Status(services::Error::create(services::ErrorUnsupportedCSRIndexing, services::ArgumentName, description));
+        }
+
+        return services::Status();
+    }
+
+    size_t getDataSize() DAAL_C11_OVERRIDE
+    {
+        size_t nobs  = getNumberOfRows();
+        if( nobs > 0)
+        {
+            return _rowOffsets.get()[nobs] - _rowOffsets.get()[0];
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+protected:
+    static const unsigned int maxColumnIndex = 0xffffffffU; /*!< Largest 1-based column index representable by 32-bit column indices */
+
+    NumericTableFeature _defaultFeature;
+    CSRIndexing _indexing;
+
+    services::SharedPtr<byte> _ptr;
+    services::SharedPtr<unsigned int> _colIndices;
+    services::SharedPtr<size_t> _rowOffsets;
+
+    template<typename DataType>
+    CSR32NumericTable(const services::SharedPtr<DataType>& ptr, const services::SharedPtr<unsigned int>& colIndices, const services::SharedPtr<size_t>& rowOffsets,
+                      size_t nColumns, size_t nRows, CSRIndexing indexing,
+                      services::Status &st):
+        NumericTable(nColumns, nRows, DictionaryIface::equal, st), _indexing(indexing)
+    {
+        _layout = csrArray;
+        st |= setArrays<DataType>(ptr, colIndices, rowOffsets, indexing);
+
+        _defaultFeature.setType<DataType>();
+        st |= _ddict->setAllFeatures( _defaultFeature );
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _ptr = services::SharedPtr<byte>();
+        _colIndices = services::SharedPtr<unsigned int>();
+        _rowOffsets = services::SharedPtr<size_t>();
+
+        _memStatus  = notAllocated;
+    }
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        size_t dataSize = 0;
+        if( !onDeserialize )
+        {
+            dataSize = getDataSize();
+        }
+        arch->set( dataSize );
+
+        if( onDeserialize )
+        {
+            allocateDataMemory( dataSize );
+        }
+
+        size_t nfeat = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+
+        if( nfeat > 0 )
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+
+            arch->set( (char *)_ptr.get(), dataSize * f.typeSize );
+            arch->set( _colIndices.get(), dataSize );
+            arch->set( _rowOffsets.get(), nobs + 1   );
+        }
+
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+        size_t* rowOffsets = _rowOffsets.get();
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        T* buffer;
+        T* castingBuffer;
+        T* location = (T*)(_ptr.get() + (rowOffsets[idx] - 1) * f.typeSize);
+
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            castingBuffer = location;
+
+            if( !block.resizeBuffer( ncols, nrows ) )
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            buffer = block.getBlockPtr();
+        }
+        else
+        {
+            size_t sparseBlockSize = rowOffsets[idx + nrows] - rowOffsets[idx];
+
+            if( !block.resizeBuffer( ncols, nrows, sparseBlockSize * sizeof(T) ) )
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            buffer = block.getBlockPtr();
+
+            castingBuffer = (T*)block.getAdditionalBufferPtr();
+
+            data_feature_utils::getVectorUpCast(f.indexType,data_feature_utils::getInternalNumType<T>())
+            ( sparseBlockSize, location, castingBuffer );
+        }
+
+        T *bufRowCursor             = castingBuffer;
+        unsigned int *indicesCursor = _colIndices.get() + rowOffsets[idx] - 1;
+
+        for( size_t i = 0; i < ncols * nrows; i++ ) { buffer[i] = (T)0; }
+
+        for( size_t i = 0; i < nrows; i++ )
+        {
+            size_t sparseRowSize = rowOffsets[idx + i + 1] - rowOffsets[idx + i];
+
+            for( size_t k = 0; k < sparseRowSize; k++ )
+            {
+                buffer[i * ncols + indicesCursor[k] - 1] = bufRowCursor[k];
+            }
+
+            bufRowCursor  += sparseRowSize;
+            indicesCursor += sparseRowSize;
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock( BlockDescriptor<T> &block )
+    {
+        if (!(block.getRWFlag() & (int)writeOnly))
+            block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+        size_t* rowOffsets = _rowOffsets.get();
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        char         *rowCursor     = (char *)_ptr.get() + (rowOffsets[idx] - 1) * f.typeSize;
+        unsigned int *indicesCursor = _colIndices.get() + (rowOffsets[idx] - 1);
+
+        T* bufferPtr = block.getBlockPtr();
+
+        for(size_t i = 0; i < nrows; i++)
+        {
+            bufferPtr[i] = (T)0;
+
+            size_t sparseRowSize = rowOffsets[idx + i + 1] - rowOffsets[idx + i];
+
+            for(size_t k = 0; k < sparseRowSize; k++)
+            {
+                if( indicesCursor[k] - 1 == feat_idx )
+                {
+                    data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+                    ( 1, rowCursor + k * f.typeSize, bufferPtr + i );
+                }
+            }
+
+            rowCursor     += sparseRowSize * f.typeSize;
+            indicesCursor += sparseRowSize;
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTFeature( BlockDescriptor<T> &block )
+    {
+        if(block.getRWFlag() & (int)writeOnly)
+            return services::Status();
+        block.reset();
+        return services::Status();
+    }
+
+    /** Column indices are returned without copying when the block stores 32-bit indices */
+    template <typename T>
+    bool setBlockColumnIndices(CSRBlockDescriptor<T, unsigned int> &block, size_t offset, size_t nValues)
+    {
+        services::SharedPtr<unsigned int> shiftedColumns(_colIndices, _colIndices.get() + offset);
+        block.setColumnIndicesPtr( shiftedColumns, nValues );
+        return true;
+    }
+
+    /** Column indices are widened to size_t when the block stores 64-bit indices */
+    template <typename T>
+    bool setBlockColumnIndices(CSRBlockDescriptor<T, size_t> &block, size_t offset, size_t nValues)
+    {
+        if( !block.resizeColumnIndicesBuffer(nValues) ) { return false; }
+
+        const unsigned int *colIndices = _colIndices.get() + offset;
+        size_t *blockColIndices = block.getBlockColumnIndicesPtr();
+        for(size_t i = 0; i < nValues; i++)
+        {
+            blockColIndices[i] = colIndices[i];
+        }
+        return true;
+    }
+
+    template <typename T, typename IndexType>
+    services::Status getSparseTBlock( size_t idx, size_t nrows, int rwFlag, CSRBlockDescriptor<T, IndexType> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( ncols, idx, rwFlag );
+        size_t* rowOffsets = _rowOffsets.get();
+
+        if (idx >= nobs)
+        {
+            block.resizeValuesBuffer( 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        NumericTableFeature &f = (*_ddict)[0];
+
+        size_t nValues = rowOffsets[idx + nrows] - rowOffsets[idx];
+
+        if( data_feature_utils::getIndexNumType<T>() == f.indexType )
+        {
+            block.setValuesPtr(&_ptr, _ptr.get() +(rowOffsets[idx] - 1) * f.typeSize, nValues);
+        }
+        else
+        {
+            if( !block.resizeValuesBuffer(nValues) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+
+            services::SharedPtr<byte> location(_ptr, _ptr.get() +(rowOffsets[idx] - 1) * f.typeSize);
+            data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+            ( nValues, location.get(), block.getBlockValuesPtr() );
+        }
+
+        if( !setBlockColumnIndices<T>(block, rowOffsets[idx] - 1, nValues) )
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        if( idx == 0 )
+        {
+            block.setRowIndicesPtr( _rowOffsets, nrows );
+        }
+        else
+        {
+            if( !block.resizeRowsBuffer(nrows) ) { return services::Status(services::ErrorMemoryAllocationFailed); }
+
+            size_t *row_offsets = block.getBlockRowIndicesSharedPtr().get();
+
+            for(size_t i = 0; i < nrows + 1; i++)
+            {
+                row_offsets[i] = rowOffsets[idx + i] - rowOffsets[idx] + 1;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T, typename IndexType>
+    services::Status releaseSparseTBlock(CSRBlockDescriptor<T, IndexType> &block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            NumericTableFeature &f = (*_ddict)[0];
+            if (f.indexType != data_feature_utils::getIndexNumType<T>())
+            {
+                size_t nrows = block.getNumberOfRows();
+                size_t idx   = block.getRowsOffset();
+                size_t nValues = _rowOffsets.get()[idx + nrows] - _rowOffsets.get()[idx];
+
+                byte *location = _ptr.get() + (_rowOffsets.get()[idx] - 1) * f.typeSize;
+
+                data_feature_utils::getVectorDownCast(f.indexType, data_feature_utils::getInternalNumType<T>())
+                        (nValues, block.getBlockValuesPtr(), location);
+            }
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    virtual services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        _ddict->setNumberOfFeatures( ncol );
+        _ddict->setAllFeatures( _defaultFeature );
+        return services::Status();
+    }
+};
+typedef services::SharedPtr<CSR32NumericTableIface> CSR32NumericTableIfacePtr;
+typedef services::SharedPtr<CSR32NumericTable> CSR32NumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::CSR32NumericTableIface;
+using interface1::CSR32NumericTableIfacePtr;
+using interface1::CSR32NumericTable;
+using interface1::CSR32NumericTablePtr;
+
+}
+} // namespace daal
+#endif
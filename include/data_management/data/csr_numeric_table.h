@@ -66,8 +66,10 @@ namespace interface1
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__CSRBLOCKDESCRIPTOR"></a>
  *  \brief %Base class that manages buffer memory for read/write operations required by CSR numeric tables.
+ *  \tparam DataType   Type of values in the block
+ *  \tparam IndexType  Type of column indices in the block
  */
-template<typename DataType = DAAL_DATA_TYPE>
+template<typename DataType = DAAL_DATA_TYPE, typename IndexType = size_t>
 class DAAL_EXPORT CSRBlockDescriptor
 {
 public:
@@ -75,7 +77,7 @@ public:
     CSRBlockDescriptor();
 
     /** \private */
-    ~CSRBlockDescriptor() { freeValuesBuffer(); freeRowsBuffer(); }
+    ~CSRBlockDescriptor() { freeValuesBuffer(); freeRowsBuffer(); freeColumnIndicesBuffer(); }
 
     /**
      *  Gets a pointer to the buffer
@@ -90,7 +92,7 @@ public:
         return _values_ptr.get();
     }
 
-    inline size_t *getBlockColumnIndicesPtr() const { return _cols_ptr.get(); }
+    inline IndexType *getBlockColumnIndicesPtr() const { return _cols_ptr.get(); }
     inline size_t *getBlockRowIndicesPtr() const { return _rows_ptr.get(); }
 
     /**
@@ -106,7 +108,7 @@ public:
         return _values_ptr;
     }
 
-    inline services::SharedPtr<size_t> getBlockColumnIndicesSharedPtr() const { return _cols_ptr; }
+    inline services::SharedPtr<IndexType> getBlockColumnIndicesSharedPtr() const { return _cols_ptr; }
     inline services::SharedPtr<size_t> getBlockRowIndicesSharedPtr() const { return _rows_ptr; }
 
     /**
@@ -136,9 +138,9 @@ public:
         _nvalues    = nValues;
     }
 
-    inline void setColumnIndicesPtr( size_t *ptr, size_t nValues )
+    inline void setColumnIndicesPtr( IndexType *ptr, size_t nValues )
     {
-        _cols_ptr   = services::SharedPtr<size_t>(ptr, services::EmptyDeleter());
+        _cols_ptr   = services::SharedPtr<IndexType>(ptr, services::EmptyDeleter());
         _nvalues    = nValues;
     }
 
@@ -165,7 +167,7 @@ public:
         _nvalues = nValues;
     }
 
-    inline void setColumnIndicesPtr( services::SharedPtr<size_t> ptr, size_t nValues )
+    inline void setColumnIndicesPtr( services::SharedPtr<IndexType> ptr, size_t nValues )
     {
         _cols_ptr   = ptr;
         _nvalues    = nValues;
@@ -245,6 +247,31 @@ public:
         return true;
     }
 
+    /**
+     *  \param[in] nValues  Number of column indices
+     */
+    inline bool resizeColumnIndicesBuffer( size_t nValues )
+    {
+        size_t newSize = nValues * sizeof(IndexType);
+        if ( newSize > _cols_capacity )
+        {
+            freeColumnIndicesBuffer();
+            _cols_buffer = services::SharedPtr<IndexType>((IndexType *)daal::services::daal_malloc(newSize), services::ServiceDeleter()) ;
+            if ( _cols_buffer )
+            {
+                _cols_capacity = newSize;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        _cols_ptr = _cols_buffer;
+
+        return true;
+    }
+
     inline void setDetails( size_t nColumns, size_t rowIdx, int rwFlag )
     {
         _ncols      = nColumns;
@@ -277,9 +304,18 @@ protected:
         _rows_capacity = 0;
     }
 
+    /**
+     *  Frees the column indices buffer
+     */
+    void freeColumnIndicesBuffer()
+    {
+        _cols_buffer = services::SharedPtr<IndexType>();
+        _cols_capacity = 0;
+    }
+
 private:
     services::SharedPtr<DataType> _values_ptr;
-    services::SharedPtr<size_t> _cols_ptr;
+    services::SharedPtr<IndexType> _cols_ptr;
     services::SharedPtr<size_t> _rows_ptr;
     size_t    _nrows;
     size_t    _ncols;
@@ -294,6 +330,9 @@ private:
     services::SharedPtr<size_t> _rows_buffer; /*<! Pointer to the buffer */
     size_t _rows_capacity; /*<! Buffer size in bytes */
 
+    services::SharedPtr<IndexType> _cols_buffer; /*<! Pointer to the buffer */
+    size_t _cols_capacity; /*<! Buffer size in bytes */
+
     services::SharedPtr<byte> *_pPtr;
     byte *_rawPtr;
 };
@@ -501,6 +540,62 @@ public:
         DAAL_DEFAULT_CREATE_IMPL_EX(CSRNumericTable, ptr, colIndices, rowOffsets, nColumns, nRows, indexing);
     }
 
+    /**
+     *  Constructs CSR numeric table that holds a copy of the data of another sparse numeric table,
+     *  for example, CSR32NumericTable or CSCNumericTable
+     *  \tparam   DataType        Type of values in the numeric table
+     *  \param[in]    source      Numeric table that implements CSRNumericTableIface
+     *  \param[out]   stat        Status of the numeric table construction
+     *  \return       CSR numeric table with 1-based indexing
+     */
+    template<typename DataType>
+    static services::SharedPtr<CSRNumericTable> create(const NumericTablePtr &source, services::Status *stat = NULL)
+    {
+        services::Status defaultSt;
+        services::Status &st = (stat ? *stat : defaultSt);
+        services::SharedPtr<CSRNumericTable> result;
+
+        CSRNumericTableIface *csr = dynamic_cast<CSRNumericTableIface *>(source.get());
+        if (!csr)
+        {
+            st.add(services::ErrorIncorrectTypeOfInputNumericTable);
+            return result;
+        }
+
+        const size_t nRows = source->getNumberOfRows();
+        CSRBlockDescriptor<DataType> block;
+        st |= csr->getSparseBlock(0, nRows, readOnly, block);
+        if (!st) { return result; }
+
+        const size_t nValues = block.getDataSize();
+        services::SharedPtr<DataType> values((DataType *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(DataType)), services::ServiceDeleter());
+        services::SharedPtr<size_t> colIndices((size_t *)daal::services::daal_malloc((nValues ? nValues : 1) * sizeof(size_t)), services::ServiceDeleter());
+        services::SharedPtr<size_t> rowOffsets((size_t *)daal::services::daal_malloc((nRows + 1) * sizeof(size_t)), services::ServiceDeleter());
+        if (!values || !colIndices || !rowOffsets)
+        {
+            csr->releaseSparseBlock(block);
+            st.add(services::ErrorMemoryAllocationFailed);
+            return result;
+        }
+
+        const DataType *srcValues = block.getBlockValuesPtr();
+        const size_t *srcCols     = block.getBlockColumnIndicesPtr();
+        const size_t *srcRows     = block.getBlockRowIndicesPtr();
+        for (size_t i = 0; i < nValues; i++)
+        {
+            values.get()[i]     = srcValues[i];
+            colIndices.get()[i] = srcCols[i];
+        }
+        for (size_t i = 0; i < nRows + 1; i++)
+        {
+            rowOffsets.get()[i] = srcRows[i] - srcRows[0] + 1;
+        }
+        st |= csr->releaseSparseBlock(block);
+        if (!st) { return result; }
+
+        return create<DataType>(values, colIndices, rowOffsets, source->getNumberOfColumns(), nRows, oneBased, &st);
+    }
+
     virtual ~CSRNumericTable()
     {
         freeDataMemoryImpl();
@@ -208,6 +208,21 @@ public:
     }
 
 protected:
+    /* Archives written by version 2016.0.0 do not pad the serialized items */
+    inline size_t alignValueUp(size_t value) const
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
     int  _majorVersion;
     int  _minorVersion;
     int  _updateVersion;
@@ -455,20 +470,6 @@ protected:
         blockOffset       [currentWriteBlock] = 0;
     }
 
-    inline size_t alignValueUp(size_t value)
-    {
-        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
-        {
-            return value;
-        }
-
-        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
-
-        size_t alignedValue = value + alignm1;
-        alignedValue &= ~alignm1;
-        return alignedValue;
-    }
-
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -708,6 +709,113 @@ private:
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__READONLYDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface over a buffer owned by the caller.
+ *  The buffer is not copied. Arrays stored in the archive can be accessed in place
+ *  by the borrow() method if the buffer satisfies the alignment of the serialization format
+ */
+class ReadOnlyDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive over a serialized buffer
+     *  \param[in] ptr   Shared pointer to the serialized data. The archive and the arrays borrowed
+     *                   from it keep a reference to the buffer
+     *  \param[in] size  Size of the serialized data in bytes
+     */
+    ReadOnlyDataArchive( const services::SharedPtr<byte> &ptr, size_t size ) :
+        _buffer(ptr), _size(ptr ? size : 0), _readOffset(0), _errors(new services::ErrorCollection())
+    {}
+
+    /** \private */
+    ~ReadOnlyDataArchive() {}
+
+    void write(byte *ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorDataArchiveInternal);
+    }
+
+    void read(byte *ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        if( _size - _readOffset < alignedSize )
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        daal::services::daal_memcpy_s(ptr, size, _buffer.get() + _readOffset, size);
+
+        _readOffset += alignedSize;
+    }
+
+    /**
+     *  Returns the pointer to the next array of the archive and skips the array.
+     *  The returned pointer shares ownership of the archive buffer
+     *  \param[in] size  Size of the array in bytes
+     *  \return Pointer to the array, or empty pointer if the array cannot be used in place.
+     *          In the latter case the read position of the archive is not changed
+     */
+    services::SharedPtr<byte> borrow(size_t size)
+    {
+        /* Items of the archives without padding are not aligned in the buffer */
+        if( size == 0 || alignValueUp(1) == 1 ) { return services::SharedPtr<byte>(); }
+
+        const size_t alignedSize = alignValueUp(size);
+        if( _size - _readOffset < alignedSize ) { return services::SharedPtr<byte>(); }
+
+        byte *ptr = _buffer.get() + _readOffset;
+        if( ((size_t)ptr) & (DAAL_MALLOC_DEFAULT_ALIGNMENT - 1) ) { return services::SharedPtr<byte>(); }
+
+        _readOffset += alignedSize;
+        return services::SharedPtr<byte>(_buffer, _buffer.getStartPtr(), ptr);
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE
+    {
+        return _size;
+    }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        return _buffer;
+    }
+
+    byte *getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        return _buffer.get();
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        return std::string( (char *)_buffer.get(), _size );
+    }
+
+    size_t copyArchiveToArray( byte *ptr, size_t maxLength ) const DAAL_C11_OVERRIDE
+    {
+        if( _size == 0 || _size > maxLength ) { return _size; }
+
+        daal::services::daal_memcpy_s(ptr, maxLength, _buffer.get(), _size);
+        return _size;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    services::SharedPtr<byte> _buffer;
+    size_t _size;
+    size_t _readOffset;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INPUTDATAARCHIVE"></a>
  *  \brief Provides methods to create an archive data object (serialized) and access this object
@@ -865,6 +973,19 @@ public:
         setSingleObj(&ptr);
     }
 
+    /**
+     *  Input data archives do not provide arrays in place. Provided for the serialization methods
+     *  shared between InputDataArchive and OutputDataArchive
+     *  \tparam  T         Basic datatype
+     *  \param[in]   size  Number of elements in the array
+     *  \return Empty pointer
+     */
+    template<typename T>
+    services::SharedPtr<T> getBorrowedArray(size_t size) const
+    {
+        return services::SharedPtr<T>();
+    }
+
     /**
      *  Returns a data archive in the byte format
      *  \return Pointer to the byte buffer with the archive data
@@ -970,7 +1091,7 @@ public:
     /**
      *  Constructor of an output data archive from an input data archive
      */
-    OutputDataArchive( InputDataArchive &arch ) : _errors(new services::ErrorCollection())
+    OutputDataArchive( InputDataArchive &arch ) : _readOnlyArch(NULL), _errors(new services::ErrorCollection())
     {
         _arch = new DataArchive(arch.getDataArchive());
         archiveHeader();
@@ -979,17 +1100,33 @@ public:
     /**
      *  Constructor of an output data archive from a byte array
      */
-    OutputDataArchive( byte *ptr, size_t size ) : _errors(new services::ErrorCollection())
+    OutputDataArchive( byte *ptr, size_t size ) : _readOnlyArch(NULL), _errors(new services::ErrorCollection())
     {
         _arch = new DataArchive(ptr, size);
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive from a byte array that is not copied.
+     *  Numeric tables and tensors deserialized from the archive refer to their data in the array
+     *  instead of allocating memory, if the array is aligned on DAAL_MALLOC_DEFAULT_ALIGNMENT bytes.
+     *  Such objects keep a reference to the array and write to it on modification of their data,
+     *  so a memory-mapped file should be mapped with copy-on-write access
+     *  \param[in] ptr   Shared pointer to the serialized data
+     *  \param[in] size  Size of the serialized data in bytes
+     */
+    OutputDataArchive( const services::SharedPtr<byte> &ptr, size_t size ) : _errors(new services::ErrorCollection())
+    {
+        _readOnlyArch = new ReadOnlyDataArchive(ptr, size);
+        _arch = _readOnlyArch;
+        archiveHeader();
+    }
+
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
     OutputDataArchive( daal::data_management::DecompressorImpl *decompressor, byte *ptr, size_t size ) :
-        _errors(new services::ErrorCollection())
+        _readOnlyArch(NULL), _errors(new services::ErrorCollection())
     {
         _arch = new DecompressedDataArchive(decompressor);
         _arch->write(ptr, size);
@@ -1082,6 +1219,21 @@ public:
         _arch->read( (byte *)ptr, size * sizeof(T) );
     }
 
+    /**
+     *  Returns the next array of values of the basic datatype in place, without copying it.
+     *  Available for the archives constructed over a shared pointer to the serialized data
+     *  \tparam  T         Basic datatype
+     *  \param[in]   size  Number of elements in the array
+     *  \return Pointer to the array in the serialized data, or empty pointer if the array cannot be used in place.
+     *          In the latter case the array must be read by the set() method
+     */
+    template<typename T>
+    services::SharedPtr<T> getBorrowedArray(size_t size) const
+    {
+        if( !_readOnlyArch ) { return services::SharedPtr<T>(); }
+        return services::reinterpretPointerCast<T, byte>(_readOnlyArch->borrow(size * sizeof(T)));
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1204,6 +1356,7 @@ public:
 
 protected:
     DataArchiveIface *_arch;
+    ReadOnlyDataArchive *_readOnlyArch;
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 /** @} */
@@ -1213,6 +1366,7 @@ using interface1::DataArchiveIface;
 using interface1::DataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
+using interface1::ReadOnlyDataArchive;
 using interface1::InputDataArchive;
 using interface1::OutputDataArchive;
 
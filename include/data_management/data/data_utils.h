@@ -100,6 +100,7 @@ template<> inline IndexNumType getIndexNumType<unsigned int>()     { return DAAL
 template<> inline IndexNumType getIndexNumType<DAAL_INT64>()       { return DAAL_INT64_S; }
 template<> inline IndexNumType getIndexNumType<DAAL_UINT64>()      { return DAAL_INT64_U; }
 template<> inline IndexNumType getIndexNumType<char>()             { return DAAL_INT8_S;  }
+template<> inline IndexNumType getIndexNumType<signed char>()      { return DAAL_INT8_S;  }
 template<> inline IndexNumType getIndexNumType<unsigned char>()    { return DAAL_INT8_U;  }
 template<> inline IndexNumType getIndexNumType<short>()            { return DAAL_INT16_S; }
 template<> inline IndexNumType getIndexNumType<unsigned short>()   { return DAAL_INT16_U; }
@@ -190,6 +191,25 @@ DAAL_EXPORT data_feature_utils::vectorConvertFuncType getVectorDownCast(int, int
 DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideUpCast(int, int);
 DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideDownCast(int, int);
 
+/**
+ * Converts a block of nRows x nCols values between the columns of structure-of-arrays storage
+ * (starting at row rowOffset) and the rows of a row-major block with the row stride rowStride
+ */
+typedef void(*vectorTransposeConvertFuncType)(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride);
+
+/**
+ * Converts a block of nRows x nCols values between the fields of array-of-structures storage
+ * (records of recordSize bytes, fields at byte offsets) and the rows of a row-major block with the row stride rowStride
+ */
+typedef void(*vectorRecordConvertFuncType)(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                           void *rows, size_t rowStride);
+
+DAAL_EXPORT data_feature_utils::vectorTransposeConvertFuncType getVectorTransposeUpCast(int, int);
+DAAL_EXPORT data_feature_utils::vectorTransposeConvertFuncType getVectorTransposeDownCast(int, int);
+
+DAAL_EXPORT data_feature_utils::vectorRecordConvertFuncType getVectorRecordUpCast(int, int);
+DAAL_EXPORT data_feature_utils::vectorRecordConvertFuncType getVectorRecordDownCast(int, int);
+
 /** @} */
 
 } // namespace data_feature_utils
@@ -887,13 +887,21 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>( archive );
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if( onDeserialize )
         {
+            services::SharedPtr<DataType> borrowedData = archive->template getBorrowedArray<DataType>( size );
+            if( borrowedData )
+            {
+                _ptr = services::reinterpretPointerCast<byte, DataType>(borrowedData);
+                _memStatus = userAllocated;
+                return services::Status();
+            }
+
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
         archive->set( (DataType*)_ptr.get(), size );
 
         return services::Status();
@@ -616,6 +616,14 @@ protected:
 
             if( isAllocated )
             {
+                services::SharedPtr<DataType> borrowedData = archive->template getBorrowedArray<DataType>( getSize() );
+                if( borrowedData )
+                {
+                    _ptr = services::reinterpretPointerCast<byte, DataType>(borrowedData);
+                    _memStatus = userAllocated;
+                    return services::Status();
+                }
+
                 allocateDataMemoryImpl();
             }
         }
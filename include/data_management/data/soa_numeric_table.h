@@ -450,30 +450,25 @@ private:
 
         if( !(block.getRWFlag() & (int)readOnly) ) return services::Status();
 
-        T lbuf[32];
-
-        size_t di = 32;
-
         T *buffer = block.getBlockPtr();
 
-        for( size_t i = 0 ; i < nrows ; i += di )
+        /* Consecutive features of the same type are converted and transposed into the block in one pass */
+        void *columns[32];
+
+        for( size_t j0 = 0 ; j0 < ncols ; )
         {
-            if( i + di > nrows ) { di = nrows - i; }
+            data_feature_utils::IndexNumType indexType = (*_ddict)[j0].indexType;
 
-            for( size_t j = 0 ; j < ncols ; j++ )
+            size_t j1 = j0;
+            for( ; j1 < ncols && j1 - j0 < 32 && (*_ddict)[j1].indexType == indexType ; j1++ )
             {
-                NumericTableFeature &f = (*_ddict)[j];
-
-                char *ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
+                columns[j1 - j0] = _arrays[j1].get();
+            }
 
-                data_feature_utils::getVectorUpCast(f.indexType, data_feature_utils::getInternalNumType<T>())
-                ( di, ptr, lbuf );
+            data_feature_utils::getVectorTransposeUpCast(indexType, data_feature_utils::getInternalNumType<T>())
+            ( nrows, j1 - j0, columns, idx, buffer + j0, ncols );
 
-                for( size_t ii = 0 ; ii < di; ii++ )
-                {
-                    buffer[ (i + ii)*ncols + j ] = lbuf[ii];
-                }
-            }
+            j0 = j1;
         }
         return services::Status();
     }
@@ -486,30 +481,24 @@ private:
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
             size_t idx   = block.getRowsOffset();
-            T lbuf[32];
-
-            size_t di = 32;
-
             T *blockPtr = block.getBlockPtr();
 
-            for( size_t i = 0 ; i < nrows ; i += di )
+            void *columns[32];
+
+            for( size_t j0 = 0 ; j0 < ncols ; )
             {
-                if( i + di > nrows ) { di = nrows - i; }
+                data_feature_utils::IndexNumType indexType = (*_ddict)[j0].indexType;
 
-                for( size_t j = 0 ; j < ncols ; j++ )
+                size_t j1 = j0;
+                for( ; j1 < ncols && j1 - j0 < 32 && (*_ddict)[j1].indexType == indexType ; j1++ )
                 {
-                    NumericTableFeature &f = (*_ddict)[j];
-
-                    char *ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
+                    columns[j1 - j0] = _arrays[j1].get();
+                }
 
-                    for( size_t ii = 0 ; ii < di; ii++ )
-                    {
-                        lbuf[ii] = blockPtr[ (i + ii) * ncols + j ];
-                    }
+                data_feature_utils::getVectorTransposeDownCast(indexType, data_feature_utils::getInternalNumType<T>())
+                ( nrows, j1 - j0, columns, idx, blockPtr + j0, ncols );
 
-                    data_feature_utils::getVectorDownCast(f.indexType, data_feature_utils::getInternalNumType<T>())
-                    ( di, lbuf, ptr );
-                }
+                j0 = j1;
             }
         }
         block.reset();
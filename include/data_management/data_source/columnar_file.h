@@ -0,0 +1,261 @@
+/* file: columnar_file.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the writer and the reader of columnar table files.
+//--
+*/
+
+#ifndef __COLUMNAR_FILE_H__
+#define __COLUMNAR_FILE_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "data_management/compression/compression.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__COLUMNCHUNKSTATISTICS"></a>
+ * \brief Statistics of the values of one column stored in one chunk of a columnar table file
+ */
+/* [ColumnChunkStatistics source code] */
+struct DAAL_EXPORT ColumnChunkStatistics
+{
+    double minimum;     /*!< Minimal value of the column in the chunk */
+    double maximum;     /*!< Maximal value of the column in the chunk */
+    size_t count;       /*!< Number of values of the column in the chunk that are not NaN */
+
+    ColumnChunkStatistics() : minimum(0.0), maximum(0.0), count(0) {}
+};
+/* [ColumnChunkStatistics source code] */
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__COLUMNARFILEWRITER"></a>
+ * \brief %ColumnarFileWriter class writes numeric tables to a file in the columnar table format.
+ *        Rows are grouped into chunks of a fixed number of rows. Each chunk stores a separate block for every column,
+ *        the block is optionally compressed and accompanied by the minimum, maximum and count of the column values in the chunk.
+ *        The index of blocks is written at the end of the file, so that a reader can decode any subset of columns and chunks.
+ *
+ * \par References
+ *      - \ref ColumnarFileReader class
+ *      - \ref ColumnarFileDataSource class
+ */
+class DAAL_EXPORT ColumnarFileWriter : public Base
+{
+public:
+    /**
+     * Constructs the writer that stores column blocks uncompressed
+     * \param[in] fileName  Name of the file to write
+     * \param[in] chunkRows Number of rows in a chunk
+     */
+    ColumnarFileWriter(const char *fileName, size_t chunkRows = 65536);
+
+    /**
+     * Constructs the writer that compresses column blocks
+     * \param[in] fileName  Name of the file to write
+     * \param[in] method    Compression method used to compress column blocks
+     * \param[in] level     Compression level
+     * \param[in] chunkRows Number of rows in a chunk
+     */
+    ColumnarFileWriter(const char *fileName, CompressionMethod method, CompressionLevel level = defaultLevel, size_t chunkRows = 65536);
+
+    /**
+     * Closes the file if it is not closed yet
+     */
+    virtual ~ColumnarFileWriter();
+
+    /**
+     * Appends the rows of a numeric table to the file.
+     * The first table defines the number and the types of columns, all subsequent tables must have the same number of columns
+     * \param[in] table Numeric table to write
+     * \return Status of the operation
+     */
+    services::Status write(NumericTable &table);
+
+    /**
+     * Writes the remaining rows and the index of blocks and closes the file
+     * \return Status of the operation
+     */
+    services::Status close();
+
+    /**
+     * Returns errors happened during the construction or the writing
+     * \return Status of the writer
+     */
+    services::Status status() const { return _status; }
+
+private:
+    ColumnarFileWriter(const ColumnarFileWriter &);
+    ColumnarFileWriter &operator=(const ColumnarFileWriter &);
+
+    void *_impl;
+    services::Status _status;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__COLUMNARFILEREADER"></a>
+ * \brief %ColumnarFileReader class reads files written by ColumnarFileWriter.
+ *        Only the blocks of the requested columns in the chunks overlapping the requested rows are read,
+ *        the blocks are decompressed and converted in parallel.
+ *
+ * \par References
+ *      - \ref ColumnarFileWriter class
+ */
+class DAAL_EXPORT ColumnarFileReader : public Base
+{
+public:
+    /**
+     * Opens the file and reads the index of blocks
+     * \param[in] fileName Name of the file to read
+     */
+    ColumnarFileReader(const char *fileName);
+
+    virtual ~ColumnarFileReader();
+
+    /**
+     * Returns errors happened during the opening of the file
+     * \return Status of the reader
+     */
+    services::Status status() const { return _status; }
+
+    /**
+     * Returns the number of columns stored in the file
+     * \return Number of columns
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns the number of rows stored in the file
+     * \return Number of rows
+     */
+    size_t getNumberOfRows() const;
+
+    /**
+     * Returns the number of chunks stored in the file
+     * \return Number of chunks
+     */
+    size_t getNumberOfChunks() const;
+
+    /**
+     * Returns the index of the first row of the chunk
+     * \param[in] chunk Index of the chunk
+     * \return Index of the first row
+     */
+    size_t getChunkFirstRow(size_t chunk) const;
+
+    /**
+     * Returns the number of rows in the chunk
+     * \param[in] chunk Index of the chunk
+     * \return Number of rows
+     */
+    size_t getChunkNumberOfRows(size_t chunk) const;
+
+    /**
+     * Returns the statistics of the column in the chunk, no data is decompressed
+     * \param[in] chunk  Index of the chunk
+     * \param[in] column Index of the column
+     * \return Statistics of the column values in the chunk
+     */
+    ColumnChunkStatistics getChunkStatistics(size_t chunk, size_t column) const;
+
+    /**
+     * Returns the type the column values are stored with
+     * \param[in] column Index of the column
+     * \return Type of the column values
+     */
+    data_feature_utils::IndexNumType getColumnType(size_t column) const;
+
+    /**
+     * Returns the feature type of the column
+     * \param[in] column Index of the column
+     * \return Feature type of the column
+     */
+    data_feature_utils::FeatureType getColumnFeatureType(size_t column) const;
+
+    /**
+     * Reads the range of rows of the selected columns into a row-major array
+     * \param[in]  firstRow Index of the first row to read
+     * \param[in]  nRows    Number of rows to read
+     * \param[in]  columns  Indices of the columns to read
+     * \param[in]  nColumns Number of columns to read
+     * \param[out] data     Array of nRows x nColumns values
+     * \return Status of the operation
+     */
+    services::Status readColumns(size_t firstRow, size_t nRows, const size_t *columns, size_t nColumns, float *data);
+
+    /**
+     * Reads the range of rows of the selected columns into a row-major array
+     * \param[in]  firstRow Index of the first row to read
+     * \param[in]  nRows    Number of rows to read
+     * \param[in]  columns  Indices of the columns to read
+     * \param[in]  nColumns Number of columns to read
+     * \param[out] data     Array of nRows x nColumns values
+     * \return Status of the operation
+     */
+    services::Status readColumns(size_t firstRow, size_t nRows, const size_t *columns, size_t nColumns, double *data);
+
+private:
+    ColumnarFileReader(const ColumnarFileReader &);
+    ColumnarFileReader &operator=(const ColumnarFileReader &);
+
+    void *_impl;
+    services::Status _status;
+};
+} // namespace interface1
+using interface1::ColumnChunkStatistics;
+using interface1::ColumnarFileWriter;
+using interface1::ColumnarFileReader;
+/** @} */
+
+} // namespace data_management
+} // namespace daal
+#endif
@@ -0,0 +1,463 @@
+/* file: columnar_file_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the columnar file data source class.
+//--
+*/
+
+#ifndef __COLUMNAR_FILE_DATA_SOURCE_H__
+#define __COLUMNAR_FILE_DATA_SOURCE_H__
+
+#include <string>
+
+#include "data_management/data_source/data_source.h"
+#include "data_management/data_source/csv_feature_manager.h"
+#include "data_management/data_source/columnar_file.h"
+#include "data_management/data/data_dictionary.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COLUMNARFEATUREMANAGER"></a>
+ *  \brief Methods of the class to select columns of a columnar table file loaded into a numeric table.
+ *         Columns are selected with \ref ColumnFilter modifiers, the same way as for CSV files
+ */
+class ColumnarFeatureManager
+{
+public:
+    ColumnarFeatureManager() {}
+
+    virtual ~ColumnarFeatureManager() {}
+
+    /**
+     *  Initializes the list of columns from the dictionary and applies all added modifiers to it
+     *  \param[in] dict Data source dictionary
+     */
+    void setFeatureDetailsFromDictionary(DataSourceDictionary *dict)
+    {
+        const size_t nCols = dict->getNumberOfFeatures();
+        funcList.clear();
+        auxVect.clear();
+        funcList.resize(nCols);
+        auxVect.resize(nCols);
+
+        for(size_t i = 0; i < nCols; i++)
+        {
+            funcList.push_back( ModifierIface::contFunc );
+            auxVect.push_back( FeatureAuxData() );
+            auxVect[i].idx = i;
+        }
+
+        for(size_t i = 0; i < filters.size(); i++)
+        {
+            filters[i].apply( funcList, auxVect );
+        }
+    }
+
+    /**
+     *  Adds the column filter. Columns filtered out are not read from the file
+     *  \param[in] modifier Column filter
+     */
+    void addModifier( const ColumnFilter &modifier )
+    {
+        filters.push_back( modifier );
+        modifier.apply( funcList, auxVect );
+    }
+
+    /**
+     *  Returns the number of columns in a numeric table loaded from the file
+     *  \return Number of selected columns
+     */
+    size_t getNumericTableNumberOfColumns() const
+    {
+        size_t nNTCols = 0;
+        for(size_t i = 0; i < auxVect.size(); i++)
+        {
+            nNTCols += (auxVect[i].wide ? 1 : 0);
+        }
+        return nNTCols;
+    }
+
+    /**
+     *  Returns the indices of columns of the file that are loaded into a numeric table
+     *  \return Indices of selected columns
+     */
+    services::Collection<size_t> getSelectedColumns() const
+    {
+        services::Collection<size_t> columns;
+        for(size_t i = 0; i < auxVect.size(); i++)
+        {
+            if(auxVect[i].wide) { columns.push_back(i); }
+        }
+        return columns;
+    }
+
+protected:
+    services::Collection<functionT>      funcList;
+    services::Collection<FeatureAuxData> auxVect;
+    services::Collection<ColumnFilter>   filters;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COLUMNARFILEDATASOURCE"></a>
+ *  \brief Specifies methods to access data stored in columnar table files written by \ref ColumnarFileWriter.
+ *         Only the selected columns of the chunks overlapping the loaded rows are read and decoded, in parallel
+ */
+template< typename _summaryStatisticsType = DAAL_SUMMARY_STATISTICS_TYPE >
+class ColumnarFileDataSource : public DataSourceTemplate<data_management::HomogenNumericTable<DAAL_DATA_TYPE>, _summaryStatisticsType>
+{
+public:
+    using DataSource::checkDictionary;
+    using DataSource::checkNumericTable;
+    using DataSource::freeNumericTable;
+    using DataSource::_dict;
+    using DataSource::_initialMaxRows;
+
+    /**
+     *  Typedef that stores the feature manager datatype
+     */
+    typedef ColumnarFeatureManager FeatureManager;
+
+protected:
+    typedef data_management::HomogenNumericTable<DAAL_DATA_TYPE> DefaultNumericTableType;
+
+    FeatureManager featureManager;
+
+public:
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  fileName                        Name of the columnar table file
+     *  \param[in]  doAllocateNumericTable          Flag that specifies whether a Numeric Table
+     *                                              associated with a Data Source is allocated inside the Data Source
+     *  \param[in]  doCreateDictionaryFromContext   Flag that specifies whether a Data %Dictionary
+     *                                              is created from the column descriptions stored in the file
+     *  \param[in]  initialMaxRows                  Initial value of maximum number of rows in Numeric Table allocated in loadDataBlock() method
+     */
+    ColumnarFileDataSource( const std::string &fileName,
+                            DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                            DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
+                            size_t initialMaxRows = 10 ) :
+        DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>(doAllocateNumericTable, doCreateDictionaryFromContext),
+        _reader(fileName.c_str()), _nextRow(0)
+    {
+        _initialMaxRows = initialMaxRows;
+        if(!_reader.status())
+            this->_status.add(services::throwIfPossible(_reader.status()));
+    }
+
+    ~ColumnarFileDataSource()
+    {
+        DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::freeNumericTable();
+    }
+
+    /**
+     *  Returns a feature manager associated with a Data Source
+     *  \return Feature manager associated with the Data Source
+     */
+    FeatureManager &getFeatureManager()
+    {
+        return featureManager;
+    }
+
+    /**
+     *  Returns the reader of the file that provides the chunk statistics
+     *  \return Reader of the columnar table file
+     */
+    ColumnarFileReader &getReader()
+    {
+        return _reader;
+    }
+
+    /**
+     *  Sets the index of the row the next loadDataBlock() call starts reading from
+     *  \param[in] row Index of the row in the file
+     *  \return Status of the operation
+     */
+    services::Status seekRow(size_t row)
+    {
+        if(row > _reader.getNumberOfRows())
+            return services::throwIfPossible(services::Status(services::ErrorIncorrectDataRange));
+        _nextRow = row;
+        return services::Status();
+    }
+
+public:
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE
+    {
+        return featureManager.getNumericTableNumberOfColumns();
+    }
+
+    services::Status setDictionary(DataSourceDictionary *dict) DAAL_C11_OVERRIDE
+    {
+        if(dict && dict->getNumberOfFeatures() != _reader.getNumberOfColumns())
+            return services::throwIfPossible(services::Status(services::ErrorIncorrectNumberOfFeatures));
+
+        services::Status s = DataSource::setDictionary(dict);
+        if(s)
+            featureManager.setFeatureDetailsFromDictionary(dict);
+        return s;
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if(_dict)
+            return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+        if(!_reader.status())
+            return services::throwIfPossible(_reader.status());
+
+        services::Status s;
+        _dict = DataSourceDictionary::create(&s);
+        if(!s) return s;
+
+        const size_t nCols = _reader.getNumberOfColumns();
+        _dict->setNumberOfFeatures(nCols);
+        for(size_t i = 0; i < nCols; i++)
+        {
+            DataSourceFeature feat;
+            switch(_reader.getColumnType(i))
+            {
+            case data_feature_utils::DAAL_FLOAT32: feat.setType<float>();  break;
+            case data_feature_utils::DAAL_INT32_S: feat.setType<int>();    break;
+            default:                               feat.setType<double>(); break;
+            }
+            feat.ntFeature.featureType = _reader.getColumnFeatureType(i);
+            _dict->setFeature(feat, i);
+        }
+
+        featureManager.setFeatureDetailsFromDictionary(_dict.get());
+        return services::Status();
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        if(!_reader.status())
+            return DataSourceIface::notReady;
+        return (_nextRow < _reader.getNumberOfRows() ? DataSourceIface::readyForLoad : DataSourceIface::endOfData);
+    }
+
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        return _reader.getNumberOfRows() - _nextRow;
+    }
+
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        const size_t nRows = getNumberOfAvailableRows();
+        return loadDataBlock(nRows, 0, nRows, nt);
+    }
+
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        size_t nLines = loadDataBlock(maxRows, 0, maxRows, nt);
+        nt->resize( nLines );
+        return nLines;
+    }
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkDictionary();
+        if(s)
+            s = checkInputNumericTable(nt);
+        if(s && !_reader.status())
+            s = _reader.status();
+        if(s && rowOffset + maxRows > fullRows)
+            s = services::Status(services::ErrorIncorrectDataRange);
+        if(s)
+            s = resetNumericTable(nt, fullRows);
+        if(!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        const size_t nRows = (maxRows < getNumberOfAvailableRows() ? maxRows : getNumberOfAvailableRows());
+        if(nRows == 0)
+            return rowOffset;
+
+        const services::Collection<size_t> columns = featureManager.getSelectedColumns();
+        const size_t nCols = columns.size();
+        if(nCols)
+        {
+            BlockDescriptor<DAAL_DATA_TYPE> block;
+            nt->getBlockOfRows( rowOffset, nRows, writeOnly, block );
+            s = _reader.readColumns( _nextRow, nRows, &columns[0], nCols, block.getBlockPtr() );
+            nt->releaseBlockOfRows( block );
+            if(s)
+                s = computeStatistics( nt, rowOffset, nRows );
+            if(!s)
+            {
+                this->_status.add(services::throwIfPossible(s));
+                return 0;
+            }
+        }
+
+        _nextRow += nRows;
+        return rowOffset + nRows;
+    }
+
+    size_t loadDataBlock() DAAL_C11_OVERRIDE
+    {
+        return DataSource::loadDataBlock();
+    }
+
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
+    {
+        return DataSource::loadDataBlock(maxRows);
+    }
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows) DAAL_C11_OVERRIDE
+    {
+        return DataSource::loadDataBlock(maxRows, rowOffset, fullRows);
+    }
+
+protected:
+    virtual services::Status resetNumericTable(NumericTable *nt, const size_t newSize)
+    {
+        const services::Collection<size_t> columns = featureManager.getSelectedColumns();
+        const size_t nFeatures = columns.size();
+
+        NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+        ntDict->setNumberOfFeatures(nFeatures);
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            ntDict->setFeature<DAAL_DATA_TYPE>(i);
+            (*ntDict)[i].featureType = (*_dict)[columns[i]].ntFeature.featureType;
+        }
+
+        services::Status s = DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::resizeNumericTableImpl(newSize, nt);
+        if(!s)
+            return s;
+
+        nt->setNormalizationFlag(NumericTable::nonNormalized);
+        return services::Status();
+    }
+
+    virtual services::Status checkInputNumericTable(const NumericTable* const nt) const
+    {
+        if(!nt)
+            return services::Status(services::ErrorNullInputNumericTable);
+
+        if (nt->getDataLayout() == NumericTable::csrArray)
+            return services::Status(services::ErrorIncorrectTypeOfInputNumericTable);
+
+        return services::Status();
+    }
+
+    /**
+     *  Computes the basic statistics of the rows loaded into the numeric table
+     */
+    services::Status computeStatistics(NumericTable *nt, size_t rowOffset, size_t nRows)
+    {
+        const size_t nCols = nt->getNumberOfColumns();
+
+        BlockDescriptor<_summaryStatisticsType> blockMin, blockMax, blockSum, blockSumSq, block;
+        nt->basicStatistics.get(NumericTable::minimum   )->getBlockOfRows(0, 1, writeOnly, blockMin);
+        nt->basicStatistics.get(NumericTable::maximum   )->getBlockOfRows(0, 1, writeOnly, blockMax);
+        nt->basicStatistics.get(NumericTable::sum       )->getBlockOfRows(0, 1, writeOnly, blockSum);
+        nt->basicStatistics.get(NumericTable::sumSquares)->getBlockOfRows(0, 1, writeOnly, blockSumSq);
+        nt->getBlockOfRows(rowOffset, nRows, readOnly, block);
+
+        _summaryStatisticsType *minimum    = blockMin.getBlockPtr();
+        _summaryStatisticsType *maximum    = blockMax.getBlockPtr();
+        _summaryStatisticsType *sum        = blockSum.getBlockPtr();
+        _summaryStatisticsType *sumSquares = blockSumSq.getBlockPtr();
+        const _summaryStatisticsType *rows = block.getBlockPtr();
+
+        services::Status s;
+        if( minimum && maximum && sum && sumSquares && rows )
+        {
+            for( size_t j = 0; j < nCols; j++ )
+            {
+                minimum[j]    = rows[j];
+                maximum[j]    = rows[j];
+                sum[j]        = 0;
+                sumSquares[j] = 0;
+            }
+            for( size_t i = 0; i < nRows; i++ )
+            {
+                const _summaryStatisticsType *row = rows + i * nCols;
+                for( size_t j = 0; j < nCols; j++ )
+                {
+                    if( minimum[j] > row[j] ) { minimum[j] = row[j]; }
+                    if( maximum[j] < row[j] ) { maximum[j] = row[j]; }
+                    sum[j]        += row[j];
+                    sumSquares[j] += row[j] * row[j];
+                }
+            }
+        }
+        else
+        {
+            s = services::Status(services::ErrorIncorrectInputNumericTable);
+        }
+
+        nt->releaseBlockOfRows(block);
+        nt->basicStatistics.get(NumericTable::minimum   )->releaseBlockOfRows(blockMin);
+        nt->basicStatistics.get(NumericTable::maximum   )->releaseBlockOfRows(blockMax);
+        nt->basicStatistics.get(NumericTable::sum       )->releaseBlockOfRows(blockSum);
+        nt->basicStatistics.get(NumericTable::sumSquares)->releaseBlockOfRows(blockSumSq);
+        return s;
+    }
+
+protected:
+    ColumnarFileReader _reader;
+    size_t _nextRow;
+};
+/** @} */
+} // namespace interface1
+using interface1::ColumnarFeatureManager;
+using interface1::ColumnarFileDataSource;
+
+}
+}
+#endif
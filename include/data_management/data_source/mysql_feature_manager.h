@@ -62,6 +62,11 @@
 #include <sqltypes.h>
 #include <sqlext.h>
 
+#if (defined(__INTEL_CXX11_MODE__) || __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER >= 1800))
+#define __DAAL_ODBC_PREFETCH
+#include <thread>
+#endif
+
 using namespace std;
 
 namespace daal
@@ -82,7 +87,36 @@ namespace interface1
 class MySQLFeatureManager
 {
 public:
-    MySQLFeatureManager() : _errors(new services::ErrorCollection()) {}
+    MySQLFeatureManager() : _errors(new services::ErrorCollection()), _fetchArraySize(1024), _prefetch(true) {}
+
+    /**
+     *  Sets the number of rows fetched from the driver with one call
+     *  \param[in] fetchArraySize  Number of rows in the array of bound column buffers
+     */
+    void setFetchArraySize(size_t fetchArraySize)
+    {
+        _fetchArraySize = (fetchArraySize > 0 ? fetchArraySize : 1);
+    }
+
+    /**
+     *  Returns the number of rows fetched from the driver with one call
+     *  \return Number of rows in the array of bound column buffers
+     */
+    size_t getFetchArraySize() const
+    {
+        return _fetchArraySize;
+    }
+
+    /**
+     *  Enables or disables fetching of the next array of rows in a background thread
+     *  while the current array is converted into the Numeric Table.
+     *  Prefetching requires C++11 support and is ignored otherwise
+     *  \param[in] prefetch  Flag that specifies whether the next array of rows is prefetched
+     */
+    void setPrefetch(bool prefetch)
+    {
+        _prefetch = prefetch;
+    }
 
     /**
      *  Executes an SQL statement from an ODBC statement handle and writes it to a Numeric Table
@@ -189,6 +223,21 @@ public:
 
 private:
     services::SharedPtr<services::ErrorCollection> _errors;
+    size_t _fetchArraySize;
+    bool   _prefetch;
+
+    /* Column-wise buffers for one array of fetched rows */
+    struct FetchBuffer
+    {
+        DAAL_DATA_TYPE *values;     /* nFeatures arrays of fetchArraySize values */
+        SQLLEN         *indicators; /* nFeatures arrays of fetchArraySize length/indicator values */
+        size_t          arraySize;  /* Number of rows in the array */
+        SQLULEN         nFetched;   /* Number of rows fetched into the buffers */
+        SQLRETURN       ret;        /* Return code of the fetch */
+    };
+
+    void fetchArray(SQLHSTMT hdlStmt, FetchBuffer &buffer, size_t nFeatures, SQLSMALLINT targetType);
+    void copyArray(const FetchBuffer &buffer, size_t nRows, size_t nFeatures, const bool *isNumeric, DAAL_DATA_TYPE *ntBuffer);
 
     size_t      getStrictureSize(NumericTableDictionary *dict);
     size_t      typeSize(data_feature_utils::IndexNumType indexNumType);
@@ -232,47 +281,88 @@ DataSourceIface::DataSourceStatus MySQLFeatureManager::statementResultsNumericTa
     nt->resize(maxRows);
     NumericTableDictionaryPtr dict = nt->getDictionarySharedPtr();
     data_feature_utils::IndexNumType indexNumType = data_feature_utils::getIndexNumType<DAAL_DATA_TYPE>();
+    SQLSMALLINT targetType = getTargetType(indexNumType);
 
-    SQLLEN *bindInd             = (SQLLEN *)daal::services::daal_malloc(sizeof(SQLLEN) * nFeatures);
-    DAAL_DATA_TYPE *fetchBuffer = (DAAL_DATA_TYPE *)daal::services::daal_malloc(sizeof(DAAL_DATA_TYPE) * nFeatures);
-    for (int j = 0; j < nFeatures; j++)
+    /* The rows are fetched by arrays into column-wise buffers. Two sets of buffers are used,
+       so the next array can be fetched while the current one is copied into the Numeric Table */
+    size_t arraySize = (_fetchArraySize < maxRows ? _fetchArraySize : maxRows);
+    if (arraySize == 0) { arraySize = 1; }
+
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+    if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
+
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)(SQLULEN)arraySize, 0);
+    if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
+
+    const size_t nBuffers = 2;
+    const size_t bufferSize = arraySize * nFeatures;
+    DAAL_DATA_TYPE *values = (DAAL_DATA_TYPE *)daal::services::daal_malloc(sizeof(DAAL_DATA_TYPE) * bufferSize * nBuffers);
+    SQLLEN *indicators     = (SQLLEN *)daal::services::daal_malloc(sizeof(SQLLEN) * bufferSize * nBuffers);
+    bool *isNumeric        = (bool *)daal::services::daal_malloc(sizeof(bool) * (nFeatures > 0 ? nFeatures : 1));
+    if (!values || !indicators || !isNumeric)
     {
-        if (indexNumType != data_feature_utils::DAAL_OTHER_T)
-        {
-            ret = SQLBindCol(hdlStmt, j + 1, getTargetType(indexNumType), (SQLPOINTER)&fetchBuffer[j], 0, &bindInd[j]);
-            if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
-        }
-        else
-        {
-            bindInd[j] = 0;
-        }
+        daal::services::daal_free(values);
+        daal::services::daal_free(indicators);
+        daal::services::daal_free(isNumeric);
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        return DataSource::notReady;
+    }
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        isNumeric[j] = ((*dict)[j].indexType != data_feature_utils::DAAL_OTHER_T);
     }
+
+    FetchBuffer buffers[nBuffers];
+    for (size_t k = 0; k < nBuffers; k++)
+    {
+        buffers[k].values     = values + k * bufferSize;
+        buffers[k].indicators = indicators + k * bufferSize;
+        buffers[k].arraySize  = arraySize;
+        buffers[k].nFetched   = 0;
+        buffers[k].ret        = SQL_NO_DATA;
+    }
+
     size_t read = 0;
 
     BlockDescriptor<DAAL_DATA_TYPE> block;
     nt->getBlockOfRows(0, maxRows, writeOnly, block);
     DAAL_DATA_TYPE *ntBuffer = block.getBlockPtr();
 
-    while (SQL_SUCCEEDED(ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 1)))
+    size_t current = 0;
+    fetchArray(hdlStmt, buffers[current], nFeatures, targetType);
+    ret = buffers[current].ret;
+
+    while (SQL_SUCCEEDED(ret))
     {
-        for (int j = 0; j < nFeatures; j++)
+        FetchBuffer &buffer = buffers[current];
+        FetchBuffer &nextBuffer = buffers[1 - current];
+        size_t nRows = (size_t)buffer.nFetched;
+        if (nRows > maxRows - read) { nRows = maxRows - read; }
+
+        /* A partially filled array or a full Numeric Table means the end of the result set */
+        bool hasNext = (buffer.nFetched == buffer.arraySize && read + nRows < maxRows);
+        nextBuffer.ret = SQL_NO_DATA;
+
+#ifdef __DAAL_ODBC_PREFETCH
+        if (hasNext && _prefetch)
         {
-            if (bindInd[j] == SQL_NULL_DATA)
-            {
-                ntBuffer[read * nFeatures + j] = 0.0;
-                continue;
-            }
-            indexNumType = (*dict)[j].indexType;
-            if (indexNumType != data_feature_utils::DAAL_OTHER_T)
-            {
-                ntBuffer[read * nFeatures + j] = *((DAAL_DATA_TYPE *) & (fetchBuffer[j]));
-            }
-            else
+            std::thread prefetchThread(&MySQLFeatureManager::fetchArray, this, hdlStmt, std::ref(nextBuffer), nFeatures, targetType);
+            copyArray(buffer, nRows, nFeatures, isNumeric, ntBuffer + read * nFeatures);
+            prefetchThread.join();
+        }
+        else
+#endif
+        {
+            copyArray(buffer, nRows, nFeatures, isNumeric, ntBuffer + read * nFeatures);
+            if (hasNext)
             {
-                ntBuffer[read * nFeatures + j] = 0.0;
+                fetchArray(hdlStmt, nextBuffer, nFeatures, targetType);
             }
         }
-        read++;
+        read += nRows;
+        current = 1 - current;
+        ret = buffers[current].ret;
     }
     nt->resize(read);
     nt->releaseBlockOfRows(block);
@@ -293,11 +383,43 @@ DataSourceIface::DataSourceStatus MySQLFeatureManager::statementResultsNumericTa
             status = DataSourceIface::endOfData;
         }
     }
-    daal::services::daal_free(fetchBuffer);
-    daal::services::daal_free(bindInd);
+    daal::services::daal_free(values);
+    daal::services::daal_free(indicators);
+    daal::services::daal_free(isNumeric);
     return status;
 }
 
+void MySQLFeatureManager::fetchArray(SQLHSTMT hdlStmt, FetchBuffer &buffer, size_t nFeatures, SQLSMALLINT targetType)
+{
+    buffer.nFetched = 0;
+    SQLRETURN ret;
+
+    /* Columns are bound to the buffers of the array before each fetch as the two sets of buffers alternate */
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(j + 1), targetType, (SQLPOINTER)(buffer.values + j * buffer.arraySize),
+                         sizeof(DAAL_DATA_TYPE), buffer.indicators + j * buffer.arraySize);
+        if (!SQL_SUCCEEDED(ret)) { buffer.ret = ret; return; }
+    }
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)&buffer.nFetched, 0);
+    if (!SQL_SUCCEEDED(ret)) { buffer.ret = ret; return; }
+
+    buffer.ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 0);
+}
+
+void MySQLFeatureManager::copyArray(const FetchBuffer &buffer, size_t nRows, size_t nFeatures, const bool *isNumeric, DAAL_DATA_TYPE *ntBuffer)
+{
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const DAAL_DATA_TYPE *columnValues = buffer.values + j * buffer.arraySize;
+        const SQLLEN *columnIndicators     = buffer.indicators + j * buffer.arraySize;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            ntBuffer[i * nFeatures + j] = ((isNumeric[j] && columnIndicators[i] != SQL_NULL_DATA) ? columnValues[i] : (DAAL_DATA_TYPE)0.0);
+        }
+    }
+}
+
 size_t MySQLFeatureManager::getStrictureSize(NumericTableDictionary *dict)
 {
     size_t structureSize = 0;
@@ -68,6 +68,9 @@
   #define DAAL_C11_OVERRIDE
 #endif
 
+/* Intel(R) DAAL 8-bit signed integer type */
+#define DAAL_INT8 signed char
+
 /* Intel(R) DAAL 64-bit integer types */
 #if (!defined(__INTEL_COMPILER)) & defined(_MSC_VER)
   #define DAAL_INT64 __int64
@@ -187,6 +190,8 @@ const int SERIALIZATION_DATADICTIONARY_NT_ID
 const int SERIALIZATION_DATADICTIONARY_DS_ID                                                   = 6010;
 const int SERIALIZATION_MATRIX_NT_ID                                                           = 7000;
 const int SERIALIZATION_CSR_NT_ID                                                              = 8000;
+const int SERIALIZATION_CSR32_NT_ID                                                            = 8010;
+const int SERIALIZATION_CSC_NT_ID                                                              = 8020;
 const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID                                                  = 11000;
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID                                                 = 12000;
 const int SERIALIZATION_MERGE_NT_ID                                                            = 13000;
@@ -206,12 +211,14 @@ const int SERIALIZATION_LINEAR_REGRESSION_TRAINING_RESULT_ID
 const int SERIALIZATION_LINEAR_REGRESSION_PREDICTION_RESULT_ID                                 = 100140;
 const int SERIALIZATION_LINEAR_REGRESSION_SINGLE_BETA_RESULT_ID                                = 100150;
 const int SERIALIZATION_LINEAR_REGRESSION_GROUP_OF_BETAS_RESULT_ID                             = 100160;
+const int SERIALIZATION_LINEAR_REGRESSION_MODELELASTICNET_ID                                   = 100170;
 
 const int SERIALIZATION_PCA_RESULT_ID                                                          = 100200;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_CORRELATION_ID                                      = 100210;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_SVD_ID                                              = 100220;
 const int SERIALIZATION_PCA_TRANSFORM_RESULT_ID                                                = 100230;
 const int SERIALIZATION_PCA_QUALITY_METRIC_RESULT_ID                                           = 100240;
+const int SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_ID                                       = 100250;
 
 const int SERIALIZATION_STUMP_MODEL_ID                                                         = 100300;
 const int SERIALIZATION_STUMP_TRAINING_RESULT_ID                                               = 100310;
@@ -257,6 +264,8 @@ const int SERIALIZATION_CLASSIFIER_TRAINING_RESULT_ID
 
 const int SERIALIZATION_MOMENTS_PARTIAL_RESULT_ID                                              = 101500;
 const int SERIALIZATION_MOMENTS_RESULT_ID                                                      = 101510;
+const int SERIALIZATION_DESCRIPTIVE_STATISTICS_PARTIAL_RESULT_ID                               = 101520;
+const int SERIALIZATION_DESCRIPTIVE_STATISTICS_RESULT_ID                                       = 101530;
 
 const int SERIALIZATION_IMPLICIT_ALS_MODEL_ID                                                  = 101600;
 const int SERIALIZATION_IMPLICIT_ALS_PARTIALMODEL_ID                                           = 101610;
@@ -278,15 +287,20 @@ const int SERIALIZATION_CHOLESKY_RESULT_ID
 
 const int SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID                                         = 101900;
 const int SERIALIZATION_COSINE_DISTANCE_RESULT_ID                                              = 101910;
+const int SERIALIZATION_EUCLIDEAN_DISTANCE_RESULT_ID                                           = 101920;
 
 const int SERIALIZATION_EM_GMM_INIT_RESULT_ID                                                  = 102000;
 const int SERIALIZATION_EM_GMM_RESULT_ID                                                       = 102010;
+const int SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID                                               = 102020;
+const int SERIALIZATION_EM_GMM_PREDICTION_RESULT_ID                                            = 102030;
 
 const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID                                              = 102100;
 
 const int SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID                               = 102200;
 const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID                                 = 102210;
 const int SERIALIZATION_OUTLIER_DETECTION_BACON_RESULT_ID                                      = 102220;
+const int SERIALIZATION_OUTLIER_DETECTION_BACON_PARTIAL_RESULT_ID                              = 102230;
+const int SERIALIZATION_OUTLIER_DETECTION_BACON_DISTRIBUTED_RESULT_ID                          = 102240;
 
 const int SERIALIZATION_PIVOTED_QR_RESULT_ID                                                   = 102300;
 
@@ -400,6 +414,10 @@ const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_RESHAPE_BACKWARD_RESULT_ID
 const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_RESHAPE_FORWARD_RESULT_ID                       = 104750;
 const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_ELTWISE_SUM_FORWARD_RESULT_ID                   = 104760;
 const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_ELTWISE_SUM_BACKWARD_RESULT_ID                  = 104770;
+const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_LSTM_FORWARD_RESULT_ID                          = 104780;
+const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_LSTM_BACKWARD_RESULT_ID                         = 104790;
+const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_GRU_FORWARD_RESULT_ID                           = 104800;
+const int SERIALIZATION_NEURAL_NETWORKS_LAYERS_GRU_BACKWARD_RESULT_ID                          = 104810;
 
 const int SERIALIZATION_RIDGE_REGRESSION_MODELNORMEQ_ID                                        = 105000;
 const int SERIALIZATION_RIDGE_REGRESSION_PARTIAL_RESULT_ID                                     = 105010;
@@ -433,6 +451,10 @@ const int SERIALIZATION_REGRESSION_PREDICTION_RESULT_ID
 
 const int SERIALIZATION_LM_TRAINING_RESULT_ID                                                  = 109100;
 const int SERIALIZATION_LM_PREDICTION_RESULT_ID                                                = 109120;
+
+const int SERIALIZATION_LOGISTIC_REGRESSION_MODEL_ID                                           = 109200;
+const int SERIALIZATION_LOGISTIC_REGRESSION_TRAINING_RESULT_ID                                 = 109210;
+const int SERIALIZATION_LOGISTIC_REGRESSION_PREDICTION_RESULT_ID                               = 109220;
 };
 
 #define DAAL_NEW_DELETE()                                \
@@ -274,6 +274,8 @@ enum ErrorID
                                                                          *   in cross-product numeric table is not equal */
     ErrorInputCorrelationNotSupportedInOnlineAndDistributed = -7804,    /*!< Input correlation matrix is not supported in online and distributed
                                                                              computation modes */
+    ErrorPCAFailedToComputeRandomizedEigenvalues = -7805,               /*!< Failed to compute eigenvalues of the sketch of the correlation matrix */
+    ErrorInputCorrelationNotSupportedInRandomizedMethod = -7806,        /*!< Input correlation matrix is not supported in the randomized method */
 
     // QR errors: -8000..-8199
     ErrorQRInternal = -8000,                                            /*!< QR internal error */
@@ -333,6 +335,7 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock = -9022,                             /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+    ErrorFramedDataFormat = -9023,                                      /*!< Input framed compressed stream is in wrong format or corrupted */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400,              /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -372,6 +375,7 @@ enum ErrorID
     ErrorInconsistenceModelAndBatchSizeInParameter = -18000,            /*!< Inconsistence of model and batch size parameter in optimization solver */
     ErrorNeuralNetworkLayerCall                    = -18001,            /*!< Error in neural network layer call */
     ErrorSplitLayerBackward = -18002,                                   /*!< Error in split layer backward */
+    ErrorIncorrectQuantizedWeights = -18003,                            /*!< Quantized weights of the layer are not stored as an int8 tensor of the weights size */
 
     // Pivoted QR errors: -19000..-19199
     ErrorPivotedQRInternal = -19000,                                    /*!< Pivoted QR internal error */
@@ -394,6 +398,8 @@ enum ErrorID
     ErrorSQLstmtHandle = -90044,                                        /*!< ErrorSQLstmtHandle */
     ErrorOnFileOpen = -90045,                                           /*!< Error on file open */
     ErrorOnFileRead = -90046,                                           /*!< Error on file read */
+    ErrorOnFileWrite = -90047,                                          /*!< Error on file write */
+    ErrorColumnarFileFormat = -90048,                                   /*!< Columnar table file is in wrong format or corrupted */
 
     ErrorKDBNoConnection = -90051,                                      /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials = -90052,                                  /*!< ErrorKDBWrongCredentials */
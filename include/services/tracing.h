@@ -0,0 +1,128 @@
+/* file: tracing.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that collects execution traces of the algorithms.
+//--
+*/
+
+#ifndef __TRACING_H__
+#define __TRACING_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__TRACING"></a>
+ * \brief Collects the durations of the computation stages of the algorithms and exports them in the Chrome trace event format.
+ *        When tracing is enabled, the library records the setup, compute and reset stages of every compute() call,
+ *        and the stages marked inside the computational kernels. Each event also includes the number of bytes
+ *        allocated by the library on the recording thread during the event.
+ *        Each thread records to its own buffer, and a disabled tracer costs one check for each stage.
+ *        clear() and the export methods can be called while algorithms are running,
+ *        the stages that have not finished yet are not included in the export
+ */
+class DAAL_EXPORT Tracing
+{
+public:
+    /**
+     *  Starts recording of the trace events
+     */
+    static void enable();
+
+    /**
+     *  Stops recording of the trace events. The events recorded before remain available for the export
+     */
+    static void disable();
+
+    /**
+     *  Returns true if the trace events are recorded
+     *  \return Flag that indicates whether the trace events are recorded
+     */
+    static bool isEnabled();
+
+    /**
+     *  Removes all recorded trace events
+     */
+    static void clear();
+
+    /**
+     *  Returns the number of the recorded trace events
+     *  \return Number of the recorded trace events
+     */
+    static size_t getNumberOfEvents();
+
+    /**
+     *  Copies the recorded trace events in the Chrome trace event JSON format to the array
+     *  \param[out] ptr        Pointer to the array
+     *  \param[in]  maxLength  Size of the array in bytes
+     *  \return Size of the trace in bytes including the terminating null character.
+     *          If it exceeds maxLength, nothing is copied
+     */
+    static size_t copyChromeTraceToArray(char *ptr, size_t maxLength);
+
+    /**
+     *  Writes the recorded trace events in the Chrome trace event JSON format to the file
+     *  \param[in]  fileName  Name of the file
+     *  \return Status of the operation
+     */
+    static Status exportChromeTrace(const char *fileName);
+};
+/** @} */
+} // namespace interface1
+using interface1::Tracing;
+
+} // namespace services
+} // namespace daal
+
+#endif
@@ -0,0 +1,126 @@
+/* file: workspace.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the workspace that keeps scratch memory of the algorithms between computations.
+//--
+*/
+
+#ifndef __WORKSPACE_H__
+#define __WORKSPACE_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/daal_shared_ptr.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__WORKSPACE"></a>
+ * \brief Pool of scratch memory shared by the computations of the algorithms it is attached to.
+ *        Temporary buffers of the kernels are taken from the workspace and returned to it when
+ *        the computation completes, so that repeated calls of compute() on small inputs do not allocate
+ *        memory again. Buffers are pooled per thread, so the threads do not contend for them.
+ *        The workspace must outlive the computations that use it
+ */
+class DAAL_EXPORT Workspace : public Base
+{
+public:
+    /**
+     *  Constructs an empty workspace
+     */
+    Workspace();
+
+    /**
+     *  Frees the memory cached by the workspace
+     */
+    virtual ~Workspace();
+
+    /**
+     *  Returns a memory block of at least the requested size aligned on DAAL_MALLOC_DEFAULT_ALIGNMENT bytes.
+     *  A block returned to the workspace before is reused when possible
+     *  \param[in] size  Size of the block in bytes
+     *  \return Pointer to the block, or NULL if the memory cannot be allocated
+     */
+    void *allocate(size_t size);
+
+    /**
+     *  Returns the block obtained from allocate() to the workspace
+     *  \param[in] ptr  Pointer to the block
+     */
+    void deallocate(void *ptr);
+
+    /**
+     *  Frees the cached blocks that are not in use
+     */
+    void release();
+
+    /**
+     *  Returns the total size of the blocks allocated by the workspace and not freed yet
+     *  \return Size of the memory in bytes
+     */
+    size_t getAllocatedSize() const;
+
+private:
+    Workspace(const Workspace &);
+    Workspace &operator=(const Workspace &);
+
+    void *_impl;
+};
+typedef SharedPtr<Workspace> WorkspacePtr;
+/** @} */
+} // namespace interface1
+using interface1::Workspace;
+using interface1::WorkspacePtr;
+
+} // namespace services
+} // namespace daal
+
+#endif
@@ -0,0 +1,578 @@
+/* file: framed_compression_stream.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of framed (de-)compression stream interface.
+//--
+*/
+
+#include "framed_compression_stream.h"
+#include "service_compression.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+/*
+ * Layout of the framed stream:
+ *   FrameHeader
+ *   ChunkIndexEntry[nChunks]  - offsets are relative to the beginning of the first compressed chunk
+ *   compressed chunks
+ * Chunk i holds bytes [i * chunkSize, min((i + 1) * chunkSize, rawSize)) of the original data.
+ */
+struct FrameHeader
+{
+    DAAL_UINT64 magic;
+    DAAL_UINT64 method;
+    DAAL_UINT64 chunkSize;
+    DAAL_UINT64 rawSize;
+    DAAL_UINT64 nChunks;
+};
+
+struct ChunkIndexEntry
+{
+    DAAL_UINT64 offset;
+    DAAL_UINT64 size;
+};
+
+const DAAL_UINT64 frameMagic = 0x3130454d41524644ULL; /* "DFRAME01" */
+
+class FramedCompressionStreamImpl
+{
+public:
+    FramedCompressionStreamImpl(CompressionMethod method, CompressionLevel level, size_t chunkSize) :
+        _method(method), _level(level), _chunkSize(chunkSize), _rawSize(0), _compressedSize(0), _readPos(0), _isPrefixValid(false) {}
+
+    void push_back(byte *ptr, size_t size, services::ErrorCollection &errors)
+    {
+        if(_readPos != 0)
+        {
+            /* Framed stream is being copied, its index can not be changed */
+            errors.add(services::ErrorIncorrectParameter);
+            return;
+        }
+        if(!_pending.append(ptr, size))
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        _isPrefixValid = false;
+        if(_pending.size() >= _chunkSize * threader_get_threads_number())
+        {
+            compressPending(false, errors);
+        }
+    }
+
+    size_t getCompressedDataSize(services::ErrorCollection &errors)
+    {
+        if(!finalize(errors)) { return 0; }
+        return _prefix.size() + _compressedSize - _readPos;
+    }
+
+    size_t copyCompressedArray(byte *ptr, size_t size, services::ErrorCollection &errors)
+    {
+        if(!finalize(errors)) { return 0; }
+
+        const size_t totalSize = _prefix.size() + _compressedSize;
+        size_t copied = 0;
+        size_t segmentStart = 0;
+        for(size_t i = 0; i <= _chunks.size() && copied < size && _readPos < totalSize; i++)
+        {
+            const ByteBuffer &segment = (i == 0) ? _prefix : *(_chunks[i - 1]);
+            const size_t segmentEnd = segmentStart + segment.size();
+            if(_readPos < segmentEnd)
+            {
+                const size_t offset = _readPos - segmentStart;
+                const size_t available = segment.size() - offset;
+                const size_t n = (size - copied < available) ? size - copied : available;
+                daal::services::daal_memcpy_s(ptr + copied, size - copied, segment.ptr() + offset, n);
+                copied += n;
+                _readPos += n;
+            }
+            segmentStart = segmentEnd;
+        }
+
+        if(_readPos == totalSize) { reset(); }
+        return copied;
+    }
+
+protected:
+    void compressPending(bool flush, services::ErrorCollection &errors)
+    {
+        const size_t nFullChunks = _pending.size() / _chunkSize;
+        const size_t tailSize = _pending.size() - nFullChunks * _chunkSize;
+        const size_t nChunks = nFullChunks + ((flush && tailSize) ? 1 : 0);
+        if(nChunks == 0) { return; }
+
+        services::Collection<ByteBufferPtr> chunks(nChunks);
+        services::Collection<ErrorCollectionPtr> chunkErrors(nChunks);
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            chunks[i] = ByteBufferPtr(new ByteBuffer());
+            chunkErrors[i] = createErrorCollection();
+        }
+
+        byte *const pending = _pending.ptr();
+        const size_t pendingSize = _pending.size();
+        const size_t chunkSize = _chunkSize;
+        const CompressionMethod method = _method;
+        const CompressionLevel level = _level;
+        daal::threader_for(nChunks, nChunks, [&](size_t iChunk)
+        {
+            const size_t start = iChunk * chunkSize;
+            const size_t size = (start + chunkSize > pendingSize) ? pendingSize - start : chunkSize;
+            compressChunk(method, level, pending + start, size, *(chunks[iChunk]), *(chunkErrors[iChunk]));
+        });
+
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            if(chunkErrors[i]->size() != 0)
+            {
+                errors.add(*(chunkErrors[i]));
+                return;
+            }
+        }
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            _chunks.push_back(chunks[i]);
+            _compressedSize += chunks[i]->size();
+        }
+
+        const size_t compressedRawSize = (nChunks == nFullChunks) ? nFullChunks * _chunkSize : pendingSize;
+        _rawSize += compressedRawSize;
+        _pending.eraseFront(compressedRawSize);
+    }
+
+    bool finalize(services::ErrorCollection &errors)
+    {
+        if(errors.size() != 0) { return false; }
+        if(_isPrefixValid) { return true; }
+
+        compressPending(true, errors);
+        if(errors.size() != 0) { return false; }
+
+        const size_t nChunks = _chunks.size();
+        _prefix.setSize(0);
+        if(!_prefix.reserve(sizeof(FrameHeader) + nChunks * sizeof(ChunkIndexEntry)))
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return false;
+        }
+
+        FrameHeader header;
+        header.magic     = frameMagic;
+        header.method    = (DAAL_UINT64)_method;
+        header.chunkSize = (DAAL_UINT64)_chunkSize;
+        header.rawSize   = (DAAL_UINT64)_rawSize;
+        header.nChunks   = (DAAL_UINT64)nChunks;
+        _prefix.append((const byte *)&header, sizeof(header));
+
+        DAAL_UINT64 offset = 0;
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            ChunkIndexEntry entry;
+            entry.offset = offset;
+            entry.size   = (DAAL_UINT64)_chunks[i]->size();
+            _prefix.append((const byte *)&entry, sizeof(entry));
+            offset += entry.size;
+        }
+        _isPrefixValid = true;
+        return true;
+    }
+
+    void reset()
+    {
+        _chunks.clear();
+        _prefix.clear();
+        _rawSize = 0;
+        _compressedSize = 0;
+        _readPos = 0;
+        _isPrefixValid = false;
+    }
+
+private:
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _chunkSize;
+
+    ByteBuffer _pending;                          /* Input data not yet compressed */
+    services::Collection<ByteBufferPtr> _chunks;  /* Compressed chunks */
+    ByteBuffer _prefix;                           /* Header and index of the framed stream */
+    size_t _rawSize;
+    size_t _compressedSize;
+    size_t _readPos;
+    bool _isPrefixValid;
+};
+
+class FramedDecompressionStreamImpl
+{
+public:
+    FramedDecompressionStreamImpl() : _isHeaderParsed(false), _readPos(0) {}
+
+    void push_back(byte *ptr, size_t size, services::ErrorCollection &errors)
+    {
+        if(!_input.append(ptr, size))
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+        }
+    }
+
+    size_t getDecompressedDataSize(services::ErrorCollection &errors)
+    {
+        return parseHeader(errors) ? (size_t)_header.rawSize : 0;
+    }
+
+    size_t getNumberOfChunks(services::ErrorCollection &errors)
+    {
+        return parseHeader(errors) ? (size_t)_header.nChunks : 0;
+    }
+
+    size_t copyDecompressedArray(byte *ptr, size_t size, services::ErrorCollection &errors)
+    {
+        if(!parseHeader(errors)) { return 0; }
+        if(_readPos >= _header.rawSize) { return 0; }
+        const size_t copied = copyDecompressedRange(_readPos, ptr, size, errors);
+        _readPos += copied;
+        return copied;
+    }
+
+    size_t copyDecompressedRange(size_t offset, byte *ptr, size_t size, services::ErrorCollection &errors)
+    {
+        if(!parseHeader(errors))
+        {
+            if(errors.size() == 0) { errors.add(services::ErrorFramedDataFormat); }
+            return 0;
+        }
+
+        const size_t rawSize = (size_t)_header.rawSize;
+        if(offset > rawSize)
+        {
+            errors.add(services::ErrorIncorrectDataRange);
+            return 0;
+        }
+        if(size > rawSize - offset) { size = rawSize - offset; }
+        if(size == 0) { return 0; }
+
+        const size_t chunkSize = (size_t)_header.chunkSize;
+        const size_t firstChunk = offset / chunkSize;
+        const size_t nChunks = (offset + size - 1) / chunkSize - firstChunk + 1;
+
+        const ChunkIndexEntry *const index = (const ChunkIndexEntry *)(_input.ptr() + sizeof(FrameHeader));
+        const size_t payloadStart = sizeof(FrameHeader) + (size_t)_header.nChunks * sizeof(ChunkIndexEntry);
+        for(size_t i = firstChunk; i < firstChunk + nChunks; i++)
+        {
+            if(payloadStart + index[i].offset + index[i].size > _input.size())
+            {
+                /* Compressed chunk is not received yet */
+                errors.add(services::ErrorFramedDataFormat);
+                return 0;
+            }
+        }
+
+        services::Collection<ErrorCollectionPtr> chunkErrors(nChunks);
+        for(size_t i = 0; i < nChunks; i++) { chunkErrors[i] = createErrorCollection(); }
+
+        const size_t bufferSize = chunkSize + decompressionSlack;
+        daal::tls<byte *> buffers([=]() -> byte *
+        {
+            return (byte *)daal::services::daal_malloc(bufferSize);
+        });
+
+        byte *const payload = _input.ptr() + payloadStart;
+        const CompressionMethod method = (CompressionMethod)_header.method;
+        daal::threader_for(nChunks, nChunks, [&](size_t i)
+        {
+            const size_t iChunk = firstChunk + i;
+            byte *const buffer = buffers.local();
+            if(!buffer)
+            {
+                chunkErrors[i]->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+
+            const size_t chunkStart = iChunk * chunkSize;
+            const size_t chunkRawSize = (chunkStart + chunkSize > rawSize) ? rawSize - chunkStart : chunkSize;
+            const size_t decompressed = decompressChunk(method, payload + index[iChunk].offset, (size_t)index[iChunk].size,
+                                                        buffer, bufferSize, *(chunkErrors[i]));
+            if(chunkErrors[i]->size() != 0) { return; }
+            if(decompressed != chunkRawSize)
+            {
+                chunkErrors[i]->add(services::ErrorFramedDataFormat);
+                return;
+            }
+
+            const size_t copyStart = (offset > chunkStart) ? offset : chunkStart;
+            const size_t copyEnd = (offset + size < chunkStart + chunkRawSize) ? offset + size : chunkStart + chunkRawSize;
+            daal::services::daal_memcpy_s(ptr + (copyStart - offset), size - (copyStart - offset), buffer + (copyStart - chunkStart),
+                                          copyEnd - copyStart);
+        });
+
+        buffers.reduce([](byte *buffer)
+        {
+            daal::services::daal_free(buffer);
+        });
+
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            if(chunkErrors[i]->size() != 0)
+            {
+                errors.add(*(chunkErrors[i]));
+                return 0;
+            }
+        }
+        return size;
+    }
+
+protected:
+    /* Returns true if the header and the index are received and valid */
+    bool parseHeader(services::ErrorCollection &errors)
+    {
+        if(_isHeaderParsed) { return true; }
+        if(_input.size() < sizeof(FrameHeader)) { return false; }
+
+        daal::services::daal_memcpy_s(&_header, sizeof(FrameHeader), _input.ptr(), sizeof(FrameHeader));
+        if(_header.magic != frameMagic || _header.method > (DAAL_UINT64)bzip2 || _header.chunkSize == 0 ||
+           _header.nChunks != (_header.rawSize + _header.chunkSize - 1) / _header.chunkSize)
+        {
+            errors.add(services::ErrorFramedDataFormat);
+            return false;
+        }
+        if(_header.nChunks > (_input.size() - sizeof(FrameHeader)) / sizeof(ChunkIndexEntry)) { return false; }
+
+        const ChunkIndexEntry *const index = (const ChunkIndexEntry *)(_input.ptr() + sizeof(FrameHeader));
+        DAAL_UINT64 offset = 0;
+        for(size_t i = 0; i < _header.nChunks; i++)
+        {
+            if(index[i].offset != offset || index[i].size == 0)
+            {
+                errors.add(services::ErrorFramedDataFormat);
+                return false;
+            }
+            offset += index[i].size;
+        }
+        _isHeaderParsed = true;
+        return true;
+    }
+
+private:
+    ByteBuffer _input;
+    FrameHeader _header;
+    bool _isHeaderParsed;
+    size_t _readPos;
+};
+
+} // namespace internal
+
+//framed compression stream realization
+FramedCompressionStream::FramedCompressionStream(CompressionMethod method, CompressionLevel level, size_t chunkSize) :
+    _errors(new services::ErrorCollection()), _impl(NULL)
+{
+    this->_errors->setCanThrow(false);
+    if(chunkSize == 0)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _impl = (void *) new internal::FramedCompressionStreamImpl(method, level, chunkSize);
+}
+
+FramedCompressionStream::~FramedCompressionStream()
+{
+    if(_impl) { delete (internal::FramedCompressionStreamImpl *)_impl; }
+}
+
+void FramedCompressionStream::push_back(DataBlock *block)
+{
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    ((internal::FramedCompressionStreamImpl *)_impl)->push_back(block->getPtr(), block->getSize(), *(this->_errors));
+}
+
+size_t FramedCompressionStream::getCompressedDataSize()
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return ((internal::FramedCompressionStreamImpl *)_impl)->getCompressedDataSize(*(this->_errors));
+}
+
+size_t FramedCompressionStream::copyCompressedArray(byte *ptr, size_t size)
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    return ((internal::FramedCompressionStreamImpl *)_impl)->copyCompressedArray(ptr, size, *(this->_errors));
+}
+
+//framed decompression stream realization
+FramedDecompressionStream::FramedDecompressionStream() : _errors(new services::ErrorCollection()), _impl(NULL)
+{
+    this->_errors->setCanThrow(false);
+    _impl = (void *) new internal::FramedDecompressionStreamImpl();
+}
+
+FramedDecompressionStream::~FramedDecompressionStream()
+{
+    if(_impl) { delete (internal::FramedDecompressionStreamImpl *)_impl; }
+}
+
+void FramedDecompressionStream::push_back(DataBlock *block)
+{
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    ((internal::FramedDecompressionStreamImpl *)_impl)->push_back(block->getPtr(), block->getSize(), *(this->_errors));
+}
+
+size_t FramedDecompressionStream::getDecompressedDataSize()
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return ((internal::FramedDecompressionStreamImpl *)_impl)->getDecompressedDataSize(*(this->_errors));
+}
+
+size_t FramedDecompressionStream::getNumberOfChunks()
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return ((internal::FramedDecompressionStreamImpl *)_impl)->getNumberOfChunks(*(this->_errors));
+}
+
+size_t FramedDecompressionStream::copyDecompressedArray(byte *ptr, size_t size)
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    return ((internal::FramedDecompressionStreamImpl *)_impl)->copyDecompressedArray(ptr, size, *(this->_errors));
+}
+
+size_t FramedDecompressionStream::copyDecompressedRange(size_t offset, byte *ptr, size_t size)
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    return ((internal::FramedDecompressionStreamImpl *)_impl)->copyDecompressedRange(offset, ptr, size, *(this->_errors));
+}
+
+} //namespace data_management
+} //namespace daal
@@ -0,0 +1,234 @@
+/* file: service_compression.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Helpers to compress and decompress independent chunks of data.
+//--
+*/
+
+#ifndef __SERVICE_COMPRESSION_H__
+#define __SERVICE_COMPRESSION_H__
+
+#include "services/daal_memory.h"
+#include "services/collection.h"
+#include "services/error_handling.h"
+#include "zlibcompression.h"
+#include "bzip2compression.h"
+#include "lzocompression.h"
+#include "rlecompression.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+/* Extra space in the decompression buffer to let decompressors reach the end of the compressed chunk */
+const size_t decompressionSlack = 64;
+
+class ByteBuffer
+{
+public:
+    ByteBuffer() : _ptr(NULL), _size(0), _capacity(0) {}
+    ~ByteBuffer() { clear(); }
+
+    byte *ptr() const { return _ptr; }
+    size_t size() const { return _size; }
+    size_t capacity() const { return _capacity; }
+
+    void setSize(size_t size) { _size = size; }
+
+    bool reserve(size_t capacity)
+    {
+        if(capacity <= _capacity) { return true; }
+        byte *newPtr = (byte *)daal::services::daal_malloc(capacity);
+        if(!newPtr) { return false; }
+        if(_size) { daal::services::daal_memcpy_s(newPtr, capacity, _ptr, _size); }
+        daal::services::daal_free(_ptr);
+        _ptr = newPtr;
+        _capacity = capacity;
+        return true;
+    }
+
+    bool append(const byte *data, size_t size)
+    {
+        if(_size + size > _capacity && !reserve(_size + size > 2 * _capacity ? _size + size : 2 * _capacity)) { return false; }
+        daal::services::daal_memcpy_s(_ptr + _size, _capacity - _size, data, size);
+        _size += size;
+        return true;
+    }
+
+    /* Removes first bytes of the buffer, the remaining bytes must not overlap the removed ones */
+    void eraseFront(size_t size)
+    {
+        const size_t rest = _size - size;
+        if(rest) { daal::services::daal_memcpy_s(_ptr, _capacity, _ptr + size, rest); }
+        _size = rest;
+    }
+
+    void clear()
+    {
+        daal::services::daal_free(_ptr);
+        _ptr = NULL;
+        _size = 0;
+        _capacity = 0;
+    }
+
+private:
+    ByteBuffer(const ByteBuffer &);
+    ByteBuffer &operator=(const ByteBuffer &);
+
+    byte *_ptr;
+    size_t _size;
+    size_t _capacity;
+};
+
+typedef services::SharedPtr<ByteBuffer> ByteBufferPtr;
+typedef services::SharedPtr<services::ErrorCollection> ErrorCollectionPtr;
+
+inline ErrorCollectionPtr createErrorCollection()
+{
+    ErrorCollectionPtr errors(new services::ErrorCollection());
+    errors->setCanThrow(false);
+    return errors;
+}
+
+template<CompressionMethod method>
+inline void compressChunk(CompressionLevel level, byte *in, size_t inSize, ByteBuffer &out, services::ErrorCollection &errors)
+{
+    Compressor<method> compressor;
+    compressor.parameter.level = level;
+    compressor.setInputDataBlock(in, inSize, 0);
+    if(compressor.getErrors()->size() != 0)
+    {
+        errors.add(*(compressor.getErrors()));
+        return;
+    }
+
+    out.setSize(0);
+    if(!out.reserve(inSize + inSize / 8 + 1024))
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for(;;)
+    {
+        compressor.run(out.ptr(), out.capacity() - out.size(), out.size());
+        if(compressor.getErrors()->size() != 0)
+        {
+            errors.add(*(compressor.getErrors()));
+            return;
+        }
+        out.setSize(out.size() + compressor.getUsedOutputDataBlockSize());
+        if(!compressor.isOutputDataBlockFull()) { break; }
+        if(!out.reserve(2 * out.capacity()))
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+}
+
+inline void compressChunk(CompressionMethod method, CompressionLevel level, byte *in, size_t inSize, ByteBuffer &out,
+                          services::ErrorCollection &errors)
+{
+    switch(method)
+    {
+    case zlib:  compressChunk<zlib> (level, in, inSize, out, errors); break;
+    case lzo:   compressChunk<lzo>  (level, in, inSize, out, errors); break;
+    case rle:   compressChunk<rle>  (level, in, inSize, out, errors); break;
+    case bzip2: compressChunk<bzip2>(level, in, inSize, out, errors); break;
+    default: errors.add(services::ErrorIncorrectParameter); break;
+    }
+}
+
+template<CompressionMethod method>
+inline size_t decompressChunk(byte *in, size_t inSize, byte *out, size_t outCapacity, services::ErrorCollection &errors)
+{
+    Decompressor<method> decompressor;
+    decompressor.setInputDataBlock(in, inSize, 0);
+    if(decompressor.getErrors()->size() != 0)
+    {
+        errors.add(*(decompressor.getErrors()));
+        return 0;
+    }
+
+    size_t used = 0;
+    do
+    {
+        if(used >= outCapacity)
+        {
+            errors.add(services::ErrorFramedDataFormat);
+            return 0;
+        }
+        decompressor.run(out, outCapacity - used, used);
+        if(decompressor.getErrors()->size() != 0)
+        {
+            errors.add(*(decompressor.getErrors()));
+            return 0;
+        }
+        used += decompressor.getUsedOutputDataBlockSize();
+    }
+    while(decompressor.isOutputDataBlockFull());
+    return used;
+}
+
+inline size_t decompressChunk(CompressionMethod method, byte *in, size_t inSize, byte *out, size_t outCapacity,
+                              services::ErrorCollection &errors)
+{
+    switch(method)
+    {
+    case zlib:  return decompressChunk<zlib> (in, inSize, out, outCapacity, errors);
+    case lzo:   return decompressChunk<lzo>  (in, inSize, out, outCapacity, errors);
+    case rle:   return decompressChunk<rle>  (in, inSize, out, outCapacity, errors);
+    case bzip2: return decompressChunk<bzip2>(in, inSize, out, outCapacity, errors);
+    default: errors.add(services::ErrorFramedDataFormat); return 0;
+    }
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
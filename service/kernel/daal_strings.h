@@ -83,6 +83,10 @@
     DECLARE_DAAL_STRING_CONST(auxGroundTruth                     ) \
     DECLARE_DAAL_STRING_CONST(inputLayerData                     ) \
     DECLARE_DAAL_STRING_CONST(auxMask                            ) \
+    DECLARE_DAAL_STRING_CONST(auxGates                           ) \
+    DECLARE_DAAL_STRING_CONST(auxCellStates                      ) \
+    DECLARE_DAAL_STRING_CONST(auxHiddenStates                    ) \
+    DECLARE_DAAL_STRING_CONST(nOutputs                           ) \
     DECLARE_DAAL_STRING_CONST(impurityThreshold                  ) \
     DECLARE_DAAL_STRING_CONST(inputGradientCollection            ) \
     DECLARE_DAAL_STRING_CONST(valueCollection                    ) \
@@ -92,6 +96,8 @@
     DECLARE_DAAL_STRING_CONST(dataDimension                      ) \
     DECLARE_DAAL_STRING_CONST(correlationDistance                ) \
     DECLARE_DAAL_STRING_CONST(cosineDistance                     ) \
+    DECLARE_DAAL_STRING_CONST(euclideanDistance                  ) \
+    DECLARE_DAAL_STRING_CONST(otherData                          ) \
     DECLARE_DAAL_STRING_CONST(quantiles                          ) \
     DECLARE_DAAL_STRING_CONST(quantileOrders                     ) \
     DECLARE_DAAL_STRING_CONST(covariance                         ) \
@@ -292,9 +298,14 @@
     DECLARE_DAAL_STRING_CONST(location                           ) \
     DECLARE_DAAL_STRING_CONST(scatter                            ) \
     DECLARE_DAAL_STRING_CONST(threshold                          ) \
+    DECLARE_DAAL_STRING_CONST(nBasicSubsetObservations           ) \
+    DECLARE_DAAL_STRING_CONST(partialCrossProduct                ) \
+    DECLARE_DAAL_STRING_CONST(basicSubsetSize                    ) \
+    DECLARE_DAAL_STRING_CONST(converged                          ) \
     DECLARE_DAAL_STRING_CONST(conservativeSequence               ) \
     DECLARE_DAAL_STRING_CONST(pastUpdateVector                   ) \
     DECLARE_DAAL_STRING_CONST(minObservationsInLeafNodes         ) \
+    DECLARE_DAAL_STRING_CONST(maxBins                            ) \
     DECLARE_DAAL_STRING_CONST(dataForPruning                     ) \
     DECLARE_DAAL_STRING_CONST(labelsForPruning                   ) \
     DECLARE_DAAL_STRING_CONST(dependentVariablesForPruning       ) \
@@ -316,7 +327,33 @@
     DECLARE_DAAL_STRING_CONST(shrinkage                          ) \
     DECLARE_DAAL_STRING_CONST(transformedData                    ) \
     DECLARE_DAAL_STRING_CONST(classSize                          ) \
-    DECLARE_DAAL_STRING_CONST(groupSum                           )
+    DECLARE_DAAL_STRING_CONST(groupSum                           ) \
+    DECLARE_DAAL_STRING_CONST(partialSumOfWeights                ) \
+    DECLARE_DAAL_STRING_CONST(partialMeans                       ) \
+    DECLARE_DAAL_STRING_CONST(partialCrossProducts               ) \
+    DECLARE_DAAL_STRING_CONST(responsibilities                   ) \
+    DECLARE_DAAL_STRING_CONST(logLikelihood                      ) \
+    DECLARE_DAAL_STRING_CONST(nObservationsRandomized            ) \
+    DECLARE_DAAL_STRING_CONST(sumRandomized                      ) \
+    DECLARE_DAAL_STRING_CONST(sumSquaresRandomized               ) \
+    DECLARE_DAAL_STRING_CONST(sketchRandomized                   ) \
+    DECLARE_DAAL_STRING_CONST(oversampling                       ) \
+    DECLARE_DAAL_STRING_CONST(nPowerIterations                   ) \
+    DECLARE_DAAL_STRING_CONST(statisticsToCompute                ) \
+    DECLARE_DAAL_STRING_CONST(lowOrderMomentsResult              ) \
+    DECLARE_DAAL_STRING_CONST(covarianceResult                   ) \
+    DECLARE_DAAL_STRING_CONST(quantilesResult                    ) \
+    DECLARE_DAAL_STRING_CONST(sortingResult                      ) \
+    DECLARE_DAAL_STRING_CONST(lowOrderMomentsPartialResult       ) \
+    DECLARE_DAAL_STRING_CONST(covariancePartialResult            ) \
+    DECLARE_DAAL_STRING_CONST(l1Penalty                          ) \
+    DECLARE_DAAL_STRING_CONST(l2Penalty                          ) \
+    DECLARE_DAAL_STRING_CONST(pathLength                         ) \
+    DECLARE_DAAL_STRING_CONST(nCorrectionPairs                   ) \
+    DECLARE_DAAL_STRING_CONST(probabilities                      ) \
+    DECLARE_DAAL_STRING_CONST(logProbabilities                   ) \
+    DECLARE_DAAL_STRING_CONST(sortedIndices                      ) \
+    DECLARE_DAAL_STRING_CONST(resultsToCompute                   )
 
 
 /**
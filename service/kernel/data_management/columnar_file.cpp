@@ -0,0 +1,741 @@
+/* file: columnar_file.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the writer and the reader of columnar table files.
+//--
+*/
+
+#include <cstdio>
+
+#include "columnar_file.h"
+#include "service_compression.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+/*
+ * Layout of the columnar table file:
+ *   ColumnarFileHeader
+ *   ColumnDesc[nColumns]
+ *   column blocks of all chunks
+ *   ChunkDesc[nChunks]
+ *   BlockDesc[nChunks * nColumns]  - blocks of chunk i are stored at [i * nColumns, (i + 1) * nColumns)
+ *   ColumnarFileTrailer
+ * Column block holds the values of one column in one chunk as a contiguous array of the column type.
+ * The block is compressed with the method (codec - 1) or stored as is if codec is 0.
+ */
+struct ColumnarFileHeader
+{
+    DAAL_UINT64 magic;
+    DAAL_UINT64 nColumns;
+};
+
+struct ColumnDesc
+{
+    DAAL_UINT64 indexType;
+    DAAL_UINT64 featureType;
+};
+
+struct ChunkDesc
+{
+    DAAL_UINT64 firstRow;
+    DAAL_UINT64 nRows;
+};
+
+struct BlockDesc
+{
+    DAAL_UINT64 offset;
+    DAAL_UINT64 size;
+    DAAL_UINT64 codec;
+    DAAL_UINT64 count;
+    double minimum;
+    double maximum;
+};
+
+struct ColumnarFileTrailer
+{
+    DAAL_UINT64 indexOffset;
+    DAAL_UINT64 nChunks;
+    DAAL_UINT64 nRows;
+    DAAL_UINT64 magic;
+};
+
+const DAAL_UINT64 columnarFileMagic = 0x314241544c4f4344ULL; /* "DCOLTAB1" */
+
+/* Returns the type used to store values of the feature: integers that fit into int are stored as int, other integers as double */
+static data_feature_utils::IndexNumType getStorageType(data_feature_utils::IndexNumType type)
+{
+    switch(type)
+    {
+    case data_feature_utils::DAAL_FLOAT32: return data_feature_utils::DAAL_FLOAT32;
+    case data_feature_utils::DAAL_INT32_S:
+    case data_feature_utils::DAAL_INT8_S:
+    case data_feature_utils::DAAL_INT8_U:
+    case data_feature_utils::DAAL_INT16_S:
+    case data_feature_utils::DAAL_INT16_U: return data_feature_utils::DAAL_INT32_S;
+    default: return data_feature_utils::DAAL_FLOAT64;
+    }
+}
+
+static size_t getStorageTypeSize(DAAL_UINT64 type)
+{
+    return (type == (DAAL_UINT64)data_feature_utils::DAAL_FLOAT64 ? sizeof(double) : sizeof(float));
+}
+
+static int getStorageInternalType(DAAL_UINT64 type)
+{
+    switch(type)
+    {
+    case data_feature_utils::DAAL_FLOAT32: return data_feature_utils::DAAL_SINGLE;
+    case data_feature_utils::DAAL_INT32_S: return data_feature_utils::DAAL_INT32;
+    default: return data_feature_utils::DAAL_DOUBLE;
+    }
+}
+
+static bool seekFile(FILE *file, DAAL_UINT64 offset, int origin)
+{
+#if defined(_MSC_VER)
+    return (_fseeki64(file, (__int64)offset, origin) == 0);
+#else
+    return (fseeko(file, (off_t)offset, origin) == 0);
+#endif
+}
+
+template<typename T>
+static void computeStatistics(const T *values, size_t n, BlockDesc &block)
+{
+    size_t count = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    for(size_t i = 0; i < n; i++)
+    {
+        const double value = (double)values[i];
+        if(value != value) { continue; }
+        if(count == 0 || value < minimum) { minimum = value; }
+        if(count == 0 || value > maximum) { maximum = value; }
+        count++;
+    }
+    block.count   = (DAAL_UINT64)count;
+    block.minimum = minimum;
+    block.maximum = maximum;
+}
+
+class ColumnarFileWriterImpl
+{
+public:
+    ColumnarFileWriterImpl(FILE *file, bool compress, CompressionMethod method, CompressionLevel level, size_t chunkRows) :
+        _file(file), _compress(compress), _method(method), _level(level), _chunkRows(chunkRows),
+        _nColumns(0), _isHeaderWritten(false), _pendingRows(0), _offset(0), _nRows(0) {}
+
+    ~ColumnarFileWriterImpl()
+    {
+        if(_file) { fclose(_file); }
+    }
+
+    services::Status write(NumericTable &table)
+    {
+        if(!_file) { return services::Status(services::ErrorOnFileWrite); }
+
+        services::Status s;
+        if(!_isHeaderWritten)
+        {
+            s = writeHeader(&table);
+            if(!s) { return s; }
+        }
+        if(table.getNumberOfColumns() != _nColumns) { return services::Status(services::ErrorIncorrectNumberOfFeatures); }
+
+        const size_t nRows = table.getNumberOfRows();
+        for(size_t row = 0; row < nRows;)
+        {
+            const size_t n = (_chunkRows - _pendingRows < nRows - row) ? _chunkRows - _pendingRows : nRows - row;
+            for(size_t j = 0; j < _nColumns && s; j++)
+            {
+                switch(_columns[j].indexType)
+                {
+                case data_feature_utils::DAAL_FLOAT32: s = appendColumn<float> (table, j, row, n); break;
+                case data_feature_utils::DAAL_INT32_S: s = appendColumn<int>   (table, j, row, n); break;
+                default:                               s = appendColumn<double>(table, j, row, n); break;
+                }
+            }
+            if(!s) { return s; }
+
+            _pendingRows += n;
+            row += n;
+            if(_pendingRows == _chunkRows)
+            {
+                s = flushChunk();
+                if(!s) { return s; }
+            }
+        }
+        return s;
+    }
+
+    services::Status close()
+    {
+        if(!_file) { return services::Status(); }
+
+        services::Status s;
+        if(!_isHeaderWritten) { s = writeHeader(NULL); }
+        if(s) { s = flushChunk(); }
+
+        if(s)
+        {
+            ColumnarFileTrailer trailer;
+            trailer.indexOffset = _offset;
+            trailer.nChunks     = (DAAL_UINT64)_chunks.size();
+            trailer.nRows       = _nRows;
+            trailer.magic       = columnarFileMagic;
+
+            if(_chunks.size()) { s = writeBytes(&_chunks[0], _chunks.size() * sizeof(ChunkDesc)); }
+            if(s && _blocks.size()) { s = writeBytes(&_blocks[0], _blocks.size() * sizeof(BlockDesc)); }
+            if(s) { s = writeBytes(&trailer, sizeof(trailer)); }
+        }
+
+        if(fclose(_file) != 0 && s) { s = services::Status(services::ErrorOnFileWrite); }
+        _file = NULL;
+        return s;
+    }
+
+protected:
+    services::Status writeHeader(NumericTable *table)
+    {
+        _nColumns = (table ? table->getNumberOfColumns() : 0);
+        NumericTableDictionaryPtr dict = (table ? table->getDictionarySharedPtr() : NumericTableDictionaryPtr());
+        for(size_t j = 0; j < _nColumns; j++)
+        {
+            ColumnDesc column;
+            column.indexType   = (DAAL_UINT64)data_feature_utils::DAAL_FLOAT64;
+            column.featureType = (DAAL_UINT64)data_feature_utils::DAAL_CONTINUOUS;
+            if(dict && j < dict->getNumberOfFeatures())
+            {
+                column.indexType   = (DAAL_UINT64)getStorageType((*dict)[j].indexType);
+                column.featureType = (DAAL_UINT64)(*dict)[j].featureType;
+            }
+            _columns.push_back(column);
+            _pending.push_back(ByteBufferPtr(new ByteBuffer()));
+        }
+
+        ColumnarFileHeader header;
+        header.magic    = columnarFileMagic;
+        header.nColumns = (DAAL_UINT64)_nColumns;
+
+        services::Status s = writeBytes(&header, sizeof(header));
+        if(s && _nColumns) { s = writeBytes(&_columns[0], _nColumns * sizeof(ColumnDesc)); }
+        _isHeaderWritten = true;
+        return s;
+    }
+
+    template<typename T>
+    services::Status appendColumn(NumericTable &table, size_t column, size_t row, size_t nRows)
+    {
+        BlockDescriptor<T> block;
+        services::Status s = table.getBlockOfColumnValues(column, row, nRows, readOnly, block);
+        if(s && !_pending[column]->append((const byte *)block.getBlockPtr(), nRows * sizeof(T)))
+        {
+            s = services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        table.releaseBlockOfColumnValues(block);
+        return s;
+    }
+
+    /* Computes statistics and compresses the blocks of the pending chunk in parallel, then writes them in the column order */
+    services::Status flushChunk()
+    {
+        if(_pendingRows == 0) { return services::Status(); }
+
+        services::Collection<BlockDesc> blocks(_nColumns);
+        services::Collection<ByteBufferPtr> compressed(_nColumns);
+        for(size_t j = 0; j < _nColumns; j++)
+        {
+            compressed[j] = ByteBufferPtr(new ByteBuffer());
+        }
+
+        const size_t nRows = _pendingRows;
+        daal::threader_for(_nColumns, _nColumns, [&](size_t j)
+        {
+            BlockDesc &block = blocks[j];
+            const byte *values = _pending[j]->ptr();
+            switch(_columns[j].indexType)
+            {
+            case data_feature_utils::DAAL_FLOAT32: computeStatistics<float> ((const float *)values,  nRows, block); break;
+            case data_feature_utils::DAAL_INT32_S: computeStatistics<int>   ((const int *)values,    nRows, block); break;
+            default:                               computeStatistics<double>((const double *)values, nRows, block); break;
+            }
+
+            block.codec = 0;
+            if(_compress)
+            {
+                /* Block is stored uncompressed if compression fails or does not reduce its size */
+                ErrorCollectionPtr errors = createErrorCollection();
+                compressChunk(_method, _level, _pending[j]->ptr(), _pending[j]->size(), *(compressed[j]), *errors);
+                if(errors->size() == 0 && compressed[j]->size() < _pending[j]->size())
+                {
+                    block.codec = (DAAL_UINT64)_method + 1;
+                }
+            }
+        });
+
+        services::Status s;
+        for(size_t j = 0; j < _nColumns && s; j++)
+        {
+            const ByteBuffer &data = (blocks[j].codec ? *(compressed[j]) : *(_pending[j]));
+            blocks[j].offset = _offset;
+            blocks[j].size   = (DAAL_UINT64)data.size();
+            s = writeBytes(data.ptr(), data.size());
+            _blocks.push_back(blocks[j]);
+            _pending[j]->setSize(0);
+        }
+
+        ChunkDesc chunk;
+        chunk.firstRow = _nRows;
+        chunk.nRows    = (DAAL_UINT64)nRows;
+        _chunks.push_back(chunk);
+
+        _nRows += nRows;
+        _pendingRows = 0;
+        return s;
+    }
+
+    services::Status writeBytes(const void *ptr, size_t size)
+    {
+        if(size && fwrite(ptr, 1, size, _file) != size) { return services::Status(services::ErrorOnFileWrite); }
+        _offset += size;
+        return services::Status();
+    }
+
+private:
+    FILE *_file;
+    bool _compress;
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _chunkRows;
+
+    size_t _nColumns;
+    bool _isHeaderWritten;
+    services::Collection<ColumnDesc> _columns;
+    services::Collection<ByteBufferPtr> _pending;   /* Values of the columns in the chunk not written yet */
+    size_t _pendingRows;
+    services::Collection<ChunkDesc> _chunks;
+    services::Collection<BlockDesc> _blocks;
+    DAAL_UINT64 _offset;
+    DAAL_UINT64 _nRows;
+};
+
+class ColumnarFileReaderImpl
+{
+public:
+    ColumnarFileReaderImpl() : _file(NULL), _nColumns(0), _nRows(0), _maxChunkRows(0) {}
+
+    ~ColumnarFileReaderImpl()
+    {
+        if(_file) { fclose(_file); }
+    }
+
+    services::Status open(const char *fileName)
+    {
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+        if(fopen_s(&_file, fileName, "rb") != 0) { _file = NULL; }
+#else
+        _file = fopen(fileName, "rb");
+#endif
+        if(!_file) { return services::Status(services::ErrorOnFileOpen); }
+
+        ColumnarFileHeader header;
+        ColumnarFileTrailer trailer;
+        if(!readBytes(0, &header, sizeof(header)) || header.magic != columnarFileMagic) { return formatError(); }
+        if(!seekFile(_file, 0, SEEK_END)) { return services::Status(services::ErrorOnFileRead); }
+        const DAAL_UINT64 fileSize = (DAAL_UINT64)
+#if defined(_MSC_VER)
+            _ftelli64(_file);
+#else
+            ftello(_file);
+#endif
+        if(fileSize < sizeof(header) + sizeof(trailer)) { return formatError(); }
+        if(!readBytes(fileSize - sizeof(trailer), &trailer, sizeof(trailer)) || trailer.magic != columnarFileMagic) { return formatError(); }
+
+        _nColumns = (size_t)header.nColumns;
+        _nRows    = (size_t)trailer.nRows;
+        const size_t nChunks = (size_t)trailer.nChunks;
+        const DAAL_UINT64 dataStart = sizeof(header) + header.nColumns * sizeof(ColumnDesc);
+        if(trailer.indexOffset < dataStart ||
+           trailer.indexOffset + trailer.nChunks * (sizeof(ChunkDesc) + header.nColumns * sizeof(BlockDesc)) + sizeof(trailer) != fileSize)
+        {
+            return formatError();
+        }
+
+        _columns.resize(_nColumns);
+        _chunks.resize(nChunks);
+        _blocks.resize(nChunks * _nColumns);
+        for(size_t j = 0; j < _nColumns; j++) { _columns.push_back(ColumnDesc()); }
+        for(size_t i = 0; i < nChunks; i++) { _chunks.push_back(ChunkDesc()); }
+        for(size_t i = 0; i < nChunks * _nColumns; i++) { _blocks.push_back(BlockDesc()); }
+
+        if((_nColumns && !readBytes(sizeof(header), &_columns[0], _nColumns * sizeof(ColumnDesc))) ||
+           (nChunks && !readBytes(trailer.indexOffset, &_chunks[0], nChunks * sizeof(ChunkDesc))) ||
+           (nChunks != 0 && _nColumns != 0 && !readBytes(trailer.indexOffset + nChunks * sizeof(ChunkDesc), &_blocks[0],
+                                                         nChunks * _nColumns * sizeof(BlockDesc))))
+        {
+            return services::Status(services::ErrorOnFileRead);
+        }
+
+        for(size_t j = 0; j < _nColumns; j++)
+        {
+            const DAAL_UINT64 type = _columns[j].indexType;
+            if(type != data_feature_utils::DAAL_FLOAT32 && type != data_feature_utils::DAAL_FLOAT64 && type != data_feature_utils::DAAL_INT32_S)
+            {
+                return formatError();
+            }
+        }
+
+        DAAL_UINT64 nextRow = 0;
+        for(size_t i = 0; i < nChunks; i++)
+        {
+            if(_chunks[i].firstRow != nextRow || _chunks[i].nRows == 0) { return formatError(); }
+            nextRow += _chunks[i].nRows;
+            if(_chunks[i].nRows > _maxChunkRows) { _maxChunkRows = (size_t)_chunks[i].nRows; }
+
+            for(size_t j = 0; j < _nColumns; j++)
+            {
+                const BlockDesc &block = _blocks[i * _nColumns + j];
+                const DAAL_UINT64 rawSize = _chunks[i].nRows * getStorageTypeSize(_columns[j].indexType);
+                if(block.offset < dataStart || block.offset + block.size > trailer.indexOffset || block.codec > (DAAL_UINT64)bzip2 + 1 ||
+                   (block.codec == 0 && block.size != rawSize) || block.count > _chunks[i].nRows)
+                {
+                    return formatError();
+                }
+            }
+        }
+        if(nextRow != trailer.nRows) { return formatError(); }
+        return services::Status();
+    }
+
+    size_t getNumberOfColumns() const { return _nColumns; }
+    size_t getNumberOfRows() const { return _nRows; }
+    size_t getNumberOfChunks() const { return _chunks.size(); }
+
+    const ChunkDesc &getChunk(size_t chunk) const { return _chunks[chunk]; }
+    const ColumnDesc &getColumn(size_t column) const { return _columns[column]; }
+    const BlockDesc &getBlock(size_t chunk, size_t column) const { return _blocks[chunk * _nColumns + column]; }
+
+    template<typename T>
+    services::Status readColumns(size_t firstRow, size_t nRows, const size_t *columns, size_t nColumns, T *data)
+    {
+        if(!_file) { return services::Status(services::ErrorOnFileRead); }
+        if(firstRow > _nRows || nRows > _nRows - firstRow) { return services::Status(services::ErrorIncorrectDataRange); }
+        if(nRows == 0 || nColumns == 0) { return services::Status(); }
+        if(!columns || !data) { return services::Status(services::ErrorNullPtr); }
+        for(size_t k = 0; k < nColumns; k++)
+        {
+            if(columns[k] >= _nColumns) { return services::Status(services::ErrorIncorrectIndex); }
+        }
+
+        const size_t firstChunk = findChunk(firstRow);
+        const size_t lastChunk  = findChunk(firstRow + nRows - 1);
+        const size_t nTasks = (lastChunk - firstChunk + 1) * nColumns;
+
+        /* Blocks are read sequentially in the file order, decompression and conversion are done in parallel */
+        services::Collection<ByteBufferPtr> blocks(nTasks);
+        for(size_t t = 0; t < nTasks; t++)
+        {
+            const BlockDesc &block = getBlock(firstChunk + t / nColumns, columns[t % nColumns]);
+            blocks[t] = ByteBufferPtr(new ByteBuffer());
+            if(!blocks[t]->reserve((size_t)block.size)) { return services::Status(services::ErrorMemoryAllocationFailed); }
+            if(!readBytes(block.offset, blocks[t]->ptr(), (size_t)block.size)) { return services::Status(services::ErrorOnFileRead); }
+            blocks[t]->setSize((size_t)block.size);
+        }
+
+        const size_t bufferSize = _maxChunkRows * sizeof(double) + decompressionSlack;
+        daal::tls<byte *> buffers([=]() -> byte *
+        {
+            return (byte *)daal::services::daal_malloc(bufferSize);
+        });
+
+        services::Collection<int> taskStatus(nTasks);
+        daal::threader_for(nTasks, nTasks, [&](size_t t)
+        {
+            taskStatus[t] = 0;
+            const size_t chunk  = firstChunk + t / nColumns;
+            const size_t column = columns[t % nColumns];
+            const BlockDesc &block = getBlock(chunk, column);
+            const size_t chunkFirstRow = (size_t)_chunks[chunk].firstRow;
+            const size_t chunkRows = (size_t)_chunks[chunk].nRows;
+            const size_t typeSize = getStorageTypeSize(_columns[column].indexType);
+
+            byte *values = blocks[t]->ptr();
+            if(block.codec)
+            {
+                byte *const buffer = buffers.local();
+                if(!buffer)
+                {
+                    taskStatus[t] = services::ErrorMemoryAllocationFailed;
+                    return;
+                }
+                ErrorCollectionPtr errors = createErrorCollection();
+                const size_t decompressed = decompressChunk((CompressionMethod)(block.codec - 1), values, blocks[t]->size(),
+                                                            buffer, bufferSize, *errors);
+                if(errors->size() != 0 || decompressed != chunkRows * typeSize)
+                {
+                    taskStatus[t] = services::ErrorColumnarFileFormat;
+                    return;
+                }
+                values = buffer;
+            }
+
+            const size_t start = (firstRow > chunkFirstRow ? firstRow : chunkFirstRow);
+            const size_t end   = (firstRow + nRows < chunkFirstRow + chunkRows ? firstRow + nRows : chunkFirstRow + chunkRows);
+            data_feature_utils::getVectorStrideUpCast((int)_columns[column].indexType, data_feature_utils::getInternalNumType<T>())
+                (end - start, values + (start - chunkFirstRow) * typeSize, typeSize,
+                 data + (start - firstRow) * nColumns + t % nColumns, sizeof(T) * nColumns);
+        });
+
+        buffers.reduce([](byte *buffer)
+        {
+            daal::services::daal_free(buffer);
+        });
+
+        for(size_t t = 0; t < nTasks; t++)
+        {
+            if(taskStatus[t] != 0) { return services::Status((services::ErrorID)taskStatus[t]); }
+        }
+        return services::Status();
+    }
+
+protected:
+    /* Returns the index of the chunk that contains the row */
+    size_t findChunk(size_t row) const
+    {
+        size_t lo = 0;
+        size_t hi = _chunks.size();
+        while(hi - lo > 1)
+        {
+            const size_t mid = (lo + hi) / 2;
+            if(_chunks[mid].firstRow <= row) { lo = mid; }
+            else { hi = mid; }
+        }
+        return lo;
+    }
+
+    bool readBytes(DAAL_UINT64 offset, void *ptr, size_t size)
+    {
+        return seekFile(_file, offset, SEEK_SET) && fread(ptr, 1, size, _file) == size;
+    }
+
+    static services::Status formatError()
+    {
+        return services::Status(services::ErrorColumnarFileFormat);
+    }
+
+private:
+    FILE *_file;
+    size_t _nColumns;
+    size_t _nRows;
+    size_t _maxChunkRows;
+    services::Collection<ColumnDesc> _columns;
+    services::Collection<ChunkDesc> _chunks;
+    services::Collection<BlockDesc> _blocks;
+};
+
+static FILE *openFileForWriting(const char *fileName)
+{
+    FILE *file = NULL;
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+    if(fopen_s(&file, fileName, "wb") != 0) { file = NULL; }
+#else
+    file = fopen(fileName, "wb");
+#endif
+    return file;
+}
+
+} // namespace internal
+
+namespace interface1
+{
+
+ColumnarFileWriter::ColumnarFileWriter(const char *fileName, size_t chunkRows) : _impl(NULL)
+{
+    if(!fileName || chunkRows == 0)
+    {
+        _status |= services::Status(services::ErrorIncorrectParameter);
+        return;
+    }
+    FILE *file = internal::openFileForWriting(fileName);
+    if(!file)
+    {
+        _status |= services::Status(services::ErrorOnFileOpen);
+        return;
+    }
+    _impl = (void *) new internal::ColumnarFileWriterImpl(file, false, zlib, defaultLevel, chunkRows);
+}
+
+ColumnarFileWriter::ColumnarFileWriter(const char *fileName, CompressionMethod method, CompressionLevel level, size_t chunkRows) : _impl(NULL)
+{
+    if(!fileName || chunkRows == 0 || method > bzip2)
+    {
+        _status |= services::Status(services::ErrorIncorrectParameter);
+        return;
+    }
+    FILE *file = internal::openFileForWriting(fileName);
+    if(!file)
+    {
+        _status |= services::Status(services::ErrorOnFileOpen);
+        return;
+    }
+    _impl = (void *) new internal::ColumnarFileWriterImpl(file, true, method, level, chunkRows);
+}
+
+ColumnarFileWriter::~ColumnarFileWriter()
+{
+    if(_impl)
+    {
+        close();
+        delete (internal::ColumnarFileWriterImpl *)_impl;
+    }
+}
+
+services::Status ColumnarFileWriter::write(NumericTable &table)
+{
+    if(!_status) { return _status; }
+    _status |= ((internal::ColumnarFileWriterImpl *)_impl)->write(table);
+    return _status;
+}
+
+services::Status ColumnarFileWriter::close()
+{
+    if(!_impl) { return _status; }
+    _status |= ((internal::ColumnarFileWriterImpl *)_impl)->close();
+    return _status;
+}
+
+ColumnarFileReader::ColumnarFileReader(const char *fileName) : _impl(NULL)
+{
+    if(!fileName)
+    {
+        _status |= services::Status(services::ErrorIncorrectParameter);
+        return;
+    }
+    internal::ColumnarFileReaderImpl *impl = new internal::ColumnarFileReaderImpl();
+    _status |= impl->open(fileName);
+    if(!_status)
+    {
+        delete impl;
+        return;
+    }
+    _impl = (void *)impl;
+}
+
+ColumnarFileReader::~ColumnarFileReader()
+{
+    if(_impl) { delete (internal::ColumnarFileReaderImpl *)_impl; }
+}
+
+size_t ColumnarFileReader::getNumberOfColumns() const
+{
+    return (_impl ? ((internal::ColumnarFileReaderImpl *)_impl)->getNumberOfColumns() : 0);
+}
+
+size_t ColumnarFileReader::getNumberOfRows() const
+{
+    return (_impl ? ((internal::ColumnarFileReaderImpl *)_impl)->getNumberOfRows() : 0);
+}
+
+size_t ColumnarFileReader::getNumberOfChunks() const
+{
+    return (_impl ? ((internal::ColumnarFileReaderImpl *)_impl)->getNumberOfChunks() : 0);
+}
+
+size_t ColumnarFileReader::getChunkFirstRow(size_t chunk) const
+{
+    if(!_impl || chunk >= getNumberOfChunks()) { return 0; }
+    return (size_t)((internal::ColumnarFileReaderImpl *)_impl)->getChunk(chunk).firstRow;
+}
+
+size_t ColumnarFileReader::getChunkNumberOfRows(size_t chunk) const
+{
+    if(!_impl || chunk >= getNumberOfChunks()) { return 0; }
+    return (size_t)((internal::ColumnarFileReaderImpl *)_impl)->getChunk(chunk).nRows;
+}
+
+ColumnChunkStatistics ColumnarFileReader::getChunkStatistics(size_t chunk, size_t column) const
+{
+    ColumnChunkStatistics statistics;
+    if(!_impl || chunk >= getNumberOfChunks() || column >= getNumberOfColumns()) { return statistics; }
+
+    const internal::BlockDesc &block = ((internal::ColumnarFileReaderImpl *)_impl)->getBlock(chunk, column);
+    statistics.minimum = block.minimum;
+    statistics.maximum = block.maximum;
+    statistics.count   = (size_t)block.count;
+    return statistics;
+}
+
+data_feature_utils::IndexNumType ColumnarFileReader::getColumnType(size_t column) const
+{
+    if(!_impl || column >= getNumberOfColumns()) { return data_feature_utils::DAAL_OTHER_T; }
+    return (data_feature_utils::IndexNumType)((internal::ColumnarFileReaderImpl *)_impl)->getColumn(column).indexType;
+}
+
+data_feature_utils::FeatureType ColumnarFileReader::getColumnFeatureType(size_t column) const
+{
+    if(!_impl || column >= getNumberOfColumns()) { return data_feature_utils::DAAL_CONTINUOUS; }
+    return (data_feature_utils::FeatureType)((internal::ColumnarFileReaderImpl *)_impl)->getColumn(column).featureType;
+}
+
+services::Status ColumnarFileReader::readColumns(size_t firstRow, size_t nRows, const size_t *columns, size_t nColumns, float *data)
+{
+    if(!_impl) { return _status; }
+    return ((internal::ColumnarFileReaderImpl *)_impl)->readColumns<float>(firstRow, nRows, columns, nColumns, data);
+}
+
+services::Status ColumnarFileReader::readColumns(size_t firstRow, size_t nRows, const size_t *columns, size_t nColumns, double *data)
+{
+    if(!_impl) { return _status; }
+    return ((internal::ColumnarFileReaderImpl *)_impl)->readColumns<double>(firstRow, nRows, columns, nColumns, data);
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
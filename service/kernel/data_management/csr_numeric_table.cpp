@@ -49,10 +49,15 @@ namespace interface1
 {
 
 
-#define DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(T)                                                  \
+#define DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR_IDX(T, I)                                           \
 template<>                                                                                          \
-CSRBlockDescriptor<T>::CSRBlockDescriptor() : _rows_capacity(0), _values_capacity(0),               \
-    _ncols(0), _nrows(0), _rowsOffset(0), _rwFlag(0), _rawPtr(0), _pPtr(0), _nvalues(0) {}
+CSRBlockDescriptor<T, I>::CSRBlockDescriptor() : _rows_capacity(0), _values_capacity(0),            \
+    _cols_capacity(0), _ncols(0), _nrows(0), _rowsOffset(0), _rwFlag(0), _rawPtr(0), _pPtr(0),      \
+    _nvalues(0) {}
+
+#define DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(T)                                                  \
+DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR_IDX(T, size_t      )                                        \
+DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR_IDX(T, unsigned int)
 
 DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(float         )
 DAAL_IMPL_CSRBLOCKDESCRIPTORCONSTRUCTOR(double        )
@@ -56,6 +56,23 @@ namespace data_management
 namespace data_feature_utils
 {
 
+#undef  DAAL_CONVERT_FUNC_DISPATCH
+#define DAAL_CONVERT_FUNC_DISPATCH(ptr, F)                                                                                           \
+    {                                                                                                                                \
+        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();                                                     \
+                                                                                                                                     \
+        switch(cpuid)                                                                                                                \
+        {                                                                                                                            \
+            DAAL_KERNEL_AVX512_ONLY_CODE    (case avx512    : ptr = daal::data_feature_utils::internal::F<T1,T2,avx512    >; break;) \
+            DAAL_KERNEL_AVX512_mic_ONLY_CODE(case avx512_mic: ptr = daal::data_feature_utils::internal::F<T1,T2,avx512_mic>; break;) \
+            DAAL_KERNEL_AVX2_ONLY_CODE      (case avx2      : ptr = daal::data_feature_utils::internal::F<T1,T2,avx2      >; break;) \
+            DAAL_KERNEL_AVX_ONLY_CODE       (case avx       : ptr = daal::data_feature_utils::internal::F<T1,T2,avx       >; break;) \
+            DAAL_KERNEL_SSE42_ONLY_CODE     (case sse42     : ptr = daal::data_feature_utils::internal::F<T1,T2,sse42     >; break;) \
+            DAAL_KERNEL_SSSE3_ONLY_CODE     (case ssse3     : ptr = daal::data_feature_utils::internal::F<T1,T2,ssse3     >; break;) \
+            default        : ptr = daal::data_feature_utils::internal::F<T1,T2,sse2      >; break;                                   \
+        };                                                                                                                           \
+    }
+
 template<typename T1, typename T2>
 static void vectorConvertFunc(size_t n, void *src, void *dst)
 {
@@ -64,30 +81,7 @@ static void vectorConvertFunc(size_t n, void *src, void *dst)
 
     if(!ptr)
     {
-        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
-
-        switch(cpuid)
-        {
-#ifdef DAAL_KERNEL_AVX512
-            case avx512    : DAAL_KERNEL_AVX512_ONLY_CODE    (ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,avx512    >); break;
-#endif
-#ifdef DAAL_KERNEL_AVX512_mic
-            case avx512_mic: DAAL_KERNEL_AVX512_mic_ONLY_CODE(ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,avx512_mic>); break;
-#endif
-#ifdef DAAL_KERNEL_AVX2
-            case avx2      : DAAL_KERNEL_AVX2_ONLY_CODE      (ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,avx2      >); break;
-#endif
-#ifdef DAAL_KERNEL_AVX
-            case avx       : DAAL_KERNEL_AVX_ONLY_CODE       (ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,avx       >); break;
-#endif
-#ifdef DAAL_KERNEL_SSE42
-            case sse42     : DAAL_KERNEL_SSE42_ONLY_CODE     (ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,sse42     >); break;
-#endif
-#ifdef DAAL_KERNEL_SSSE3
-            case ssse3     : DAAL_KERNEL_SSSE3_ONLY_CODE     (ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,ssse3     >); break;
-#endif
-            default        : ptr = daal::data_feature_utils::internal::vectorConvertFuncCpu<T1,T2,sse2      >; break;
-        };
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorConvertFuncCpu);
     }
 
     ptr(n,src,dst);
@@ -101,35 +95,66 @@ static void vectorStrideConvertFunc(size_t n, void *src, size_t srcByteStride, v
 
     if(!ptr)
     {
-        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
-
-        switch(cpuid)
-        {
-#ifdef DAAL_KERNEL_AVX512
-            case avx512    : DAAL_KERNEL_AVX512_ONLY_CODE    (ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,avx512    >); break;
-#endif
-#ifdef DAAL_KERNEL_AVX512_mic
-            case avx512_mic: DAAL_KERNEL_AVX512_mic_ONLY_CODE(ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,avx512_mic>); break;
-#endif
-#ifdef DAAL_KERNEL_AVX2
-            case avx2      : DAAL_KERNEL_AVX2_ONLY_CODE      (ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,avx2      >); break;
-#endif
-#ifdef DAAL_KERNEL_AVX
-            case avx       : DAAL_KERNEL_AVX_ONLY_CODE       (ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,avx       >); break;
-#endif
-#ifdef DAAL_KERNEL_SSE42
-            case sse42     : DAAL_KERNEL_SSE42_ONLY_CODE     (ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,sse42     >); break;
-#endif
-#ifdef DAAL_KERNEL_SSSE3
-            case ssse3     : DAAL_KERNEL_SSSE3_ONLY_CODE     (ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,ssse3     >); break;
-#endif
-            default        : ptr = daal::data_feature_utils::internal::vectorStrideConvertFuncCpu<T1,T2,sse2      >; break;
-        };
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorStrideConvertFuncCpu);
     }
 
     ptr(n, src, srcByteStride, dst, dstByteStride);
 }
 
+template<typename T1, typename T2>
+static void vectorTransposeUpConvertFunc(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride)
+{
+    static data_feature_utils::vectorTransposeConvertFuncType ptr = 0;
+
+    if(!ptr)
+    {
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorTransposeUpConvertFuncCpu);
+    }
+
+    ptr(nRows, nCols, columns, rowOffset, rows, rowStride);
+}
+
+template<typename T1, typename T2>
+static void vectorTransposeDownConvertFunc(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride)
+{
+    static data_feature_utils::vectorTransposeConvertFuncType ptr = 0;
+
+    if(!ptr)
+    {
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorTransposeDownConvertFuncCpu);
+    }
+
+    ptr(nRows, nCols, columns, rowOffset, rows, rowStride);
+}
+
+template<typename T1, typename T2>
+static void vectorRecordUpConvertFunc(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                      void *rows, size_t rowStride)
+{
+    static data_feature_utils::vectorRecordConvertFuncType ptr = 0;
+
+    if(!ptr)
+    {
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorRecordUpConvertFuncCpu);
+    }
+
+    ptr(nRows, nCols, records, recordSize, offsets, rows, rowStride);
+}
+
+template<typename T1, typename T2>
+static void vectorRecordDownConvertFunc(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                        void *rows, size_t rowStride)
+{
+    static data_feature_utils::vectorRecordConvertFuncType ptr = 0;
+
+    if(!ptr)
+    {
+        DAAL_CONVERT_FUNC_DISPATCH(ptr, vectorRecordDownConvertFuncCpu);
+    }
+
+    ptr(nRows, nCols, records, recordSize, offsets, rows, rowStride);
+}
+
 #undef  DAAL_TABLE_UP_ENTRY
 #define DAAL_TABLE_UP_ENTRY(F,T) {F<T, float>, F<T, double>, F<T, int> }
 
@@ -188,6 +213,30 @@ DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideDownC
     return table[idx1][idx2];
 }
 
+DAAL_EXPORT data_feature_utils::vectorTransposeConvertFuncType getVectorTransposeUpCast(int idx1, int idx2)
+{
+    static data_feature_utils::vectorTransposeConvertFuncType table[NumOfIndexNumTypes][3] = DAAL_CONVERT_UP_TABLE(vectorTransposeUpConvertFunc);
+    return table[idx1][idx2];
+}
+
+DAAL_EXPORT data_feature_utils::vectorTransposeConvertFuncType getVectorTransposeDownCast(int idx1, int idx2)
+{
+    static data_feature_utils::vectorTransposeConvertFuncType table[NumOfIndexNumTypes][3] = DAAL_CONVERT_DOWN_TABLE(vectorTransposeDownConvertFunc);
+    return table[idx1][idx2];
+}
+
+DAAL_EXPORT data_feature_utils::vectorRecordConvertFuncType getVectorRecordUpCast(int idx1, int idx2)
+{
+    static data_feature_utils::vectorRecordConvertFuncType table[NumOfIndexNumTypes][3] = DAAL_CONVERT_UP_TABLE(vectorRecordUpConvertFunc);
+    return table[idx1][idx2];
+}
+
+DAAL_EXPORT data_feature_utils::vectorRecordConvertFuncType getVectorRecordDownCast(int idx1, int idx2)
+{
+    static data_feature_utils::vectorRecordConvertFuncType table[NumOfIndexNumTypes][3] = DAAL_CONVERT_DOWN_TABLE(vectorRecordDownConvertFunc);
+    return table[idx1][idx2];
+}
+
 }
 }
 }
@@ -67,6 +67,143 @@ void vectorStrideConvertFuncCpu(size_t n, void *src, size_t srcByteStride, void
     }
 }
 
+/* Size of the tile processed by the transpose kernels: the source and destination lines
+   of one tile of 64 rows by 16 columns fit in L1 cache together */
+const size_t transposeBlockRows = 64;
+const size_t transposeBlockCols = 16;
+
+/* Converts columns of type T1 into the rows of type T2 tile by tile.
+   The innermost loop reads a column with unit stride and is vectorized */
+template<typename T1, typename T2, CpuType cpu>
+void vectorTransposeUpConvertFuncCpu(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride)
+{
+    T2 *dst = (T2 *)rows;
+    for(size_t i0 = 0; i0 < nRows; i0 += transposeBlockRows)
+    {
+        const size_t nBlockRows = (i0 + transposeBlockRows < nRows ? transposeBlockRows : nRows - i0);
+        for(size_t j0 = 0; j0 < nCols; j0 += transposeBlockCols)
+        {
+            const size_t j1 = (j0 + transposeBlockCols < nCols ? j0 + transposeBlockCols : nCols);
+            for(size_t j = j0; j < j1; j++)
+            {
+                const T1 *src = (const T1 *)columns[j] + rowOffset + i0;
+                T2 *out = dst + i0 * rowStride + j;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t i = 0; i < nBlockRows; i++)
+                {
+                    out[i * rowStride] = static_cast<T2>(src[i]);
+                }
+            }
+        }
+    }
+}
+
+/* Converts rows of type T1 into the columns of type T2 tile by tile */
+template<typename T1, typename T2, CpuType cpu>
+void vectorTransposeDownConvertFuncCpu(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride)
+{
+    const T1 *src = (const T1 *)rows;
+    for(size_t i0 = 0; i0 < nRows; i0 += transposeBlockRows)
+    {
+        const size_t nBlockRows = (i0 + transposeBlockRows < nRows ? transposeBlockRows : nRows - i0);
+        for(size_t j0 = 0; j0 < nCols; j0 += transposeBlockCols)
+        {
+            const size_t j1 = (j0 + transposeBlockCols < nCols ? j0 + transposeBlockCols : nCols);
+            for(size_t j = j0; j < j1; j++)
+            {
+                const T1 *in = src + i0 * rowStride + j;
+                T2 *dst = (T2 *)columns[j] + rowOffset + i0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t i = 0; i < nBlockRows; i++)
+                {
+                    dst[i] = static_cast<T2>(in[i * rowStride]);
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+static bool isPackedRecord(size_t nCols, const size_t *offsets)
+{
+    for(size_t j = 1; j < nCols; j++)
+    {
+        if(offsets[j] != offsets[0] + j * sizeof(T)) { return false; }
+    }
+    return true;
+}
+
+/* Converts fields of type T1 of consecutive records into the rows of type T2 one record at a time,
+   so that both the records and the rows are read and written sequentially */
+template<typename T1, typename T2, CpuType cpu>
+void vectorRecordUpConvertFuncCpu(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                  void *rows, size_t rowStride)
+{
+    const char *src = (const char *)records;
+    T2 *dst = (T2 *)rows;
+    if(isPackedRecord<T1>(nCols, offsets))
+    {
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const T1 *in = (const T1 *)(src + i * recordSize + offsets[0]);
+            T2 *out = dst + i * rowStride;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nCols; j++)
+            {
+                out[j] = static_cast<T2>(in[j]);
+            }
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const char *in = src + i * recordSize;
+        T2 *out = dst + i * rowStride;
+        for(size_t j = 0; j < nCols; j++)
+        {
+            out[j] = static_cast<T2>(*(const T1 *)(in + offsets[j]));
+        }
+    }
+}
+
+/* Converts rows of type T1 into fields of type T2 of consecutive records one record at a time */
+template<typename T1, typename T2, CpuType cpu>
+void vectorRecordDownConvertFuncCpu(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                    void *rows, size_t rowStride)
+{
+    char *dst = (char *)records;
+    const T1 *src = (const T1 *)rows;
+    if(isPackedRecord<T2>(nCols, offsets))
+    {
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const T1 *in = src + i * rowStride;
+            T2 *out = (T2 *)(dst + i * recordSize + offsets[0]);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nCols; j++)
+            {
+                out[j] = static_cast<T2>(in[j]);
+            }
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const T1 *in = src + i * rowStride;
+        char *out = dst + i * recordSize;
+        for(size_t j = 0; j < nCols; j++)
+        {
+            *(T2 *)(out + offsets[j]) = static_cast<T2>(in[j]);
+        }
+    }
+}
+
 #undef  DAAL_FUNCS_UP_ENTRY
 #define DAAL_FUNCS_UP_ENTRY(F,T,A)      \
 template void F<T, float , DAAL_CPU> A; \
@@ -108,6 +245,18 @@ DAAL_CONVERT_DOWN_FUNCS(vectorConvertFuncCpu,(size_t n, void *src, void *dst))
 DAAL_CONVERT_UP_FUNCS(vectorStrideConvertFuncCpu,(size_t n, void *src, size_t srcByteStride, void *dst, size_t dstByteStride))
 DAAL_CONVERT_DOWN_FUNCS(vectorStrideConvertFuncCpu,(size_t n, void *src, size_t srcByteStride, void *dst, size_t dstByteStride))
 
+DAAL_CONVERT_UP_FUNCS(vectorTransposeUpConvertFuncCpu,(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorTransposeDownConvertFuncCpu,float,(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorTransposeDownConvertFuncCpu,double,(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorTransposeDownConvertFuncCpu,int,(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride))
+DAAL_CONVERT_DOWN_FUNCS(vectorTransposeDownConvertFuncCpu,(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride))
+
+DAAL_CONVERT_UP_FUNCS(vectorRecordUpConvertFuncCpu,(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorRecordDownConvertFuncCpu,float,(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorRecordDownConvertFuncCpu,double,(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets, void *rows, size_t rowStride))
+DAAL_FUNCS_DOWN_ENTRY(vectorRecordDownConvertFuncCpu,int,(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets, void *rows, size_t rowStride))
+DAAL_CONVERT_DOWN_FUNCS(vectorRecordDownConvertFuncCpu,(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets, void *rows, size_t rowStride))
+
 }
 }
 }
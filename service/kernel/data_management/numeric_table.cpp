@@ -46,6 +46,8 @@
 #include "data_management/data/row_merged_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/csr32_numeric_table.h"
+#include "data_management/data/csc_numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
 #include "data_management/data/data_collection.h"
 #include "data_management/data/memory_block.h"
@@ -236,6 +238,8 @@ DAAL_INSTANTIATE_SLOW(long          )
 
 IMPLEMENT_SERIALIZABLE_TAG(SOANumericTable,SERIALIZATION_SOA_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(CSRNumericTable,SERIALIZATION_CSR_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(CSR32NumericTable,SERIALIZATION_CSR32_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(CSCNumericTable,SERIALIZATION_CSC_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(AOSNumericTable,SERIALIZATION_AOS_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MergedNumericTable,SERIALIZATION_MERGE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(RowMergedNumericTable,SERIALIZATION_ROWMERGE_NT_ID)
@@ -390,6 +394,29 @@ Status createSparseTable<float>(const NumericTablePtr &inputTable, CSRNumericTab
     return createSparseTableImpl<float>(inputTable, resTable);
 }
 
+Status checkWeights(const NumericTable *weights, const char *description)
+{
+    const size_t nRows = weights->getNumberOfRows();
+    const size_t blockSize = 4096;
+    double sum = 0.0;
+    for(size_t iStart = 0; iStart < nRows; iStart += blockSize)
+    {
+        const size_t nRowsInBlock = (iStart + blockSize < nRows ? blockSize : nRows - iStart);
+        ReadRows<double, sse2> block(const_cast<NumericTable *>(weights), iStart, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS(block);
+        const double *w = block.get();
+        for(size_t i = 0; i < nRowsInBlock; i++)
+        {
+            if(!(w[i] >= 0.0))
+                return Status(Error::create(ErrorIncorrectOptionalInput, OptionalInput, description));
+            sum += w[i];
+        }
+    }
+    if(!(sum > 0.0))
+        return Status(Error::create(ErrorIncorrectOptionalInput, OptionalInput, description));
+    return Status();
+}
+
 IMPLEMENT_SERIALIZABLE_TAG1T(MklTensor,float,SERIALIZATION_MKL_TENSOR_ID)
 IMPLEMENT_SERIALIZABLE_TAG1T(MklTensor,double,SERIALIZATION_MKL_TENSOR_ID)
 
@@ -50,6 +50,7 @@
 
 #include "homogen_numeric_table.h"
 #include "csr_numeric_table.h"
+#include "csr32_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "service_defines.h"
 #include "service_memory.h"
@@ -481,29 +482,38 @@ using WriteRows = GetRows<algorithmFPType, algorithmFPType, cpu, readWrite, Nume
 template<typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyRows = GetRows<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
-template<typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode>
+/* Sparse table interface that provides blocks with the given type of column indices */
+template<typename IndexType>
+struct CSRIfaceByIndexType { typedef CSRNumericTableIface type; };
+
+template<>
+struct CSRIfaceByIndexType<unsigned int> { typedef CSR32NumericTableIface type; };
+
+template<typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename IndexType = size_t>
 class GetRowsCSR
 {
 public:
-    GetRowsCSR(CSRNumericTableIface& data, size_t iStartFrom, size_t nRows) : _data(&data)
+    typedef typename CSRIfaceByIndexType<IndexType>::type IfaceType;
+
+    GetRowsCSR(IfaceType& data, size_t iStartFrom, size_t nRows) : _data(&data)
     {
         getBlock(iStartFrom, nRows);
     }
-    GetRowsCSR(CSRNumericTableIface* data, size_t iStartFrom, size_t nRows) : _data(data), _toReleaseFlag(false)
+    GetRowsCSR(IfaceType* data, size_t iStartFrom, size_t nRows) : _data(data), _toReleaseFlag(false)
     {
         if(_data)
         {
             getBlock(iStartFrom, nRows);
         }
     }
-    GetRowsCSR(CSRNumericTableIface* data = nullptr) : _data(data), _toReleaseFlag(false) {}
+    GetRowsCSR(IfaceType* data = nullptr) : _data(data), _toReleaseFlag(false) {}
     ~GetRowsCSR() { release(); }
 
     const algorithmFPAccessType* values() const { return _data ? _block.getBlockValuesPtr() : nullptr; }
-    const size_t* cols() const { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
+    const IndexType* cols() const { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
     const size_t* rows() const { return _data ? _block.getBlockRowIndicesPtr() : nullptr; }
     algorithmFPAccessType* values() { return _data ? _block.getBlockValuesPtr() : nullptr; }
-    size_t* cols() { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
+    IndexType* cols() { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
     size_t* rows() { return _data ? _block.getBlockRowIndicesPtr() : nullptr; }
 
     void next(size_t iStartFrom, size_t nRows)
@@ -517,7 +527,7 @@ public:
             getBlock(iStartFrom, nRows);
         }
     }
-    void set(CSRNumericTableIface* data, size_t iStartFrom, size_t nRows)
+    void set(IfaceType* data, size_t iStartFrom, size_t nRows)
     {
         release();
         if(data)
@@ -551,8 +561,8 @@ private:
     }
 
 private:
-    CSRNumericTableIface* _data;
-    CSRBlockDescriptor<algorithmFPType> _block;
+    IfaceType* _data;
+    CSRBlockDescriptor<algorithmFPType, IndexType> _block;
     services::Status _status;
     bool _toReleaseFlag;
 };
@@ -566,6 +576,9 @@ using WriteRowsCSR = GetRowsCSR<algorithmFPType, algorithmFPType, cpu, readWrite
 template<typename algorithmFPType, CpuType cpu>
 using WriteOnlyRowsCSR = GetRowsCSR<algorithmFPType, algorithmFPType, cpu, writeOnly>;
 
+template<typename algorithmFPType, CpuType cpu>
+using ReadRowsCSR32 = GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, unsigned int>;
+
 template<typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename NumericTableType>
 class GetColumns
 {
@@ -991,6 +1004,13 @@ private:
 template <typename algorithmFPType>
 services::Status createSparseTable(const NumericTablePtr &inputTable, CSRNumericTablePtr &resTable);
 
+/**
+ * Checks that the weights of observations are non-negative and their sum is positive
+ * \param[in] weights      Numeric table of size n x 1 with the weights of observations
+ * \param[in] description  Name of the input object used in the error details
+ */
+services::Status checkWeights(const NumericTable *weights, const char *description);
+
 } // internal namespace
 } // daal namespace
 
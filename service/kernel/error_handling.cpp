@@ -901,6 +901,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorIncorrectCrossProductTableSize, "Number of columns or rows in cross-product numeric table is incorrect");
     add(ErrorCrossProductTableIsNotSquare, "Number of columns or rows in cross-product numeric table is not equal");
     add(ErrorInputCorrelationNotSupportedInOnlineAndDistributed, "Input correlation matrix is not supported in online and distributed computation modes");
+    add(ErrorPCAFailedToComputeRandomizedEigenvalues, "Failed to compute eigenvalues of the sketch of the correlation matrix");
+    add(ErrorInputCorrelationNotSupportedInRandomizedMethod, "Input correlation matrix is not supported in the randomized method");
 
     // QR errors: -8000..-8199
     add(ErrorQRInternal, "QR internal error");
@@ -946,6 +948,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormat, "Input compressed stream is in wrong format or corrupted");
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+    add(ErrorFramedDataFormat, "Input framed compressed stream is in wrong format or corrupted");
 
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
@@ -985,6 +988,7 @@ void ErrorMessageCollection::parseResourceFile()
     // Neural Networks errors: -18000...18999
     add(ErrorInconsistenceModelAndBatchSizeInParameter, "Inconsistence of model and batch size parameter in optimization solver");
     add(ErrorNeuralNetworkLayerCall, "Neural networks: Error in layer call. Details are as follows");
+    add(ErrorIncorrectQuantizedWeights, "Neural networks: Quantized weights of the layer are not stored as an int8 tensor of the weights size");
 
     // Pivoted QR errors: -19000..-19199
     add(ErrorPivotedQRInternal, "Pivoted QR internal error");
@@ -1004,6 +1008,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
+    add(ErrorColumnarFileFormat, "Columnar table file is in wrong format or corrupted");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
@@ -184,6 +184,20 @@ void vectorConvertFuncCpu(size_t n, void *src, void *dst);
 template<typename T1, typename T2, CpuType cpu>
 void vectorStrideConvertFuncCpu(size_t n, void *src, size_t srcByteStride, void *dst, size_t dstByteStride);
 
+template<typename T1, typename T2, CpuType cpu>
+void vectorTransposeUpConvertFuncCpu(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride);
+
+template<typename T1, typename T2, CpuType cpu>
+void vectorTransposeDownConvertFuncCpu(size_t nRows, size_t nCols, void **columns, size_t rowOffset, void *rows, size_t rowStride);
+
+template<typename T1, typename T2, CpuType cpu>
+void vectorRecordUpConvertFuncCpu(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                  void *rows, size_t rowStride);
+
+template<typename T1, typename T2, CpuType cpu>
+void vectorRecordDownConvertFuncCpu(size_t nRows, size_t nCols, void *records, size_t recordSize, const size_t *offsets,
+                                    void *rows, size_t rowStride);
+
 }
 }
 }
@@ -0,0 +1,126 @@
+/* file: service_tracing.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the trace event recording used by the algorithms and the kernels.
+//--
+*/
+
+#ifndef __SERVICE_TRACING_H__
+#define __SERVICE_TRACING_H__
+
+#include <atomic>
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/* Tracing state is read on every traced stage and on every allocation */
+extern std::atomic<bool> tracingEnabled;
+
+/* The flag orders no other data, so the relaxed load is enough and costs as much as a plain read */
+inline bool isTracingEnabled() { return tracingEnabled.load(std::memory_order_relaxed); }
+
+/* Returns the current time in nanoseconds */
+unsigned long long traceTimestamp();
+
+/* Returns the number of bytes allocated by daal_malloc on the calling thread while tracing is enabled */
+unsigned long long traceAllocatedBytes();
+
+/* Accounts an allocation of the given size on the calling thread */
+void traceAllocation(size_t size);
+
+/* Adds a completed event to the buffer of the calling thread.
+   The strings must remain valid until the trace is cleared */
+void traceEvent(const char *name, const char *category, const char *detail, int method,
+                unsigned long long start, unsigned long long duration, unsigned long long bytes);
+
+/**
+ *  Records the lifetime of the object as a trace event on the calling thread
+ */
+class TraceScope
+{
+public:
+    TraceScope(const char *name, const char *category = "kernel", const char *detail = 0, int method = -1) :
+        _name(name), _category(category), _detail(detail), _method(method), _active(isTracingEnabled())
+    {
+        if(_active)
+        {
+            _bytes = traceAllocatedBytes();
+            _start = traceTimestamp();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if(_active)
+        {
+            const unsigned long long end = traceTimestamp();
+            traceEvent(_name, _category, _detail, _method, _start, end - _start, traceAllocatedBytes() - _bytes);
+        }
+    }
+
+private:
+    TraceScope(const TraceScope &);
+    TraceScope &operator=(const TraceScope &);
+
+    const char *_name;
+    const char *_category;
+    const char *_detail;
+    int _method;
+    bool _active;
+    unsigned long long _start;
+    unsigned long long _bytes;
+};
+
+} // namespace internal
+} // namespace daal
+
+#define DAAL_TRACE_CONCAT_(a, b) a##b
+#define DAAL_TRACE_CONCAT(a, b) DAAL_TRACE_CONCAT_(a, b)
+
+/* Marks a stage of a kernel that lasts until the end of the enclosing scope */
+#define DAAL_TRACE_SCOPE(name) daal::internal::TraceScope DAAL_TRACE_CONCAT(__daalTraceScope, __LINE__)(name)
+
+#endif
@@ -0,0 +1,183 @@
+/* file: service_workspace.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the scratch memory helpers that draw from the workspace of the running algorithm.
+//--
+*/
+
+#ifndef __SERVICE_WORKSPACE_H__
+#define __SERVICE_WORKSPACE_H__
+
+#include "services/workspace.h"
+#include "services/daal_memory.h"
+#include "service_defines.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/* Returns the workspace of the algorithm computed on the calling thread, or NULL.
+   Kernels read it on the thread that calls them and pass it to the parallel regions */
+services::Workspace *currentWorkspace();
+
+/* Makes the workspace current on the calling thread for the lifetime of the object.
+   NULL keeps the workspace of the enclosing computation */
+class WorkspaceScope
+{
+public:
+    WorkspaceScope(services::Workspace *workspace);
+    ~WorkspaceScope();
+
+private:
+    WorkspaceScope(const WorkspaceScope &);
+    WorkspaceScope &operator=(const WorkspaceScope &);
+
+    services::Workspace *_previous;
+    bool _active;
+};
+
+inline void *workspaceMalloc(services::Workspace *workspace, size_t size)
+{
+    return (workspace ? workspace->allocate(size) : services::daal_malloc(size));
+}
+
+inline void workspaceFree(services::Workspace *workspace, void *ptr)
+{
+    if(workspace) { workspace->deallocate(ptr); }
+    else          { services::daal_free(ptr); }
+}
+
+template<typename T, CpuType cpu>
+T *workspace_malloc(services::Workspace *workspace, size_t size)
+{
+    return (T *)workspaceMalloc(workspace, size * sizeof(T));
+}
+
+template<typename T, CpuType cpu>
+T *workspace_calloc(services::Workspace *workspace, size_t size)
+{
+    T *ptr = (T *)workspaceMalloc(workspace, size * sizeof(T));
+    if( ptr == NULL ) { return NULL; }
+
+    char *cptr = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+    for(size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+    return ptr;
+}
+
+template<typename T, CpuType cpu>
+void workspace_free(services::Workspace *workspace, T *ptr)
+{
+    workspaceFree(workspace, ptr);
+}
+
+//Counterpart of TArray that takes its memory from the workspace
+template<typename T, CpuType cpu>
+class TWorkspaceArray
+{
+public:
+    TWorkspaceArray(services::Workspace *workspace, size_t n = 0) : _workspace(workspace), _data(nullptr), _size(0) { alloc(n); }
+    TWorkspaceArray(const TWorkspaceArray &) = delete;
+
+    ~TWorkspaceArray() { destroy(); }
+    T *get() { return _data; }
+    const T *get() const { return _data; }
+    size_t size() const { return _size; }
+
+    T *reset(size_t n)
+    {
+        destroy();
+        alloc(n);
+        return _data;
+    }
+
+    T &operator [] (size_t index)
+    {
+        return _data[index];
+    }
+
+    const T &operator [] (size_t index) const
+    {
+        return _data[index];
+    }
+
+    TWorkspaceArray &operator = (const TWorkspaceArray &) = delete;
+
+private:
+    void alloc(size_t n)
+    {
+        _data = (T *)(n ? workspaceMalloc(_workspace, n * sizeof(T)) : nullptr);
+        if(_data)
+        {
+            for(size_t i = 0; i < n; ++i)
+                ::new(_data + i)T;
+            _size = n;
+        }
+    }
+
+    void destroy()
+    {
+        if(_data)
+        {
+            for(size_t i = 0; i < _size; ++i)
+                _data[i].~T();
+            workspaceFree(_workspace, _data);
+            _data = nullptr;
+            _size = 0;
+        }
+    }
+
+private:
+    services::Workspace *_workspace;
+    T *_data;
+    size_t _size;
+};
+
+} // namespace internal
+} // namespace daal
+
+#endif
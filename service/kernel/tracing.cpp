@@ -0,0 +1,346 @@
+/* file: tracing.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the trace event recording and the Chrome trace export.
+//--
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "services/tracing.h"
+#include "services/daal_memory.h"
+#include "service_tracing.h"
+#include "service_threading.h"
+
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+    #define DAAL_TRACE_THREAD_LOCAL __declspec(thread)
+#else
+    #define DAAL_TRACE_THREAD_LOCAL thread_local
+#endif
+
+namespace daal
+{
+namespace internal
+{
+
+std::atomic<bool> tracingEnabled(false);
+
+namespace
+{
+
+struct TraceEvent
+{
+    const char *name;
+    const char *category;
+    const char *detail;
+    int method;
+    unsigned long long start;
+    unsigned long long duration;
+    unsigned long long bytes;
+};
+
+/* Events of one thread. The storage is allocated with malloc so that
+   the tracer itself does not contribute to the traced allocations.
+   The owning thread appends the events under the lock of the buffer, so that
+   the export and clear() can run concurrently with the traced algorithms.
+   The lock is contended only while the trace is exported or cleared */
+struct ThreadTrace
+{
+    ThreadTrace(size_t id) : tid(id), allocatedBytes(0), events(0), size(0), capacity(0), next(0) {}
+    ~ThreadTrace() { free(events); }
+
+    size_t tid;
+    unsigned long long allocatedBytes;
+    TraceEvent *events;
+    size_t size;
+    size_t capacity;
+    ThreadTrace *next;
+    Mutex mutex;
+
+    void add(const TraceEvent &event)
+    {
+        AUTOLOCK(mutex);
+        if(size == capacity)
+        {
+            const size_t newCapacity = (capacity ? capacity * 2 : 1024);
+            TraceEvent *newEvents = (TraceEvent *)realloc(events, newCapacity * sizeof(TraceEvent));
+            if(!newEvents) { return; }
+            events = newEvents;
+            capacity = newCapacity;
+        }
+        events[size++] = event;
+    }
+};
+
+/* Registry of the thread buffers. Buffers live until the library is unloaded,
+   so the events of the finished threads remain available for the export */
+class TraceRegistry
+{
+public:
+    TraceRegistry() : _head(0), _nThreads(0), _origin(std::chrono::steady_clock::now()) {}
+
+    ~TraceRegistry()
+    {
+        while(_head)
+        {
+            ThreadTrace *next = _head->next;
+            _head->~ThreadTrace();
+            free(_head);
+            _head = next;
+        }
+    }
+
+    ThreadTrace *registerThread()
+    {
+        void *ptr = malloc(sizeof(ThreadTrace));
+        if(!ptr) { return 0; }
+
+        AUTOLOCK(_mutex);
+        ThreadTrace *trace = new (ptr) ThreadTrace(_nThreads++);
+        trace->next = _head;
+        _head = trace;
+        return trace;
+    }
+
+    void clear()
+    {
+        AUTOLOCK(_mutex);
+        for(ThreadTrace *trace = _head; trace; trace = trace->next)
+        {
+            AUTOLOCK(trace->mutex);
+            trace->size = 0;
+        }
+    }
+
+    size_t getNumberOfEvents()
+    {
+        AUTOLOCK(_mutex);
+        size_t n = 0;
+        for(ThreadTrace *trace = _head; trace; trace = trace->next)
+        {
+            AUTOLOCK(trace->mutex);
+            n += trace->size;
+        }
+        return n;
+    }
+
+    void writeChromeTrace(std::string &out);
+
+    unsigned long long timestamp() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _origin).count();
+    }
+
+private:
+    Mutex _mutex;
+    ThreadTrace *_head;
+    size_t _nThreads;
+    std::chrono::steady_clock::time_point _origin;
+};
+
+TraceRegistry &registry()
+{
+    static TraceRegistry instance;
+    return instance;
+}
+
+DAAL_TRACE_THREAD_LOCAL ThreadTrace *threadTrace = 0;
+
+ThreadTrace *getThreadTrace()
+{
+    if(!threadTrace)
+    {
+        threadTrace = registry().registerThread();
+    }
+    return threadTrace;
+}
+
+void appendEscaped(std::string &out, const char *str)
+{
+    for(; *str; str++)
+    {
+        const char c = *str;
+        if(c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if((unsigned char)c < 0x20) { out += ' '; }
+        else { out += c; }
+    }
+}
+
+void appendEvent(std::string &out, const TraceEvent &event, size_t tid)
+{
+    char buf[256];
+    out += "{\"name\":\"";
+    appendEscaped(out, event.name);
+    out += "\",\"cat\":\"";
+    appendEscaped(out, event.category);
+    /* Complete events with the timestamps in microseconds */
+    snprintf(buf, sizeof(buf), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"bytes\":%llu",
+             (unsigned long)tid, event.start * 1e-3, event.duration * 1e-3, event.bytes);
+    out += buf;
+    if(event.method >= 0)
+    {
+        snprintf(buf, sizeof(buf), ",\"method\":%d", event.method);
+        out += buf;
+    }
+    if(event.detail)
+    {
+        out += ",\"algorithm\":\"";
+        appendEscaped(out, event.detail);
+        out += '"';
+    }
+    out += "}}";
+}
+
+void TraceRegistry::writeChromeTrace(std::string &out)
+{
+    AUTOLOCK(_mutex);
+    out = "{\"traceEvents\":[";
+    bool first = true;
+    for(ThreadTrace *trace = _head; trace; trace = trace->next)
+    {
+        AUTOLOCK(trace->mutex);
+        for(size_t i = 0; i < trace->size; i++)
+        {
+            if(!first) { out += ",\n"; }
+            first = false;
+            appendEvent(out, trace->events[i], trace->tid);
+        }
+    }
+    out += "],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+} // namespace
+
+unsigned long long traceTimestamp()
+{
+    return registry().timestamp();
+}
+
+unsigned long long traceAllocatedBytes()
+{
+    ThreadTrace *trace = getThreadTrace();
+    return trace ? trace->allocatedBytes : 0;
+}
+
+void traceAllocation(size_t size)
+{
+    ThreadTrace *trace = getThreadTrace();
+    if(trace) { trace->allocatedBytes += size; }
+}
+
+void traceEvent(const char *name, const char *category, const char *detail, int method,
+                unsigned long long start, unsigned long long duration, unsigned long long bytes)
+{
+    ThreadTrace *trace = getThreadTrace();
+    if(!trace) { return; }
+
+    TraceEvent event = { name, category, detail, method, start, duration, bytes };
+    trace->add(event);
+}
+
+} // namespace internal
+
+namespace services
+{
+namespace interface1
+{
+
+void Tracing::enable()
+{
+    internal::registry();
+    internal::tracingEnabled.store(true);
+}
+
+void Tracing::disable()
+{
+    internal::tracingEnabled.store(false);
+}
+
+bool Tracing::isEnabled()
+{
+    return internal::isTracingEnabled();
+}
+
+void Tracing::clear()
+{
+    internal::registry().clear();
+}
+
+size_t Tracing::getNumberOfEvents()
+{
+    return internal::registry().getNumberOfEvents();
+}
+
+size_t Tracing::copyChromeTraceToArray(char *ptr, size_t maxLength)
+{
+    std::string trace;
+    internal::registry().writeChromeTrace(trace);
+
+    const size_t length = trace.size() + 1;
+    if(ptr && length <= maxLength)
+    {
+        daal_memcpy_s(ptr, maxLength, trace.c_str(), length);
+    }
+    return length;
+}
+
+Status Tracing::exportChromeTrace(const char *fileName)
+{
+    std::string trace;
+    internal::registry().writeChromeTrace(trace);
+
+    FILE *f = fopen(fileName, "wb");
+    if(!f) { return Status(ErrorOnFileOpen); }
+
+    const size_t written = fwrite(trace.c_str(), 1, trace.size(), f);
+    fclose(f);
+    return (written == trace.size() ? Status() : Status(ErrorOnFileOpen));
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace daal
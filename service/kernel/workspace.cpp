@@ -0,0 +1,259 @@
+/* file: workspace.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the workspace that keeps scratch memory of the algorithms between computations.
+//--
+*/
+
+#include <atomic>
+
+#include "services/workspace.h"
+#include "service_workspace.h"
+#include "service_threading.h"
+
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+    #define DAAL_WORKSPACE_THREAD_LOCAL __declspec(thread)
+#else
+    #define DAAL_WORKSPACE_THREAD_LOCAL thread_local
+#endif
+
+namespace daal
+{
+namespace internal
+{
+namespace
+{
+
+const size_t nShards     = 64;
+const size_t minBlockSize = 64;
+
+struct WorkspaceShard;
+
+/* Header placed in front of every block. Its size keeps the blocks aligned */
+union BlockHeader
+{
+    struct
+    {
+        size_t capacity;
+        WorkspaceShard *shard;
+    } info;
+    char padding[DAAL_MALLOC_DEFAULT_ALIGNMENT];
+};
+
+/* Free blocks of the threads mapped to the shard, searched for the best fit */
+struct WorkspaceShard
+{
+    WorkspaceShard() : blocks(nullptr), nBlocks(0), capacity(0), allocatedSize(0) {}
+
+    BlockHeader *take(size_t size)
+    {
+        AUTOLOCK(mutex);
+        size_t best = nBlocks;
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            if(blocks[i]->info.capacity >= size && (best == nBlocks || blocks[i]->info.capacity < blocks[best]->info.capacity))
+            {
+                best = i;
+            }
+        }
+        if(best == nBlocks) { return nullptr; }
+
+        BlockHeader *block = blocks[best];
+        blocks[best] = blocks[--nBlocks];
+        return block;
+    }
+
+    void put(BlockHeader *block)
+    {
+        AUTOLOCK(mutex);
+        if(nBlocks == capacity)
+        {
+            const size_t newCapacity = (capacity ? capacity * 2 : 16);
+            BlockHeader **newBlocks = (BlockHeader **)services::daal_malloc(newCapacity * sizeof(BlockHeader *));
+            if(!newBlocks)
+            {
+                allocatedSize -= block->info.capacity;
+                services::daal_free(block);
+                return;
+            }
+            for(size_t i = 0; i < nBlocks; i++) { newBlocks[i] = blocks[i]; }
+            services::daal_free(blocks);
+            blocks = newBlocks;
+            capacity = newCapacity;
+        }
+        blocks[nBlocks++] = block;
+    }
+
+    void release()
+    {
+        AUTOLOCK(mutex);
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            allocatedSize -= blocks[i]->info.capacity;
+            services::daal_free(blocks[i]);
+        }
+        nBlocks = 0;
+    }
+
+    Mutex mutex;
+    BlockHeader **blocks;
+    size_t nBlocks;
+    size_t capacity;
+    size_t allocatedSize;
+};
+
+struct WorkspaceImpl
+{
+    ~WorkspaceImpl()
+    {
+        for(size_t i = 0; i < nShards; i++)
+        {
+            shards[i].release();
+            services::daal_free(shards[i].blocks);
+        }
+    }
+
+    WorkspaceShard shards[nShards];
+};
+
+/* Threads are mapped to the shards in the order of their first allocation */
+size_t threadShardIndex()
+{
+    static std::atomic<size_t> nThreads(0);
+    static DAAL_WORKSPACE_THREAD_LOCAL size_t index = 0;
+    static DAAL_WORKSPACE_THREAD_LOCAL bool assigned = false;
+    if(!assigned)
+    {
+        index = nThreads++ % nShards;
+        assigned = true;
+    }
+    return index;
+}
+
+DAAL_WORKSPACE_THREAD_LOCAL services::Workspace *threadWorkspace = nullptr;
+
+} // namespace
+
+services::Workspace *currentWorkspace()
+{
+    return threadWorkspace;
+}
+
+WorkspaceScope::WorkspaceScope(services::Workspace *workspace) : _previous(threadWorkspace), _active(workspace != nullptr)
+{
+    if(_active) { threadWorkspace = workspace; }
+}
+
+WorkspaceScope::~WorkspaceScope()
+{
+    if(_active) { threadWorkspace = _previous; }
+}
+
+} // namespace internal
+
+namespace services
+{
+namespace interface1
+{
+
+Workspace::Workspace() : _impl(new daal::internal::WorkspaceImpl) {}
+
+Workspace::~Workspace()
+{
+    delete static_cast<daal::internal::WorkspaceImpl *>(_impl);
+}
+
+void *Workspace::allocate(size_t size)
+{
+    daal::internal::WorkspaceImpl *impl = static_cast<daal::internal::WorkspaceImpl *>(_impl);
+    daal::internal::WorkspaceShard &shard = impl->shards[daal::internal::threadShardIndex()];
+
+    daal::internal::BlockHeader *block = shard.take(size);
+    if(!block)
+    {
+        /* Sizes are rounded up to powers of two so that the blocks fit the varying requests */
+        size_t capacity = daal::internal::minBlockSize;
+        while(capacity < size) { capacity *= 2; }
+
+        block = (daal::internal::BlockHeader *)daal_malloc(sizeof(daal::internal::BlockHeader) + capacity);
+        if(!block) { return NULL; }
+        block->info.capacity = capacity;
+        block->info.shard    = &shard;
+
+        AUTOLOCK(shard.mutex);
+        shard.allocatedSize += capacity;
+    }
+    return block + 1;
+}
+
+void Workspace::deallocate(void *ptr)
+{
+    if(!ptr) { return; }
+    daal::internal::BlockHeader *block = static_cast<daal::internal::BlockHeader *>(ptr) - 1;
+    block->info.shard->put(block);
+}
+
+void Workspace::release()
+{
+    daal::internal::WorkspaceImpl *impl = static_cast<daal::internal::WorkspaceImpl *>(_impl);
+    for(size_t i = 0; i < daal::internal::nShards; i++)
+    {
+        impl->shards[i].release();
+    }
+}
+
+size_t Workspace::getAllocatedSize() const
+{
+    daal::internal::WorkspaceImpl *impl = static_cast<daal::internal::WorkspaceImpl *>(_impl);
+    size_t size = 0;
+    for(size_t i = 0; i < daal::internal::nShards; i++)
+    {
+        AUTOLOCK(impl->shards[i].mutex);
+        size += impl->shards[i].allocatedSize;
+    }
+    return size;
+}
+
+} // namespace interface1
+} // namespace services
+} // namespace daal